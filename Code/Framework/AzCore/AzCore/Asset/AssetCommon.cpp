@@ -149,9 +149,10 @@ namespace AZ::Data
         {
             if (AssetManager::IsReady())
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(AssetManager::Instance().m_assetMutex);
-                auto it = AssetManager::Instance().m_assets.find(id);
-                if (it != AssetManager::Instance().m_assets.end())
+                AssetManager::AssetShard& shard = AssetManager::Instance().GetAssetShard(id);
+                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                auto it = shard.m_assets.find(id);
+                if (it != shard.m_assets.end())
                 {
                     return { it->second, assetReferenceLoadBehavior };
                 }
@@ -10,6 +10,7 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ::Data
 {
@@ -61,7 +62,8 @@ namespace AZ::Data
             // Queue each asset to load.
             auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                 dependentAsset.GetId(), dependentAsset.GetType(),
-                AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                AZ::Data::AssetLoadBehavior::Default,
+                GetPreloadGraphLoadParams(dependentAsset.GetId(), dependentAsset.GetType(), loadParamsCopyWithNoLoadingFilter),
                 dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
@@ -155,6 +157,11 @@ namespace AZ::Data
                 dependencyInfoList.push_back(assetInfo);
             }
         }
+        if (AssetManager::Instance().GetPreloadGraphEnabled())
+        {
+            BuildPreloadGraph(rootAssetId, dependencyInfoList);
+        }
+
         for (auto& thisInfo : dependencyInfoList)
         {
             waitingList.push_back(thisInfo.m_assetId);
@@ -233,7 +240,7 @@ namespace AZ::Data
         // it doesn't have any chance of serializing in until after all the dependent assets have been queued for loading and have
         // been added to the list of dependencies.
         auto thisAsset = AssetManager::Instance().GetAssetInternal(rootAssetId, rootAssetType, rootAsset.GetAutoLoadBehavior(),
-            loadParamsCopyWithNoLoadingFilter, AssetInfo(), HasPreloads(rootAssetId));
+            GetPreloadGraphLoadParams(rootAssetId, rootAssetType, loadParamsCopyWithNoLoadingFilter), AssetInfo(), HasPreloads(rootAssetId));
 
         if (!thisAsset)
         {
@@ -253,6 +260,126 @@ namespace AZ::Data
         CheckReady();
     }
 
+    void AssetContainer::BuildPreloadGraph(const AssetId& rootAssetId, AZStd::vector<AssetInfo>& dependencyInfoList)
+    {
+        // Only edges between assets that are part of this load are of interest, anything that got filtered out won't be waited on.
+        AZStd::unordered_map<AssetId, AZStd::vector<AssetId>> directDependencies;
+        directDependencies[rootAssetId];
+        for (const AssetInfo& thisInfo : dependencyInfoList)
+        {
+            directDependencies[thisInfo.m_assetId];
+        }
+        for (auto& [assetId, dependencies] : directDependencies)
+        {
+            Outcome<AZStd::vector<ProductDependency>, AZStd::string> directResult = Failure(AZStd::string());
+            AssetCatalogRequestBus::BroadcastResult(directResult, &AssetCatalogRequestBus::Events::GetDirectProductDependencies, assetId);
+            if (!directResult.IsSuccess())
+            {
+                // Without edges the asset is treated as a leaf, which is the same order the container would otherwise use.
+                continue;
+            }
+            for (const ProductDependency& dependency : directResult.GetValue())
+            {
+                if (dependency.m_assetId != assetId && directDependencies.contains(dependency.m_assetId))
+                {
+                    dependencies.push_back(dependency.m_assetId);
+                }
+            }
+        }
+
+        // Iterative post-order walk so deep hierarchies can't overflow the stack.  Edges back to an asset that is still being
+        // visited are cycles, which have already been reported by the catalog and are ignored here.
+        enum class VisitState : uint8_t
+        {
+            Visiting,
+            Visited
+        };
+        AZStd::unordered_map<AssetId, VisitState> visitState;
+        AZStd::vector<AZStd::pair<AssetId, size_t>> stack;
+        m_dependencyHeights.clear();
+        m_maxDependencyHeight = 0;
+
+        auto visit = [&](const AssetId& startId)
+        {
+            if (visitState.contains(startId))
+            {
+                return;
+            }
+            visitState[startId] = VisitState::Visiting;
+            stack.emplace_back(startId, 0);
+            while (!stack.empty())
+            {
+                auto& [assetId, nextChild] = stack.back();
+                const AZStd::vector<AssetId>& children = directDependencies[assetId];
+                if (nextChild < children.size())
+                {
+                    const AssetId childId = children[nextChild++];
+                    if (!visitState.contains(childId))
+                    {
+                        visitState[childId] = VisitState::Visiting;
+                        stack.emplace_back(childId, 0);
+                    }
+                    continue;
+                }
+
+                uint32_t height = 0;
+                for (const AssetId& childId : children)
+                {
+                    if (visitState[childId] == VisitState::Visited)
+                    {
+                        height = AZStd::max(height, m_dependencyHeights[childId] + 1);
+                    }
+                }
+                m_dependencyHeights[assetId] = height;
+                m_maxDependencyHeight = AZStd::max(m_maxDependencyHeight, height);
+                visitState[assetId] = VisitState::Visited;
+                stack.pop_back();
+            }
+        };
+
+        visit(rootAssetId);
+        for (const AssetInfo& thisInfo : dependencyInfoList)
+        {
+            visit(thisInfo.m_assetId);
+        }
+
+        // Queue the leaves first so their reads are issued before the assets that need them.  The sort is stable so assets at the
+        // same height keep the order the catalog provided.
+        AZStd::stable_sort(dependencyInfoList.begin(), dependencyInfoList.end(),
+            [this](const AssetInfo& lhs, const AssetInfo& rhs)
+            {
+                return m_dependencyHeights[lhs.m_assetId] < m_dependencyHeights[rhs.m_assetId];
+            });
+    }
+
+    AssetLoadParameters AssetContainer::GetPreloadGraphLoadParams(
+        const AssetId& assetId, const AssetType& assetType, const AssetLoadParameters& loadParams) const
+    {
+        auto heightIter = m_dependencyHeights.find(assetId);
+        if (heightIter == m_dependencyHeights.end())
+        {
+            return loadParams;
+        }
+
+        AZStd::chrono::milliseconds deadline = loadParams.m_deadline.value_or(AZStd::chrono::milliseconds(0));
+        if (!loadParams.m_deadline)
+        {
+            AssetHandler* handler = AssetManager::Instance().GetHandler(assetType);
+            if (!handler)
+            {
+                return loadParams;
+            }
+            AZ::IO::IStreamerTypes::Priority priority;
+            handler->GetDefaultAssetLoadPriority(assetType, deadline, priority);
+        }
+
+        // An asset of height h gets (h + 1) / (maxHeight + 1) of the deadline, so the leaves are read first and the root keeps
+        // the deadline that was requested for the whole container.
+        AssetLoadParameters graphLoadParams = loadParams;
+        graphLoadParams.m_deadline = AZStd::chrono::milliseconds(deadline.count() * (heightIter->second + 1) / (m_maxDependencyHeight + 1));
+        return graphLoadParams;
+    }
+
     bool AssetContainer::IsReady() const
     {
         return (m_rootAsset && m_waitingCount == 0);
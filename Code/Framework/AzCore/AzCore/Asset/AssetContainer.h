@@ -100,6 +100,14 @@ namespace AZ
             void AddDependency(const Asset<AssetData>& newDependency);
             void AddDependency(Asset<AssetData>&& addDependency);
 
+            // Preload graph mode: computes the height of every asset in the dependency closure, which is the length of the longest
+            // chain of dependencies below it, and orders the dependency list so the deepest dependencies are queued first.
+            void BuildPreloadGraph(const AssetId& rootAssetId, AZStd::vector<AssetInfo>& dependencyInfoList);
+
+            // Returns the load parameters to queue the given asset with.  In preload graph mode the read deadline is scaled by the
+            // asset's height so dependencies are read before the assets that depend on them, while the root keeps the requested deadline.
+            AssetLoadParameters GetPreloadGraphLoadParams(const AssetId& assetId, const AssetType& assetType, const AssetLoadParameters& loadParams) const;
+
             // Add a "graph section" to our list of dependencies.  This checks the catalog for all Pre and Queue load assets which are dependents of the requested asset and kicks off loads
             // NoLoads which are encounted are placed in another list and can be loaded on demand with the LoadDependency call.
             void AddDependentAssets(Asset<AssetData> rootAsset, const AssetLoadParameters& loadParams);
@@ -145,6 +153,10 @@ namespace AZ
 
             // AssetId -> List of assets waiting on it
             PreloadAssetListType m_preloadWaitList;
+
+            // AssetId -> height in the dependency graph, only filled in preload graph mode
+            AZStd::unordered_map<AssetId, uint32_t> m_dependencyHeights;
+            uint32_t m_maxDependencyHeight{ 0 };
         private:
             AssetContainer operator=(const AssetContainer& copyContainer) = delete;
             AssetContainer operator=(const AssetContainer&& copyContainer) = delete;
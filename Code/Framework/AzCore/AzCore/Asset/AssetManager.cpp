@@ -546,8 +546,8 @@ namespace AZ::Data
     {
         PrepareShutDown();
 
-        // Acquire the asset lock to make sure nobody else is trying to do anything fancy with assets
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        // Acquire the asset locks to make sure nobody else is trying to do anything fancy with assets
+        AllAssetShardsLock assetLock(m_assetShards);
 
         while (!m_handlers.empty())
         {
@@ -606,6 +606,16 @@ namespace AZ::Data
         return m_enableParallelDependentLoading;
     }
 
+    void AssetManager::SetPreloadGraphEnabled(bool enable)
+    {
+        m_enablePreloadGraph = enable;
+    }
+
+    bool AssetManager::GetPreloadGraphEnabled() const
+    {
+        return m_enablePreloadGraph;
+    }
+
     void AssetManager::PrepareShutDown()
     {
         m_cancelAllActiveJobs = true;
@@ -677,10 +687,11 @@ namespace AZ::Data
                     // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
                     WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                    // this scope is used to control the scope of the lock.
+                    AllAssetShardsLock assetLock(m_assetShards);
+                    for (AssetShard& shard : m_assetShards)
                     {
-                        // this scope is used to control the scope of the lock.
-                        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        for (const auto &assetEntry : shard.m_assets)
                         {
                             // is the handler that handles this type, this handler we're removing?
                             if (assetEntry.second->m_registeredHandler == handler)
@@ -772,19 +783,22 @@ namespace AZ::Data
             return;
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AllAssetShardsLock assetLock(m_assetShards);
         // First, release any containers that were loading this asset
-        for (auto asset = m_assets.begin();asset != m_assets.end();)
+        for (AssetShard& shard : m_assetShards)
         {
-            if (asset->second->m_useCount == 0)
-            {
-                auto releaseAsset = asset->second;
-                ++asset;
-                ReleaseAssetContainersForAsset(releaseAsset);
-            }
-            else
+            for (auto asset = shard.m_assets.begin(); asset != shard.m_assets.end();)
             {
-                ++asset;
+                if (asset->second->m_useCount == 0)
+                {
+                    auto releaseAsset = asset->second;
+                    ++asset;
+                    ReleaseAssetContainersForAsset(releaseAsset);
+                }
+                else
+                {
+                    ++asset;
+                }
             }
         }
 
@@ -792,13 +806,16 @@ namespace AZ::Data
 
         AZStd::vector<AssetData*> assetsToRelease;
 
-        for(auto&& asset : m_assets)
+        for (AssetShard& shard : m_assetShards)
         {
-            if(asset.second->m_weakUseCount == 0)
+            for (auto&& asset : shard.m_assets)
             {
-                // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
-                // currently looping on.
-                assetsToRelease.push_back(asset.second);
+                if (asset.second->m_weakUseCount == 0)
+                {
+                    // Keep a separate list of assets to release, because releasing them will modify the asset maps that we're
+                    // currently looping on.
+                    assetsToRelease.push_back(asset.second);
+                }
             }
         }
 
@@ -841,7 +858,7 @@ namespace AZ::Data
     {
         // Look up the asset id in the catalog, and use the result of that instead.
         // If assetId is a legacy id, assetInfo.m_assetId will be the canonical id. Otherwise, assetInfo.m_assetID == assetId.
-        // This is because only canonical ids are stored in m_assets (see below).
+        // This is because only canonical ids are stored in the asset shards (see below).
         // Only do the look up if upgrading is enabled
         AZ::Data::AssetInfo assetInfo;
         if (GetAssetInfoUpgradingEnabled())
@@ -852,9 +869,10 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
-        if (it != m_assets.end())
+        AssetShard& shard = GetAssetShard(assetToFind);
+        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+        AssetMap::iterator it = shard.m_assets.find(assetToFind);
+        if (it != shard.m_assets.end())
         {
             Asset<AssetData> asset(assetReferenceLoadBehavior);
             asset.SetData(it->second);
@@ -988,17 +1006,18 @@ namespace AZ::Data
         AssetData* assetData = nullptr;
         Asset<AssetData> asset; // Used to hold a reference while job is dispatched and while outside of the assetMutex lock.
 
-        // Control the scope of the assetMutex lock
+        // Control the scope of the asset shard lock
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetShard& shard = GetAssetShard(assetInfo.m_assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
             bool isNewEntry = false;
 
             // check if asset already exists
             {
                 AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAsset");
 
-                AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                if (it != m_assets.end())
+                AssetMap::iterator it = shard.m_assets.find(assetInfo.m_assetId);
+                if (it != shard.m_assets.end())
                 {
                     assetData = it->second;
                     asset.SetData(assetData);
@@ -1047,11 +1066,11 @@ namespace AZ::Data
                 if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                 {
                     AZ_PROFILE_SCOPE(AzCore, "GetAsset: RegisterAsset");
-                    m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
+                    shard.m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
                 }
-                if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
+                AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::NotLoaded;
+                if (assetData->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::Queued))
                 {
-                    assetData->m_status = AssetData::AssetStatus::Queued;
                     UpdateDebugStatus(asset);
                     loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
                     wasUnloaded = true;
@@ -1080,7 +1099,7 @@ namespace AZ::Data
 
         asset.SetAutoLoadBehavior(assetReferenceLoadBehavior);
 
-        // We delay queueing the async file I/O until we release m_assetMutex
+        // We delay queueing the async file I/O until we release the asset shard lock
         if (dataStream)
         {
             AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
@@ -1131,16 +1150,29 @@ namespace AZ::Data
 
     Asset<AssetData> AssetManager::FindOrCreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        // Resolve the canonical id up front, the same way FindAsset does, so the catalog isn't queried while holding a lock.
+        AZ::Data::AssetInfo assetInfo;
+        if (GetAssetInfoUpgradingEnabled())
+        {
+            AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+        }
+        const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        Asset<AssetData> asset = FindAsset(assetId, assetReferenceLoadBehavior);
+        // The asset is looked up by its canonical id but created with the requested id, so both shards are held to make the
+        // find and create atomic. They are acquired together to avoid lock order inversions with other callers.
+        AssetShard& shard = GetAssetShard(assetToFind);
+        AZStd::scoped_lock<AZStd::recursive_mutex, AZStd::recursive_mutex> asset_lock(shard.m_mutex, GetAssetShard(assetId).m_mutex);
 
-        if (!asset)
+        AssetMap::iterator it = shard.m_assets.find(assetToFind);
+        if (it != shard.m_assets.end())
         {
-            asset = CreateAsset(assetId, assetType, assetReferenceLoadBehavior);
+            Asset<AssetData> asset(assetReferenceLoadBehavior);
+            asset.SetData(it->second);
+
+            return asset;
         }
 
-        return asset;
+        return CreateAsset(assetId, assetType, assetReferenceLoadBehavior);
     }
 
     //=========================================================================
@@ -1149,11 +1181,12 @@ namespace AZ::Data
     //=========================================================================
     Asset<AssetData> AssetManager::CreateAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(shard.m_mutex);
 
         // check if asset already exist
-        AssetMap::iterator it = m_assets.find(assetId);
-        if (it == m_assets.end())
+        AssetMap::iterator it = shard.m_assets.find(assetId);
+        if (it == shard.m_assets.end())
         {
             // find the asset type handler
             AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
@@ -1171,7 +1204,7 @@ namespace AZ::Data
                     assetData->RegisterWithHandler(handler);
                     if (assetData->IsRegisterReadonlyAndShareable())
                     {
-                        m_assets.insert(AZStd::make_pair(assetId, assetData));
+                        shard.m_assets.insert(AZStd::make_pair(assetId, assetData));
                     }
 
                     Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -1205,8 +1238,9 @@ namespace AZ::Data
 
         if (removeAssetFromHash)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetId);
+            AssetShard& shard = GetAssetShard(assetId);
+            AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(shard.m_mutex);
+            AssetMap::iterator it = shard.m_assets.find(assetId);
             // need to check the count again in here in case
            // someone was trying to get the asset on another thread
            // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
@@ -1214,10 +1248,10 @@ namespace AZ::Data
             // if the assetId is not in the map or if the identifierId
             // do not match it implies that the asset has been already destroyed.
             // if the usecount is non zero it implies that we cannot destroy this asset.
-            if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+            if (it != shard.m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
             {
                 wasInAssetsHash = true;
-                m_assets.erase(it);
+                shard.m_assets.erase(it);
                 destroyAsset = true;
             }
         }
@@ -1325,17 +1359,35 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::ReloadAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior, bool isAutoReload)
     {
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        auto assetIter = m_assets.find(assetId);
+        AssetShard& shard = GetAssetShard(assetId);
 
-        if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+        // The reload is tracked under the canonical id, which can live in another shard. Resolve it first and then take
+        // both shards together, the same way FindOrCreateAsset does. Nesting the second lock inside the first would take
+        // shards in asset id order and deadlock against a reload in the opposite direction or an AllAssetShardsLock.
+        AssetId canonicalId;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+            auto assetIter = shard.m_assets.find(assetId);
+            if (assetIter == shard.m_assets.end() || assetIter->second->IsLoading())
+            {
+                // Only existing assets can be reloaded.
+                return;
+            }
+            canonicalId = Asset<AssetData>(assetIter->second, AZ::Data::AssetLoadBehavior::Default).GetId();
+        }
+
+        AssetShard& reloadShard = GetAssetShard(canonicalId);
+        AZStd::scoped_lock<AZStd::recursive_mutex, AZStd::recursive_mutex> assetLock(shard.m_mutex, reloadShard.m_mutex);
+        auto assetIter = shard.m_assets.find(assetId);
+
+        if (assetIter == shard.m_assets.end() || assetIter->second->IsLoading())
         {
             // Only existing assets can be reloaded.
             return;
         }
 
-        auto reloadIter = m_reloads.find(assetId);
-        if (reloadIter != m_reloads.end())
+        auto reloadIter = shard.m_reloads.find(assetId);
+        if (reloadIter != shard.m_reloads.end())
         {
             auto curStatus = reloadIter->second.GetData()->GetStatus();
             // We don't need another reload if we're in "Queued" state because that reload has not actually begun yet.
@@ -1362,6 +1414,12 @@ namespace AZ::Data
         // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
         // implicitly and repeatedly for anything we call.
         Asset<AssetData> currentAsset(assetIter->second, AZ::Data::AssetLoadBehavior::Default);
+        if (currentAsset.GetId() != canonicalId)
+        {
+            // The catalog remapped the id between the two locks. Drop this request rather than track the reload in a
+            // shard that isn't locked.
+            return;
+        }
 
         if (!assetIter->second->IsRegisterReadonlyAndShareable() && !preventAutoReload)
         {
@@ -1406,7 +1464,8 @@ namespace AZ::Data
             newAssetData->m_status = AssetData::AssetStatus::Queued;
             Asset<AssetData> newAsset(newAssetData, assetReferenceLoadBehavior);
 
-            m_reloads[newAsset.GetId()] = newAsset;
+            // The reload is tracked under the canonical id, which is what the reload completion looks it up by.
+            reloadShard.m_reloads[newAsset.GetId()] = newAsset;
 
             UpdateDebugStatus(newAsset);
 
@@ -1457,17 +1516,18 @@ namespace AZ::Data
 
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetShard& shard = GetAssetShard(asset.GetId());
+            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
             AZ_Assert(
-                m_assets.find(asset.GetId()) != m_assets.end(),
+                shard.m_assets.find(asset.GetId()) != shard.m_assets.end(),
                 "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
             AZ_Assert(
-                m_assets.find(asset.GetId()) == m_assets.end() ||
-                    asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
+                shard.m_assets.find(asset.GetId()) == shard.m_assets.end() ||
+                    asset->RTTI_GetType() == shard.m_assets.find(asset.GetId())->second->RTTI_GetType(),
                 "New and old data types are mismatched!");
 
-            auto found = m_assets.find(asset.GetId());
-            if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+            auto found = shard.m_assets.find(asset.GetId());
+            if ((found == shard.m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
             {
                 return; // this will just lead to crashes down the line and the above asserts cover this.
             }
@@ -1491,7 +1551,7 @@ namespace AZ::Data
             }
         }
 
-        // We specifically perform this outside of the m_assetMutex lock so that the lock isn't held at the point that
+        // We specifically perform this outside of the asset shard lock so that the lock isn't held at the point that
         // OnAssetReload is triggered inside of AssignAssetData.  Otherwise, we open up a high potential for deadlocks.
         if (shouldAssignAssetData)
         {
@@ -1528,9 +1588,10 @@ namespace AZ::Data
         {
             bool requeue{ false };
             {
-                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                auto found = m_assets.find(assetId);
-                AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
+                AssetShard& shard = GetAssetShard(assetId);
+                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+                auto found = shard.m_assets.find(assetId);
+                AZ_Assert(found == shard.m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
                     "New and old data types are mismatched!");
 
                 // if we are here it implies that we have two assets with the same asset id, and we are
@@ -1539,21 +1600,21 @@ namespace AZ::Data
                 // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore
                 // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.
                 asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                if (found != m_assets.end())
+                if (found != shard.m_assets.end())
                 {
                     found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
                 }
 
                 // Held references to old data are retained, but replace the entry in the DB for future requests.
                 // Fire an OnAssetReloaded message so listeners can react to the new data.
-                m_assets[assetId] = asset.Get();
+                shard.m_assets[assetId] = asset.Get();
 
                 // Release the reload reference.
-                auto reloadInfo = m_reloads.find(assetId);
-                if (reloadInfo != m_reloads.end())
+                auto reloadInfo = shard.m_reloads.find(assetId);
+                if (reloadInfo != shard.m_reloads.end())
                 {
                     requeue = reloadInfo->second->GetRequeue();
-                    m_reloads.erase(reloadInfo);
+                    shard.m_reloads.erase(reloadInfo);
                 }
             }
             // Call reloaded before we can call ReloadAsset below to preserve order
@@ -1619,14 +1680,13 @@ namespace AZ::Data
                 AZ_PROFILE_SCOPE(AzCore, "AZ::Data::LoadAssetStreamerCallback %s",
                     loadingAsset.GetHint().c_str());
                 {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
                     AssetData* data = loadingAsset.Get();
-                    if (data->GetStatus() != AssetData::AssetStatus::Queued)
+                    AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::Queued;
+                    if (!data->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::StreamReady))
                     {
                         AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
                         return;
                     }
-                    data->m_status = AssetData::AssetStatus::StreamReady;
                 }
 
                 // The callback from AZ Streamer blocks the streaming thread until this function completes. To minimize the overhead,
@@ -1726,8 +1786,9 @@ namespace AZ::Data
     {
         // Failed reloads have no side effects. Just notify observers (error reporting, etc).
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            m_reloads.erase(asset.GetId());
+            AssetShard& shard = GetAssetShard(asset.GetId());
+            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+            shard.m_reloads.erase(asset.GetId());
         }
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetReloadError, asset);
     }
@@ -1768,23 +1829,19 @@ namespace AZ::Data
     bool AssetManager::ValidateAndRegisterAssetLoading(const Asset<AssetData>& asset)
     {
         AssetData* data = asset.Get();
+        if (data)
         {
-
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            if (data)
+            // The purpose of this function is to validate this asset is still in a StreamReady
+            // and only then continue the load.  We change status to loading if everything
+            // is expected which the blocking RegisterAssetLoading call does not do because it
+            // is already in loading status
+            AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::StreamReady;
+            if (!data->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::Loading))
             {
-                // The purpose of this function is to validate this asset is still in a StreamReady
-                // and only then continue the load.  We change status to loading if everything
-                // is expected which the blocking RegisterAssetLoading call does not do because it
-                // is already in loading status
-                if (data->GetStatus() != AssetData::AssetStatus::StreamReady)
-                {
-                    // Something else has attempted to load this asset
-                    return false;
-                }
-                data->m_status = AssetData::AssetStatus::Loading;
-                UpdateDebugStatus(asset);
+                // Something else has attempted to load this asset
+                return false;
             }
+            UpdateDebugStatus(asset);
         }
 
         return true;
@@ -2111,13 +2168,17 @@ namespace AZ::Data
                                            bool isReload, AZ::Data::AssetHandler* assetHandler)
     {
         {
-            // We may need to revalidate that this asset hasn't already passed through postLoad
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            if (asset->IsReady() || asset->m_status == AssetData::AssetStatus::LoadedPreReady)
+            // We may need to revalidate that this asset hasn't already passed through postLoad. Only the thread that
+            // wins the transition to LoadedPreReady continues.
+            AssetData::AssetStatus expectedStatus = asset->GetStatus();
+            do
             {
-                return;
-            }
-            asset->m_status = AssetData::AssetStatus::LoadedPreReady;
+                if (expectedStatus == AssetData::AssetStatus::Ready || expectedStatus == AssetData::AssetStatus::ReadyPreNotify ||
+                    expectedStatus == AssetData::AssetStatus::LoadedPreReady)
+                {
+                    return;
+                }
+            } while (!asset->m_status.compare_exchange_weak(expectedStatus, AssetData::AssetStatus::LoadedPreReady));
             UpdateDebugStatus(asset);
         }
         PostLoad(asset, loadSucceeded, isReload, assetHandler);
@@ -2156,28 +2217,49 @@ namespace AZ::Data
             return CreateAssetContainer(asset, loadParams);
         }
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> containerLock(m_assetContainerMutex);
         AssetContainerKey containerKey{ asset.GetId(), loadParams };
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> containerLock(m_assetContainerMutex);
+            auto curIter = m_assetContainers.find(containerKey);
+            if (curIter != m_assetContainers.end())
+            {
+                auto newRef = curIter->second.lock();
+                if (newRef && newRef->IsValid())
+                {
+                    return newRef;
+                }
+            }
+        }
 
+        // Constructing a container queues the loads of all of its dependencies, so it's done outside of the lock to let
+        // containers for different assets be set up in parallel.
+        auto newContainer = CreateAssetContainer(asset, loadParams);
+
+        AZStd::scoped_lock<AZStd::recursive_mutex> containerLock(m_assetContainerMutex);
         auto curIter = m_assetContainers.find(containerKey);
         if (curIter != m_assetContainers.end())
         {
+            // Another thread may have finished a container for the same asset in the meantime, in which case that one is shared
+            // and the new one is released. Its dependency loads are already shared through the asset table.
             auto newRef = curIter->second.lock();
             if (newRef && newRef->IsValid())
             {
                 return newRef;
             }
-            auto newContainer = CreateAssetContainer(asset, loadParams);
             curIter->second = newContainer;
             return newContainer;
         }
-        auto newContainer = CreateAssetContainer(asset, loadParams);
 
         m_assetContainers.insert({ containerKey, newContainer });
 
         return newContainer;
     }
 
+    AssetManager::AssetShard& AssetManager::GetAssetShard(const AssetId& assetId)
+    {
+        return m_assetShards[AZStd::hash<AssetId>{}(assetId) % AssetShardCount];
+    }
+
     AZStd::shared_ptr<AssetContainer> AssetManager::CreateAssetContainer(Asset<AssetData> asset, const AssetLoadParameters& loadParams) const
     {
         return AZStd::shared_ptr<AssetContainer>( aznew AssetContainer(AZStd::move(asset), loadParams));
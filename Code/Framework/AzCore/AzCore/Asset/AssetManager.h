@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -153,6 +154,7 @@ namespace AZ
             typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
             typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
             typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
+            typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
             typedef AZStd::unordered_map<AssetContainerKey, AZStd::weak_ptr<AssetContainer>> WeakAssetContainerMap;
             typedef AZStd::unordered_map<AssetContainer*, AZStd::shared_ptr<AssetContainer>> OwnedAssetContainerMap;
 
@@ -311,6 +313,15 @@ namespace AZ
             void        SetParallelDependentLoadingEnabled(bool enable);
             bool        GetParallelDependentLoadingEnabled() const;
 
+            /**
+             * Preload graph mode makes Asset Containers compute the height of every asset in the dependency closure up front.
+             * Dependencies are then queued deepest first and their Streamer deadlines are scaled by their height, so assets
+             * are read before the assets that depend on them and each one can finish as soon as its own dependencies are ready.
+             * It's disabled by default and only has an effect when parallel dependent loading is enabled.
+             **/
+            void        SetPreloadGraphEnabled(bool enable);
+            bool        GetPreloadGraphEnabled() const;
+
             /**
             * This method must be invoked before you start unregistering handlers manually and shutting down the asset manager.
             * This method ensures that all jobs in flight are either canceled or completed.
@@ -403,21 +414,55 @@ namespace AZ
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            //! The asset table is split into shards by asset id, each with its own lock, so that loads of unrelated assets don't
+            //! contend with each other. Operations on a single asset only ever lock the shard of that asset.
+            struct AssetShard
+            {
+                AZStd::recursive_mutex  m_mutex;        // lock when accessing the assets or reloads of this shard
+                AssetMap                m_assets;
+                ReloadMap               m_reloads;      // book-keeping and reference-holding for asset reloads
+            };
+            static constexpr size_t AssetShardCount = 64;
+            using AssetShardArray = AZStd::array<AssetShard, AssetShardCount>;
+
+            //! Locks every shard in index order, for the rare operations that need a consistent view of the whole table.
+            class AllAssetShardsLock
+            {
+            public:
+                explicit AllAssetShardsLock(AssetShardArray& shards)
+                    : m_shards(shards)
+                {
+                    for (AssetShard& shard : m_shards)
+                    {
+                        shard.m_mutex.lock();
+                    }
+                }
+                ~AllAssetShardsLock()
+                {
+                    for (auto shard = m_shards.rbegin(); shard != m_shards.rend(); ++shard)
+                    {
+                        shard->m_mutex.unlock();
+                    }
+                }
+                AZ_DISABLE_COPY_MOVE(AllAssetShardsLock);
+
+            private:
+                AssetShardArray& m_shards;
+            };
+
+            AssetShard& GetAssetShard(const AssetId& assetId);
+
+            AssetShardArray m_assetShards;
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
             AZStd::unordered_multimap<AssetId, AssetContainer*> m_ownedAssetContainerLookup;
-            AZStd::recursive_mutex  m_assetContainerMutex;       // lock when accessing the assetContainers map
+            AZStd::recursive_mutex  m_assetContainerMutex;       // lock when accessing the assetContainers map, never held while a container is constructed
 
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
 
-            int m_creationTokenGenerator = 0; // this is used to generate unique identifiers for assets
-
-            typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
-            ReloadMap               m_reloads;          // book-keeping and reference-holding for asset reloads
+            AZStd::atomic_int m_creationTokenGenerator{ 0 }; // this is used to generate unique identifiers for assets
 
             typedef AZStd::intrusive_list<AssetDatabaseJob, AZStd::list_base_hook<AssetDatabaseJob> > ActiveJobList;
             ActiveJobList           m_activeJobs;
@@ -442,6 +487,9 @@ namespace AZ
             //! to set it to false.
             bool m_enableParallelDependentLoading = true;
 
+            //! Enable or disable ordering and scheduling dependent loads by their depth in the dependency graph.
+            AZStd::atomic_bool m_enablePreloadGraph{ false };
+
             bool m_assetInfoUpgradingEnabled = true;
 
             static EnvironmentVariable<AssetManager*>  s_assetDB;
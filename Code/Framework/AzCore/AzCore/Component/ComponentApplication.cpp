@@ -69,6 +69,7 @@
 #endif // defined(AZ_ENABLE_DEBUG_TOOLS)
 
 #include <AzCore/Module/Environment.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/Time/TimeSystem.h>
@@ -452,6 +453,19 @@ namespace AZ
         // can be read to determine the Game folder and the asset platform
         m_settingsRegistry = AZStd::make_unique<SettingsRegistryImpl>();
 
+        // Allow registry folders to be parsed on multiple threads and cached in binary form before the first folder is merged
+        if (constexpr AZStd::string_view mergeThreadsSwitch = "regmerge-threads"; m_commandLine.GetNumSwitchValues(mergeThreadsSwitch) > 0)
+        {
+            const AZStd::string& threadCountValue = m_commandLine.GetSwitchValue(mergeThreadsSwitch, 0);
+            m_settingsRegistry->SetMergeThreadCount(threadCountValue.empty() || threadCountValue == "auto"
+                ? AZStd::thread::hardware_concurrency()
+                : static_cast<AZ::u32>(strtoul(threadCountValue.c_str(), nullptr, 10)));
+        }
+        if (constexpr AZStd::string_view mergeCacheSwitch = "regmerge-cache"; m_commandLine.GetNumSwitchValues(mergeCacheSwitch) > 0)
+        {
+            m_settingsRegistry->SetMergeCacheFolder(m_commandLine.GetSwitchValue(mergeCacheSwitch, 0));
+        }
+
         // Register the Settings Registry with the AZ Interface if there isn't one registered already
         if (SettingsRegistry::Get() == nullptr)
         {
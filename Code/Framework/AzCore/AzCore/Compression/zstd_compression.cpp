@@ -14,6 +14,8 @@
 
 #include <AzCore/Compression/zstd_compression.h>
 
+#include <zdict.h>
+
 using namespace AZ;
 
 ZStd::ZStd(IAllocator* workMemAllocator)
@@ -165,6 +167,17 @@ unsigned int ZStd::Decompress(const void* compressedData, unsigned int compresse
     return azlossy_cast<unsigned int>(m_outBuffer.pos); //return number of bytes decompressed
 }
 
+size_t ZStd::TrainDictionary(void* dictionary, size_t dictionaryCapacity, const void* samples, const size_t* sampleSizes, unsigned int numSamples)
+{
+    size_t result = ZDICT_trainFromBuffer(dictionary, dictionaryCapacity, samples, sampleSizes, numSamples);
+    if (ZDICT_isError(result))
+    {
+        AZ_Warning("ZStd", false, "Unable to train a compression dictionary from %u samples: %s", numSamples, ZDICT_getErrorName(result));
+        return 0;
+    }
+    return result;
+}
+
 bool ZStd::IsCompressorStarted() const
 {
     return m_streamCompression != nullptr;
@@ -68,6 +68,15 @@ namespace AZ
         // Decompressor
         unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int outputDataSize, size_t* sizeOfNextBlock);
         //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // Dictionary
+        /// Trains a dictionary for compressing many small files with similar content. The samples are stored back to back in
+        /// the samples buffer and sampleSizes holds the size of each sample.
+        /// Returns the size of the dictionary written to the dictionary buffer or 0 if no dictionary could be trained, which
+        /// usually means there were too few samples.
+        static size_t TrainDictionary(void* dictionary, size_t dictionaryCapacity, const void* samples, const size_t* sampleSizes, unsigned int numSamples);
+        //////////////////////////////////////////////////////////////////////////
     private:
         static void* AllocateMem(void* userData, size_t size);
         static void  FreeMem(void* userData, void* address);
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/Backends/Binary/BinarySerializationUtils.h>
+#include <AzCore/DOM/DomBackend.h>
+
+namespace AZ::Dom
+{
+    //! A DOM backend for serializing and deserializing a compact binary representation of a DOM.
+    //! Binary buffers are read in place without a tokenization pass, see Binary::Token for the format.
+    class BinaryBackend final : public Backend
+    {
+    public:
+        Visitor::Result ReadFromBuffer(const char* buffer, size_t size, AZ::Dom::Lifetime lifetime, Visitor& visitor) override
+        {
+            return Binary::VisitSerializedBinary({ buffer, size }, lifetime, visitor);
+        }
+
+        Visitor::Result ReadFromBufferInPlace(char* buffer, AZStd::optional<size_t> size, Visitor& visitor) override
+        {
+            // The format never needs to modify the buffer, but it isn't null terminated so a size is required.
+            AZ_Assert(size.has_value(), "BinaryBackend requires a buffer size");
+            return Binary::VisitSerializedBinary({ buffer, size.value_or(0) }, Lifetime::Persistent, visitor);
+        }
+
+        Visitor::Result WriteToBuffer(AZStd::string& buffer, WriteCallback callback) override
+        {
+            return Binary::WriteToBinaryBuffer(buffer, AZStd::move(callback));
+        }
+    };
+} // namespace AZ::Dom
@@ -0,0 +1,702 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/DOM/Backends/Binary/BinarySerializationUtils.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::Dom::Binary
+{
+    namespace Internal
+    {
+        // Limits the nesting the reader accepts, so malformed buffers can't exhaust the stack.
+        static constexpr size_t MaxDepth = 1024;
+
+        static constexpr size_t StringTableOffsetPosition = 8;
+        static constexpr size_t StringCountPosition = 12;
+
+        template<class T>
+        void Append(AZStd::string& buffer, T value)
+        {
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template<class T>
+        void WriteAt(AZStd::string& buffer, size_t offset, T value)
+        {
+            memcpy(buffer.data() + offset, &value, sizeof(T));
+        }
+
+        template<class T>
+        T ReadAt(const char* data, size_t offset)
+        {
+            T value;
+            memcpy(&value, data + offset, sizeof(T));
+            return value;
+        }
+    } // namespace Internal
+
+    //
+    // class BinaryWriter
+    //
+    // Visitor that appends values in the binary DOM format to a string.
+    class BinaryWriter final : public Visitor
+    {
+    public:
+        explicit BinaryWriter(AZStd::string& buffer)
+            : m_buffer(buffer)
+        {
+            m_buffer.clear();
+            m_buffer.append(FormatMagic, sizeof(FormatMagic));
+            Internal::Append<AZ::u16>(m_buffer, FormatVersion);
+            Internal::Append<AZ::u16>(m_buffer, 0);
+            Internal::Append<AZ::u32>(m_buffer, 0); // string table offset, patched by Finish
+            Internal::Append<AZ::u32>(m_buffer, 0); // string count, patched by Finish
+        }
+
+        VisitorFlags GetVisitorFlags() const override
+        {
+            return VisitorFlags::SupportsRawKeys | VisitorFlags::SupportsArrays | VisitorFlags::SupportsObjects |
+                VisitorFlags::SupportsNodes;
+        }
+
+        Result Null() override
+        {
+            AppendToken(Token::Null);
+            return VisitorSuccess();
+        }
+
+        Result Bool(bool value) override
+        {
+            AppendToken(value ? Token::True : Token::False);
+            return VisitorSuccess();
+        }
+
+        Result Int64(AZ::s64 value) override
+        {
+            AppendToken(Token::Int64);
+            Internal::Append(m_buffer, value);
+            return VisitorSuccess();
+        }
+
+        Result Uint64(AZ::u64 value) override
+        {
+            AppendToken(Token::Uint64);
+            Internal::Append(m_buffer, value);
+            return VisitorSuccess();
+        }
+
+        Result Double(double value) override
+        {
+            AppendToken(Token::Double);
+            Internal::Append(m_buffer, value);
+            return VisitorSuccess();
+        }
+
+        Result String(AZStd::string_view value, [[maybe_unused]] Lifetime lifetime) override
+        {
+            AppendToken(Token::String);
+            Internal::Append(m_buffer, InternString(value));
+            return VisitorSuccess();
+        }
+
+        Result RefCountedString(AZStd::shared_ptr<const AZStd::vector<char>> value, Lifetime lifetime) override
+        {
+            return String({ value->data(), value->size() }, lifetime);
+        }
+
+        Result StartObject() override
+        {
+            return StartContainer(Token::Object);
+        }
+
+        Result EndObject(AZ::u64 attributeCount) override
+        {
+            return EndContainer(Token::Object, attributeCount, 0);
+        }
+
+        Result Key(AZ::Name key) override
+        {
+            return RawKey(key.GetStringView(), Lifetime::Persistent);
+        }
+
+        Result RawKey(AZStd::string_view key, [[maybe_unused]] Lifetime lifetime) override
+        {
+            if (m_containerStack.empty() || m_containerStack.back().m_token == Token::Array)
+            {
+                return VisitorFailure(VisitorErrorCode::InvalidData, "Key called outside of an object or node");
+            }
+            AppendToken(Token::Key);
+            Internal::Append(m_buffer, InternString(key));
+            return VisitorSuccess();
+        }
+
+        Result StartArray() override
+        {
+            return StartContainer(Token::Array);
+        }
+
+        Result EndArray(AZ::u64 elementCount) override
+        {
+            return EndContainer(Token::Array, 0, elementCount);
+        }
+
+        Result StartNode(AZ::Name name) override
+        {
+            return RawStartNode(name.GetStringView(), Lifetime::Persistent);
+        }
+
+        Result RawStartNode(AZStd::string_view name, [[maybe_unused]] Lifetime lifetime) override
+        {
+            const AZ::u32 nameIndex = InternString(name);
+            Result result = StartContainer(Token::Node);
+            Internal::WriteAt(m_buffer, m_containerStack.back().m_payloadOffset, nameIndex);
+            return result;
+        }
+
+        Result EndNode(AZ::u64 attributeCount, AZ::u64 elementCount) override
+        {
+            return EndContainer(Token::Node, attributeCount, elementCount);
+        }
+
+        //! Appends the string table and completes the header.
+        Result Finish()
+        {
+            if (!m_containerStack.empty())
+            {
+                return VisitorFailure(VisitorErrorCode::InvalidData, "Binary DOM write finished with unterminated containers");
+            }
+            if (m_buffer.size() == HeaderSize)
+            {
+                return VisitorFailure(VisitorErrorCode::InvalidData, "Binary DOM write finished without a value");
+            }
+
+            const size_t stringTableOffset = m_buffer.size();
+            const size_t stringCount = m_strings.size();
+            size_t stringOffset = stringTableOffset + stringCount * sizeof(AZ::u32);
+            for (AZStd::string_view string : m_strings)
+            {
+                Internal::Append(m_buffer, aznumeric_cast<AZ::u32>(stringOffset));
+                stringOffset += sizeof(AZ::u32) + string.size() + 1;
+            }
+            for (AZStd::string_view string : m_strings)
+            {
+                Internal::Append(m_buffer, aznumeric_cast<AZ::u32>(string.size()));
+                m_buffer.append(string.data(), string.size());
+                m_buffer.push_back('\0');
+            }
+
+            if (m_buffer.size() > AZStd::numeric_limits<AZ::u32>::max())
+            {
+                return VisitorFailure(VisitorErrorCode::InternalError, "Binary DOM buffers are limited to 4GB");
+            }
+
+            Internal::WriteAt(m_buffer, Internal::StringTableOffsetPosition, aznumeric_cast<AZ::u32>(stringTableOffset));
+            Internal::WriteAt(m_buffer, Internal::StringCountPosition, aznumeric_cast<AZ::u32>(stringCount));
+            return VisitorSuccess();
+        }
+
+    private:
+        struct ContainerInfo
+        {
+            Token m_token;
+            size_t m_payloadOffset;
+        };
+
+        void AppendToken(Token token)
+        {
+            m_buffer.push_back(static_cast<char>(token));
+        }
+
+        AZ::u32 InternString(AZStd::string_view string)
+        {
+            const AZ::u32 index = aznumeric_cast<AZ::u32>(m_strings.size());
+            auto [it, inserted] = m_stringIndices.emplace(string, index);
+            if (inserted)
+            {
+                m_strings.push_back(it->first);
+            }
+            return it->second;
+        }
+
+        Result StartContainer(Token token)
+        {
+            AppendToken(token);
+            m_containerStack.push_back({ token, m_buffer.size() });
+            // counts and end offset are patched by EndContainer
+            const size_t payloadSize = (token == Token::Node ? 4 : 2) * sizeof(AZ::u32);
+            m_buffer.append(payloadSize, '\0');
+            return VisitorSuccess();
+        }
+
+        Result EndContainer(Token token, AZ::u64 attributeCount, AZ::u64 elementCount)
+        {
+            if (m_containerStack.empty() || m_containerStack.back().m_token != token)
+            {
+                return VisitorFailure(VisitorErrorCode::InvalidData, "End call doesn't match the container being written");
+            }
+
+            size_t offset = m_containerStack.back().m_payloadOffset;
+            m_containerStack.pop_back();
+            if (token == Token::Node)
+            {
+                offset += sizeof(AZ::u32); // skip the name
+            }
+            if (token != Token::Array)
+            {
+                Internal::WriteAt(m_buffer, offset, aznumeric_cast<AZ::u32>(attributeCount));
+                offset += sizeof(AZ::u32);
+            }
+            if (token != Token::Object)
+            {
+                Internal::WriteAt(m_buffer, offset, aznumeric_cast<AZ::u32>(elementCount));
+                offset += sizeof(AZ::u32);
+            }
+            Internal::WriteAt(m_buffer, offset, aznumeric_cast<AZ::u32>(m_buffer.size()));
+            return VisitorSuccess();
+        }
+
+        AZStd::string& m_buffer;
+        AZStd::vector<ContainerInfo> m_containerStack;
+        // The string table in index order, viewing the keys owned by m_stringIndices (map nodes don't move).
+        AZStd::vector<AZStd::string_view> m_strings;
+        AZStd::unordered_map<AZStd::string, AZ::u32> m_stringIndices;
+    };
+
+    //
+    // class BinaryReader
+    //
+    // Reads a binary DOM buffer in place and forwards its values to a Visitor.
+    class BinaryReader final
+    {
+    public:
+        BinaryReader(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor)
+            : m_data(buffer.data())
+            , m_size(buffer.size())
+            , m_lifetime(lifetime)
+            , m_visitor(visitor)
+        {
+        }
+
+        Visitor::Result ReadHeader()
+        {
+            if (!IsSerializedBinary({ m_data, m_size }))
+            {
+                return Failure("Buffer isn't a supported binary DOM");
+            }
+            m_stringTableOffset = Internal::ReadAt<AZ::u32>(m_data, Internal::StringTableOffsetPosition);
+            m_stringCount = Internal::ReadAt<AZ::u32>(m_data, Internal::StringCountPosition);
+            if (m_stringTableOffset < HeaderSize || m_stringTableOffset > m_size ||
+                (m_size - m_stringTableOffset) / sizeof(AZ::u32) < m_stringCount)
+            {
+                return Failure("Binary DOM string table is out of bounds");
+            }
+            return AZ::Success();
+        }
+
+        //! Visits the value at offset, returning the offset past the value through nextOffset.
+        Visitor::Result ReadValue(size_t offset, size_t& nextOffset, size_t depth = 0)
+        {
+            if (depth > Internal::MaxDepth)
+            {
+                return Failure("Binary DOM exceeds the maximum nesting depth");
+            }
+
+            Token token;
+            if (!ReadToken(offset, token))
+            {
+                return Failure("Unexpected end of binary DOM values");
+            }
+            ++offset;
+
+            switch (token)
+            {
+            case Token::Null:
+                nextOffset = offset;
+                return m_visitor.Null();
+            case Token::False:
+            case Token::True:
+                nextOffset = offset;
+                return m_visitor.Bool(token == Token::True);
+            case Token::Int64:
+            case Token::Uint64:
+            case Token::Double:
+                {
+                    if (!InValues(offset, sizeof(AZ::u64)))
+                    {
+                        return Failure("Unexpected end of binary DOM values");
+                    }
+                    nextOffset = offset + sizeof(AZ::u64);
+                    if (token == Token::Int64)
+                    {
+                        return m_visitor.Int64(Internal::ReadAt<AZ::s64>(m_data, offset));
+                    }
+                    if (token == Token::Uint64)
+                    {
+                        return m_visitor.Uint64(Internal::ReadAt<AZ::u64>(m_data, offset));
+                    }
+                    return m_visitor.Double(Internal::ReadAt<double>(m_data, offset));
+                }
+            case Token::String:
+                {
+                    AZStd::string_view string;
+                    if (!ReadStringReference(offset, string))
+                    {
+                        return Failure("Invalid binary DOM string reference");
+                    }
+                    nextOffset = offset + sizeof(AZ::u32);
+                    return m_visitor.String(string, m_lifetime);
+                }
+            case Token::Object:
+            case Token::Array:
+            case Token::Node:
+                return ReadContainer(token, offset, nextOffset, depth);
+            default:
+                return Failure("Unexpected token in binary DOM values");
+            }
+        }
+
+        //! Locates the value at path without visiting anything, skipping all containers that aren't part of the path.
+        Visitor::Result FindValue(const Path& path, size_t& valueOffset)
+        {
+            size_t offset = HeaderSize;
+            for (const PathEntry& entry : path)
+            {
+                Token token;
+                if (!ReadToken(offset, token))
+                {
+                    return Failure("Unexpected end of binary DOM values");
+                }
+                ContainerHeader header;
+                if ((token != Token::Object && token != Token::Array && token != Token::Node) ||
+                    !ReadContainerHeader(token, offset + 1, header))
+                {
+                    return PathNotFound(path);
+                }
+
+                bool found = false;
+                size_t elementIndex = 0;
+                offset = header.m_firstEntryOffset;
+                while (offset < header.m_endOffset && !found)
+                {
+                    if (!ReadToken(offset, token))
+                    {
+                        return Failure("Unexpected end of binary DOM values");
+                    }
+                    if (token == Token::Key)
+                    {
+                        AZStd::string_view key;
+                        if (!ReadStringReference(offset + 1, key))
+                        {
+                            return Failure("Invalid binary DOM string reference");
+                        }
+                        offset += 1 + sizeof(AZ::u32);
+                        found = entry.IsKey() && entry.GetKey().GetStringView() == key;
+                    }
+                    else
+                    {
+                        found = entry.IsIndex() && entry.GetIndex() == elementIndex;
+                        ++elementIndex;
+                    }
+
+                    if (!found && !SkipValue(offset, offset))
+                    {
+                        return Failure("Malformed binary DOM value");
+                    }
+                }
+
+                if (!found)
+                {
+                    return PathNotFound(path);
+                }
+            }
+
+            valueOffset = offset;
+            return AZ::Success();
+        }
+
+        size_t GetValuesEnd() const
+        {
+            return m_stringTableOffset;
+        }
+
+    private:
+        struct ContainerHeader
+        {
+            AZStd::string_view m_name;
+            AZ::u32 m_attributeCount = 0;
+            AZ::u32 m_elementCount = 0;
+            size_t m_firstEntryOffset = 0;
+            size_t m_endOffset = 0;
+        };
+
+        Visitor::Result Failure(const char* message) const
+        {
+            return AZ::Failure(VisitorError(VisitorErrorCode::InvalidData, message));
+        }
+
+        Visitor::Result PathNotFound(const Path& path) const
+        {
+            return AZ::Failure(VisitorError(
+                VisitorErrorCode::InvalidData, AZStd::string::format("Path \"%s\" not found in binary DOM", path.ToString().c_str())));
+        }
+
+        bool InValues(size_t offset, size_t size) const
+        {
+            return offset <= m_stringTableOffset && m_stringTableOffset - offset >= size;
+        }
+
+        bool ReadToken(size_t offset, Token& token) const
+        {
+            if (!InValues(offset, 1))
+            {
+                return false;
+            }
+            token = static_cast<Token>(m_data[offset]);
+            return true;
+        }
+
+        bool ReadStringReference(size_t offset, AZStd::string_view& string) const
+        {
+            if (!InValues(offset, sizeof(AZ::u32)))
+            {
+                return false;
+            }
+            const AZ::u32 index = Internal::ReadAt<AZ::u32>(m_data, offset);
+            if (index >= m_stringCount)
+            {
+                return false;
+            }
+            const size_t stringOffset = Internal::ReadAt<AZ::u32>(m_data, m_stringTableOffset + index * sizeof(AZ::u32));
+            if (stringOffset > m_size || m_size - stringOffset < sizeof(AZ::u32))
+            {
+                return false;
+            }
+            const size_t length = Internal::ReadAt<AZ::u32>(m_data, stringOffset);
+            if (m_size - stringOffset - sizeof(AZ::u32) < length + 1)
+            {
+                return false;
+            }
+            string = AZStd::string_view(m_data + stringOffset + sizeof(AZ::u32), length);
+            return true;
+        }
+
+        bool ReadContainerHeader(Token token, size_t offset, ContainerHeader& header) const
+        {
+            const size_t payloadSize = (token == Token::Node ? 4 : 2) * sizeof(AZ::u32);
+            if (!InValues(offset, payloadSize))
+            {
+                return false;
+            }
+            if (token == Token::Node)
+            {
+                if (!ReadStringReference(offset, header.m_name))
+                {
+                    return false;
+                }
+                offset += sizeof(AZ::u32);
+            }
+            if (token != Token::Array)
+            {
+                header.m_attributeCount = Internal::ReadAt<AZ::u32>(m_data, offset);
+                offset += sizeof(AZ::u32);
+            }
+            if (token != Token::Object)
+            {
+                header.m_elementCount = Internal::ReadAt<AZ::u32>(m_data, offset);
+                offset += sizeof(AZ::u32);
+            }
+            header.m_endOffset = Internal::ReadAt<AZ::u32>(m_data, offset);
+            header.m_firstEntryOffset = offset + sizeof(AZ::u32);
+            return header.m_endOffset >= header.m_firstEntryOffset && header.m_endOffset <= m_stringTableOffset;
+        }
+
+        bool SkipValue(size_t offset, size_t& nextOffset) const
+        {
+            Token token;
+            if (!ReadToken(offset, token))
+            {
+                return false;
+            }
+            ++offset;
+            switch (token)
+            {
+            case Token::Null:
+            case Token::False:
+            case Token::True:
+                nextOffset = offset;
+                return true;
+            case Token::Int64:
+            case Token::Uint64:
+            case Token::Double:
+                nextOffset = offset + sizeof(AZ::u64);
+                return InValues(offset, sizeof(AZ::u64));
+            case Token::String:
+                nextOffset = offset + sizeof(AZ::u32);
+                return InValues(offset, sizeof(AZ::u32));
+            case Token::Object:
+            case Token::Array:
+            case Token::Node:
+                {
+                    ContainerHeader header;
+                    if (!ReadContainerHeader(token, offset, header))
+                    {
+                        return false;
+                    }
+                    nextOffset = header.m_endOffset;
+                    return true;
+                }
+            default:
+                return false;
+            }
+        }
+
+        Visitor::Result ReadContainer(Token token, size_t offset, size_t& nextOffset, size_t depth)
+        {
+            ContainerHeader header;
+            if (!ReadContainerHeader(token, offset, header))
+            {
+                return Failure("Malformed binary DOM container");
+            }
+
+            Visitor::Result result = AZ::Success();
+            if (token == Token::Object)
+            {
+                result = m_visitor.StartObject();
+            }
+            else if (token == Token::Array)
+            {
+                result = m_visitor.StartArray();
+            }
+            else if (m_visitor.SupportsRawKeys())
+            {
+                result = m_visitor.RawStartNode(header.m_name, m_lifetime);
+            }
+            else
+            {
+                result = m_visitor.StartNode(AZ::Name(header.m_name));
+            }
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+
+            offset = header.m_firstEntryOffset;
+            while (offset < header.m_endOffset)
+            {
+                Token entryToken;
+                if (!ReadToken(offset, entryToken))
+                {
+                    return Failure("Unexpected end of binary DOM values");
+                }
+                if (entryToken == Token::Key)
+                {
+                    if (token == Token::Array)
+                    {
+                        return Failure("Binary DOM array contains a key");
+                    }
+                    AZStd::string_view key;
+                    if (!ReadStringReference(offset + 1, key))
+                    {
+                        return Failure("Invalid binary DOM string reference");
+                    }
+                    result = m_visitor.SupportsRawKeys() ? m_visitor.RawKey(key, m_lifetime) : m_visitor.Key(AZ::Name(key));
+                    if (!result.IsSuccess())
+                    {
+                        return result;
+                    }
+                    offset += 1 + sizeof(AZ::u32);
+                }
+
+                result = ReadValue(offset, offset, depth + 1);
+                if (!result.IsSuccess())
+                {
+                    return result;
+                }
+            }
+            if (offset != header.m_endOffset)
+            {
+                return Failure("Binary DOM container overruns its end offset");
+            }
+            nextOffset = offset;
+
+            if (token == Token::Object)
+            {
+                return m_visitor.EndObject(header.m_attributeCount);
+            }
+            if (token == Token::Array)
+            {
+                return m_visitor.EndArray(header.m_elementCount);
+            }
+            return m_visitor.EndNode(header.m_attributeCount, header.m_elementCount);
+        }
+
+        const char* m_data;
+        size_t m_size;
+        size_t m_stringTableOffset = 0;
+        size_t m_stringCount = 0;
+        Lifetime m_lifetime;
+        Visitor& m_visitor;
+    };
+
+    bool IsSerializedBinary(AZStd::string_view buffer)
+    {
+        return buffer.size() >= HeaderSize && memcmp(buffer.data(), FormatMagic, sizeof(FormatMagic)) == 0 &&
+            Internal::ReadAt<AZ::u16>(buffer.data(), sizeof(FormatMagic)) == FormatVersion;
+    }
+
+    Visitor::Result WriteToBinaryBuffer(AZStd::string& buffer, Backend::WriteCallback writeCallback)
+    {
+        BinaryWriter writer(buffer);
+        Visitor::Result result = writeCallback(writer);
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+        return writer.Finish();
+    }
+
+    Visitor::Result VisitSerializedBinary(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor)
+    {
+        BinaryReader reader(buffer, lifetime, visitor);
+        Visitor::Result result = reader.ReadHeader();
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+
+        size_t nextOffset = 0;
+        result = reader.ReadValue(HeaderSize, nextOffset);
+        if (result.IsSuccess() && nextOffset != reader.GetValuesEnd())
+        {
+            return AZ::Failure(VisitorError(VisitorErrorCode::InvalidData, "Unexpected data after the binary DOM root value"));
+        }
+        return result;
+    }
+
+    Visitor::Result VisitSerializedBinaryAtPath(AZStd::string_view buffer, const Path& path, Lifetime lifetime, Visitor& visitor)
+    {
+        BinaryReader reader(buffer, lifetime, visitor);
+        Visitor::Result result = reader.ReadHeader();
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+
+        size_t valueOffset = 0;
+        result = reader.FindValue(path, valueOffset);
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+
+        size_t nextOffset = 0;
+        return reader.ReadValue(valueOffset, nextOffset);
+    }
+} // namespace AZ::Dom::Binary
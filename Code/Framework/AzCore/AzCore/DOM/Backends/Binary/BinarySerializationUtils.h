@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/DomBackend.h>
+#include <AzCore/DOM/DomPath.h>
+#include <AzCore/DOM/DomVisitor.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Dom::Binary
+{
+    //! Binary DOM format layout.
+    //! All integers are little endian and stored unaligned, so a buffer can be read in place from any address (e.g. a
+    //! memory mapped file or a stored archive entry) without being copied or parsed up front.
+    //!
+    //! Header:
+    //!   char[4] magic ("AZDB"), u16 version, u16 reserved, u32 string table offset, u32 string count
+    //! Values (immediately after the header), each value is a one byte Token followed by its payload:
+    //!   Null, False, True: no payload
+    //!   Int64, Uint64, Double: 8 bytes
+    //!   String, Key: u32 string index
+    //!   Object: u32 attribute count, u32 end offset, then Key/value pairs
+    //!   Array: u32 element count, u32 end offset, then values
+    //!   Node: u32 name string index, u32 attribute count, u32 element count, u32 end offset, then Key/value pairs and values
+    //! String table:
+    //!   u32 offset of each string, each string is stored as u32 length, its characters and a null terminator.
+    //!
+    //! Strings are deduplicated through the string table. The end offsets allow skipping containers, which makes it
+    //! possible to visit a single value without reading the rest of the document (\see VisitSerializedBinaryAtPath).
+    enum class Token : AZ::u8
+    {
+        Null,
+        False,
+        True,
+        Int64,
+        Uint64,
+        Double,
+        String,
+        Key,
+        Object,
+        Array,
+        Node,
+    };
+
+    static constexpr char FormatMagic[4] = { 'A', 'Z', 'D', 'B' };
+    static constexpr AZ::u16 FormatVersion = 1;
+    static constexpr size_t HeaderSize = 16;
+
+    //! Returns true if buffer starts with a binary DOM header of a supported version.
+    bool IsSerializedBinary(AZStd::string_view buffer);
+
+    //! Takes a visitor specified by a callback and serializes its contents to buffer in the binary DOM format.
+    //! \param buffer The buffer to write to, its contents will be overridden.
+    //! \param writeCallback A callback specifying a visitor to accept to build the resulting document.
+    //! \return The aggregate result specifying whether the visitor operations were successful.
+    Visitor::Result WriteToBinaryBuffer(AZStd::string& buffer, Backend::WriteCallback writeCallback);
+
+    //! Reads a binary DOM buffer and applies it to a visitor. Nothing is allocated by the reader, strings are handed to the
+    //! visitor as views into buffer.
+    //! \param buffer The binary DOM buffer to read.
+    //! \param lifetime Specifies the lifetime of the specified buffer. If the buffer might be deallocated before the visitor is
+    //! done with its strings, ensure Lifetime::Temporary is specified.
+    //! \param visitor The visitor to visit with the buffer's contents.
+    //! \return The aggregate result specifying whether the visitor operations were successful.
+    Visitor::Result VisitSerializedBinary(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor);
+
+    //! Reads only the value at path from a binary DOM buffer and applies it to a visitor. Sibling containers that aren't
+    //! part of the path are skipped without being read.
+    //! \return The aggregate result specifying whether the visitor operations were successful. Fails with
+    //! VisitorErrorCode::InvalidData if path doesn't exist in the buffer.
+    Visitor::Result VisitSerializedBinaryAtPath(AZStd::string_view buffer, const Path& path, Lifetime lifetime, Visitor& visitor);
+} // namespace AZ::Dom::Binary
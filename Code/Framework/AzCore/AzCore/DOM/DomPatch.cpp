@@ -383,18 +383,14 @@ namespace AZ::Dom
         return AZ::Failure<AZStd::string>("Unable to invert DOM patch, unknown type specified");
     }
 
-    AZ::Outcome<PatchOperation::PathContext, AZStd::string> PatchOperation::LookupPath(
-        Value& rootElement, const Path& path, ExistenceCheckFlags flags)
+    PatchOutcome PatchOperation::ValidatePath(const Value& rootElement, const Path& path, ExistenceCheckFlags flags)
     {
         const bool verifyFullPath = (flags & ExistenceCheckFlags::VerifyFullPath) != ExistenceCheckFlags::DefaultExistenceCheck;
         const bool allowEndOfArray = (flags & ExistenceCheckFlags::AllowEndOfArray) != ExistenceCheckFlags::DefaultExistenceCheck;
 
-        Path target = path;
-        if (target.IsEmpty())
+        if (path.IsEmpty())
         {
-            Value wrapper(Dom::Type::Array);
-            wrapper.ArrayPushBack(rootElement);
-            return AZ::Success<PathContext>({ wrapper, PathEntry(0) });
+            return AZ::Success();
         }
 
         if (verifyFullPath || !allowEndOfArray)
@@ -409,10 +405,11 @@ namespace AZ::Dom
             }
         }
 
-        PathEntry destinationIndex = target[target.Size() - 1];
+        Path target = path;
+        const PathEntry& destinationIndex = path[path.Size() - 1];
         target.Pop();
 
-        Value* targetValue = rootElement.FindMutableChild(target);
+        const Value* targetValue = rootElement.FindChild(target);
         if (targetValue == nullptr)
         {
             AZStd::string errorMessage = "Path not found: ";
@@ -448,6 +445,32 @@ namespace AZ::Dom
             }
         }
 
+        return AZ::Success();
+    }
+
+    AZ::Outcome<PatchOperation::PathContext, AZStd::string> PatchOperation::LookupPath(
+        Value& rootElement, const Path& path, ExistenceCheckFlags flags)
+    {
+        // Validate before touching rootElement so a failed lookup never detaches shared containers
+        PatchOutcome validationResult = ValidatePath(rootElement, path, flags);
+        if (!validationResult.IsSuccess())
+        {
+            return AZ::Failure(validationResult.TakeError());
+        }
+
+        Path target = path;
+        if (target.IsEmpty())
+        {
+            Value wrapper(Dom::Type::Array);
+            wrapper.ArrayPushBack(rootElement);
+            return AZ::Success<PathContext>({ wrapper, PathEntry(0) });
+        }
+
+        PathEntry destinationIndex = target[target.Size() - 1];
+        target.Pop();
+
+        Value* targetValue = rootElement.FindMutableChild(target);
+        AZ_Assert(targetValue != nullptr, "PatchOperation::LookupPath: validated path couldn't be found");
         return AZ::Success<PathContext>({ *targetValue, AZStd::move(destinationIndex) });
     }
 
@@ -508,10 +531,10 @@ namespace AZ::Dom
 
     PatchOutcome PatchOperation::ApplyReplace(Value& rootElement) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
-        if (!pathLookup.IsSuccess())
+        PatchOutcome validationResult = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        if (!validationResult.IsSuccess())
         {
-            return AZ::Failure(pathLookup.TakeError());
+            return validationResult;
         }
 
         rootElement[m_domPath] = GetValue();
@@ -520,19 +543,22 @@ namespace AZ::Dom
 
     PatchOutcome PatchOperation::ApplyCopy(Value& rootElement) const
     {
-        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
-        if (!sourceLookup.IsSuccess())
+        PatchOutcome sourceValidationResult = ValidatePath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
+        if (!sourceValidationResult.IsSuccess())
         {
-            return AZ::Failure(sourceLookup.TakeError());
+            return sourceValidationResult;
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray);
-        if (!destLookup.IsSuccess())
+        PatchOutcome destValidationResult = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray);
+        if (!destValidationResult.IsSuccess())
         {
-            return AZ::Failure(destLookup.TakeError());
+            return destValidationResult;
         }
 
-        rootElement[m_domPath] = rootElement[GetSourcePath()];
+        // The source is only read, copying it shares its contents rather than detaching the source path
+        const Value& constRootElement = rootElement;
+        Value valueToCopy = constRootElement[GetSourcePath()];
+        rootElement[m_domPath] = AZStd::move(valueToCopy);
         return AZ::Success();
     }
 
@@ -571,13 +597,14 @@ namespace AZ::Dom
 
     PatchOutcome PatchOperation::ApplyTest(Value& rootElement) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
-        if (!pathLookup.IsSuccess())
+        PatchOutcome validationResult = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        if (!validationResult.IsSuccess())
         {
-            return AZ::Failure(pathLookup.TakeError());
+            return validationResult;
         }
 
-        if (!Utils::DeepCompareIsEqual(rootElement[m_domPath], GetValue()))
+        const Value& constRootElement = rootElement;
+        if (!Utils::DeepCompareIsEqual(constRootElement[m_domPath], GetValue()))
         {
             return AZ::Failure<AZStd::string>("Test failed, values don't match");
         }
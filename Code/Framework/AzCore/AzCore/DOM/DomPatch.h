@@ -89,6 +89,12 @@ namespace AZ::Dom
             PathEntry m_key;
         };
 
+        //! Checks that path can be resolved against rootElement without mutating it.
+        //! Read-only lookups must go through this rather than LookupPath, as any mutable access detaches containers that are
+        //! shared with other Values (e.g. undo snapshots) along the path.
+        static PatchOutcome ValidatePath(
+            const Value& rootElement, const Path& path, ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck);
+        //! Validates path and returns a mutable reference to its parent, detaching only the containers along path.
         static AZ::Outcome<PathContext, AZStd::string> LookupPath(
             Value& rootElement, const Path& path, ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck);
 
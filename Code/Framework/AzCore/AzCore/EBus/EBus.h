@@ -186,6 +186,16 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Specifies whether queued events are stored in a lock-free queue.
+         * Each thread queues events into its own fixed-size slots, which avoids
+         * locking #EventQueueMutexType and allocating for each queued event.
+         * Events queued by one thread are executed in order, but events queued by
+         * different threads are not ordered relative to each other.
+         * Used only when #EnableEventQueue is true.
+         */
+        static constexpr bool LocklessEventQueue = false;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -497,7 +507,8 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = AZStd::conditional_t<Traits::EnableEventQueue && Traits::LocklessEventQueue,
+            EBusLocklessQueuePolicy<ThisType>, EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -1499,6 +1499,174 @@ namespace AZ
             typename HandlerStorage::StorageType m_handlers;
         };
 
+        // Specialization for single address, multiple handlers stored contiguously
+        template <typename Interface, typename Traits>
+        struct EBusContainer<Interface, Traits, EBusAddressPolicy::Single, EBusHandlerPolicy::MultipleContiguous>
+        {
+        public:
+            using ContainerType = EBusContainer;
+            using IdType = typename Traits::BusIdType;
+
+            using CallstackEntry = AZ::Internal::CallstackEntry<Interface, Traits>;
+
+            // This struct will hold the handlers per address
+            struct HandlerHolder;
+            // This struct will hold each handler
+            using HandlerNode = AZ::Internal::HandlerNode<Interface, Traits, HandlerHolder>;
+            // Handlers are stored in arrays grouped by type, disconnecting handlers mid-dispatch is handled by the storage
+            using HandlerStorage = HandlerStoragePolicy<Interface, Traits, HandlerNode>;
+            // No need for AddressStorage, there's only 1
+
+            struct BusPtr { };
+            using Handler = NonIdHandler<Interface, Traits, ContainerType>;
+
+            EBusContainer() = default;
+
+            // EBus will extend this class to gain the Event*/Broadcast* functions
+            template <typename Bus>
+            struct Dispatcher
+            {
+                // Broadcast family
+                template <typename Function, typename... ArgsT>
+                static void Broadcast(Function&& func, ArgsT&&... args)
+                {
+                    if (auto* context = Bus::GetContext())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DO_ROUTING(*context, nullptr, false, false);
+
+                        CallstackEntry entry(context, nullptr);
+                        context->m_buses.m_handlers.ForEach([&](Interface* handler)
+                        {
+                            // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
+                            // due to potential of multiple handlers of this EBus container invoking the function multiple times
+                            Traits::EventProcessingPolicy::Call(func, handler, args...);
+                            return true;
+                        });
+                    }
+                }
+                template <typename Results, typename Function, typename... ArgsT>
+                static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
+                {
+                    if (auto* context = Bus::GetContext())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DO_ROUTING(*context, nullptr, false, false);
+
+                        CallstackEntry entry(context, nullptr);
+                        context->m_buses.m_handlers.ForEach([&](Interface* handler)
+                        {
+                            Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                            return true;
+                        });
+                    }
+                }
+                template <typename Function, typename... ArgsT>
+                static void BroadcastReverse(Function&& func, ArgsT&&... args)
+                {
+                    if (auto* context = Bus::GetContext())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DO_ROUTING(*context, nullptr, false, true);
+
+                        CallstackEntry entry(context, nullptr);
+                        context->m_buses.m_handlers.ReverseForEach([&](Interface* handler)
+                        {
+                            Traits::EventProcessingPolicy::Call(func, handler, args...);
+                            return true;
+                        });
+                    }
+                }
+                template <typename Results, typename Function, typename... ArgsT>
+                static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
+                {
+                    if (auto* context = Bus::GetContext())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DO_ROUTING(*context, nullptr, false, true);
+
+                        CallstackEntry entry(context, nullptr);
+                        context->m_buses.m_handlers.ReverseForEach([&](Interface* handler)
+                        {
+                            Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                            return true;
+                        });
+                    }
+                }
+
+                /**
+                 * Dispatches an event once for every value in [first, last) to all handlers, taking the bus lock once.
+                 * Each handler receives the event for all values before the next handler receives any, so handlers
+                 * must not rely on other handlers having seen a value. Falls back to a Broadcast per value when
+                 * routers are connected to the bus.
+                 * @param func          Function pointer of the event to dispatch, called with the handler and a value.
+                 * @param first         Iterator to the first value.
+                 * @param last          Iterator past the last value.
+                 */
+                template <typename Function, typename InputIterator>
+                static void BroadcastBatch(Function&& func, InputIterator first, InputIterator last)
+                {
+                    if (auto* context = Bus::GetContext())
+                    {
+                        {
+                            typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                            if (!context->m_routing.m_routers.size())
+                            {
+                                CallstackEntry entry(context, nullptr);
+                                context->m_buses.m_handlers.ForEach([&](Interface* handler)
+                                {
+                                    for (InputIterator value = first; value != last; ++value)
+                                    {
+                                        Traits::EventProcessingPolicy::Call(func, handler, *value);
+                                    }
+                                    return true;
+                                });
+                                return;
+                            }
+                        }
+
+                        // Routers can intercept each event, so they have to see the values one at a time
+                        for (; first != last; ++first)
+                        {
+                            Broadcast(func, *first);
+                        }
+                    }
+                }
+
+                // Enumerate family
+                template <class Callback>
+                static void EnumerateHandlers(Callback&& callback)
+                {
+                    if (auto* context = Bus::GetContext())
+                    {
+                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+
+                        CallstackEntry entry(context, nullptr);
+                        context->m_buses.m_handlers.ForEach([&callback](Interface* handler)
+                        {
+                            bool result = false;
+                            Traits::EventProcessingPolicy::CallResult(result, callback, handler);
+                            return result;
+                        });
+                    }
+                }
+            };
+
+            void Connect(HandlerNode& handler, const IdType&)
+            {
+                // Don't need to check for duplicates here, because BusConnect would have caught it already
+                m_handlers.insert(handler);
+            }
+
+            void Disconnect(HandlerNode& handler)
+            {
+                // Don't need to check that handler is already connected here, because BusDisconnect would have caught it already
+                m_handlers.erase(handler);
+            }
+
+            typename HandlerStorage::StorageType m_handlers;
+        };
+
         // Specialization for single address, single handler
         template <typename Interface, typename Traits>
         struct EBusContainer<Interface, Traits, EBusAddressPolicy::Single, EBusHandlerPolicy::Single>
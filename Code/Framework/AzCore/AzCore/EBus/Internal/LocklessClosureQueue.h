@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/Internal/Debug.h>
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Multiple producer, single consumer queue of closures, used by EBusLocklessQueuePolicy.
+         * Every thread that enqueues closures gets its own chain of blocks of fixed-size closure slots, so enqueuing never
+         * takes a lock and only allocates when all blocks of the thread are still waiting to be executed. A producer recycles
+         * its blocks once the consumer has executed all closures in them. Closures that don't fit in a slot are moved to the heap.
+         * Closures are executed in the order they were enqueued by each thread, there's no order between threads.
+         * \tparam Allocator    Allocator for the blocks and the closures that don't fit in a slot.
+         * \tparam Tag          Gives each user of the queue, usually an EBus, its own cache of the producer of each thread.
+         */
+        template <class Allocator, class Tag>
+        class LocklessClosureQueue
+        {
+        public:
+            static constexpr size_t SlotSize = 128;
+            static constexpr size_t SlotsPerBlock = 64;
+
+            LocklessClosureQueue() = default;
+            ~LocklessClosureQueue();
+
+            LocklessClosureQueue(const LocklessClosureQueue&) = delete;
+            LocklessClosureQueue& operator=(const LocklessClosureQueue&) = delete;
+
+            //! Adds a closure to the queue of the calling thread. Can be called from any number of threads at once.
+            template <class Function>
+            void Enqueue(Function&& function);
+
+            //! Executes and destroys all closures that were enqueued before the call.
+            //! Closures enqueued by the executed closures are executed by the next call.
+            void Execute();
+
+            //! Destroys all closures that were enqueued before the call without executing them.
+            void Clear();
+
+            //! Returns the number of closures that weren't executed yet.
+            size_t Count() const;
+
+        private:
+            class Slot
+            {
+            public:
+                template <class Function>
+                void Construct(Function&& function);
+
+                void Execute()
+                {
+                    m_call(m_storage, true);
+                }
+
+                void Destroy()
+                {
+                    m_call(m_storage, false);
+                }
+
+            private:
+                // Calls the closure if execute is true, then destroys it
+                using CallFunction = void(*)(void* storage, bool execute);
+
+                CallFunction m_call = nullptr;
+                alignas(16) unsigned char m_storage[SlotSize - 16];
+            };
+            static_assert(sizeof(Slot) == SlotSize, "Slots are expected to be exactly SlotSize bytes");
+
+            struct Block
+            {
+                Slot m_slots[SlotsPerBlock];
+                Block* m_next = nullptr;
+            };
+
+            // The queue of a single thread. The counts are the total number of closures that passed through the queue, slot
+            // N is in the block starting at the closest multiple of SlotsPerBlock below N.
+            struct Producer
+            {
+                // Only accessed by the producing thread.
+                AZStd::thread_id m_threadId;
+                Block* m_firstBlock = nullptr; // Oldest block, recycled once the consumer moved past it
+                uint64_t m_firstBlockStart = 0;
+                Block* m_writeBlock = nullptr;
+                uint64_t m_writeBlockStart = 0;
+                uint64_t m_writeCount = 0;
+                Producer* m_next = nullptr; // Never changes after the producer is registered
+                AZStd::atomic<uint64_t> m_enqueuedCount{ 0 };
+
+                // Only accessed by the consumer, on its own cache line so producing and consuming don't contend.
+                alignas(64) Block* m_readBlock = nullptr;
+                uint64_t m_readBlockStart = 0;
+                uint64_t m_readCount = 0;
+                // Published once the consumer no longer touches the slots below it
+                AZStd::atomic<uint64_t> m_releasedCount{ 0 };
+            };
+
+            // Caches the producer of the calling thread, tagged with the queue it belongs to
+            struct ProducerCache
+            {
+                const LocklessClosureQueue* m_queue;
+                uint64_t m_queueId;
+                Producer* m_producer;
+            };
+
+            Producer& GetProducer();
+            void AppendBlock(Producer& producer);
+            Block* AllocateBlock();
+
+            template <bool ExecuteClosures>
+            void Consume();
+
+            static uint64_t GenerateQueueId()
+            {
+                static AZStd::atomic<uint64_t> s_nextQueueId{ 1 };
+                return s_nextQueueId.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+
+            static AZ_THREAD_LOCAL ProducerCache s_producerCache;
+
+            const uint64_t m_queueId = GenerateQueueId();
+            AZStd::atomic<Producer*> m_producers{ nullptr };
+            // Consuming is rare compared to enqueuing, a lock keeps Execute and Clear from different threads apart.
+            // It's recursive so executed closures can execute or clear the queue.
+            AZStd::recursive_mutex m_consumerMutex;
+            uint32_t m_consumerDepth = 0;
+        };
+
+        template <class Allocator, class Tag>
+        AZ_THREAD_LOCAL typename LocklessClosureQueue<Allocator, Tag>::ProducerCache LocklessClosureQueue<Allocator, Tag>::s_producerCache = { nullptr, 0, nullptr };
+
+        template <class Allocator, class Tag>
+        template <class Function>
+        void LocklessClosureQueue<Allocator, Tag>::Slot::Construct(Function&& function)
+        {
+            using Closure = AZStd::decay_t<Function>;
+            if constexpr (sizeof(Closure) <= sizeof(m_storage) && alignof(Closure) <= 16)
+            {
+                new (m_storage) Closure(AZStd::forward<Function>(function));
+                m_call = [](void* storage, bool execute)
+                {
+                    Closure* closure = static_cast<Closure*>(storage);
+                    if (execute)
+                    {
+                        (*closure)();
+                    }
+                    closure->~Closure();
+                };
+            }
+            else
+            {
+                void* memory = Allocator().allocate(sizeof(Closure), alignof(Closure));
+                new (m_storage) Closure*(new (memory) Closure(AZStd::forward<Function>(function)));
+                m_call = [](void* storage, bool execute)
+                {
+                    Closure* closure = *static_cast<Closure**>(storage);
+                    if (execute)
+                    {
+                        (*closure)();
+                    }
+                    closure->~Closure();
+                    Allocator().deallocate(closure, sizeof(Closure), alignof(Closure));
+                };
+            }
+        }
+
+        template <class Allocator, class Tag>
+        LocklessClosureQueue<Allocator, Tag>::~LocklessClosureQueue()
+        {
+            Clear();
+
+            Producer* producer = m_producers.load(AZStd::memory_order_acquire);
+            while (producer)
+            {
+                Block* block = producer->m_firstBlock;
+                while (block)
+                {
+                    Block* next = block->m_next;
+                    block->~Block();
+                    Allocator().deallocate(block, sizeof(Block), alignof(Block));
+                    block = next;
+                }
+
+                Producer* next = producer->m_next;
+                producer->~Producer();
+                Allocator().deallocate(producer, sizeof(Producer), alignof(Producer));
+                producer = next;
+            }
+
+            if (s_producerCache.m_queue == this)
+            {
+                s_producerCache = { nullptr, 0, nullptr };
+            }
+        }
+
+        template <class Allocator, class Tag>
+        template <class Function>
+        void LocklessClosureQueue<Allocator, Tag>::Enqueue(Function&& function)
+        {
+            Producer& producer = GetProducer();
+            if (producer.m_writeCount == producer.m_writeBlockStart + SlotsPerBlock)
+            {
+                AppendBlock(producer);
+            }
+
+            producer.m_writeBlock->m_slots[producer.m_writeCount - producer.m_writeBlockStart].Construct(AZStd::forward<Function>(function));
+            ++producer.m_writeCount;
+            producer.m_enqueuedCount.store(producer.m_writeCount, AZStd::memory_order_release);
+        }
+
+        template <class Allocator, class Tag>
+        void LocklessClosureQueue<Allocator, Tag>::Execute()
+        {
+            Consume<true>();
+        }
+
+        template <class Allocator, class Tag>
+        void LocklessClosureQueue<Allocator, Tag>::Clear()
+        {
+            Consume<false>();
+        }
+
+        template <class Allocator, class Tag>
+        size_t LocklessClosureQueue<Allocator, Tag>::Count() const
+        {
+            size_t count = 0;
+            for (Producer* producer = m_producers.load(AZStd::memory_order_acquire); producer; producer = producer->m_next)
+            {
+                // Released first, as it never passes the number of enqueued closures at any later point
+                const uint64_t releasedCount = producer->m_releasedCount.load(AZStd::memory_order_acquire);
+                count += static_cast<size_t>(producer->m_enqueuedCount.load(AZStd::memory_order_acquire) - releasedCount);
+            }
+            return count;
+        }
+
+        template <class Allocator, class Tag>
+        auto LocklessClosureQueue<Allocator, Tag>::GetProducer() -> Producer&
+        {
+            ProducerCache& cache = s_producerCache;
+            if (cache.m_queue == this && cache.m_queueId == m_queueId)
+            {
+                return *cache.m_producer;
+            }
+
+            // The cache is per module, so other modules may have registered a producer for this thread already.
+            // Producers are only ever added at the front, so the list can be walked without a lock.
+            const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+            Producer* head = m_producers.load(AZStd::memory_order_acquire);
+            Producer* producer = head;
+            while (producer && producer->m_threadId != threadId)
+            {
+                producer = producer->m_next;
+            }
+
+            if (!producer)
+            {
+                producer = new (Allocator().allocate(sizeof(Producer), alignof(Producer))) Producer();
+                producer->m_threadId = threadId;
+                producer->m_firstBlock = AllocateBlock();
+                producer->m_writeBlock = producer->m_firstBlock;
+                producer->m_readBlock = producer->m_firstBlock;
+                producer->m_next = head;
+                while (!m_producers.compare_exchange_weak(producer->m_next, producer, AZStd::memory_order_release, AZStd::memory_order_relaxed))
+                {
+                }
+            }
+
+            cache = { this, m_queueId, producer };
+            return *producer;
+        }
+
+        template <class Allocator, class Tag>
+        void LocklessClosureQueue<Allocator, Tag>::AppendBlock(Producer& producer)
+        {
+            Block* block = nullptr;
+            // The consumer reads a slot of the next block before it's done with the previous one, so the first block can only
+            // be recycled once the consumer released a slot past it.
+            if (producer.m_releasedCount.load(AZStd::memory_order_acquire) > producer.m_firstBlockStart + SlotsPerBlock)
+            {
+                block = producer.m_firstBlock;
+                producer.m_firstBlock = block->m_next;
+                producer.m_firstBlockStart += SlotsPerBlock;
+                block->m_next = nullptr;
+            }
+            else
+            {
+                block = AllocateBlock();
+            }
+
+            // The consumer only follows m_next after it saw a closure in the new block, which is published after this.
+            producer.m_writeBlock->m_next = block;
+            producer.m_writeBlock = block;
+            producer.m_writeBlockStart += SlotsPerBlock;
+        }
+
+        template <class Allocator, class Tag>
+        auto LocklessClosureQueue<Allocator, Tag>::AllocateBlock() -> Block*
+        {
+            return new (Allocator().allocate(sizeof(Block), alignof(Block))) Block();
+        }
+
+        template <class Allocator, class Tag>
+        template <bool ExecuteClosures>
+        void LocklessClosureQueue<Allocator, Tag>::Consume()
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_consumerMutex);
+            ++m_consumerDepth;
+
+            for (Producer* producer = m_producers.load(AZStd::memory_order_acquire); producer; producer = producer->m_next)
+            {
+                const uint64_t enqueuedCount = producer->m_enqueuedCount.load(AZStd::memory_order_acquire);
+                while (producer->m_readCount < enqueuedCount)
+                {
+                    if (producer->m_readCount == producer->m_readBlockStart + SlotsPerBlock)
+                    {
+                        producer->m_readBlock = producer->m_readBlock->m_next;
+                        producer->m_readBlockStart += SlotsPerBlock;
+                    }
+
+                    // Move past the slot first, so executing or clearing the queue from inside the closure skips it.
+                    Slot& slot = producer->m_readBlock->m_slots[producer->m_readCount - producer->m_readBlockStart];
+                    ++producer->m_readCount;
+                    if constexpr (ExecuteClosures)
+                    {
+                        slot.Execute();
+                    }
+                    else
+                    {
+                        slot.Destroy();
+                    }
+                }
+            }
+
+            // Only the outermost call releases the slots, as the outer calls may still be executing closures in them.
+            if (--m_consumerDepth == 0)
+            {
+                for (Producer* producer = m_producers.load(AZStd::memory_order_acquire); producer; producer = producer->m_next)
+                {
+                    producer->m_releasedCount.store(producer->m_readCount, AZStd::memory_order_release);
+                }
+            }
+        }
+    } // namespace Internal
+} // namespace AZ
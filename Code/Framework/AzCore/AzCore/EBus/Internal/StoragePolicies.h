@@ -15,6 +15,8 @@
 #include <AzCore/std/containers/rbtree.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -174,6 +176,203 @@ namespace AZ
             using StorageType = AZStd::intrusive_multiset<Handler, AZStd::intrusive_multiset_base_hook<Handler>, Compare>;
         };
 
+        // Contiguous
+        template <typename Interface, typename Traits, typename Handler>
+        struct HandlerStoragePolicy<Interface, Traits, Handler, EBusHandlerPolicy::MultipleContiguous>
+        {
+            static_assert(Traits::AddressPolicy == EBusAddressPolicy::Single, "EBusHandlerPolicy::MultipleContiguous is only supported on buses with a single address");
+            static_assert(AZStd::is_polymorphic<Interface>::value, "EBusHandlerPolicy::MultipleContiguous groups handlers by their virtual table and requires a polymorphic interface");
+
+        public:
+            /**
+             * Stores the handlers in one array per handler type, in the order in which the types first connected.
+             * The handler type is identified by the virtual table of the interface, which is read when the handler connects.
+             * Handlers disconnecting in the middle of a dispatch leave an empty slot behind that is removed once the
+             * outermost dispatch ends, so the indices the dispatch iterates over remain valid.
+             */
+            class StorageType
+            {
+                using HandlerArray = AZStd::vector<Interface*, typename Traits::AllocatorType>;
+                using NodeArray = AZStd::vector<Handler*, typename Traits::AllocatorType>;
+
+                struct Group
+                {
+                    const void* m_type = nullptr;
+                    HandlerArray m_handlers;
+                    NodeArray m_nodes;
+                };
+
+            public:
+                void insert(Handler& elem)
+                {
+                    const void* type = GetHandlerType(elem.m_interface);
+                    size_t groupIndex = 0;
+                    while (groupIndex < m_groups.size() && m_groups[groupIndex].m_type != type)
+                    {
+                        ++groupIndex;
+                    }
+                    if (groupIndex == m_groups.size())
+                    {
+                        m_groups.emplace_back().m_type = type;
+                    }
+
+                    Group& group = m_groups[groupIndex];
+                    elem.m_groupIndex = static_cast<uint32_t>(groupIndex);
+                    elem.m_handlerIndex = static_cast<uint32_t>(group.m_handlers.size());
+                    group.m_handlers.push_back(elem.m_interface);
+                    group.m_nodes.push_back(&elem);
+                    ++m_size;
+                }
+
+                void erase(Handler& elem)
+                {
+                    Group& group = m_groups[elem.m_groupIndex];
+                    const size_t handlerIndex = elem.m_handlerIndex;
+                    EBUS_ASSERT(handlerIndex < group.m_nodes.size() && group.m_nodes[handlerIndex] == &elem, "Internal error: handler is not stored at its recorded index!");
+                    --m_size;
+
+                    if (m_dispatchDepth.load(AZStd::memory_order_relaxed) > 0)
+                    {
+                        // Leave the slot in place so the indices of the dispatch in progress stay valid.
+                        group.m_handlers[handlerIndex] = nullptr;
+                        group.m_nodes[handlerIndex] = nullptr;
+                        m_hasEmptySlots = true;
+                        return;
+                    }
+
+                    const size_t lastIndex = group.m_nodes.size() - 1;
+                    if (handlerIndex != lastIndex)
+                    {
+                        group.m_handlers[handlerIndex] = group.m_handlers[lastIndex];
+                        group.m_nodes[handlerIndex] = group.m_nodes[lastIndex];
+                        group.m_nodes[handlerIndex]->m_handlerIndex = static_cast<uint32_t>(handlerIndex);
+                    }
+                    group.m_handlers.pop_back();
+                    group.m_nodes.pop_back();
+                }
+
+                bool empty() const
+                {
+                    return m_size == 0;
+                }
+
+                size_t size() const
+                {
+                    return m_size;
+                }
+
+                /**
+                 * Calls callback with the Interface* of every handler until it returns false.
+                 * Handlers that connect during the enumeration are not visited, handlers that disconnect are skipped.
+                 * @return False if the enumeration was stopped by the callback.
+                 */
+                template <typename Callback>
+                bool ForEach(Callback&& callback)
+                {
+                    DispatchScope scope(*this);
+                    const size_t groupCount = m_groups.size();
+                    for (size_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+                    {
+                        // Handlers may connect from inside the callback and grow the arrays, so they're accessed by index.
+                        const size_t handlerCount = m_groups[groupIndex].m_handlers.size();
+                        for (size_t handlerIndex = 0; handlerIndex < handlerCount; ++handlerIndex)
+                        {
+                            if (Interface* handler = m_groups[groupIndex].m_handlers[handlerIndex])
+                            {
+                                if (!callback(handler))
+                                {
+                                    return false;
+                                }
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+                //! Same as ForEach, but visits the handlers in the opposite order.
+                template <typename Callback>
+                bool ReverseForEach(Callback&& callback)
+                {
+                    DispatchScope scope(*this);
+                    for (size_t groupIndex = m_groups.size(); groupIndex-- > 0;)
+                    {
+                        for (size_t handlerIndex = m_groups[groupIndex].m_handlers.size(); handlerIndex-- > 0;)
+                        {
+                            if (Interface* handler = m_groups[groupIndex].m_handlers[handlerIndex])
+                            {
+                                if (!callback(handler))
+                                {
+                                    return false;
+                                }
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+            private:
+                // Tracks the dispatches iterating over the handlers. This is atomic because buses with a shared dispatch
+                // mutex dispatch from multiple threads at once, but handlers can only disconnect mid-dispatch while the
+                // dispatch lock is held exclusively, so the empty slots are never removed while another thread iterates.
+                class DispatchScope
+                {
+                public:
+                    explicit DispatchScope(StorageType& storage)
+                        : m_storage(storage)
+                    {
+                        m_storage.m_dispatchDepth.fetch_add(1, AZStd::memory_order_relaxed);
+                    }
+
+                    ~DispatchScope()
+                    {
+                        if (m_storage.m_dispatchDepth.fetch_sub(1, AZStd::memory_order_relaxed) == 1 && m_storage.m_hasEmptySlots)
+                        {
+                            m_storage.RemoveEmptySlots();
+                        }
+                    }
+
+                    DispatchScope(const DispatchScope&) = delete;
+                    DispatchScope& operator=(const DispatchScope&) = delete;
+
+                private:
+                    StorageType& m_storage;
+                };
+
+                static const void* GetHandlerType(const Interface* handler)
+                {
+                    // Handlers of the same type share a virtual table, which is the first member of a polymorphic object
+                    // on all supported platforms. Any other value only makes the grouping less effective.
+                    return *reinterpret_cast<const void* const*>(handler);
+                }
+
+                void RemoveEmptySlots()
+                {
+                    m_hasEmptySlots = false;
+                    for (Group& group : m_groups)
+                    {
+                        size_t writeIndex = 0;
+                        for (size_t readIndex = 0; readIndex < group.m_nodes.size(); ++readIndex)
+                        {
+                            if (Handler* node = group.m_nodes[readIndex])
+                            {
+                                group.m_handlers[writeIndex] = group.m_handlers[readIndex];
+                                group.m_nodes[writeIndex] = node;
+                                node->m_handlerIndex = static_cast<uint32_t>(writeIndex);
+                                ++writeIndex;
+                            }
+                        }
+                        group.m_handlers.resize(writeIndex);
+                        group.m_nodes.resize(writeIndex);
+                    }
+                }
+
+                AZStd::vector<Group, typename Traits::AllocatorType> m_groups;
+                size_t m_size = 0;
+                AZStd::atomic_uint m_dispatchDepth{ 0 };
+                bool m_hasEmptySlots = false;
+            };
+        };
+
         // Param Handler to HandlerStoragePolicy is expected to inherit from this type.
         template <typename Handler, EBusHandlerPolicy>
         struct HandlerStorageNode
@@ -189,5 +388,12 @@ namespace AZ
             : public AZStd::intrusive_multiset_node<Handler>
         {
         };
+        template <typename Handler>
+        struct HandlerStorageNode<Handler, EBusHandlerPolicy::MultipleContiguous>
+        {
+            // Location of the handler in HandlerStoragePolicy<..., EBusHandlerPolicy::MultipleContiguous>::StorageType
+            uint32_t m_groupIndex = 0;
+            uint32_t m_handlerIndex = 0;
+        };
     } // namespace Internal
 } // namespace AZ
@@ -19,6 +19,7 @@
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/EBus/Internal/LocklessClosureQueue.h>
 
 
 namespace AZ
@@ -80,6 +81,18 @@ namespace AZ
          * by AZ::EBusTraits::BusHandlerOrderCompare.
          */
         MultipleAndOrdered,
+
+        /**
+         * Allows any number of handlers on an EBus with a single address;
+         * handlers are stored in contiguous arrays grouped by the type of
+         * the handler, so broadcasting walks memory linearly and calls the
+         * same virtual function implementation back to back. Handlers of
+         * one type receive events together, in an unspecified order.
+         * Adds AZ::EBus::BroadcastBatch to send one event for a range of
+         * values while taking the bus lock once.
+         * Only supported with AZ::EBusAddressPolicy::Single.
+         */
+        MultipleContiguous,
     };
 
     namespace Internal
@@ -247,6 +260,14 @@ namespace AZ
         MessageQueueType            m_messages;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
+        template <class Function>
+        void Enqueue(Function&& function)
+        {
+            BusMessageCall message(AZStd::forward<Function>(function), typename Bus::AllocatorType());
+            AZStd::scoped_lock lock(m_messagesMutex);
+            m_messages.push(AZStd::move(message));
+        }
+
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
@@ -296,6 +317,58 @@ namespace AZ
         }
     };
 
+    /**
+     * Event queue used when EBusTraits::LocklessEventQueue is true.
+     * Queued events are stored in fixed-size slots in per-thread blocks that are recycled once executed,
+     * so queueing doesn't lock or allocate. Events queued by different threads aren't ordered.
+     */
+    template <class Bus>
+    struct EBusLocklessQueuePolicy
+    {
+        typedef AZStd::function<void()> BusMessageCall;
+
+        EBusLocklessQueuePolicy() = default;
+
+        AZStd::atomic_bool          m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        AZ::Internal::LocklessClosureQueue<typename Bus::AllocatorType, Bus> m_messages;
+
+        template <class Function>
+        void Enqueue(Function&& function)
+        {
+            m_messages.Enqueue(AZStd::forward<Function>(function));
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+            m_messages.Execute();
+        }
+
+        void Clear()
+        {
+            m_messages.Clear();
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive = isActive;
+            if (!isActive)
+            {
+                m_messages.Clear();
+            }
+        }
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        size_t Count()
+        {
+            return m_messages.Count();
+        }
+    };
+
     /// @endcond
 
     ////////////////////////////////////////////////////////////
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionSeekTable.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ::IO
+{
+    namespace CompressionSeekTableInternal
+    {
+        // The seekable format is always stored in little endian.
+        static u32 ReadU32(const u8* data)
+        {
+            return static_cast<u32>(data[0]) | (static_cast<u32>(data[1]) << 8) |
+                (static_cast<u32>(data[2]) << 16) | (static_cast<u32>(data[3]) << 24);
+        }
+
+        static u8* WriteU32(u8* data, u32 value)
+        {
+            data[0] = static_cast<u8>(value);
+            data[1] = static_cast<u8>(value >> 8);
+            data[2] = static_cast<u8>(value >> 16);
+            data[3] = static_cast<u8>(value >> 24);
+            return data + 4;
+        }
+
+        static constexpr u8 ChecksumFlag = 1 << 7;
+        static constexpr u8 ReservedBits = 0x7C;
+        static constexpr size_t EntrySize = 8;
+        static constexpr size_t EntryWithChecksumSize = 12;
+    } // namespace CompressionSeekTableInternal
+
+    size_t CompressionSeekTable::GetTableSize(const void* footer)
+    {
+        using namespace CompressionSeekTableInternal;
+
+        const u8* data = reinterpret_cast<const u8*>(footer);
+        u32 numBlocks = ReadU32(data);
+        u8 descriptor = data[4];
+        if (ReadU32(data + 5) != SeekableMagic || (descriptor & ReservedBits) != 0)
+        {
+            return 0;
+        }
+        size_t entrySize = (descriptor & ChecksumFlag) ? EntryWithChecksumSize : EntrySize;
+        return FrameHeaderSize + (aznumeric_cast<size_t>(numBlocks) * entrySize) + FooterSize;
+    }
+
+    void CompressionSeekTable::AddBlock(u32 compressedSize, u32 uncompressedSize)
+    {
+        const Block& end = m_blocks.back();
+        m_blocks.push_back(Block{ end.m_compressedOffset + compressedSize, end.m_uncompressedOffset + uncompressedSize });
+    }
+
+    bool CompressionSeekTable::Load(const void* table, size_t tableSize, u64 compressedSize, u64 uncompressedSize)
+    {
+        using namespace CompressionSeekTableInternal;
+
+        if (tableSize < FrameHeaderSize + FooterSize || tableSize > compressedSize)
+        {
+            return false;
+        }
+
+        const u8* data = reinterpret_cast<const u8*>(table);
+        const u8* footer = data + tableSize - FooterSize;
+        if (GetTableSize(footer) != tableSize || ReadU32(data) != SkippableFrameMagic ||
+            ReadU32(data + 4) != tableSize - FrameHeaderSize)
+        {
+            return false;
+        }
+
+        size_t entrySize = (footer[4] & ChecksumFlag) ? EntryWithChecksumSize : EntrySize;
+        u32 numBlocks = ReadU32(footer);
+
+        AZStd::vector<Block> blocks;
+        blocks.reserve(numBlocks + 1);
+        blocks.push_back(Block{ 0, 0 });
+        const u8* entry = data + FrameHeaderSize;
+        for (u32 i = 0; i < numBlocks; ++i, entry += entrySize)
+        {
+            const Block& end = blocks.back();
+            blocks.push_back(Block{ end.m_compressedOffset + ReadU32(entry), end.m_uncompressedOffset + ReadU32(entry + 4) });
+        }
+
+        // The blocks have to exactly cover the compressed data in front of the table and the entire uncompressed file.
+        if (blocks.back().m_compressedOffset + tableSize != compressedSize || blocks.back().m_uncompressedOffset != uncompressedSize)
+        {
+            return false;
+        }
+
+        m_blocks = AZStd::move(blocks);
+        return true;
+    }
+
+    size_t CompressionSeekTable::GetStoredSize() const
+    {
+        return FrameHeaderSize + (GetNumBlocks() * CompressionSeekTableInternal::EntrySize) + FooterSize;
+    }
+
+    size_t CompressionSeekTable::Store(void* output, size_t outputSize) const
+    {
+        using namespace CompressionSeekTableInternal;
+
+        size_t tableSize = GetStoredSize();
+        if (outputSize < tableSize)
+        {
+            return 0;
+        }
+
+        u8* data = reinterpret_cast<u8*>(output);
+        data = WriteU32(data, SkippableFrameMagic);
+        data = WriteU32(data, aznumeric_cast<u32>(tableSize - FrameHeaderSize));
+        for (size_t i = 0; i < GetNumBlocks(); ++i)
+        {
+            data = WriteU32(data, aznumeric_cast<u32>(m_blocks[i + 1].m_compressedOffset - m_blocks[i].m_compressedOffset));
+            data = WriteU32(data, aznumeric_cast<u32>(m_blocks[i + 1].m_uncompressedOffset - m_blocks[i].m_uncompressedOffset));
+        }
+        data = WriteU32(data, aznumeric_cast<u32>(GetNumBlocks()));
+        *data++ = 0; // No checksums are stored.
+        WriteU32(data, SeekableMagic);
+        return tableSize;
+    }
+
+    size_t CompressionSeekTable::GetNumBlocks() const
+    {
+        return m_blocks.size() - 1;
+    }
+
+    size_t CompressionSeekTable::FindBlock(u64 uncompressedOffset) const
+    {
+        auto it = AZStd::upper_bound(m_blocks.begin(), m_blocks.end() - 1, uncompressedOffset,
+            [](u64 offset, const Block& block)
+            {
+                return offset < block.m_uncompressedOffset;
+            });
+        size_t index = AZStd::distance(m_blocks.begin(), it);
+        return index > 0 ? index - 1 : 0;
+    }
+
+    const CompressionSeekTable::Block& CompressionSeekTable::GetBlock(size_t index) const
+    {
+        AZ_Assert(index < m_blocks.size(), "Block index %zu is out of range for a seek table with %zu blocks.", index, GetNumBlocks());
+        return m_blocks[index];
+    }
+} // namespace AZ::IO
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    //! Table with the location of independently compressed blocks in a compressed file, which allows a file to be decompressed
+    //! in parallel and ranges in the file to be decompressed without decompressing the entire file.
+    //! The table is stored at the end of the compressed data using the layout of the zstd seekable format:
+    //! https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+    //! The table is stored in a skippable frame so decompressors that don't know about the table can still decompress the
+    //! entire file in one go.
+    class CompressionSeekTable
+    {
+    public:
+        //! Size of the footer at the very end of the seek table.
+        static constexpr size_t FooterSize = 9;
+        //! Size of the skippable frame header at the start of the seek table.
+        static constexpr size_t FrameHeaderSize = 8;
+        static constexpr u32 SkippableFrameMagic = 0x184D2A5E;
+        static constexpr u32 SeekableMagic = 0x8F92EAB1;
+
+        struct Block
+        {
+            //! Offset of the block in the compressed data.
+            u64 m_compressedOffset;
+            //! Offset of the block in the uncompressed data.
+            u64 m_uncompressedOffset;
+        };
+
+        //! Returns the size of the entire seek table if the footer is a valid seek table footer, otherwise 0.
+        //! @param footer The last FooterSize bytes of the compressed data.
+        static size_t GetTableSize(const void* footer);
+
+        //! Adds a block to the end of the table.
+        void AddBlock(u32 compressedSize, u32 uncompressedSize);
+        //! Reads the blocks from a seek table that was stored at the end of compressed data.
+        //! @param table The seek table, which has to be GetTableSize bytes long.
+        //! @param compressedSize The size of the compressed data, including the seek table.
+        //! @param uncompressedSize The size of the data after decompression.
+        //! @return True if the table is valid and matches the sizes, otherwise false.
+        bool Load(const void* table, size_t tableSize, u64 compressedSize, u64 uncompressedSize);
+        //! Returns the number of bytes needed to store the table.
+        size_t GetStoredSize() const;
+        //! Writes the table to the output buffer, which needs to be at least GetStoredSize bytes.
+        //! @return The number of bytes written or 0 if the buffer is too small.
+        size_t Store(void* output, size_t outputSize) const;
+
+        size_t GetNumBlocks() const;
+        //! Returns the index of the block that contains the uncompressed offset. Offsets past the end return the last block.
+        size_t FindBlock(u64 uncompressedOffset) const;
+        //! Returns the start of the block. Using the number of blocks as index returns the end of the last block.
+        const Block& GetBlock(size_t index) const;
+
+    private:
+        //! Offsets of all blocks plus an additional entry that marks the end of the last block.
+        AZStd::vector<Block> m_blocks{ Block{ 0, 0 } };
+    };
+} // namespace AZ::IO
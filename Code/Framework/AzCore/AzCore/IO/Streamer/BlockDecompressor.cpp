@@ -0,0 +1,768 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> BlockDecompressorConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<BlockDecompressor>(m_maxNumReads, m_maxNumJobs,
+            aznumeric_caster(hardware.m_maxPhysicalSectorSize), aznumeric_cast<u64>(m_minSeekableSizeKib) * 1_kib, m_seekTableCacheSize);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void BlockDecompressorConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<BlockDecompressorConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxNumReads", &BlockDecompressorConfig::m_maxNumReads)
+                ->Field("MaxNumJobs", &BlockDecompressorConfig::m_maxNumJobs)
+                ->Field("MinSeekableSizeKib", &BlockDecompressorConfig::m_minSeekableSizeKib)
+                ->Field("SeekTableCacheSize", &BlockDecompressorConfig::m_seekTableCacheSize);
+        }
+    }
+
+    // The amount of data read from the end of a compressed file to find the seek table. Tables of files that have up to about
+    // 500 blocks fit in this, larger tables require a second read.
+    static constexpr u64 SeekTableProbeSize = 4_kib;
+
+    bool BlockDecompressor::SeekTableKey::operator==(const SeekTableKey& rhs) const
+    {
+        return m_archiveHash == rhs.m_archiveHash && m_offset == rhs.m_offset;
+    }
+
+    size_t BlockDecompressor::SeekTableKeyHasher::operator()(const SeekTableKey& key) const
+    {
+        size_t hash = key.m_archiveHash;
+        AZStd::hash_combine(hash, key.m_offset);
+        return hash;
+    }
+
+    BlockDecompressor::BlockDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u64 minSeekableSize, u32 seekTableCacheSize)
+        : StreamStackEntry("Block decompressor")
+        , m_minSeekableSize(minSeekableSize)
+        , m_seekTableCacheSize(seekTableCacheSize)
+        , m_maxNumReads(AZ::GetMax(maxNumReads, 1u))
+        , m_alignment(alignment)
+    {
+        u32 hardwareThreads = AZ::GetMax(AZStd::thread::hardware_concurrency(), 1u);
+        m_numDecompressionThreads = maxNumJobs == 0 ? hardwareThreads : AZ::GetMin(maxNumJobs, hardwareThreads);
+
+        JobManagerDesc jobDesc;
+        jobDesc.m_jobManagerName = "Block Decompressor";
+        for (u32 i = 0; i < m_numDecompressionThreads; ++i)
+        {
+            jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+        }
+        m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+        m_decompressionJobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
+
+        m_readSlots = AZStd::make_unique<ReadSlot[]>(m_maxNumReads);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_bytesDecompressed.PushEntry(1);
+        m_decompressionDurationMicroSec.PushEntry(1);
+        m_blocksPerRead.PushEntry(1);
+    }
+
+    void BlockDecompressor::PrepareRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadRequestData>)
+            {
+                PrepareReadRequest(request, args);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CreateDedicatedCacheData> ||
+                AZStd::is_same_v<Command, Requests::DestroyDedicatedCacheData>)
+            {
+                PrepareDedicatedCache(request, args.m_path);
+            }
+            else
+            {
+                StreamStackEntry::PrepareRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    void BlockDecompressor::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                m_pendingReads.push_back(request);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                m_pendingFileExistChecks.push_back(request);
+            }
+            else
+            {
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool BlockDecompressor::ExecuteRequests()
+    {
+        bool result = false;
+
+        // Queue as many new reads as possible. Requests for files that don't have a known seek table yet first read the
+        // seek table and are then put back at the front of the queue. Seek table reads take up a read slot as well, so the
+        // number of reads sent to the next entry never exceeds the maximum.
+        while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+        {
+            FileRequest* compressedRequest = m_pendingReads.front();
+            auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Request queued for reading in BlockDecompressor didn't contain compression read data.");
+
+            m_pendingReads.pop_front();
+            SeekTablePtr seekTable;
+            if (FindSeekTable(seekTable, data->m_compressionInfo))
+            {
+                StartArchiveRead(compressedRequest, AZStd::move(seekTable));
+            }
+            else
+            {
+                ++m_numSeekTableMisses;
+                StartSeekTableRead(compressedRequest, AZStd::min(SeekTableProbeSize, aznumeric_cast<u64>(data->m_compressionInfo.m_compressedSize)));
+            }
+            result = true;
+        }
+
+        // If nothing else happened and there is at least one pending file exist check request, run one of those.
+        if (!result && !m_pendingFileExistChecks.empty())
+        {
+            FileExistsCheck(m_pendingFileExistChecks.front());
+            m_pendingFileExistChecks.pop_front();
+            result = true;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || result;
+    }
+
+    void BlockDecompressor::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
+        status.m_isIdle = status.m_isIdle && IsIdle();
+    }
+
+    void BlockDecompressor::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        // Create predictions for all pending requests. Some will be further processed after this.
+        AZStd::reverse_copy(m_pendingFileExistChecks.begin(), m_pendingFileExistChecks.end(), AZStd::back_inserter(internalPending));
+        AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        // The recorded durations are the wall time it took to decompress all blocks of a read, so they already include the
+        // benefit of decompressing blocks in parallel.
+        auto highResolutionNow = AZStd::chrono::high_resolution_clock::now();
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            const ReadSlot& slot = m_readSlots[i];
+            AZStd::chrono::microseconds decompressionDuration = EstimateDecompressionDuration(slot.m_compressedSize);
+            switch (slot.m_status)
+            {
+            case ReadSlotStatus::Unused:
+                break;
+            case ReadSlotStatus::ReadInFlight:
+            {
+                // Internal read requests can start and complete but pending finalization before they're ever scheduled in which case
+                // the estimated time is not set.
+                AZStd::chrono::system_clock::time_point baseTime = slot.m_request->GetEstimatedCompletion();
+                if (baseTime == AZStd::chrono::system_clock::time_point())
+                {
+                    baseTime = now;
+                }
+                slot.m_request->SetEstimatedCompletion(baseTime + decompressionDuration);
+                break;
+            }
+            case ReadSlotStatus::Decompressing:
+            {
+                auto timeInProcessing = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(highResolutionNow - slot.m_queueStartTime);
+                auto timeLeft = decompressionDuration > timeInProcessing ? decompressionDuration - timeInProcessing : AZStd::chrono::microseconds(0);
+                slot.m_request->SetEstimatedCompletion(now + timeLeft);
+                break;
+            }
+            default:
+                AZ_Assert(false, "Unsupported read slot status: %i.", slot.m_status);
+                break;
+            }
+        }
+
+        // For all compressed reads add the decompression time. The read time will have already been added downstream.
+        auto addDecompressionTime = [this](FileRequest* request)
+        {
+            if (auto data = AZStd::get_if<Requests::CompressedReadData>(&request->GetCommand()); data != nullptr)
+            {
+                request->SetEstimatedCompletion(request->GetEstimatedCompletion() +
+                    EstimateDecompressionDuration(data->m_compressionInfo.m_compressedSize));
+            }
+        };
+        AZStd::for_each(internalPending.rbegin(), internalPending.rend(), addDecompressionTime);
+        AZStd::for_each(pendingBegin, pendingEnd, addDecompressionTime);
+    }
+
+    void BlockDecompressor::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+        constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+
+        if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+        {
+            // It only makes sense to add decompression statistics when reading from PAK files.
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available read slots", m_maxNumReads - m_numInFlightReads));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Decompressing", m_numDecompressing));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Buffer memory (MB)", m_memoryUsage * bytesToMB));
+
+            double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
+            double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+            statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per read (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Blocks per read (avg.)", m_blocksPerRead.CalculateAverage()));
+
+            size_t seekTableLookups = m_numSeekTableHits + m_numSeekTableMisses;
+            if (seekTableLookups > 0)
+            {
+                statistics.push_back(Statistic::CreatePercentage(m_name, "Seek table cache hits",
+                    aznumeric_cast<double>(m_numSeekTableHits) / aznumeric_cast<double>(seekTableLookups)));
+            }
+        }
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool BlockDecompressor::IsIdle() const
+    {
+        return
+            m_pendingReads.empty() &&
+            m_pendingFileExistChecks.empty() &&
+            m_seekTableReads.empty() &&
+            m_numInFlightReads == 0;
+    }
+
+    void BlockDecompressor::PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data)
+    {
+        CompressionInfo info;
+        if (CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
+        {
+            FileRequest* nextRequest = m_context->GetNewInternalRequest();
+            if (info.m_isCompressed)
+            {
+                AZ_Assert(info.m_decompressor,
+                    "BlockDecompressor::PrepareRequest found a compressed file, but no decompressor to decompress with.");
+                nextRequest->CreateCompressedRead(request, AZStd::move(info), data.m_output, data.m_offset, data.m_size);
+            }
+            else
+            {
+                FileRequest* pathStorageRequest = m_context->GetNewInternalRequest();
+                pathStorageRequest->CreateRequestPathStore(request, AZStd::move(info.m_archiveFilename));
+                auto& pathStorage = AZStd::get<Requests::RequestPathStoreData>(pathStorageRequest->GetCommand());
+
+                nextRequest->CreateRead(pathStorageRequest, data.m_output, data.m_outputSize, pathStorage.m_path,
+                    info.m_offset + data.m_offset, data.m_size, info.m_isSharedPak);
+            }
+
+            if (info.m_conflictResolution == ConflictResolution::PreferFile)
+            {
+                auto callback = [this, nextRequest](const FileRequest& checkRequest)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    auto check = AZStd::get_if<Requests::FileExistsCheckData>(&checkRequest.GetCommand());
+                    AZ_Assert(check,
+                        "Callback in BlockDecompressor::PrepareReadRequest expected FileExistsCheck but got another command.");
+                    if (check->m_found)
+                    {
+                        FileRequest* originalRequest = m_context->RejectRequest(nextRequest);
+                        if (AZStd::holds_alternative<Requests::RequestPathStoreData>(originalRequest->GetCommand()))
+                        {
+                            originalRequest = m_context->RejectRequest(originalRequest);
+                        }
+                        StreamStackEntry::PrepareRequest(originalRequest);
+                    }
+                    else
+                    {
+                        m_context->PushPreparedRequest(nextRequest);
+                    }
+                };
+                FileRequest* fileCheckRequest = m_context->GetNewInternalRequest();
+                fileCheckRequest->CreateFileExistsCheck(data.m_path);
+                fileCheckRequest->SetCompletionCallback(AZStd::move(callback));
+                StreamStackEntry::QueueRequest(fileCheckRequest);
+            }
+            else
+            {
+                m_context->PushPreparedRequest(nextRequest);
+            }
+        }
+        else
+        {
+            StreamStackEntry::PrepareRequest(request);
+        }
+    }
+
+    void BlockDecompressor::PrepareDedicatedCache(FileRequest* request, const RequestPath& path)
+    {
+        CompressionInfo info;
+        if (CompressionUtils::FindCompressionInfo(info, path.GetRelativePath()))
+        {
+            FileRequest* nextRequest = m_context->GetNewInternalRequest();
+            AZStd::visit([request, &info, nextRequest](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, Requests::CreateDedicatedCacheData>)
+                {
+                    nextRequest->CreateDedicatedCacheCreation(AZStd::move(info.m_archiveFilename),
+                        FileRange::CreateRange(info.m_offset, info.m_compressedSize), request);
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::DestroyDedicatedCacheData>)
+                {
+                    nextRequest->CreateDedicatedCacheDestruction(AZStd::move(info.m_archiveFilename),
+                        FileRange::CreateRange(info.m_offset, info.m_compressedSize), request);
+                }
+            }, request->GetCommand());
+
+            if (info.m_conflictResolution == ConflictResolution::PreferFile)
+            {
+                auto callback = [this, nextRequest](const FileRequest& checkRequest)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    auto check = AZStd::get_if<Requests::FileExistsCheckData>(&checkRequest.GetCommand());
+                    AZ_Assert(check,
+                        "Callback in BlockDecompressor::PrepareDedicatedCache expected FileExistsCheck but got another command.");
+                    if (check->m_found)
+                    {
+                        FileRequest* originalRequest = nextRequest->GetParent();
+                        m_context->RejectRequest(nextRequest);
+                        StreamStackEntry::PrepareRequest(originalRequest);
+                    }
+                    else
+                    {
+                        m_context->PushPreparedRequest(nextRequest);
+                    }
+                };
+                FileRequest* fileCheckRequest = m_context->GetNewInternalRequest();
+                fileCheckRequest->CreateFileExistsCheck(path);
+                fileCheckRequest->SetCompletionCallback(AZStd::move(callback));
+                StreamStackEntry::QueueRequest(fileCheckRequest);
+            }
+            else
+            {
+                m_context->PushPreparedRequest(nextRequest);
+            }
+        }
+        else
+        {
+            StreamStackEntry::PrepareRequest(request);
+        }
+    }
+
+    void BlockDecompressor::FileExistsCheck(FileRequest* checkRequest)
+    {
+        auto& fileCheckRequest = AZStd::get<Requests::FileExistsCheckData>(checkRequest->GetCommand());
+        CompressionInfo info;
+        if (CompressionUtils::FindCompressionInfo(info, fileCheckRequest.m_path.GetRelativePath()))
+        {
+            fileCheckRequest.m_found = true;
+        }
+        else
+        {
+            // The file isn't in the archive but might still exist as a loose file, so let the next node have a shot.
+            StreamStackEntry::QueueRequest(checkRequest);
+        }
+    }
+
+    bool BlockDecompressor::FindSeekTable(SeekTablePtr& seekTable, const CompressionInfo& info)
+    {
+        seekTable.reset();
+        // Small files are decompressed as a whole as the additional read to find the seek table would cost more than what would
+        // be gained by decompressing in parallel.
+        if (!info.m_isCompressed || info.m_compressedSize < m_minSeekableSize || m_seekTableCacheSize == 0 ||
+            info.m_compressedSize < CompressionSeekTable::FooterSize)
+        {
+            return true;
+        }
+
+        auto it = m_seekTables.find(SeekTableKey{ info.m_archiveFilename.GetHash(), info.m_offset });
+        if (it != m_seekTables.end())
+        {
+            it->second.m_lastUsed = ++m_seekTableUseCounter;
+            seekTable = it->second.m_table;
+            ++m_numSeekTableHits;
+            return true;
+        }
+        return false;
+    }
+
+    void BlockDecompressor::StoreSeekTable(const CompressionInfo& info, SeekTablePtr seekTable)
+    {
+        if (m_seekTables.size() >= m_seekTableCacheSize)
+        {
+            // The cache is small and only updated after reading a seek table, so a linear search is cheap enough.
+            auto leastRecentlyUsed = m_seekTables.begin();
+            for (auto it = m_seekTables.begin(); it != m_seekTables.end(); ++it)
+            {
+                if (it->second.m_lastUsed < leastRecentlyUsed->second.m_lastUsed)
+                {
+                    leastRecentlyUsed = it;
+                }
+            }
+            m_seekTables.erase(leastRecentlyUsed);
+        }
+        m_seekTables.insert_or_assign(SeekTableKey{ info.m_archiveFilename.GetHash(), info.m_offset },
+            SeekTableCacheEntry{ AZStd::move(seekTable), ++m_seekTableUseCounter });
+    }
+
+    void BlockDecompressor::StartSeekTableRead(FileRequest* compressedRequest, u64 readSize)
+    {
+        if (!m_next)
+        {
+            compressedRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(compressedRequest);
+            return;
+        }
+
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(data, "Compressed request that's reading a seek table in BlockDecompressor didn't contain compression read data.");
+        const CompressionInfo& info = data->m_compressionInfo;
+
+        SeekTableRead& tableRead = m_seekTableReads.emplace_back();
+        tableRead.m_compressedRequest = compressedRequest;
+        tableRead.m_readSize = readSize;
+        u64 readOffset = info.m_offset + info.m_compressedSize - readSize;
+        tableRead.m_buffer = AllocateBuffer(readOffset, readSize, tableRead.m_bufferSize, tableRead.m_alignmentOffset);
+
+        // The read doesn't have the compressed request as a parent because the compressed request isn't done after this read.
+        tableRead.m_readRequest = m_context->GetNewInternalRequest();
+        tableRead.m_readRequest->CreateRead(nullptr, tableRead.m_buffer + tableRead.m_alignmentOffset,
+            tableRead.m_bufferSize - tableRead.m_alignmentOffset, info.m_archiveFilename, readOffset, readSize, info.m_isSharedPak);
+        tableRead.m_readRequest->SetCompletionCallback(
+            [this](FileRequest& request)
+            {
+                AZ_PROFILE_FUNCTION(AzCore);
+                FinishSeekTableRead(&request);
+            });
+
+        AZ_Assert(m_numInFlightReads < m_maxNumReads,
+            "A seek table read was queued in BlockDecompressor, but there's no slots available.");
+        m_numInFlightReads++;
+        m_next->QueueRequest(tableRead.m_readRequest);
+    }
+
+    void BlockDecompressor::FinishSeekTableRead(FileRequest* readRequest)
+    {
+        auto tableReadIt = AZStd::find_if(m_seekTableReads.begin(), m_seekTableReads.end(),
+            [readRequest](const SeekTableRead& tableRead)
+            {
+                return tableRead.m_readRequest == readRequest;
+            });
+        AZ_Assert(tableReadIt != m_seekTableReads.end(), "Seek table read completed in BlockDecompressor that wasn't registered.");
+        SeekTableRead tableRead = *tableReadIt;
+        m_seekTableReads.erase(tableReadIt);
+        AZ_Assert(m_numInFlightReads > 0, "A seek table read completed in BlockDecompressor, but no reads are supposed to be in flight.");
+        m_numInFlightReads--;
+
+        FileRequest* compressedRequest = tableRead.m_compressedRequest;
+        if (readRequest->GetStatus() != IStreamerTypes::RequestStatus::Completed)
+        {
+            FreeBuffer(tableRead.m_buffer, tableRead.m_bufferSize);
+            compressedRequest->SetStatus(readRequest->GetStatus());
+            m_context->MarkRequestAsCompleted(compressedRequest);
+            return;
+        }
+
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(data, "Compressed request that read a seek table in BlockDecompressor didn't contain compression read data.");
+        const CompressionInfo& info = data->m_compressionInfo;
+
+        const u8* tail = tableRead.m_buffer + tableRead.m_alignmentOffset;
+        size_t tableSize = CompressionSeekTable::GetTableSize(tail + tableRead.m_readSize - CompressionSeekTable::FooterSize);
+        if (tableSize > tableRead.m_readSize && tableSize <= info.m_compressedSize)
+        {
+            // The table is larger than what was read, so read it again but now with the exact size.
+            FreeBuffer(tableRead.m_buffer, tableRead.m_bufferSize);
+            StartSeekTableRead(compressedRequest, tableSize);
+            return;
+        }
+
+        SeekTablePtr seekTable;
+        if (tableSize != 0 && tableSize <= tableRead.m_readSize)
+        {
+            auto table = AZStd::make_shared<CompressionSeekTable>();
+            if (table->Load(tail + tableRead.m_readSize - tableSize, tableSize, info.m_compressedSize, info.m_uncompressedSize))
+            {
+                seekTable = AZStd::move(table);
+            }
+        }
+        FreeBuffer(tableRead.m_buffer, tableRead.m_bufferSize);
+
+        // Files without a valid seek table are also stored so they're not checked again.
+        StoreSeekTable(info, AZStd::move(seekTable));
+        m_pendingReads.push_front(compressedRequest);
+    }
+
+    void BlockDecompressor::StartArchiveRead(FileRequest* compressedRequest, SeekTablePtr seekTable)
+    {
+        if (!m_next)
+        {
+            compressedRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(compressedRequest);
+            return;
+        }
+
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            ReadSlot& slot = m_readSlots[i];
+            if (slot.m_status == ReadSlotStatus::Unused)
+            {
+                auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+                AZ_Assert(data, "Compressed request that's starting a read in BlockDecompressor didn't contain compression read data.");
+                const CompressionInfo& info = data->m_compressionInfo;
+                AZ_Assert(info.m_decompressor, "FileRequest for BlockDecompressor is missing a decompression callback.");
+
+                if (seekTable && seekTable->GetNumBlocks() > 0)
+                {
+                    // Only read the blocks that overlap with the requested range.
+                    u64 lastByte = data->m_readOffset + AZStd::max(data->m_readSize, u64{ 1 }) - 1;
+                    slot.m_firstBlock = seekTable->FindBlock(data->m_readOffset);
+                    slot.m_numBlocks = seekTable->FindBlock(lastByte) - slot.m_firstBlock + 1;
+                    slot.m_compressedStart = seekTable->GetBlock(slot.m_firstBlock).m_compressedOffset;
+                    slot.m_compressedSize =
+                        seekTable->GetBlock(slot.m_firstBlock + slot.m_numBlocks).m_compressedOffset - slot.m_compressedStart;
+                    slot.m_seekTable = AZStd::move(seekTable);
+                }
+                else
+                {
+                    slot.m_firstBlock = 0;
+                    slot.m_numBlocks = 1;
+                    slot.m_compressedStart = 0;
+                    slot.m_compressedSize = info.m_compressedSize;
+                    slot.m_seekTable.reset();
+                }
+
+                // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
+                // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
+                // the BlockCache's prolog and epilog are read into aligned buffers.
+                u64 readOffset = info.m_offset + slot.m_compressedStart;
+                slot.m_compressedData = AllocateBuffer(readOffset, slot.m_compressedSize, slot.m_bufferSize, slot.m_alignmentOffset);
+
+                FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
+                archiveReadRequest->CreateRead(compressedRequest, slot.m_compressedData + slot.m_alignmentOffset,
+                    slot.m_bufferSize - slot.m_alignmentOffset, info.m_archiveFilename, readOffset, slot.m_compressedSize, info.m_isSharedPak);
+                archiveReadRequest->SetCompletionCallback(
+                    [this, readSlot = i](FileRequest& request)
+                    {
+                        AZ_PROFILE_FUNCTION(AzCore);
+                        FinishArchiveRead(&request, readSlot);
+                    });
+                m_next->QueueRequest(archiveReadRequest);
+
+                slot.m_request = archiveReadRequest;
+                slot.m_status = ReadSlotStatus::ReadInFlight;
+
+                AZ_Assert(m_numInFlightReads < m_maxNumReads,
+                    "A FileRequest was queued for reading in BlockDecompressor, but there's no slots available.");
+                m_numInFlightReads++;
+                return;
+            }
+        }
+        AZ_Assert(false, "%u of %u read slots are use in the BlockDecompressor, but no empty slot was found.", m_numInFlightReads, m_maxNumReads);
+    }
+
+    void BlockDecompressor::FinishArchiveRead(FileRequest* readRequest, u32 readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        AZ_Assert(slot.m_request == readRequest, "Request in the archive read slot isn't the same as request that's being completed.");
+
+        FileRequest* compressedRequest = readRequest->GetParent();
+        AZ_Assert(compressedRequest, "Read requests started by BlockDecompressor is missing a parent request.");
+
+        if (readRequest->GetStatus() == IStreamerTypes::RequestStatus::Completed)
+        {
+            // Add this wait so the compressed request isn't fully completed yet as only the read part is done. The last
+            // job to finish a block will complete this wait, which in turn will call FinishDecompression on the main streaming thread.
+            FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(compressedRequest);
+            waitRequest->SetCompletionCallback([this, readSlot](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    FinishDecompression(&request, readSlot);
+                });
+
+            slot.m_request = waitRequest;
+            slot.m_status = ReadSlotStatus::Decompressing;
+            slot.m_queueStartTime = AZStd::chrono::high_resolution_clock::now();
+            slot.m_failed = false;
+            slot.m_remainingBlocks = slot.m_numBlocks;
+            ++m_numDecompressing;
+
+            for (size_t i = 0; i < slot.m_numBlocks; ++i)
+            {
+                auto job = [this, &slot, block = slot.m_firstBlock + i]()
+                {
+                    DecompressBlock(m_context, slot, block);
+                };
+                AZ::Job* decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionJobContext.get());
+                decompressionJob->Start();
+            }
+        }
+        else
+        {
+            FreeBuffer(slot.m_compressedData, slot.m_bufferSize);
+            slot.m_compressedData = nullptr;
+            slot.m_seekTable.reset();
+            slot.m_request = nullptr;
+            slot.m_status = ReadSlotStatus::Unused;
+            AZ_Assert(m_numInFlightReads > 0,
+                "Trying to decrement a read request after it was canceled or failed in BlockDecompressor, "
+                "but no read requests are supposed to be queued.");
+            m_numInFlightReads--;
+        }
+    }
+
+    void BlockDecompressor::FinishDecompression([[maybe_unused]] FileRequest* waitRequest, u32 readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        AZ_Assert(slot.m_request == waitRequest, "Read slot didn't contain the expected wait request.");
+
+        auto endTime = AZStd::chrono::high_resolution_clock::now();
+        m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            endTime - slot.m_queueStartTime).count());
+        m_bytesDecompressed.PushEntry(slot.m_compressedSize);
+        m_blocksPerRead.PushEntry(slot.m_numBlocks);
+
+        FreeBuffer(slot.m_compressedData, slot.m_bufferSize);
+        slot.m_compressedData = nullptr;
+        slot.m_seekTable.reset();
+        slot.m_request = nullptr;
+        slot.m_status = ReadSlotStatus::Unused;
+
+        AZ_Assert(m_numDecompressing > 0, "About to complete a decompression, but the internal count doesn't see a running decompression.");
+        --m_numDecompressing;
+        AZ_Assert(m_numInFlightReads > 0, "About to release a read slot in BlockDecompressor, but no read slots are in use.");
+        --m_numInFlightReads;
+    }
+
+    void BlockDecompressor::DecompressBlock(StreamerContext* context, ReadSlot& slot, size_t block)
+    {
+        FileRequest* compressedRequest = slot.m_request->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to BlockDecompressor was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in BlockDecompressor that's decompressing a block didn't contain compression read data.");
+        const CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_decompressor, "Block decompression job started, but there's no decompressor callback assigned.");
+
+        u64 compressedBegin = 0;
+        u64 compressedEnd = compressionInfo.m_compressedSize;
+        u64 uncompressedBegin = 0;
+        u64 uncompressedEnd = compressionInfo.m_uncompressedSize;
+        if (slot.m_seekTable)
+        {
+            const CompressionSeekTable::Block& begin = slot.m_seekTable->GetBlock(block);
+            const CompressionSeekTable::Block& end = slot.m_seekTable->GetBlock(block + 1);
+            compressedBegin = begin.m_compressedOffset;
+            compressedEnd = end.m_compressedOffset;
+            uncompressedBegin = begin.m_uncompressedOffset;
+            uncompressedEnd = end.m_uncompressedOffset;
+        }
+
+        const u8* compressed = slot.m_compressedData + slot.m_alignmentOffset + (compressedBegin - slot.m_compressedStart);
+        size_t compressedSize = aznumeric_caster(compressedEnd - compressedBegin);
+        size_t uncompressedSize = aznumeric_caster(uncompressedEnd - uncompressedBegin);
+
+        u64 readBegin = request->m_readOffset;
+        u64 readEnd = request->m_readOffset + request->m_readSize;
+        u64 copyBegin = AZStd::max(readBegin, uncompressedBegin);
+        u64 copyEnd = AZStd::min(readEnd, uncompressedEnd);
+        u8* output = reinterpret_cast<u8*>(request->m_output);
+
+        bool success = false;
+        if (copyBegin == uncompressedBegin && copyEnd == uncompressedEnd)
+        {
+            // The entire block is requested so decompress directly into the output.
+            success = compressionInfo.m_decompressor(compressionInfo, compressed, compressedSize,
+                output + (uncompressedBegin - readBegin), uncompressedSize);
+        }
+        else
+        {
+            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[uncompressedSize]);
+            success = compressionInfo.m_decompressor(compressionInfo, compressed, compressedSize, decompressionBuffer.get(), uncompressedSize);
+            if (success && copyEnd > copyBegin)
+            {
+                memcpy(output + (copyBegin - readBegin), decompressionBuffer.get() + (copyBegin - uncompressedBegin), copyEnd - copyBegin);
+            }
+        }
+
+        if (!success)
+        {
+            slot.m_failed = true;
+        }
+
+        // The last block to finish completes the request. The slot can be reused as soon as the wait request is
+        // completed, so it can't be touched after that.
+        if (slot.m_remainingBlocks.fetch_sub(1) == 1)
+        {
+            FileRequest* waitRequest = slot.m_request;
+            waitRequest->SetStatus(slot.m_failed ? IStreamerTypes::RequestStatus::Failed : IStreamerTypes::RequestStatus::Completed);
+            context->MarkRequestAsCompleted(waitRequest);
+            context->WakeUpSchedulingThread();
+        }
+    }
+
+    auto BlockDecompressor::AllocateBuffer(u64 offset, u64 size, size_t& bufferSize, u32& alignmentOffset) -> Buffer
+    {
+        alignmentOffset = aznumeric_caster(offset - AZ_SIZE_ALIGN_DOWN(offset, aznumeric_cast<u64>(m_alignment)));
+        bufferSize = aznumeric_caster(AZ_SIZE_ALIGN_UP(size + alignmentOffset, aznumeric_cast<u64>(m_alignment)));
+        m_memoryUsage += bufferSize;
+        return reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+            bufferSize, m_alignment, 0, "AZ::IO::Streamer BlockDecompressor", __FILE__, __LINE__));
+    }
+
+    void BlockDecompressor::FreeBuffer(Buffer buffer, size_t bufferSize)
+    {
+        if (buffer)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, bufferSize, m_alignment);
+            m_memoryUsage -= bufferSize;
+        }
+    }
+
+    AZStd::chrono::microseconds BlockDecompressor::EstimateDecompressionDuration(u64 compressedSize) const
+    {
+        double totalBytesDecompressed = aznumeric_caster(m_bytesDecompressed.GetTotal());
+        double totalDecompressionDuration = aznumeric_caster(m_decompressionDurationMicroSec.GetTotal());
+        return AZStd::chrono::microseconds(aznumeric_cast<u64>((compressedSize * totalDecompressionDuration) / totalBytesDecompressed));
+    }
+} // namespace AZ::IO
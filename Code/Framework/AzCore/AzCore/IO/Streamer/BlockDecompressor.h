@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/CompressionSeekTable.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadRequestData;
+    }
+
+    struct BlockDecompressorConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::BlockDecompressorConfig, "{3C7D1B7E-5E64-4F1A-9C1B-2B8E45A7D6F1}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(BlockDecompressorConfig, AZ::SystemAllocator, 0);
+
+        ~BlockDecompressorConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Maximum number of reads that are kept in flight.
+        u32 m_maxNumReads{ 4 };
+        //! Number of threads that decompress blocks. 0 uses one thread per core.
+        u32 m_maxNumJobs{ 0 };
+        //! Compressed files smaller than this are always decompressed as a whole without looking for a seek table.
+        u32 m_minSeekableSizeKib{ 512 };
+        //! Maximum number of seek tables that are kept in memory.
+        u32 m_seekTableCacheSize{ 256 };
+    };
+
+    //! Entry in the streaming stack that decompresses files from an archive. Files that were compressed as a series of
+    //! independent blocks with a seek table (see CompressionSeekTable) only have the blocks that overlap with the requested
+    //! range read and every block is decompressed as a separate job so large files are decompressed on multiple cores.
+    //! Files without a seek table are treated as a single block, which makes this entry a replacement for the
+    //! FullFileDecompressor.
+    //! The seek table of a file is read on first access and kept in a small cache afterwards.
+    class BlockDecompressor
+        : public StreamStackEntry
+    {
+    public:
+        BlockDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u64 minSeekableSize = 512_kib, u32 seekTableCacheSize = 256);
+        ~BlockDecompressor() override = default;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        using Buffer = u8*;
+        using SeekTablePtr = AZStd::shared_ptr<const CompressionSeekTable>;
+
+        enum class ReadSlotStatus : uint8_t
+        {
+            Unused,
+            ReadInFlight,
+            Decompressing
+        };
+
+        struct ReadSlot
+        {
+            AZStd::chrono::high_resolution_clock::time_point m_queueStartTime;
+            //! Null if the file is decompressed as a single block.
+            SeekTablePtr m_seekTable;
+            Buffer m_compressedData{ nullptr };
+            //! The read request while reading and the wait request while decompressing.
+            FileRequest* m_request{ nullptr };
+            size_t m_bufferSize{ 0 };
+            //! Offset of the first block that was read relative to the start of the compressed file.
+            u64 m_compressedStart{ 0 };
+            //! Number of compressed bytes that were read.
+            u64 m_compressedSize{ 0 };
+            size_t m_firstBlock{ 0 };
+            size_t m_numBlocks{ 0 };
+            AZStd::atomic<size_t> m_remainingBlocks{ 0 };
+            AZStd::atomic_bool m_failed{ false };
+            u32 m_alignmentOffset{ 0 };
+            ReadSlotStatus m_status{ ReadSlotStatus::Unused };
+        };
+
+        struct SeekTableKey
+        {
+            bool operator==(const SeekTableKey& rhs) const;
+
+            size_t m_archiveHash;
+            u64 m_offset;
+        };
+        struct SeekTableKeyHasher
+        {
+            size_t operator()(const SeekTableKey& key) const;
+        };
+        struct SeekTableCacheEntry
+        {
+            //! Null if the file doesn't have a seek table.
+            SeekTablePtr m_table;
+            u64 m_lastUsed;
+        };
+
+        struct SeekTableRead
+        {
+            FileRequest* m_compressedRequest{ nullptr };
+            FileRequest* m_readRequest{ nullptr };
+            Buffer m_buffer{ nullptr };
+            size_t m_bufferSize{ 0 };
+            u64 m_readSize{ 0 };
+            u32 m_alignmentOffset{ 0 };
+        };
+
+        bool IsIdle() const;
+
+        void PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data);
+        void PrepareDedicatedCache(FileRequest* request, const RequestPath& path);
+        void FileExistsCheck(FileRequest* checkRequest);
+
+        //! Finds the seek table for the compressed request. Returns false if the seek table still needs to be read.
+        bool FindSeekTable(SeekTablePtr& seekTable, const CompressionInfo& info);
+        void StoreSeekTable(const CompressionInfo& info, SeekTablePtr seekTable);
+        void StartSeekTableRead(FileRequest* compressedRequest, u64 readSize);
+        void FinishSeekTableRead(FileRequest* readRequest);
+
+        void StartArchiveRead(FileRequest* compressedRequest, SeekTablePtr seekTable);
+        void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
+        void FinishDecompression(FileRequest* waitRequest, u32 readSlot);
+        static void DecompressBlock(StreamerContext* context, ReadSlot& slot, size_t block);
+
+        Buffer AllocateBuffer(u64 offset, u64 size, size_t& bufferSize, u32& alignmentOffset);
+        void FreeBuffer(Buffer buffer, size_t bufferSize);
+        AZStd::chrono::microseconds EstimateDecompressionDuration(u64 compressedSize) const;
+
+        AZStd::deque<FileRequest*> m_pendingReads;
+        AZStd::deque<FileRequest*> m_pendingFileExistChecks;
+        AZStd::vector<SeekTableRead> m_seekTableReads;
+
+        AZStd::unordered_map<SeekTableKey, SeekTableCacheEntry, SeekTableKeyHasher> m_seekTables;
+        u64 m_seekTableUseCounter{ 0 };
+
+        AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
+        AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+        AverageWindow<size_t, double, s_statisticsWindowSize> m_blocksPerRead;
+        size_t m_numSeekTableHits{ 0 };
+        size_t m_numSeekTableMisses{ 0 };
+
+        AZStd::unique_ptr<ReadSlot[]> m_readSlots;
+
+        AZStd::unique_ptr<JobManager> m_decompressionJobManager;
+        AZStd::unique_ptr<JobContext> m_decompressionJobContext;
+
+        size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+        u64 m_minSeekableSize{ 512_kib };
+        u32 m_seekTableCacheSize{ 256 };
+        u32 m_maxNumReads{ 4 };
+        u32 m_numInFlightReads{ 0 }; //!< Number of seek table reads plus read slots that are either reading or decompressing.
+        u32 m_numDecompressing{ 0 };
+        u32 m_numDecompressionThreads{ 1 };
+        u32 m_alignment{ 0 };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        /**
+         * For use with rapidjson::Reader/Document::ParseStream.
+         * Reads the stream in chunks of readCacheSize bytes so the json text never has to be fully loaded into memory before
+         * it's parsed. Reading stops at the end of the stream or at the first null character, whichever comes first.
+         */
+        class RapidJSONStreamReader
+        {
+        public:
+            typedef char Ch;    //!< Character type. Only support char.
+
+            RapidJSONStreamReader(AZ::IO::GenericStream* stream, size_t readCacheSize = 64 * 1024)
+                : m_stream(stream)
+            {
+                AZ_Assert(readCacheSize > 0, "RapidJSONStreamReader requires a read cache of at least one byte.");
+                m_cache.resize_no_construct(readCacheSize);
+                m_cacheEnd = m_cache.data();
+                FillCache();
+            }
+
+            RapidJSONStreamReader(const RapidJSONStreamReader&) = delete;
+            RapidJSONStreamReader& operator=(const RapidJSONStreamReader&) = delete;
+
+            void FillCache()
+            {
+                m_cacheOffset += m_cacheEnd - m_cache.data();
+                const AZ::IO::SizeType bytesRead = m_stream->Read(m_cache.size(), m_cache.data());
+                m_cacheEnd = m_cache.data() + bytesRead;
+                m_current = m_cache.data();
+                // A short read before the end of the stream means the stream failed, which the parser would otherwise
+                // only see as the json text ending early.
+                if (bytesRead < m_cache.size() && m_stream->GetCurPos() < m_stream->GetLength())
+                {
+                    m_readFailed = true;
+                }
+            }
+
+            char Peek() const
+            {
+                return m_current != m_cacheEnd ? *m_current : '\0';
+            }
+
+            char Take()
+            {
+                if (m_current == m_cacheEnd)
+                {
+                    return '\0';
+                }
+
+                char c = *m_current++;
+                m_lineNumber += (c == '\n') ? 1 : 0;
+                if (m_current == m_cacheEnd)
+                {
+                    FillCache();
+                }
+                return c;
+            }
+
+            size_t Tell() const
+            {
+                return m_cacheOffset + (m_current - m_cache.data());
+            }
+
+            //! Returns the line the next character will be read from, starting at 1.
+            size_t GetLineNumber() const
+            {
+                return m_lineNumber;
+            }
+
+            //! Returns true if a read returned fewer bytes than requested before the end of the stream was reached.
+            bool HasReadFailed() const
+            {
+                return m_readFailed;
+            }
+
+            // Not implemented
+            void Put(char)
+            {
+                AZ_Assert(false, "RapidJSONStreamReader Put not supported.");
+            }
+            void Flush()
+            {
+                AZ_Assert(false, "RapidJSONStreamReader Flush not supported.");
+            }
+            char* PutBegin()
+            {
+                AZ_Assert(false, "RapidJSONStreamReader PutBegin not supported.");
+                return 0;
+            }
+            size_t PutEnd(char*)
+            {
+                AZ_Assert(false, "RapidJSONStreamReader PutEnd not supported.");
+                return 0;
+            }
+
+            AZ::IO::GenericStream* m_stream;
+            AZStd::vector<char> m_cache;
+            char* m_current = nullptr;
+            char* m_cacheEnd = nullptr;
+            size_t m_cacheOffset = 0;
+            size_t m_lineNumber = 1;
+            bool m_readFailed = false;
+        };
+    }   // namespace IO
+}   // namespace AZ
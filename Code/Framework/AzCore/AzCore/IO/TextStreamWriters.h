@@ -122,11 +122,18 @@ namespace AZ
                     if (bytes != m_cache.size())
                     {
                         AZ_Error("Serializer", false, "Failed writing %d byte(s) to stream, wrote only %d bytes!", m_cache.size(), bytes);
+                        m_writeFailed = true;
                     }
                     m_cache.clear();
                 }
             }
 
+            //! Returns true if any flush wrote fewer bytes than were cached. Call Flush first to include the pending bytes.
+            bool HasWriteFailed() const
+            {
+                return m_writeFailed;
+            }
+
             void Put(char c)
             {
                 if (m_cache.size() == m_cache.capacity())
@@ -180,6 +187,7 @@ namespace AZ
 
             AZ::IO::GenericStream* m_stream;
             AZStd::vector<AZ::u8> m_cache;
+            bool m_writeFailed = false;
         };
     }   // namespace IO
 }   // namespace AZ
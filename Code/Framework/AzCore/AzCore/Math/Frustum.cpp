@@ -8,6 +8,9 @@
 
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/Vector3Array.h>
+#include <AzCore/Math/Internal/BatchMath_avx2.h>
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/MathScriptHelpers.h>
@@ -156,6 +159,99 @@ namespace AZ
     }
 
 
+    void Frustum::IntersectAabbs(const Vector3Array& minimums, const Vector3Array& maximums, IntersectResult* results) const
+    {
+        AZ_MATH_ASSERT(minimums.GetSize() == maximums.GetSize(), "The number of minimums and maximums has to match");
+
+        // Process as many boxes as possible 8 at a time if the cpu supports AVX2, the rest is processed 4 at a time below.
+        size_t firstBlock = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        if (Simd::IsAvx2Enabled())
+        {
+            static_assert(Simd::Avx2::FrustumPlaneCount == PlaneId::MAX, "The AVX2 implementation expects a different number of planes");
+            static_assert(static_cast<int32_t>(IntersectResult::Interior) == Simd::Avx2::IntersectResultInterior &&
+                static_cast<int32_t>(IntersectResult::Overlaps) == Simd::Avx2::IntersectResultOverlaps &&
+                static_cast<int32_t>(IntersectResult::Exterior) == Simd::Avx2::IntersectResultExterior,
+                "The AVX2 implementation expects different IntersectResult values");
+
+            alignas(16) float planes[PlaneId::MAX][4];
+            for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+            {
+                Simd::Vec4::StoreUnaligned(planes[i], m_planes[i]);
+            }
+            const float* const minimumData[3] = { minimums.GetXData(), minimums.GetYData(), minimums.GetZData() };
+            const float* const maximumData[3] = { maximums.GetXData(), maximums.GetYData(), maximums.GetZData() };
+            firstBlock = Simd::Avx2::IntersectAabbs(planes, minimumData, maximumData, minimums.GetSize(), results) / Vector3Array::LaneCount;
+        }
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+
+        using Simd::Vec4;
+        struct SplatPlane
+        {
+            Vec4::FloatType m_normal[3];
+            Vec4::FloatType m_distance;
+            bool m_disjointUsesMaximum[3];
+            bool m_intersectUsesMaximum[3];
+        };
+
+        SplatPlane planes[PlaneId::MAX];
+        for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+        {
+            alignas(16) float plane[4];
+            Vec4::StoreUnaligned(plane, m_planes[i]);
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                planes[i].m_normal[axis] = Vec4::Splat(plane[axis]);
+                planes[i].m_disjointUsesMaximum[axis] = plane[axis] > 0.0f;
+                planes[i].m_intersectUsesMaximum[axis] = plane[axis] < 0.0f;
+            }
+            planes[i].m_distance = Vec4::Splat(plane[3]);
+        }
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType* minimumBlocks[3] = { minimums.GetXBlocks(), minimums.GetYBlocks(), minimums.GetZBlocks() };
+        const Vec4::FloatType* maximumBlocks[3] = { maximums.GetXBlocks(), maximums.GetYBlocks(), maximums.GetZBlocks() };
+        const size_t size = minimums.GetSize();
+        for (size_t block = firstBlock; block < minimums.GetBlockCount(); ++block)
+        {
+            // Same test as IntersectAabb: the support point furthest along the plane normal decides whether the box is
+            // outside of the plane and the point furthest against the normal whether it's fully inside of it.
+            // Since the normal is the same for all lanes, the support points can be chosen per plane instead of per lane.
+            Vec4::FloatType exterior = zero;
+            Vec4::FloatType interior = Vec4::CmpEq(zero, zero);
+            for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+            {
+                const SplatPlane& plane = planes[i];
+                Vec4::FloatType disjointDistance = plane.m_distance;
+                Vec4::FloatType intersectDistance = plane.m_distance;
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    const Vec4::FloatType& disjointSupport =
+                        plane.m_disjointUsesMaximum[axis] ? maximumBlocks[axis][block] : minimumBlocks[axis][block];
+                    const Vec4::FloatType& intersectSupport =
+                        plane.m_intersectUsesMaximum[axis] ? maximumBlocks[axis][block] : minimumBlocks[axis][block];
+                    disjointDistance = Vec4::Madd(plane.m_normal[axis], disjointSupport, disjointDistance);
+                    intersectDistance = Vec4::Madd(plane.m_normal[axis], intersectSupport, intersectDistance);
+                }
+                exterior = Vec4::Or(exterior, Vec4::CmpLt(disjointDistance, zero));
+                interior = Vec4::And(interior, Vec4::CmpGtEq(intersectDistance, zero));
+            }
+
+            alignas(16) int32_t exteriorLanes[Vec4::ElementCount];
+            alignas(16) int32_t interiorLanes[Vec4::ElementCount];
+            Vec4::StoreUnaligned(exteriorLanes, Vec4::CastToInt(exterior));
+            Vec4::StoreUnaligned(interiorLanes, Vec4::CastToInt(interior));
+            const size_t first = block * Vec4::ElementCount;
+            const size_t laneCount = AZStd::min<size_t>(Vec4::ElementCount, size - first);
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                results[first + lane] = exteriorLanes[lane] ? IntersectResult::Exterior
+                    : (interiorLanes[lane] ? IntersectResult::Interior : IntersectResult::Overlaps);
+            }
+        }
+    }
+
+
     void Frustum::ConstructPlanes(const ViewFrustumAttributes& viewFrustumAttributes)
     {
         const float tanHalfFov = std::tan(viewFrustumAttributes.m_verticalFovRadians * 0.5f);
@@ -19,6 +19,7 @@
 namespace AZ
 {
     class ReflectContext;
+    class Vector3Array;
 
     //! Attributes required to construct a Frustum from a view volume.
     struct ViewFrustumAttributes
@@ -142,6 +143,13 @@ namespace AZ
         //! @return the intersection result of the Aabb against the frustum
         IntersectResult IntersectAabb(const Aabb& aabb) const;
 
+        //! Intersects a batch of axis-aligned bounding boxes, Simd::Vec4::ElementCount boxes at a time.
+        //! 
+        //! @param minimums the smallest extents of the bounding volumes to test against
+        //! @param maximums the largest extents of the bounding volumes to test against, must have the same size as minimums
+        //! @param results receives the intersection result of each Aabb against the frustum, must have room for minimums.GetSize() results
+        void IntersectAabbs(const Vector3Array& minimums, const Vector3Array& maximums, IntersectResult* results) const;
+
         //! Returns true if the current frustum and provided frustum are close to identical.
         //! @param rhs the frustum to compare against for closeness
         bool IsClose(const Frustum& rhs, float tolerance = Constants::Tolerance) const;
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// This file is compiled with AVX2 enabled, see the platform cmake files, so it deliberately includes as little as possible.
+#include <AzCore/PlatformDef.h>
+#include <AzCore/Math/Internal/BatchMath_avx2.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+
+#include <AzCore/Math/SimdMathVec8.h>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Avx2
+        {
+            size_t IntersectAabbs(const float (&planes)[FrustumPlaneCount][4], const float* const (&minimums)[3],
+                const float* const (&maximums)[3], size_t count, IntersectResult* results)
+            {
+                struct SplatPlane
+                {
+                    Vec8::FloatType m_normal[3];
+                    Vec8::FloatType m_distance;
+                    bool m_disjointUsesMaximum[3];
+                    bool m_intersectUsesMaximum[3];
+                };
+
+                SplatPlane splatPlanes[FrustumPlaneCount];
+                for (size_t planeIndex = 0; planeIndex < FrustumPlaneCount; ++planeIndex)
+                {
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        splatPlanes[planeIndex].m_normal[axis] = Vec8::Splat(planes[planeIndex][axis]);
+                        splatPlanes[planeIndex].m_disjointUsesMaximum[axis] = planes[planeIndex][axis] > 0.0f;
+                        splatPlanes[planeIndex].m_intersectUsesMaximum[axis] = planes[planeIndex][axis] < 0.0f;
+                    }
+                    splatPlanes[planeIndex].m_distance = Vec8::Splat(planes[planeIndex][3]);
+                }
+
+                const Vec8::FloatType zero = Vec8::ZeroFloat();
+                size_t first = 0;
+                for (; first + Vec8::ElementCount <= count; first += Vec8::ElementCount)
+                {
+                    Vec8::FloatType minimum[3];
+                    Vec8::FloatType maximum[3];
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        minimum[axis] = Vec8::LoadUnaligned(minimums[axis] + first);
+                        maximum[axis] = Vec8::LoadUnaligned(maximums[axis] + first);
+                    }
+
+                    // Same test as the Vec4 implementation in Frustum::IntersectAabbs.
+                    Vec8::FloatType exterior = zero;
+                    Vec8::FloatType interior = Vec8::CmpEq(zero, zero);
+                    for (const SplatPlane& plane : splatPlanes)
+                    {
+                        Vec8::FloatType disjointDistance = plane.m_distance;
+                        Vec8::FloatType intersectDistance = plane.m_distance;
+                        for (int32_t axis = 0; axis < 3; ++axis)
+                        {
+                            const Vec8::FloatType disjointSupport = plane.m_disjointUsesMaximum[axis] ? maximum[axis] : minimum[axis];
+                            const Vec8::FloatType intersectSupport = plane.m_intersectUsesMaximum[axis] ? maximum[axis] : minimum[axis];
+                            disjointDistance = Vec8::Madd(plane.m_normal[axis], disjointSupport, disjointDistance);
+                            intersectDistance = Vec8::Madd(plane.m_normal[axis], intersectSupport, intersectDistance);
+                        }
+                        exterior = Vec8::Or(exterior, Vec8::CmpLt(disjointDistance, zero));
+                        interior = Vec8::And(interior, Vec8::CmpGtEq(intersectDistance, zero));
+                    }
+
+                    const int32_t exteriorMask = Vec8::MoveMask(exterior);
+                    const int32_t interiorMask = Vec8::MoveMask(interior);
+                    for (int32_t lane = 0; lane < Vec8::ElementCount; ++lane)
+                    {
+                        const int32_t laneBit = 1 << lane;
+                        const int32_t result = (exteriorMask & laneBit) ? IntersectResultExterior
+                            : ((interiorMask & laneBit) ? IntersectResultInterior : IntersectResultOverlaps);
+                        results[first + lane] = static_cast<IntersectResult>(result);
+                    }
+                }
+                return first;
+            }
+
+            size_t TransformPoints(const float (&matrix)[3][4], const float* const (&points)[3], float* const (&results)[3], size_t count)
+            {
+                Vec8::FloatType elements[3][4];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        elements[row][col] = Vec8::Splat(matrix[row][col]);
+                    }
+                }
+
+                size_t first = 0;
+                for (; first + Vec8::ElementCount <= count; first += Vec8::ElementCount)
+                {
+                    const Vec8::FloatType x = Vec8::LoadUnaligned(points[0] + first);
+                    const Vec8::FloatType y = Vec8::LoadUnaligned(points[1] + first);
+                    const Vec8::FloatType z = Vec8::LoadUnaligned(points[2] + first);
+                    for (int32_t row = 0; row < 3; ++row)
+                    {
+                        const Vec8::FloatType result = Vec8::Madd(elements[row][0], x,
+                            Vec8::Madd(elements[row][1], y, Vec8::Madd(elements[row][2], z, elements[row][3])));
+                        Vec8::StoreUnaligned(results[row] + first, result);
+                    }
+                }
+                return first;
+            }
+        } // namespace Avx2
+    } // namespace Simd
+} // namespace AZ
+
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_SSE
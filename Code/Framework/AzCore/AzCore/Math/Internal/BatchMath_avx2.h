@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace AZ
+{
+    enum class IntersectResult;
+
+    namespace Simd
+    {
+        //! AVX2 implementations of the batch math functions, processing Vec8::ElementCount elements at once.
+        //! They must only be called if IsAvx2Enabled() returns true. Each function processes as many full groups of
+        //! Vec8::ElementCount elements as possible and returns the number of elements it processed, the caller processes the
+        //! remaining elements with Vec4.
+        //! The implementations only take plain arrays, so BatchMath_avx2.cpp doesn't need to include any other AzCore math headers.
+        namespace Avx2
+        {
+            //! The number of planes of a Frustum and the values of AZ::IntersectResult, verified in Frustum.cpp.
+            //! @{
+            constexpr size_t FrustumPlaneCount = 6;
+            constexpr int32_t IntersectResultInterior = 0;
+            constexpr int32_t IntersectResultOverlaps = 1;
+            constexpr int32_t IntersectResultExterior = 2;
+            //! @}
+
+            //! Implementation of Frustum::IntersectAabbs, each plane is stored as its normal followed by its distance.
+            //! minimums and maximums are the x, y and z component arrays of the boxes.
+            size_t IntersectAabbs(const float (&planes)[FrustumPlaneCount][4], const float* const (&minimums)[3],
+                const float* const (&maximums)[3], size_t count, IntersectResult* results);
+
+            //! Implementation of Vector3Array::TransformPoints, matrix holds the rows of a 3x4 matrix and points and results are
+            //! the x, y and z component arrays of the points. results may be the same arrays as points.
+            size_t TransformPoints(const float (&matrix)[3][4], const float* const (&points)[3], float* const (&results)[3], size_t count);
+        } // namespace Avx2
+    } // namespace Simd
+} // namespace AZ
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#       include <immintrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace
+        {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            enum CpuIdRegister
+            {
+                Eax,
+                Ebx,
+                Ecx,
+                Edx,
+                RegisterCount
+            };
+
+            void CpuId(uint32_t leaf, uint32_t subLeaf, uint32_t (&registers)[RegisterCount])
+            {
+#   if defined(AZ_COMPILER_MSVC)
+                int values[RegisterCount];
+                __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+                for (int index = 0; index < RegisterCount; ++index)
+                {
+                    registers[index] = static_cast<uint32_t>(values[index]);
+                }
+#   else
+                __cpuid_count(leaf, subLeaf, registers[Eax], registers[Ebx], registers[Ecx], registers[Edx]);
+#   endif
+            }
+
+            uint64_t ReadExtendedControlRegister()
+            {
+#   if defined(AZ_COMPILER_MSVC)
+                return _xgetbv(0);
+#   else
+                // Not using the _xgetbv intrinsic, as it requires compiling the whole file with xsave enabled
+                uint32_t eax = 0;
+                uint32_t edx = 0;
+                __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                return (static_cast<uint64_t>(edx) << 32) | eax;
+#   endif
+            }
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+
+            bool DetectAvx2()
+            {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+                uint32_t registers[RegisterCount];
+                CpuId(0, 0, registers);
+                const uint32_t highestLeaf = registers[Eax];
+                if (highestLeaf < 7)
+                {
+                    return false;
+                }
+
+                constexpr uint32_t FmaBit = 1u << 12;
+                constexpr uint32_t OsXsaveBit = 1u << 27;
+                constexpr uint32_t AvxBit = 1u << 28;
+                constexpr uint32_t RequiredLeaf1Bits = FmaBit | OsXsaveBit | AvxBit;
+                CpuId(1, 0, registers);
+                if ((registers[Ecx] & RequiredLeaf1Bits) != RequiredLeaf1Bits)
+                {
+                    return false;
+                }
+
+                // The cpu supporting AVX isn't enough, the operating system also has to preserve the upper halves of the
+                // ymm registers on context switches.
+                constexpr uint64_t XmmAndYmmStateBits = 0x6;
+                if ((ReadExtendedControlRegister() & XmmAndYmmStateBits) != XmmAndYmmStateBits)
+                {
+                    return false;
+                }
+
+                constexpr uint32_t Avx2Bit = 1u << 5;
+                CpuId(7, 0, registers);
+                return (registers[Ebx] & Avx2Bit) != 0;
+#else
+                return false;
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            }
+
+            AZStd::atomic_bool s_avx2Enabled{ true };
+        } // namespace
+
+        bool IsAvx2Supported()
+        {
+            static const bool isSupported = DetectAvx2();
+            return isSupported;
+        }
+
+        bool IsAvx2Enabled()
+        {
+            return s_avx2Enabled.load(AZStd::memory_order_relaxed) && IsAvx2Supported();
+        }
+
+        void SetAvx2Enabled(bool enabled)
+        {
+            s_avx2Enabled.store(enabled, AZStd::memory_order_relaxed);
+        }
+    }
+}
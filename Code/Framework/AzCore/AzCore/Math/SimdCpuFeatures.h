@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        //! Returns true if both the cpu and the operating system support AVX2 and FMA, so the batch math functions with
+        //! AVX2 implementations (Frustum::IntersectAabbs, Vector3Array::TransformPoints) can process Vec8::ElementCount
+        //! elements at once. Always false on platforms without SSE. The result is detected once and cached.
+        bool IsAvx2Supported();
+
+        //! Returns true if the AVX2 implementations are used, which is the case whenever they're supported and haven't
+        //! been disabled with SetAvx2Enabled.
+        bool IsAvx2Enabled();
+
+        //! Enables or disables the AVX2 implementations, e.g. to compare them against the Vec4 implementations.
+        //! Enabling them has no effect if AVX2 isn't supported.
+        void SetAvx2Enabled(bool enabled);
+    }
+}
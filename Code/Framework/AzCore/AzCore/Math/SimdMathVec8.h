@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// Vec8 maps directly onto the 256-bit AVX2 registers, so it's only available in translation units compiled with AVX2 enabled.
+// Those translation units must only be entered after checking AZ::Simd::IsAvx2Enabled() and should not include other AzCore
+// headers with inline functions, as the linker may otherwise pick their AVX2 encoded copies for the rest of the engine.
+#if !defined(__AVX2__) || (!defined(_MSC_VER) && !defined(__FMA__))
+#   error "SimdMathVec8.h requires a translation unit compiled with AVX2 and FMA enabled"
+#endif
+
+#include <AzCore/PlatformDef.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        struct Vec8
+        {
+            static constexpr int32_t ElementCount = 8;
+
+            using FloatType = __m256;
+            using Int32Type = __m256i;
+            using FloatArgType = FloatType;
+            using Int32ArgType = Int32Type;
+
+            static FloatType LoadAligned(const float* __restrict addr); // addr *must* be 32-byte aligned
+            static Int32Type LoadAligned(const int32_t* __restrict addr); // addr *must* be 32-byte aligned
+            static FloatType LoadUnaligned(const float* __restrict addr);
+            static Int32Type LoadUnaligned(const int32_t* __restrict addr);
+
+            static void StoreAligned(float* __restrict addr, FloatArgType value); // addr *must* be 32-byte aligned
+            static void StoreAligned(int32_t* __restrict addr, Int32ArgType value); // addr *must* be 32-byte aligned
+            static void StoreUnaligned(float* __restrict addr, FloatArgType value);
+            static void StoreUnaligned(int32_t* __restrict addr, Int32ArgType value);
+
+            static void StreamAligned(float* __restrict addr, FloatArgType value); // addr *must* be 32-byte aligned
+            static void StreamAligned(int32_t* __restrict addr, Int32ArgType value); // addr *must* be 32-byte aligned
+
+            static float SelectFirst(FloatArgType value);
+
+            static FloatType Splat(float value);
+            static Int32Type Splat(int32_t value);
+
+            static FloatType Add(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Sub(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Mul(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add); // Fused, so the result is only rounded once
+            static FloatType Div(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Abs(FloatArgType value);
+
+            static Int32Type Add(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Sub(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Mul(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Madd(Int32ArgType mul1, Int32ArgType mul2, Int32ArgType add);
+            static Int32Type Abs(Int32ArgType value);
+
+            static FloatType Not(FloatArgType value);
+            static FloatType And(FloatArgType arg1, FloatArgType arg2);
+            static FloatType AndNot(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Or(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Xor(FloatArgType arg1, FloatArgType arg2);
+
+            static Int32Type Not(Int32ArgType value);
+            static Int32Type And(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type AndNot(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Or(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Xor(Int32ArgType arg1, Int32ArgType arg2);
+
+            static FloatType Floor(FloatArgType value);
+            static FloatType Ceil(FloatArgType value);
+            static FloatType Round(FloatArgType value); // Ties to even (banker's rounding)
+            static FloatType Truncate(FloatArgType value);
+            static FloatType Min(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Max(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Clamp(FloatArgType value, FloatArgType min, FloatArgType max);
+
+            static Int32Type Min(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Max(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Clamp(Int32ArgType value, Int32ArgType min, Int32ArgType max);
+
+            static FloatType CmpEq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpNeq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpGt(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpGtEq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpLt(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpLtEq(FloatArgType arg1, FloatArgType arg2);
+
+            static bool CmpAllEq(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllLt(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllLtEq(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllGt(FloatArgType arg1, FloatArgType arg2);
+            static bool CmpAllGtEq(FloatArgType arg1, FloatArgType arg2);
+
+            static Int32Type CmpEq(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpNeq(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpGt(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpGtEq(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpLt(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type CmpLtEq(Int32ArgType arg1, Int32ArgType arg2);
+
+            static bool CmpAllEq(Int32ArgType arg1, Int32ArgType arg2);
+
+            //! Returns one bit per lane, set if the sign bit of the lane is set, so comparison results can be tested at once.
+            static int32_t MoveMask(FloatArgType value);
+
+            static FloatType Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask);
+            static Int32Type Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask);
+
+            static FloatType Reciprocal(FloatArgType value); // Slow, but full accuracy
+            static FloatType ReciprocalEstimate(FloatArgType value); // Fastest, but roughly half precision
+
+            static FloatType Sqrt(FloatArgType value); // Slow, but full accuracy
+            static FloatType SqrtEstimate(FloatArgType value); // Fastest, but roughly half precision
+            static FloatType SqrtInv(FloatArgType value); // Slow, but full accuracy
+            static FloatType SqrtInvEstimate(FloatArgType value); // Fastest, but roughly half precision
+
+            static FloatType ConvertToFloat(Int32ArgType value);
+            static Int32Type ConvertToInt(FloatArgType value); // Truncates
+            static Int32Type ConvertToIntNearest(FloatArgType value); // Rounds to nearest int with ties to even (banker's rounding)
+
+            static FloatType CastToFloat(Int32ArgType value);
+            static Int32Type CastToInt(FloatArgType value);
+
+            static FloatType ZeroFloat();
+            static Int32Type ZeroInt();
+        };
+    }
+}
+
+#include <AzCore/Math/Internal/SimdMathVec8_avx2.inl>
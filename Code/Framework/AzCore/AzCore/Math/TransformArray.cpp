@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/TransformArray.h>
+
+namespace AZ
+{
+    namespace TransformArrayInternal
+    {
+        //! Rotates the vectors by the quaternions and adds the translations, the same way Quaternion::TransformVector does it:
+        //! 2 * dot(q, v) * q + (w * w - dot(q, q)) * v + 2 * w * cross(q, v)
+        AZ_MATH_INLINE void RotateAndTranslate(
+            Simd::Vec4::FloatArgType qx, Simd::Vec4::FloatArgType qy, Simd::Vec4::FloatArgType qz, Simd::Vec4::FloatArgType qw,
+            Simd::Vec4::FloatArgType vx, Simd::Vec4::FloatArgType vy, Simd::Vec4::FloatArgType vz,
+            Simd::Vec4::FloatArgType tx, Simd::Vec4::FloatArgType ty, Simd::Vec4::FloatArgType tz,
+            Simd::Vec4::FloatType& outX, Simd::Vec4::FloatType& outY, Simd::Vec4::FloatType& outZ)
+        {
+            using Simd::Vec4;
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+
+            const Vec4::FloatType dotQV2 = Vec4::Mul(two, Vec4::Madd(qx, vx, Vec4::Madd(qy, vy, Vec4::Mul(qz, vz))));
+            const Vec4::FloatType dotQQ = Vec4::Madd(qx, qx, Vec4::Madd(qy, qy, Vec4::Mul(qz, qz)));
+            const Vec4::FloatType scaleV = Vec4::Sub(Vec4::Mul(qw, qw), dotQQ);
+            const Vec4::FloatType w2 = Vec4::Mul(two, qw);
+
+            const Vec4::FloatType crossX = Vec4::Sub(Vec4::Mul(qy, vz), Vec4::Mul(qz, vy));
+            const Vec4::FloatType crossY = Vec4::Sub(Vec4::Mul(qz, vx), Vec4::Mul(qx, vz));
+            const Vec4::FloatType crossZ = Vec4::Sub(Vec4::Mul(qx, vy), Vec4::Mul(qy, vx));
+
+            outX = Vec4::Add(Vec4::Madd(dotQV2, qx, Vec4::Madd(scaleV, vx, Vec4::Mul(w2, crossX))), tx);
+            outY = Vec4::Add(Vec4::Madd(dotQV2, qy, Vec4::Madd(scaleV, vy, Vec4::Mul(w2, crossY))), ty);
+            outZ = Vec4::Add(Vec4::Madd(dotQV2, qz, Vec4::Madd(scaleV, vz, Vec4::Mul(w2, crossZ))), tz);
+        }
+    } // namespace TransformArrayInternal
+
+
+    void TransformArray::TransformPoints(const Vector3Array& points, Vector3Array& results) const
+    {
+        AZ_MATH_ASSERT(points.GetSize() == m_size, "The number of points has to match the number of transforms");
+
+        using Simd::Vec4;
+        results.Resize(m_size);
+        const Vec4::FloatType* pointsX = points.GetXBlocks();
+        const Vec4::FloatType* pointsY = points.GetYBlocks();
+        const Vec4::FloatType* pointsZ = points.GetZBlocks();
+        Vec4::FloatType* resultsX = results.GetXBlocks();
+        Vec4::FloatType* resultsY = results.GetYBlocks();
+        Vec4::FloatType* resultsZ = results.GetZBlocks();
+
+        for (size_t index = 0; index < m_blocks.size(); ++index)
+        {
+            const Block& block = m_blocks[index];
+            TransformArrayInternal::RotateAndTranslate(
+                block.m_rotationX, block.m_rotationY, block.m_rotationZ, block.m_rotationW,
+                Vec4::Mul(block.m_scale, pointsX[index]), Vec4::Mul(block.m_scale, pointsY[index]), Vec4::Mul(block.m_scale, pointsZ[index]),
+                block.m_translationX, block.m_translationY, block.m_translationZ,
+                resultsX[index], resultsY[index], resultsZ[index]);
+        }
+    }
+
+
+    void TransformArray::TransformPoint(const Vector3& point, Vector3Array& results) const
+    {
+        using Simd::Vec4;
+        results.Resize(m_size);
+        const Vec4::FloatType pointX = Vec4::Splat(point.GetX());
+        const Vec4::FloatType pointY = Vec4::Splat(point.GetY());
+        const Vec4::FloatType pointZ = Vec4::Splat(point.GetZ());
+        Vec4::FloatType* resultsX = results.GetXBlocks();
+        Vec4::FloatType* resultsY = results.GetYBlocks();
+        Vec4::FloatType* resultsZ = results.GetZBlocks();
+
+        for (size_t index = 0; index < m_blocks.size(); ++index)
+        {
+            const Block& block = m_blocks[index];
+            TransformArrayInternal::RotateAndTranslate(
+                block.m_rotationX, block.m_rotationY, block.m_rotationZ, block.m_rotationW,
+                Vec4::Mul(block.m_scale, pointX), Vec4::Mul(block.m_scale, pointY), Vec4::Mul(block.m_scale, pointZ),
+                block.m_translationX, block.m_translationY, block.m_translationZ,
+                resultsX[index], resultsY[index], resultsZ[index]);
+        }
+    }
+} // namespace AZ
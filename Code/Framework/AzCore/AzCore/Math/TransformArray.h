@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3Array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! A batch of Transform's stored as blocks of Simd::Vec4::ElementCount transforms, where each component of the
+    //! transforms in a block is stored contiguously. Operations on the batch transform Simd::Vec4::ElementCount points at
+    //! once using the platform's SIMD instructions. The last block is padded with identity transforms.
+    class TransformArray
+    {
+    public:
+        AZ_TYPE_INFO(TransformArray, "{9B0E5C27-4F1A-4D86-B3E8-26C7A1D05F4B}");
+
+        //! The number of transforms processed at once.
+        static constexpr size_t LaneCount = Simd::Vec4::ElementCount;
+
+        TransformArray() = default;
+        explicit TransformArray(size_t size);
+
+        //! Resizes the batch, new transforms are initialized to identity.
+        void Resize(size_t size);
+        void Reserve(size_t capacity);
+        void Clear();
+
+        void PushBack(const Transform& value);
+
+        size_t GetSize() const;
+        bool IsEmpty() const;
+
+        Transform GetElement(size_t index) const;
+        void SetElement(size_t index, const Transform& value);
+
+        //! Transforms each point by the transform at the same index and stores it in results, results may be points.
+        //! points must have the same size as this array.
+        void TransformPoints(const Vector3Array& points, Vector3Array& results) const;
+
+        //! Transforms a single point by every transform and stores the transformed points in results.
+        void TransformPoint(const Vector3& point, Vector3Array& results) const;
+
+    private:
+        struct Block
+        {
+            Simd::Vec4::FloatType m_rotationX;
+            Simd::Vec4::FloatType m_rotationY;
+            Simd::Vec4::FloatType m_rotationZ;
+            Simd::Vec4::FloatType m_rotationW;
+            Simd::Vec4::FloatType m_scale;
+            Simd::Vec4::FloatType m_translationX;
+            Simd::Vec4::FloatType m_translationY;
+            Simd::Vec4::FloatType m_translationZ;
+        };
+
+        static Block CreateIdentityBlock();
+        static void SetLane(Block& block, size_t lane, const Transform& value);
+        static float& GetLane(Simd::Vec4::FloatType& block, size_t lane);
+        static float GetLane(const Simd::Vec4::FloatType& block, size_t lane);
+
+        AZStd::vector<Block> m_blocks;
+        size_t m_size = 0;
+    };
+} // namespace AZ
+
+#include <AzCore/Math/TransformArray.inl>
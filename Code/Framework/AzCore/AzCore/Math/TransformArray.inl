@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE TransformArray::TransformArray(size_t size)
+    {
+        Resize(size);
+    }
+
+
+    AZ_MATH_INLINE void TransformArray::Resize(size_t size)
+    {
+        const size_t blockCount = (size + LaneCount - 1) / LaneCount;
+        m_blocks.resize(blockCount, CreateIdentityBlock());
+
+        // Reset the padding in the last block so transforms added to the block start out as identity.
+        for (size_t index = AZStd::min(m_size, size); index < blockCount * LaneCount; ++index)
+        {
+            SetLane(m_blocks[index / LaneCount], index % LaneCount, Transform::CreateIdentity());
+        }
+        m_size = size;
+    }
+
+
+    AZ_MATH_INLINE void TransformArray::Reserve(size_t capacity)
+    {
+        m_blocks.reserve((capacity + LaneCount - 1) / LaneCount);
+    }
+
+
+    AZ_MATH_INLINE void TransformArray::Clear()
+    {
+        m_blocks.clear();
+        m_size = 0;
+    }
+
+
+    AZ_MATH_INLINE void TransformArray::PushBack(const Transform& value)
+    {
+        Resize(m_size + 1);
+        SetElement(m_size - 1, value);
+    }
+
+
+    AZ_MATH_INLINE size_t TransformArray::GetSize() const
+    {
+        return m_size;
+    }
+
+
+    AZ_MATH_INLINE bool TransformArray::IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+
+    AZ_MATH_INLINE Transform TransformArray::GetElement(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range, the array has %zu elements", index, m_size);
+        const Block& block = m_blocks[index / LaneCount];
+        const size_t lane = index % LaneCount;
+        return Transform(
+            Vector3(GetLane(block.m_translationX, lane), GetLane(block.m_translationY, lane), GetLane(block.m_translationZ, lane)),
+            Quaternion(GetLane(block.m_rotationX, lane), GetLane(block.m_rotationY, lane), GetLane(block.m_rotationZ, lane),
+                GetLane(block.m_rotationW, lane)),
+            GetLane(block.m_scale, lane));
+    }
+
+
+    AZ_MATH_INLINE void TransformArray::SetElement(size_t index, const Transform& value)
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range, the array has %zu elements", index, m_size);
+        SetLane(m_blocks[index / LaneCount], index % LaneCount, value);
+    }
+
+
+    AZ_MATH_INLINE void TransformArray::SetLane(Block& block, size_t lane, const Transform& value)
+    {
+        const Quaternion& rotation = value.GetRotation();
+        const Vector3& translation = value.GetTranslation();
+        GetLane(block.m_rotationX, lane) = rotation.GetX();
+        GetLane(block.m_rotationY, lane) = rotation.GetY();
+        GetLane(block.m_rotationZ, lane) = rotation.GetZ();
+        GetLane(block.m_rotationW, lane) = rotation.GetW();
+        GetLane(block.m_scale, lane) = value.GetUniformScale();
+        GetLane(block.m_translationX, lane) = translation.GetX();
+        GetLane(block.m_translationY, lane) = translation.GetY();
+        GetLane(block.m_translationZ, lane) = translation.GetZ();
+    }
+
+
+    AZ_MATH_INLINE TransformArray::Block TransformArray::CreateIdentityBlock()
+    {
+        const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+        const Simd::Vec4::FloatType one = Simd::Vec4::Splat(1.0f);
+        return Block{ zero, zero, zero, one, one, zero, zero, zero };
+    }
+
+
+    AZ_MATH_INLINE float& TransformArray::GetLane(Simd::Vec4::FloatType& block, size_t lane)
+    {
+        return reinterpret_cast<float*>(&block)[lane];
+    }
+
+
+    AZ_MATH_INLINE float TransformArray::GetLane(const Simd::Vec4::FloatType& block, size_t lane)
+    {
+        return reinterpret_cast<const float*>(&block)[lane];
+    }
+} // namespace AZ
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Vector3Array.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Internal/BatchMath_avx2.h>
+
+namespace AZ
+{
+    void Vector3Array::Dot(const Vector3Array& rhs, float* results) const
+    {
+        AZ_MATH_ASSERT(rhs.GetSize() == m_size, "Both arrays need to have the same size");
+
+        using Simd::Vec4;
+        const size_t fullBlockCount = m_size / LaneCount;
+        for (size_t block = 0; block < fullBlockCount; ++block)
+        {
+            const Vec4::FloatType dot = Vec4::Madd(m_x[block], rhs.m_x[block],
+                Vec4::Madd(m_y[block], rhs.m_y[block], Vec4::Mul(m_z[block], rhs.m_z[block])));
+            Vec4::StoreUnaligned(results + block * LaneCount, dot);
+        }
+
+        // results only has room for m_size floats, so the last partial block is written lane by lane
+        for (size_t index = fullBlockCount * LaneCount; index < m_size; ++index)
+        {
+            results[index] = GetElement(index).Dot(rhs.GetElement(index));
+        }
+    }
+
+
+    void Vector3Array::Cross(const Vector3Array& rhs, Vector3Array& results) const
+    {
+        AZ_MATH_ASSERT(rhs.GetSize() == m_size, "Both arrays need to have the same size");
+
+        using Simd::Vec4;
+        results.Resize(m_size);
+        for (size_t block = 0; block < GetBlockCount(); ++block)
+        {
+            const Vec4::FloatType x1 = m_x[block];
+            const Vec4::FloatType y1 = m_y[block];
+            const Vec4::FloatType z1 = m_z[block];
+            const Vec4::FloatType x2 = rhs.m_x[block];
+            const Vec4::FloatType y2 = rhs.m_y[block];
+            const Vec4::FloatType z2 = rhs.m_z[block];
+            results.m_x[block] = Vec4::Sub(Vec4::Mul(y1, z2), Vec4::Mul(z1, y2));
+            results.m_y[block] = Vec4::Sub(Vec4::Mul(z1, x2), Vec4::Mul(x1, z2));
+            results.m_z[block] = Vec4::Sub(Vec4::Mul(x1, y2), Vec4::Mul(y1, x2));
+        }
+    }
+
+
+    void Vector3Array::NormalizeSafe(float tolerance)
+    {
+        using Simd::Vec4;
+        const Vec4::FloatType toleranceSquared = Vec4::Splat(tolerance * tolerance);
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        for (size_t block = 0; block < GetBlockCount(); ++block)
+        {
+            const Vec4::FloatType lengthSquared = Vec4::Madd(m_x[block], m_x[block],
+                Vec4::Madd(m_y[block], m_y[block], Vec4::Mul(m_z[block], m_z[block])));
+
+            // Vectors below the tolerance are divided by one and then masked out, so no lane ever divides by zero.
+            const Vec4::FloatType tooShort = Vec4::CmpLt(lengthSquared, toleranceSquared);
+            const Vec4::FloatType lengthInv = Vec4::AndNot(tooShort, Vec4::Div(one, Vec4::Sqrt(Vec4::Select(one, lengthSquared, tooShort))));
+
+            m_x[block] = Vec4::Mul(m_x[block], lengthInv);
+            m_y[block] = Vec4::Mul(m_y[block], lengthInv);
+            m_z[block] = Vec4::Mul(m_z[block], lengthInv);
+        }
+    }
+
+
+    void Vector3Array::TransformPoints(const Transform& transform, Vector3Array& results) const
+    {
+        using Simd::Vec4;
+        results.Resize(m_size);
+
+        // Transforming by the equivalent 3x4 matrix takes three multiply-adds per component,
+        // while the quaternion rotation used by Transform::TransformPoint takes about three times as many instructions.
+        const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(transform);
+
+        // Process as many points as possible 8 at a time if the cpu supports AVX2, the rest is processed 4 at a time below.
+        size_t firstBlock = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        if (Simd::IsAvx2Enabled())
+        {
+            float rows[3][4];
+            matrix.StoreToRowMajorFloat12(&rows[0][0]);
+            const float* const points[3] = { GetXData(), GetYData(), GetZData() };
+            float* const resultData[3] = { results.GetXData(), results.GetYData(), results.GetZData() };
+            firstBlock = Simd::Avx2::TransformPoints(rows, points, resultData, m_size) / LaneCount;
+        }
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+
+        Vec4::FloatType elements[3][4];
+        for (int32_t row = 0; row < 3; ++row)
+        {
+            for (int32_t col = 0; col < 4; ++col)
+            {
+                elements[row][col] = Vec4::Splat(matrix.GetElement(row, col));
+            }
+        }
+
+        for (size_t block = firstBlock; block < GetBlockCount(); ++block)
+        {
+            const Vec4::FloatType x = m_x[block];
+            const Vec4::FloatType y = m_y[block];
+            const Vec4::FloatType z = m_z[block];
+            results.m_x[block] = Vec4::Madd(elements[0][0], x, Vec4::Madd(elements[0][1], y, Vec4::Madd(elements[0][2], z, elements[0][3])));
+            results.m_y[block] = Vec4::Madd(elements[1][0], x, Vec4::Madd(elements[1][1], y, Vec4::Madd(elements[1][2], z, elements[1][3])));
+            results.m_z[block] = Vec4::Madd(elements[2][0], x, Vec4::Madd(elements[2][1], y, Vec4::Madd(elements[2][2], z, elements[2][3])));
+        }
+    }
+} // namespace AZ
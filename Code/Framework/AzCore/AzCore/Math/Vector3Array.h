@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Transform;
+
+    //! A batch of Vector3's stored as a structure of arrays, so the x, y and z components of all vectors are each stored
+    //! contiguously. Operations on the batch process Simd::Vec4::ElementCount vectors at once using the platform's SIMD
+    //! instructions, which is considerably faster than processing thousands of AZ::Vector3's one at a time.
+    //! The component arrays are padded to a multiple of the SIMD width.
+    class Vector3Array
+    {
+    public:
+        AZ_TYPE_INFO(Vector3Array, "{3F6D1B0E-8A2C-4E57-9C41-D7B25E0A6F93}");
+
+        //! The number of vectors processed at once.
+        static constexpr size_t LaneCount = Simd::Vec4::ElementCount;
+
+        Vector3Array() = default;
+        explicit Vector3Array(size_t size);
+
+        //! Resizes the batch, new vectors are initialized to zero.
+        void Resize(size_t size);
+        void Reserve(size_t capacity);
+        void Clear();
+
+        void PushBack(const Vector3& value);
+
+        size_t GetSize() const;
+        bool IsEmpty() const;
+
+        Vector3 GetElement(size_t index) const;
+        void SetElement(size_t index, const Vector3& value);
+
+        //! Access to the contiguous component arrays, each with GetSize() elements.
+        //! @{
+        float* GetXData();
+        float* GetYData();
+        float* GetZData();
+        const float* GetXData() const;
+        const float* GetYData() const;
+        const float* GetZData() const;
+        //! @}
+
+        //! Stores the dot product of each vector with the vector at the same index in rhs in results.
+        //! results must have room for GetSize() floats.
+        void Dot(const Vector3Array& rhs, float* results) const;
+
+        //! Stores the cross product of each vector with the vector at the same index in rhs in results.
+        //! results may be this array or rhs.
+        void Cross(const Vector3Array& rhs, Vector3Array& results) const;
+
+        //! Normalizes all vectors, vectors shorter than tolerance are set to zero, just like Vector3::NormalizeSafe.
+        void NormalizeSafe(float tolerance = Constants::Tolerance);
+
+        //! Transforms all vectors as points by the transform and stores them in results, results may be this array.
+        void TransformPoints(const Transform& transform, Vector3Array& results) const;
+
+        //! Access to the blocks of LaneCount components, used to implement batch operations.
+        //! @{
+        size_t GetBlockCount() const;
+        Simd::Vec4::FloatType* GetXBlocks();
+        Simd::Vec4::FloatType* GetYBlocks();
+        Simd::Vec4::FloatType* GetZBlocks();
+        const Simd::Vec4::FloatType* GetXBlocks() const;
+        const Simd::Vec4::FloatType* GetYBlocks() const;
+        const Simd::Vec4::FloatType* GetZBlocks() const;
+        //! @}
+
+    private:
+        AZStd::vector<Simd::Vec4::FloatType> m_x;
+        AZStd::vector<Simd::Vec4::FloatType> m_y;
+        AZStd::vector<Simd::Vec4::FloatType> m_z;
+        size_t m_size = 0;
+    };
+} // namespace AZ
+
+#include <AzCore/Math/Vector3Array.inl>
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE Vector3Array::Vector3Array(size_t size)
+    {
+        Resize(size);
+    }
+
+
+    AZ_MATH_INLINE void Vector3Array::Resize(size_t size)
+    {
+        const size_t blockCount = (size + LaneCount - 1) / LaneCount;
+        m_x.resize(blockCount, Simd::Vec4::ZeroFloat());
+        m_y.resize(blockCount, Simd::Vec4::ZeroFloat());
+        m_z.resize(blockCount, Simd::Vec4::ZeroFloat());
+
+        // Batch operations write to the padding in the last block, so clear it for vectors added to the block.
+        for (size_t index = AZStd::min(m_size, size); index < blockCount * LaneCount; ++index)
+        {
+            GetXData()[index] = 0.0f;
+            GetYData()[index] = 0.0f;
+            GetZData()[index] = 0.0f;
+        }
+        m_size = size;
+    }
+
+
+    AZ_MATH_INLINE void Vector3Array::Reserve(size_t capacity)
+    {
+        const size_t blockCount = (capacity + LaneCount - 1) / LaneCount;
+        m_x.reserve(blockCount);
+        m_y.reserve(blockCount);
+        m_z.reserve(blockCount);
+    }
+
+
+    AZ_MATH_INLINE void Vector3Array::Clear()
+    {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+        m_size = 0;
+    }
+
+
+    AZ_MATH_INLINE void Vector3Array::PushBack(const Vector3& value)
+    {
+        Resize(m_size + 1);
+        SetElement(m_size - 1, value);
+    }
+
+
+    AZ_MATH_INLINE size_t Vector3Array::GetSize() const
+    {
+        return m_size;
+    }
+
+
+    AZ_MATH_INLINE bool Vector3Array::IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+
+    AZ_MATH_INLINE Vector3 Vector3Array::GetElement(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range, the array has %zu elements", index, m_size);
+        return Vector3(GetXData()[index], GetYData()[index], GetZData()[index]);
+    }
+
+
+    AZ_MATH_INLINE void Vector3Array::SetElement(size_t index, const Vector3& value)
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range, the array has %zu elements", index, m_size);
+        GetXData()[index] = value.GetX();
+        GetYData()[index] = value.GetY();
+        GetZData()[index] = value.GetZ();
+    }
+
+
+    AZ_MATH_INLINE float* Vector3Array::GetXData()
+    {
+        return reinterpret_cast<float*>(m_x.data());
+    }
+
+
+    AZ_MATH_INLINE float* Vector3Array::GetYData()
+    {
+        return reinterpret_cast<float*>(m_y.data());
+    }
+
+
+    AZ_MATH_INLINE float* Vector3Array::GetZData()
+    {
+        return reinterpret_cast<float*>(m_z.data());
+    }
+
+
+    AZ_MATH_INLINE const float* Vector3Array::GetXData() const
+    {
+        return reinterpret_cast<const float*>(m_x.data());
+    }
+
+
+    AZ_MATH_INLINE const float* Vector3Array::GetYData() const
+    {
+        return reinterpret_cast<const float*>(m_y.data());
+    }
+
+
+    AZ_MATH_INLINE const float* Vector3Array::GetZData() const
+    {
+        return reinterpret_cast<const float*>(m_z.data());
+    }
+
+
+    AZ_MATH_INLINE size_t Vector3Array::GetBlockCount() const
+    {
+        return m_x.size();
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec4::FloatType* Vector3Array::GetXBlocks()
+    {
+        return m_x.data();
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec4::FloatType* Vector3Array::GetYBlocks()
+    {
+        return m_y.data();
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec4::FloatType* Vector3Array::GetZBlocks()
+    {
+        return m_z.data();
+    }
+
+
+    AZ_MATH_INLINE const Simd::Vec4::FloatType* Vector3Array::GetXBlocks() const
+    {
+        return m_x.data();
+    }
+
+
+    AZ_MATH_INLINE const Simd::Vec4::FloatType* Vector3Array::GetYBlocks() const
+    {
+        return m_y.data();
+    }
+
+
+    AZ_MATH_INLINE const Simd::Vec4::FloatType* Vector3Array::GetZBlocks() const
+    {
+        return m_z.data();
+    }
+} // namespace AZ
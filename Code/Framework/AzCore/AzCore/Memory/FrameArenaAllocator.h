@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /*!
+        * Template you can use to create your own frame arena allocators, as you can't inherit from FrameArenaAllocator.
+        * This is the case because we use thread local storage and we need separate "static" instance for each allocator.
+        * Individual allocations are not profiled or recorded since they are released in bulk by ResetFrame.
+        */
+        template<class Schema>
+        class FrameArenaAllocatorHelper
+            : public SimpleSchemaAllocator<Schema, typename Schema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+        {
+        public:
+            using Base = SimpleSchemaAllocator<Schema, typename Schema::Descriptor, false, true>;
+            using Descriptor = typename Schema::Descriptor;
+
+            FrameArenaAllocatorHelper(const char* name, const char* desc)
+                : Base(name, desc)
+            {
+            }
+
+            bool Create(const Descriptor& descriptor = Descriptor())
+            {
+                AZ_Assert(this->IsReady() == false, "Allocator was already created!");
+                if (this->IsReady())
+                {
+                    return false;
+                }
+
+                bool isReady = static_cast<Base*>(this)->Create(descriptor);
+                if (isReady)
+                {
+                    isReady = static_cast<Schema*>(this->m_schema)->Create(descriptor);
+                }
+
+                return isReady;
+            }
+
+            void Destroy() override
+            {
+                static_cast<Schema*>(this->m_schema)->Destroy();
+                Base::Destroy();
+            }
+
+            AllocatorDebugConfig GetDebugConfig() override
+            {
+                return AllocatorDebugConfig().ExcludeFromDebugging();
+            }
+
+            //! Releases all memory allocated by all threads since the previous reset in O(1). Call this once per frame
+            //! when no transient data of the previous frame is in use anymore, e.g.
+            //! static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).ResetFrame();
+            void ResetFrame()
+            {
+                static_cast<Schema*>(this->m_schema)->ResetFrame();
+            }
+
+            FrameArenaAllocatorHelper& operator=(const FrameArenaAllocatorHelper&) = delete;
+        };
+    }
+
+    template<class Allocator>
+    using FrameArenaBase = Internal::FrameArenaAllocatorHelper<FrameArenaSchemaHelper<Allocator>>;
+
+    /*!
+     * Frame arena allocator
+     * Thread safe linear allocator for transient per frame data. See FrameArenaSchema for details. If you want to create
+     * your own frame arena, for example one that is reset at a different cadence, inherit from FrameArenaBase, as we
+     * need a unique static variable for each allocator type.
+     */
+    class FrameArenaAllocator final
+        : public FrameArenaBase<FrameArenaAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaAllocator, SystemAllocator, 0);
+        AZ_TYPE_INFO(FrameArenaAllocator, "{1D46668F-07A9-45FA-9BFE-AB0D803175C6}");
+
+        using Base = FrameArenaBase<FrameArenaAllocator>;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Thread safe linear allocator for transient per frame data")
+        {
+        }
+    };
+
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+}
@@ -0,0 +1,462 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Header at the start of every page, allocations are carved from the memory following it.
+     */
+    struct alignas(16) FrameArenaPage
+    {
+        FrameArenaPage* m_next = nullptr;
+        size_t m_size = 0; ///< Total size of the page including this header.
+
+        char* Begin()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        char* End()
+        {
+            return reinterpret_cast<char*>(this) + m_size;
+        }
+    };
+
+    /**
+     * Per thread arena state. Only the owning thread modifies it, other threads only read the allocated byte count.
+     */
+    struct FrameArenaThreadData
+    {
+        FrameArenaPage* m_firstPage = nullptr;
+        FrameArenaPage* m_currentPage = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;
+        AZStd::atomic<AZ::u64> m_frame{ 0 };
+        AZ::u64 m_collectGeneration = 0;
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+    };
+
+    /**
+     * FrameArenaSchema Implementation... to keep the header clean.
+     */
+    class FrameArenaSchemaImpl
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaSchemaImpl, SystemAllocator, 0)
+
+        // Minimum alignment of all allocations, matching what the C heap guarantees.
+        static constexpr size_t DefaultAlignment = 16;
+
+        FrameArenaSchemaImpl(
+            const FrameArenaSchema::Descriptor& desc,
+            FrameArenaSchema::GetThreadData threadDataGetter,
+            FrameArenaSchema::SetThreadData threadDataSetter);
+        ~FrameArenaSchemaImpl();
+
+        void* Allocate(size_t byteSize, size_t alignment);
+        void DeAllocate(void* ptr);
+        size_t Resize(void* ptr, size_t newSize);
+        size_t AllocationSize(void* ptr);
+
+        FrameArenaThreadData* GetCurrentThreadData();
+        FrameArenaThreadData* CreateThreadData();
+        void Rewind(FrameArenaThreadData& threadData, AZ::u64 frame);
+        char* AllocateFromNextPage(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment);
+        FrameArenaPage* ConstructPage(size_t pageSize);
+        void FreePage(FrameArenaPage* page);
+
+        IAllocatorSchema* m_pageAllocator;
+        size_t m_pageSize;
+        FrameArenaSchema::GetThreadData m_threadDataGetter;
+        FrameArenaSchema::SetThreadData m_threadDataSetter;
+
+        AZStd::atomic<AZ::u64> m_frame{ 1 };
+        AZStd::atomic<AZ::u64> m_collectGeneration{ 0 };
+        AZStd::atomic<size_t> m_capacity{ 0 };
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<FrameArenaThreadData*> m_threads;
+    };
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(GetThreadData getThreadData, SetThreadData setThreadData)
+        : m_impl(nullptr)
+        , m_threadDataGetter(getThreadData)
+        , m_threadDataSetter(setThreadData)
+    {
+    }
+
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        AZ_Assert(m_impl == nullptr, "You did not destroy the frame arena schema!");
+        delete m_impl;
+    }
+
+    bool FrameArenaSchema::Create(const Descriptor& desc)
+    {
+        AZ_Assert(m_impl == nullptr, "FrameArenaSchema already created!");
+        if (m_impl == nullptr)
+        {
+            m_impl = aznew FrameArenaSchemaImpl(desc, m_threadDataGetter, m_threadDataSetter);
+        }
+        return (m_impl != nullptr);
+    }
+
+    bool FrameArenaSchema::Destroy()
+    {
+        delete m_impl;
+        m_impl = nullptr;
+        return true;
+    }
+
+    void FrameArenaSchema::ResetFrame()
+    {
+        // Threads compare their frame against this counter on their next allocation and rewind when it changed.
+        m_impl->m_frame.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    FrameArenaSchema::pointer_type FrameArenaSchema::Allocate(
+        size_type byteSize,
+        size_type alignment,
+        int flags,
+        const char* name,
+        const char* fileName,
+        int lineNum,
+        unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+        return m_impl->Allocate(byteSize, alignment);
+    }
+
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        m_impl->DeAllocate(ptr);
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        return m_impl->Resize(ptr, newSize);
+    }
+
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return m_impl->Allocate(newSize, newAlignment);
+        }
+
+        // Grow in place when this is the last allocation of the thread, otherwise move to a new block.
+        if (newAlignment <= FrameArenaSchemaImpl::DefaultAlignment || (reinterpret_cast<size_t>(ptr) & (newAlignment - 1)) == 0)
+        {
+            if (m_impl->Resize(ptr, newSize) == newSize)
+            {
+                return ptr;
+            }
+        }
+
+        // The size of older allocations isn't tracked, the size is only known for the most recent allocation
+        // which would have been resized above unless it didn't fit in the page.
+        size_type oldSize = m_impl->AllocationSize(ptr);
+        AZ_Assert(oldSize != 0, "FrameArenaSchema can only reallocate the most recent allocation of the calling thread.");
+        if (oldSize == 0)
+        {
+            return nullptr;
+        }
+
+        pointer_type newPtr = m_impl->Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::min(oldSize, newSize));
+        }
+        return newPtr;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        return m_impl->AllocationSize(ptr);
+    }
+
+    void FrameArenaSchema::GarbageCollect()
+    {
+        m_impl->m_collectGeneration.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    auto FrameArenaSchema::GetMaxContiguousAllocationSize() const -> size_type
+    {
+        return AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        size_type bytesAllocated = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
+            const AZ::u64 frame = m_impl->m_frame.load(AZStd::memory_order_relaxed);
+            for (const FrameArenaThreadData* threadData : m_impl->m_threads)
+            {
+                // Threads that didn't allocate since the last reset haven't rewound yet, their memory is already released
+                if (threadData->m_frame.load(AZStd::memory_order_relaxed) == frame)
+                {
+                    bytesAllocated += threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+                }
+            }
+        }
+        return bytesAllocated;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        return m_impl->m_capacity.load(AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // FrameArenaSchemaImpl
+    //=========================================================================
+    FrameArenaSchemaImpl::FrameArenaSchemaImpl(
+        const FrameArenaSchema::Descriptor& desc,
+        FrameArenaSchema::GetThreadData threadDataGetter,
+        FrameArenaSchema::SetThreadData threadDataSetter)
+        : m_pageAllocator(desc.m_pageAllocator)
+        , m_pageSize(AZStd::max(desc.m_pageSize, sizeof(FrameArenaPage) + DefaultAlignment))
+        , m_threadDataGetter(threadDataGetter)
+        , m_threadDataSetter(threadDataSetter)
+    {
+        if (m_pageAllocator == nullptr)
+        {
+            m_pageAllocator = &AllocatorInstance<SystemAllocator>::Get(); // use the SystemAllocator if no page allocator is provided
+        }
+    }
+
+    FrameArenaSchemaImpl::~FrameArenaSchemaImpl()
+    {
+        // IMPORTANT: We assume/rely that all threads (except the calling one) are or will
+        // destroyed before you create another instance of the frame arena, same as the thread pool.
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (FrameArenaThreadData* threadData : m_threads)
+        {
+            FrameArenaPage* page = threadData->m_firstPage;
+            while (page)
+            {
+                FrameArenaPage* next = page->m_next;
+                FreePage(page);
+                page = next;
+            }
+            threadData->~FrameArenaThreadData();
+            m_pageAllocator->DeAllocate(threadData, sizeof(FrameArenaThreadData), alignof(FrameArenaThreadData));
+        }
+        m_threads.clear();
+
+        // reset the variable for the owner thread.
+        m_threadDataSetter(nullptr);
+    }
+
+    FrameArenaThreadData* FrameArenaSchemaImpl::GetCurrentThreadData()
+    {
+        FrameArenaThreadData* threadData = m_threadDataGetter();
+        if (threadData)
+        {
+            AZ::u64 frame = m_frame.load(AZStd::memory_order_acquire);
+            if (threadData->m_frame.load(AZStd::memory_order_relaxed) != frame)
+            {
+                Rewind(*threadData, frame);
+            }
+        }
+        return threadData;
+    }
+
+    FrameArenaThreadData* FrameArenaSchemaImpl::CreateThreadData()
+    {
+        void* memory = m_pageAllocator->Allocate(
+            sizeof(FrameArenaThreadData), alignof(FrameArenaThreadData), 0, "AZSystem::FrameArenaSchema::CreateThreadData", __FILE__, __LINE__);
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        FrameArenaThreadData* threadData = new (memory) FrameArenaThreadData;
+        threadData->m_firstPage = ConstructPage(m_pageSize);
+        threadData->m_collectGeneration = m_collectGeneration.load(AZStd::memory_order_relaxed);
+        Rewind(*threadData, m_frame.load(AZStd::memory_order_acquire));
+
+        m_threadDataSetter(threadData);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_threads.push_back(threadData);
+        }
+        return threadData;
+    }
+
+    void FrameArenaSchemaImpl::Rewind(FrameArenaThreadData& threadData, AZ::u64 frame)
+    {
+        AZ::u64 collectGeneration = m_collectGeneration.load(AZStd::memory_order_acquire);
+        if (threadData.m_collectGeneration != collectGeneration && threadData.m_currentPage)
+        {
+            // Free the pages that weren't touched during the frame that just ended
+            FrameArenaPage* page = threadData.m_currentPage->m_next;
+            threadData.m_currentPage->m_next = nullptr;
+            while (page)
+            {
+                FrameArenaPage* next = page->m_next;
+                FreePage(page);
+                page = next;
+            }
+        }
+        threadData.m_collectGeneration = collectGeneration;
+
+        threadData.m_frame.store(frame, AZStd::memory_order_relaxed);
+        threadData.m_currentPage = threadData.m_firstPage;
+        threadData.m_lastAllocation = nullptr;
+        if (threadData.m_firstPage)
+        {
+            threadData.m_cursor = threadData.m_firstPage->Begin();
+            threadData.m_end = threadData.m_firstPage->End();
+        }
+        threadData.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    void* FrameArenaSchemaImpl::Allocate(size_t byteSize, size_t alignment)
+    {
+        FrameArenaThreadData* threadData = GetCurrentThreadData();
+        if (threadData == nullptr)
+        {
+            threadData = CreateThreadData();
+        }
+        if (threadData == nullptr || threadData->m_currentPage == nullptr)
+        {
+            return nullptr;
+        }
+
+        alignment = AZStd::max(alignment, DefaultAlignment);
+        char* address = PointerAlignUp(threadData->m_cursor, alignment);
+        if (address > threadData->m_end || static_cast<size_t>(threadData->m_end - address) < byteSize)
+        {
+            address = AllocateFromNextPage(*threadData, byteSize, alignment);
+            if (address == nullptr)
+            {
+                return nullptr;
+            }
+        }
+
+        threadData->m_cursor = address + byteSize;
+        threadData->m_lastAllocation = address;
+        threadData->m_allocatedBytes.store(
+            threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    char* FrameArenaSchemaImpl::AllocateFromNextPage(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment)
+    {
+        // Move on to the next page that is kept from previous frames and large enough
+        FrameArenaPage* page = threadData.m_currentPage;
+        while (page->m_next)
+        {
+            page = page->m_next;
+            char* address = PointerAlignUp(page->Begin(), alignment);
+            if (address <= page->End() && static_cast<size_t>(page->End() - address) >= byteSize)
+            {
+                threadData.m_currentPage = page;
+                threadData.m_end = page->End();
+                return address;
+            }
+        }
+
+        // Append a new page, oversized allocations get a page of their own
+        FrameArenaPage* newPage = ConstructPage(AZStd::max(m_pageSize, sizeof(FrameArenaPage) + byteSize + alignment));
+        if (newPage == nullptr)
+        {
+            return nullptr;
+        }
+        page->m_next = newPage;
+        threadData.m_currentPage = newPage;
+        threadData.m_end = newPage->End();
+        return PointerAlignUp(newPage->Begin(), alignment);
+    }
+
+    void FrameArenaSchemaImpl::DeAllocate(void* ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        // Only the most recent allocation can be returned to the arena, everything else is released by the next reset
+        FrameArenaThreadData* threadData = GetCurrentThreadData();
+        if (threadData && ptr == threadData->m_lastAllocation)
+        {
+            size_t size = threadData->m_cursor - threadData->m_lastAllocation;
+            threadData->m_allocatedBytes.store(
+                threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed) - size, AZStd::memory_order_relaxed);
+            threadData->m_cursor = threadData->m_lastAllocation;
+            threadData->m_lastAllocation = nullptr;
+        }
+    }
+
+    size_t FrameArenaSchemaImpl::Resize(void* ptr, size_t newSize)
+    {
+        FrameArenaThreadData* threadData = GetCurrentThreadData();
+        if (threadData && ptr != nullptr && ptr == threadData->m_lastAllocation &&
+            static_cast<size_t>(threadData->m_end - threadData->m_lastAllocation) >= newSize)
+        {
+            size_t oldSize = threadData->m_cursor - threadData->m_lastAllocation;
+            threadData->m_cursor = threadData->m_lastAllocation + newSize;
+            threadData->m_allocatedBytes.store(
+                threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed) - oldSize + newSize, AZStd::memory_order_relaxed);
+            return newSize;
+        }
+        return 0;
+    }
+
+    size_t FrameArenaSchemaImpl::AllocationSize(void* ptr)
+    {
+        FrameArenaThreadData* threadData = GetCurrentThreadData();
+        if (threadData && ptr != nullptr && ptr == threadData->m_lastAllocation)
+        {
+            return threadData->m_cursor - threadData->m_lastAllocation;
+        }
+        return 0;
+    }
+
+    FrameArenaPage* FrameArenaSchemaImpl::ConstructPage(size_t pageSize)
+    {
+        void* memory = m_pageAllocator->Allocate(pageSize, alignof(FrameArenaPage), 0, "AZSystem::FrameArenaSchema::ConstructPage", __FILE__, __LINE__);
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        m_capacity.fetch_add(pageSize, AZStd::memory_order_relaxed);
+        FrameArenaPage* page = new (memory) FrameArenaPage;
+        page->m_size = pageSize;
+        return page;
+    }
+
+    void FrameArenaSchemaImpl::FreePage(FrameArenaPage* page)
+    {
+        size_t pageSize = page->m_size;
+        m_capacity.fetch_sub(pageSize, AZStd::memory_order_relaxed);
+        page->~FrameArenaPage();
+        m_pageAllocator->DeAllocate(page, pageSize, alignof(FrameArenaPage));
+    }
+} // namespace AZ
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    struct FrameArenaThreadData;
+
+    /**
+     * Frame arena allocator schema.
+     * Linear (bump pointer) allocation for transient data that only lives until the end of the frame, such as
+     * per view work lists or debug draw queues. Every thread allocates from its own chain of pages, so allocations
+     * don't require any synchronization. Individual deallocations are ignored, except for the most recent allocation
+     * of a thread which is rolled back (this makes growing containers cheap). All memory is reclaimed at once by
+     * ResetFrame, which is O(1) as threads rewind lazily on their next allocation. Pages are kept for the next frame.
+     * IMPORTANT: Memory allocated before a call to ResetFrame can't be accessed after the call.
+     */
+    class FrameArenaSchema
+        : public IAllocatorSchema
+    {
+    public:
+        // Functions for getting an instance of FrameArenaThreadData when using thread local storage
+        typedef FrameArenaThreadData* (*GetThreadData)();
+        typedef void (*SetThreadData)(FrameArenaThreadData*);
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_pageSize(256 * 1024)
+                , m_pageAllocator(nullptr)
+            {}
+
+            size_t              m_pageSize;         ///< Page size in bytes. Allocations larger than a page get a page of their own.
+            IAllocatorSchema*   m_pageAllocator;    ///< If you provide this interface we will use it for page allocations, otherwise SystemAllocator will be used.
+        };
+
+        FrameArenaSchema(GetThreadData getThreadData, SetThreadData setThreadData);
+        ~FrameArenaSchema();
+
+        bool Create(const Descriptor& desc);
+        bool Destroy();
+
+        /// Releases all allocations made by all threads since the previous reset.
+        void ResetFrame();
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment) override;
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+
+        /// Frees the pages that each thread didn't need during its last frame. Like ResetFrame this is deferred until
+        /// the next allocation of a thread, as only the owning thread can access its pages.
+        void GarbageCollect() override;
+
+        size_type GetMaxContiguousAllocationSize() const override;
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+
+    protected:
+        FrameArenaSchema(const FrameArenaSchema&);
+        FrameArenaSchema& operator=(const FrameArenaSchema&);
+
+        class FrameArenaSchemaImpl* m_impl;
+        GetThreadData m_threadDataGetter;
+        SetThreadData m_threadDataSetter;
+    };
+
+    /**
+     * Helper class to allow multiple instances of frame arenas that can
+     * operate independent from each other. Your frame arena allocator should inherit from that class.
+     */
+    template<class Allocator>
+    class FrameArenaSchemaHelper
+        : public FrameArenaSchema
+    {
+    public:
+        FrameArenaSchemaHelper(const Descriptor& desc = Descriptor())
+            : FrameArenaSchema(&GetThreadData, &SetThreadData)
+        {
+            // Descriptor is ignored here; Create() must be called directly on the schema
+            (void)desc;
+        }
+
+    protected:
+        static FrameArenaThreadData* GetThreadData()
+        {
+            return m_threadData;
+        }
+
+        static void SetThreadData(FrameArenaThreadData* data)
+        {
+            m_threadData = data;
+        }
+
+        static AZ_THREAD_LOCAL FrameArenaThreadData* m_threadData;
+    };
+
+    template<class Allocator>
+    AZ_THREAD_LOCAL FrameArenaThreadData* FrameArenaSchemaHelper<Allocator>::m_threadData = nullptr;
+}
@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/intrusive_slist.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -234,6 +235,12 @@ namespace AZ
         void GarbageCollect();
         //////////////////////////////////////////////////////////////////////////
 
+        // Per thread magazine caches
+        void RefillMagazine(ThreadPoolData* threadData, size_t bucketIndex, size_t elementSize);
+        void FlushMagazine(ThreadPoolData* threadData, size_t bucketIndex, u32 numElements);
+        void FlushAllMagazines(ThreadPoolData* threadData);
+        void DeAllocateFreedElements(ThreadPoolData* threadData);
+
         // Functions used by PoolAllocation template
         AZ_INLINE Page* PopFreePage();
         AZ_INLINE void PushFreePage(Page* page);
@@ -310,6 +317,8 @@ namespace AZ
         bool m_isDynamic;
         // TODO rbbaklov Changed to recursive_mutex from mutex for Linux support.
         AZStd::recursive_mutex m_mutex;
+        /// Incremented by GarbageCollect, threads return their cached elements when they see a new value.
+        AZStd::atomic<u32> m_collectGeneration{ 0 };
     };
 
     struct ThreadPoolData
@@ -328,8 +337,32 @@ namespace AZ
             ThreadPoolSchemaImpl::Page::FakeNodeLF,
             AZStd::lock_free_intrusive_stack_base_hook<ThreadPoolSchemaImpl::Page::FakeNodeLF>>;
 
+        /**
+         * Small cache of free elements for one bucket, linked through the elements themselves. Allocations and deallocations
+         * are served from the magazine without touching the pages, elements are exchanged with the pool in batches when
+         * the magazine runs empty or overflows. The cached elements can belong to pages owned by other threads, they are
+         * returned to their owner with a single push per owner when flushed.
+         */
+        struct Magazine
+        {
+            struct Node
+            {
+                Node* m_next;
+            };
+
+            Node* m_head = nullptr;
+            u32 m_numElements = 0;
+            u32 m_capacity = 0;
+        };
+
+        static constexpr u32 MaxMagazineElements = 32;
+        static constexpr size_t MaxMagazineBytes = 4 * 1024;
+
         AllocatorType m_allocator;
         FreedElementsStack m_freedElements;
+        Magazine* m_magazines; ///< One magazine per bucket.
+        size_t m_numCachedBytes; ///< Bytes in the magazines, the pools count them as allocated.
+        u32 m_collectGeneration;
     };
 } // namespace AZ
 
@@ -1073,6 +1106,11 @@ namespace AZ
             {
                 bytesAllocated += m_impl->m_threads[i]->m_allocator.m_numBytesAllocated;
             }
+            // elements cached in the magazines are free, even if the pools still count them
+            for (size_t i = 0; i < m_impl->m_threads.size(); ++i)
+            {
+                bytesAllocated -= m_impl->m_threads[i]->m_numCachedBytes;
+            }
         }
         return bytesAllocated;
     }
@@ -1200,23 +1238,47 @@ namespace AZ
         if (threadData == nullptr)
         {
             threadData = aznew ThreadPoolData(this, m_pageSize, m_minAllocationSize, m_maxAllocationSize);
+            threadData->m_collectGeneration = m_collectGeneration.load(AZStd::memory_order_relaxed);
             m_threadPoolSetter(threadData);
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
                 m_threads.push_back(threadData);
             }
         }
-        else
+        else if (threadData->m_collectGeneration != m_collectGeneration.load(AZStd::memory_order_relaxed))
+        {
+            // GarbageCollect was called, return the cached elements so their pages can be released.
+            threadData->m_collectGeneration = m_collectGeneration.load(AZStd::memory_order_relaxed);
+            FlushAllMagazines(threadData);
+            DeAllocateFreedElements(threadData);
+        }
+
+        ThreadPoolData::AllocatorType& allocator = threadData->m_allocator;
+        const size_t elementSize = AZ::SizeAlignUp(AZ::SizeAlignUp(byteSize, allocator.m_minAllocationSize), alignment);
+        if (byteSize == 0 || elementSize > allocator.m_maxAllocationSize)
         {
-            // deallocate elements if they were freed from other threads
-            Page::FakeNodeLF* fakeLFNode;
-            while ((fakeLFNode = threadData->m_freedElements.pop()) != nullptr)
+            // let the pool report the invalid request
+            return allocator.Allocate(byteSize, alignment);
+        }
+
+        // All elements of a bucket are aligned on the largest power of 2 that divides the element size, so any cached
+        // element can serve the request.
+        const size_t bucketIndex = (elementSize >> allocator.m_minAllocationShift) - 1;
+        ThreadPoolData::Magazine& magazine = threadData->m_magazines[bucketIndex];
+        if (magazine.m_head == nullptr)
+        {
+            RefillMagazine(threadData, bucketIndex, elementSize);
+            if (magazine.m_head == nullptr)
             {
-                threadData->m_allocator.DeAllocate(fakeLFNode);
+                return nullptr;
             }
         }
 
-        return threadData->m_allocator.Allocate(byteSize, alignment);
+        ThreadPoolData::Magazine::Node* node = magazine.m_head;
+        magazine.m_head = node->m_next;
+        --magazine.m_numElements;
+        threadData->m_numCachedBytes -= elementSize;
+        return node;
     }
 
     //=========================================================================
@@ -1233,14 +1295,23 @@ namespace AZ
         }
         AZ_Assert(page->m_threadData != nullptr, ("We must have valid page thread data for the page!"));
         ThreadPoolData* threadData = m_threadPoolGetter();
-        if (threadData == page->m_threadData)
+        if (threadData)
         {
-            // we can free here
-            threadData->m_allocator.DeAllocate(ptr);
+            // cache the element, even if it belongs to another thread it will be reused from here
+            ThreadPoolData::Magazine& magazine = threadData->m_magazines[page->m_bin];
+            ThreadPoolData::Magazine::Node* node = reinterpret_cast<ThreadPoolData::Magazine::Node*>(ptr);
+            node->m_next = magazine.m_head;
+            magazine.m_head = node;
+            ++magazine.m_numElements;
+            threadData->m_numCachedBytes += page->m_elementSize;
+            if (magazine.m_numElements > magazine.m_capacity)
+            {
+                FlushMagazine(threadData, page->m_bin, magazine.m_numElements - magazine.m_capacity / 2);
+            }
         }
         else
         {
-            // push this element to be deleted from it's own thread!
+            // this thread never allocated from the pool, push this element to be deleted from it's own thread!
             // cast the pointer to a fake lock free node
             Page::FakeNodeLF* fakeLFNode = reinterpret_cast<Page::FakeNodeLF*>(ptr);
 #ifdef AZ_DEBUG_BUILD
@@ -1267,6 +1338,120 @@ namespace AZ
         return page->m_threadData->m_allocator.AllocationSize(ptr);
     }
 
+    //=========================================================================
+    // RefillMagazine
+    //=========================================================================
+    void ThreadPoolSchemaImpl::RefillMagazine(ThreadPoolData* threadData, size_t bucketIndex, size_t elementSize)
+    {
+        // elements freed by other threads might have made pages available
+        DeAllocateFreedElements(threadData);
+
+        ThreadPoolData::Magazine& magazine = threadData->m_magazines[bucketIndex];
+        const u32 numElements = (magazine.m_capacity + 1) / 2;
+        for (u32 i = 0; i < numElements; ++i)
+        {
+            void* address = threadData->m_allocator.Allocate(elementSize, 1);
+            if (address == nullptr)
+            {
+                break;
+            }
+            ThreadPoolData::Magazine::Node* node = reinterpret_cast<ThreadPoolData::Magazine::Node*>(address);
+            node->m_next = magazine.m_head;
+            magazine.m_head = node;
+            ++magazine.m_numElements;
+            threadData->m_numCachedBytes += elementSize;
+        }
+    }
+
+    //=========================================================================
+    // FlushMagazine
+    //=========================================================================
+    void ThreadPoolSchemaImpl::FlushMagazine(ThreadPoolData* threadData, size_t bucketIndex, u32 numElements)
+    {
+        // Elements of other threads are collected in one chain per owner, so each owner is pushed to only once.
+        struct OwnerChain
+        {
+            ThreadPoolData* m_owner;
+            Page::FakeNodeLF* m_first;
+            Page::FakeNodeLF* m_last;
+        };
+        OwnerChain chains[ThreadPoolData::MaxMagazineElements + 1];
+        size_t numChains = 0;
+
+        ThreadPoolData::Magazine& magazine = threadData->m_magazines[bucketIndex];
+        AZ_Assert(magazine.m_numElements <= AZ_ARRAY_SIZE(chains), "Magazine holds more elements than its capacity allows!");
+        while (numElements > 0 && magazine.m_head != nullptr)
+        {
+            ThreadPoolData::Magazine::Node* node = magazine.m_head;
+            magazine.m_head = node->m_next;
+            --magazine.m_numElements;
+            --numElements;
+
+            Page* page = PageFromAddress(node);
+            threadData->m_numCachedBytes -= page->m_elementSize;
+            if (page->m_threadData == threadData)
+            {
+                threadData->m_allocator.DeAllocate(node);
+                continue;
+            }
+
+            Page::FakeNodeLF* fakeLFNode = reinterpret_cast<Page::FakeNodeLF*>(node);
+            size_t chainIndex = 0;
+            while (chainIndex < numChains && chains[chainIndex].m_owner != page->m_threadData)
+            {
+                ++chainIndex;
+            }
+            if (chainIndex < numChains)
+            {
+                fakeLFNode->m_next = chains[chainIndex].m_first;
+                chains[chainIndex].m_first = fakeLFNode;
+            }
+            else
+            {
+                fakeLFNode->m_next = nullptr;
+                chains[numChains++] = { page->m_threadData, fakeLFNode, fakeLFNode };
+            }
+        }
+
+        for (size_t i = 0; i < numChains; ++i)
+        {
+            chains[i].m_owner->m_freedElements.push_chain(*chains[i].m_first, *chains[i].m_last);
+        }
+    }
+
+    //=========================================================================
+    // FlushAllMagazines
+    //=========================================================================
+    void ThreadPoolSchemaImpl::FlushAllMagazines(ThreadPoolData* threadData)
+    {
+        for (size_t i = 0; i < threadData->m_allocator.m_numBuckets; ++i)
+        {
+            FlushMagazine(threadData, i, threadData->m_magazines[i].m_numElements);
+        }
+    }
+
+    //=========================================================================
+    // DeAllocateFreedElements
+    //=========================================================================
+    void ThreadPoolSchemaImpl::DeAllocateFreedElements(ThreadPoolData* threadData)
+    {
+        // deallocate elements if they were freed from other threads
+        if (threadData->m_freedElements.empty())
+        {
+            return;
+        }
+        Page::FakeNodeLF* fakeLFNode = threadData->m_freedElements.pop_all();
+        while (fakeLFNode != nullptr)
+        {
+            Page::FakeNodeLF* next = fakeLFNode->m_next;
+#ifdef AZ_DEBUG_BUILD
+            fakeLFNode->m_next = nullptr;
+#endif
+            threadData->m_allocator.DeAllocate(fakeLFNode);
+            fakeLFNode = next;
+        }
+    }
+
     //=========================================================================
     // PopFreePage
     // [9/15/2009]
@@ -1318,6 +1503,16 @@ namespace AZ
     //=========================================================================
     void ThreadPoolSchemaImpl::GarbageCollect()
     {
+        // Cached elements keep their pages alive. Other threads return them on their next allocation, the calling thread
+        // can do it right away.
+        m_collectGeneration.fetch_add(1, AZStd::memory_order_relaxed);
+        if (ThreadPoolData* threadData = m_threadPoolGetter())
+        {
+            threadData->m_collectGeneration = m_collectGeneration.load(AZStd::memory_order_relaxed);
+            FlushAllMagazines(threadData);
+            DeAllocateFreedElements(threadData);
+        }
+
         if (!m_isDynamic)
         {
             return; // we have the memory statically allocated, can't collect garbage.
@@ -1370,7 +1565,18 @@ namespace AZ
     //=========================================================================
     ThreadPoolData::ThreadPoolData(ThreadPoolSchemaImpl* alloc, size_t pageSize, size_t minAllocationSize, size_t maxAllocationSize)
         : m_allocator(alloc, pageSize, minAllocationSize, maxAllocationSize)
+        , m_numCachedBytes(0)
+        , m_collectGeneration(0)
     {
+        m_magazines = reinterpret_cast<Magazine*>(
+            alloc->m_pageAllocator->Allocate(sizeof(Magazine) * m_allocator.m_numBuckets, AZStd::alignment_of<Magazine>::value));
+        for (size_t i = 0; i < m_allocator.m_numBuckets; ++i)
+        {
+            // cache less elements of the bigger sizes, so idle threads don't hold on to too much memory
+            const size_t elementSize = (i + 1) * m_allocator.m_minAllocationSize;
+            Magazine* magazine = new (m_magazines + i) Magazine();
+            magazine->m_capacity = static_cast<u32>(AZ::GetClamp<size_t>(MaxMagazineBytes / elementSize, 1, MaxMagazineElements));
+        }
     }
 
     //=========================================================================
@@ -1385,6 +1591,14 @@ namespace AZ
         {
             m_allocator.DeAllocate(fakeLFNode);
         }
+
+        // Elements left in the magazines are released with their pages. Elements of other threads must not be
+        // returned, their owners might be destroyed already.
+        for (size_t i = 0; i < m_allocator.m_numBuckets; ++i)
+        {
+            m_magazines[i].~Magazine();
+        }
+        m_allocator.m_allocator->m_pageAllocator->DeAllocate(m_magazines, sizeof(Magazine) * m_allocator.m_numBuckets);
     }
 
 } // namespace AZ
@@ -86,6 +86,9 @@ namespace AZ
         * Thread safe pool allocator. For pool details \ref PoolSchema.
         * IMPORTNAT: Keep in mind the thread pool allocator will create separate pools,
         * for each thread. So there will be some memory overhead, especially if you use fixed pool sizes.
+        * Each thread also keeps a small cache (magazine) of free elements per pool size, which serves allocations and
+        * deallocations without touching the pools. Elements freed by another thread are cached by that thread and returned
+        * to their owner in batches. GarbageCollect makes every thread return its cached elements on its next allocation.
         */
     class ThreadPoolSchema
         : public IAllocatorSchema
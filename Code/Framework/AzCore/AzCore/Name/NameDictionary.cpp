@@ -112,34 +112,129 @@ namespace AZ
 
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
-            else
+
+            for (Internal::NameData* retiredName : shard.m_retiredNames)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                delete retiredName;
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash & (ShardCount - 1)];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash & (ShardCount - 1)];
+    }
+
+    size_t NameDictionary::GetLookupTableIndex(Name::Hash hash)
+    {
+        // The low bits are the same for all names in a shard, so use the bits above them.
+        return (hash / ShardCount) & (LookupTableSize - 1);
+    }
+
+    Internal::NameData* NameDictionary::AcquireFromLookupTable(const Shard& shard, Name::Hash hash, AZStd::string_view nameString) const
+    {
+        // While m_activeLookups is non-zero no entry that was removed from the lookup table will be deleted, so it's
+        // safe to inspect the entry even if it's concurrently being released.
+        shard.m_activeLookups.fetch_add(1);
+
+        Internal::NameData* result = nullptr;
+        Internal::NameData* nameData = shard.m_lookupTable[GetLookupTableIndex(hash)].load();
+        if (nameData && nameData->m_hash == hash && (nameString.empty() || nameData->m_name == nameString))
+        {
+            // Only add a reference if the entry isn't being deleted. A count of zero is fine as the entry is still in the
+            // dictionary, in which case TryReleaseName will see the new reference and keep it.
+            int32_t useCount = nameData->m_useCount.load();
+            while (useCount >= 0)
+            {
+                if (nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1))
+                {
+                    result = nameData;
+                    break;
+                }
+            }
+        }
+
+        shard.m_activeLookups.fetch_sub(1);
+        return result;
+    }
+
+    void NameDictionary::PublishToLookupTable(const Shard& shard, Internal::NameData* nameData) const
+    {
+        AZStd::atomic<Internal::NameData*>& entry = shard.m_lookupTable[GetLookupTableIndex(nameData->m_hash)];
+        if (entry.load(AZStd::memory_order_relaxed) != nameData)
+        {
+            entry.store(nameData);
+        }
+    }
+
+    void NameDictionary::FreeRetiredNames(Shard& shard)
+    {
+        if (!shard.m_retiredNames.empty() && shard.m_activeLookups.load() == 0)
+        {
+            // Any lookup that starts after this point can no longer find the retired entries as they've already
+            // been removed from the lookup table.
+            for (Internal::NameData* retiredName : shard.m_retiredNames)
+            {
+                delete retiredName;
+            }
+            shard.m_retiredNames.clear();
+        }
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t count = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            count += shard.m_dictionary.size();
+        }
+        return count;
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        if (Internal::NameData* nameData = AcquireFromLookupTable(shard, hash, {}); nameData)
+        {
+            Name name(nameData);
+            // Name holds its own reference now, so drop the one added by the lookup.
+            --nameData->m_useCount;
+            return name;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
+            PublishToLookupTable(shard, iter->second);
             return Name(iter->second);
         }
         return Name();
@@ -225,10 +320,19 @@ namespace AZ
         }
 
         Name::Hash hash = CalcHash(nameString);
+        Shard& shard = GetShard(hash);
+
+        // If we find the same name with the same hash, just return it.
+        // The lookup table doesn't require a lock, and FindName() only takes a shared_lock whereas the
+        // loop below requires a unique_lock to modify the dictionary.
+        if (Internal::NameData* nameData = AcquireFromLookupTable(shard, hash, nameString); nameData)
+        {
+            Name name(nameData);
+            // Name holds its own reference now, so drop the one added by the lookup.
+            --nameData->m_useCount;
+            return name;
+        }
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
         Name name = FindName(hash);
         if (name.GetStringView() == nameString)
         {
@@ -236,18 +340,19 @@ namespace AZ
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        auto iter = m_dictionary.find(hash);
+        auto iter = shard.m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                shard.m_dictionary.emplace(hash, nameData);
+                PublishToLookupTable(shard, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -260,8 +365,9 @@ namespace AZ
             {
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                // Step by the shard count so the resolved hash still maps to this shard.
+                hash += ShardCount;
+                iter = shard.m_dictionary.find(hash);
             }
         }
     }
@@ -272,46 +378,54 @@ namespace AZ
         // This avoids specific edge cases where a Name object could get an incorrect hash value. Consider
         // the following scenario, supposing that "hello" and "world" hash to the to same value [1000]...
         //    - Create "hello" ... insert with hash 1000
-        //    - Create "world" ... insert with hash 1001
+        //    - Create "world" ... insert with hash 1000 + ShardCount
         //    - Release "hello" ... removed and now 1000 is empty
         //    - Invoke the Name constructor by string with "world". It will hash the string to value 1000,
         //      try to find that hash in the dictionary, and nothing is found. So now "world" is added to
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
+        Shard& shard = GetShard(hash);
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            auto dictIt = shard.m_dictionary.find(hash);
+            if (dictIt == shard.m_dictionary.end())
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
-        {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
-            return;
-        }
+            Internal::NameData* nameData = dictIt->second;
 
-        Internal::NameData* nameData = dictIt->second;
+            // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
-        {
-            return;
-        }
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name. Lock-free lookups won't add a reference once it's -1.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.m_dictionary.erase(nameData->GetHash());
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+                // A lock-free lookup could still be inspecting the entry, so only delete it once they've finished.
+                Internal::NameData* expectedEntry = nameData;
+                shard.m_lookupTable[GetLookupTableIndex(hash)].compare_exchange_strong(expectedEntry, nullptr);
+                shard.m_retiredNames.push_back(nameData);
+            }
+
+            FreeRetiredNames(shard);
         }
 
         ReportStats();
@@ -332,34 +446,40 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            for (const Shard& shard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
-
-                if (!longestName || longestName->m_name.size() < nameLength)
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+                nameCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = iter.second;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = iter.second;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = iter.second;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %zu\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
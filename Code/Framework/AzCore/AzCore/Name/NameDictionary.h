@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -38,6 +41,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! The dictionary is split into shards selected by the low bits of the hash, each with its own lock,
+    //! so threads interning different names rarely contend. Each shard also keeps a small lock-free lookup
+    //! table of recently used entries so that resolving a name that's already in the dictionary usually
+    //! doesn't need to take a lock at all.
     class NameDictionary final
     {
     public:
@@ -106,8 +114,44 @@ namespace AZ
         //! Unloads the data with all deferred names registered using LoadDeferredName.
         void UnloadDeferredNames();
 
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        // Number of shards, must be a power of two. Hash collisions are resolved by probing in steps of
+        // ShardCount so a name always stays in the shard selected by its original hash.
+        static constexpr size_t ShardCount = 32;
+        // Number of entries in the lock-free lookup table of each shard, must be a power of two.
+        static constexpr size_t LookupTableSize = 256;
+
+        struct alignas(64) Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            mutable AZStd::shared_mutex m_sharedMutex;
+
+            // Direct mapped table of entries that are in m_dictionary. Entries can be read without holding
+            // m_sharedMutex, but are only written while holding it.
+            mutable AZStd::array<AZStd::atomic<Internal::NameData*>, LookupTableSize> m_lookupTable{};
+            // Number of lookups that are reading from m_lookupTable without holding m_sharedMutex.
+            mutable AZStd::atomic<uint32_t> m_activeLookups{ 0 };
+            // Entries that have been removed from the dictionary, but could still be referenced by an active
+            // lookup. They're deleted once no lookups are active anymore. Only accessed with m_sharedMutex
+            // locked exclusively.
+            AZStd::vector<Internal::NameData*> m_retiredNames;
+        };
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+        static size_t GetLookupTableIndex(Name::Hash hash);
+
+        // Tries to find the name in the lock-free lookup table of the shard. If the entry is found and still alive
+        // a reference is added and the name data is returned, otherwise nullptr is returned.
+        // If nameString is empty only the hash is compared.
+        Internal::NameData* AcquireFromLookupTable(const Shard& shard, Name::Hash hash, AZStd::string_view nameString) const;
+        // Stores the entry in the lookup table. Requires at least a shared lock on the shard.
+        void PublishToLookupTable(const Shard& shard, Internal::NameData* nameData) const;
+        // Deletes retired entries if there are no lock-free lookups in progress. Requires an exclusive lock on the shard.
+        void FreeRetiredNames(Shard& shard);
+
+        size_t GetEntryCount() const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
 
         Name* m_deferredHead;
     };
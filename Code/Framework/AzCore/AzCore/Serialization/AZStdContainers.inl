@@ -344,6 +344,16 @@ namespace AZ
             /// Returns true for RandomAccessContainers.
             bool CanAccessElementsByIndex() const override { return true; }
 
+            /// Returns true, random access containers store their elements contiguously and can reserve storage for them up front.
+            bool CanReserveCapacity() const override { return true; }
+
+            /// Reserve storage for numElements elements.
+            void ReserveCapacity(void* instance, size_t numElements) override
+            {
+                auto arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->reserve(numElements);
+            }
+
             /// Get an element's address by its index (called before the element is loaded).
             void* GetElementByIndex(void* instance, const SerializeContext::ClassElement* classElement, size_t index) override
             {
@@ -374,6 +384,9 @@ namespace AZ
             /// Returns if the container is fixed capacity, otherwise false
             bool    IsFixedCapacity() const override          { return true; }
 
+            /// Returns false, the storage of fixed capacity containers is always allocated.
+            bool    CanReserveCapacity() const override       { return false; }
+
             /// Reserve element
             void*   ReserveElement(void* instance, const SerializeContext::ClassElement* classElement) override
             {
@@ -323,6 +323,49 @@ namespace AZ
         return result;
     }
 
+    JsonSerializationResult::ResultCode JsonSerialization::Store(JsonStreamWriter& output, const void* object, const void* defaultObject,
+        const Uuid& objectType, const JsonSerializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonSerializerSettings settingsCopy{settings};
+        return Store(output, object, defaultObject, objectType, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::Store(JsonStreamWriter& output, const void* object, const void* defaultObject,
+        const Uuid& objectType, JsonSerializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        ResultCode result = JsonSerializationInternal::GetContexts(settings, settings.m_serializeContext, settings.m_registrationContext);
+        if (result.GetOutcome() == Outcomes::Success)
+        {
+            if (defaultObject)
+            {
+                // If a default object is provided by the user, then the intention is to strip defaults, so make sure
+                // the settings match this.
+                settings.m_keepDefaults = false;
+            }
+
+            // Json values are only created for the parts of the object that can't be written while they're stored and those
+            // are released as soon as they're written, so the buffer only needs to fit the largest of them.
+            alignas(16) char allocatorBuffer[4 * 1024];
+            rapidjson::Document::AllocatorType scratchAllocator(allocatorBuffer, sizeof(allocatorBuffer));
+            JsonSerializerContext context(settings, scratchAllocator);
+            result = JsonSerializer::Store(output, object, defaultObject, objectType, context);
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonSerialization::StoreTypeId(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const Uuid& typeId, AZStd::string_view elementPath,
         const JsonSerializerSettings& settings)
@@ -18,6 +18,7 @@
 namespace AZ
 {
     class BaseJsonSerializer;
+    class JsonStreamWriter;
 
     struct JsonImportSettings;
     
@@ -254,6 +255,31 @@ namespace AZ
             rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const void* object, const void* defaultObject,
             const Uuid& objectType, JsonSerializerSettings& settings);
 
+        //! Stores the data in the provided object and writes the json to the output while the object is being stored. Unlike
+        //! the other Store functions, no json document is built for the object, so memory use doesn't grow with its size.
+        //! If the store fails, the output may have received part of the json.
+        //! @param output The writer that receives the json, for instance a JsonStreamWriterAdapter around a rapidjson::Writer.
+        //! @param object Pointer to the object that will be read from for values to convert.
+        //! @param defaultObject Pointer to a default object used to compare the object to in order to determine if values are
+        //!     defaulted or not. This argument can be null, in which case a temporary default may be created if required by
+        //!     the settings. If this is argument is provided m_keepDefaults in the settings will automatically  be set to true.
+        //! @param objectType The type id of the object and default object.
+        //! @param settings Optional additional settings to control the way the object is serialized.
+        static JsonSerializationResult::ResultCode Store(JsonStreamWriter& output, const void* object, const void* defaultObject,
+            const Uuid& objectType, const JsonSerializerSettings& settings = JsonSerializerSettings{});
+        //! Stores the data in the provided object and writes the json to the output while the object is being stored. Unlike
+        //! the other Store functions, no json document is built for the object, so memory use doesn't grow with its size.
+        //! If the store fails, the output may have received part of the json.
+        //! @param output The writer that receives the json, for instance a JsonStreamWriterAdapter around a rapidjson::Writer.
+        //! @param object Pointer to the object that will be read from for values to convert.
+        //! @param defaultObject Pointer to a default object used to compare the object to in order to determine if values are
+        //!     defaulted or not. This argument can be null, in which case a temporary default may be created if required by
+        //!     the settings. If this is argument is provided m_keepDefaults in the settings will automatically  be set to true.
+        //! @param objectType The type id of the object and default object.
+        //! @param settings Additional settings to control the way the object is serialized.
+        static JsonSerializationResult::ResultCode Store(JsonStreamWriter& output, const void* object, const void* defaultObject,
+            const Uuid& objectType, JsonSerializerSettings& settings);
+
         //! Stores a name for the type id in the provided output. The name can be safely used to reference a type such as a class during loading.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -11,16 +11,144 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/JsonSerializer.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/BasicContainerSerializer.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonStreamWriter.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/utils.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
+    //! Writes the json for a stored object to a JsonStreamWriter. Whether or not a member, object or array is written depends on
+    //! whether defaults are kept, which is only known after it has been stored. Because of this they're staged and only
+    //! written once a value is written inside of them or when they're explicitly requested to be written when closed.
+    class JsonSerializer::StreamOutput final
+    {
+    public:
+        StreamOutput(JsonStreamWriter& writer, rapidjson::Document::AllocatorType& scratchAllocator)
+            : m_writer(writer)
+            , m_scratchAllocator(scratchAllocator)
+        {
+        }
+
+        void BeginMember(const char* name)
+        {
+            m_staged.push_back(Entry{ name, EntryType::Member });
+        }
+
+        void EndMember()
+        {
+            AZ_Assert(!m_staged.empty() && m_staged.back().m_type == EntryType::Member, "Json stream member closed out of order.");
+            m_staged.pop_back();
+            m_writtenCount = AZStd::min(m_writtenCount, m_staged.size());
+        }
+
+        void BeginObject()
+        {
+            m_staged.push_back(Entry{ nullptr, EntryType::Object });
+        }
+
+        //! Closes the last started object. If nothing was written to it, it's only written if writeIfEmpty is set.
+        //! Returns true if the object was written.
+        bool EndObject(bool writeIfEmpty)
+        {
+            return End(EntryType::Object, writeIfEmpty);
+        }
+
+        void BeginArray()
+        {
+            m_staged.push_back(Entry{ nullptr, EntryType::Array });
+        }
+
+        //! Closes the last started array. If nothing was written to it, it's only written if writeIfEmpty is set.
+        //! Returns true if the array was written.
+        bool EndArray(bool writeIfEmpty)
+        {
+            return End(EntryType::Array, writeIfEmpty);
+        }
+
+        //! Writes the value and anything staged for it. Afterwards the value is cleared and the memory from the scratch allocator
+        //! that was used to create it is released, so the value can no longer be used.
+        void Write(rapidjson::Value& value)
+        {
+            if (Flush())
+            {
+                m_hasFailed = !m_writer.Write(value);
+            }
+            value.SetNull();
+            m_scratchAllocator.Clear();
+        }
+
+        bool HasFailed() const
+        {
+            return m_hasFailed;
+        }
+
+    private:
+        enum class EntryType : u8
+        {
+            Member,
+            Object,
+            Array
+        };
+
+        struct Entry
+        {
+            const char* m_name;
+            EntryType m_type;
+        };
+
+        bool End(EntryType type, bool writeIfEmpty)
+        {
+            AZ_Assert(!m_staged.empty() && m_staged.back().m_type == type, "Json stream object or array closed out of order.");
+            bool isWritten = m_writtenCount == m_staged.size();
+            if (!isWritten && writeIfEmpty)
+            {
+                Flush();
+                isWritten = true;
+            }
+            if (isWritten && !m_hasFailed)
+            {
+                m_hasFailed = !(type == EntryType::Object ? m_writer.EndObject() : m_writer.EndArray());
+            }
+            m_staged.pop_back();
+            m_writtenCount = AZStd::min(m_writtenCount, m_staged.size());
+            return isWritten;
+        }
+
+        bool Flush()
+        {
+            for (; m_writtenCount < m_staged.size() && !m_hasFailed; ++m_writtenCount)
+            {
+                const Entry& entry = m_staged[m_writtenCount];
+                switch (entry.m_type)
+                {
+                case EntryType::Member:
+                    m_hasFailed = !m_writer.Key(entry.m_name);
+                    break;
+                case EntryType::Object:
+                    m_hasFailed = !m_writer.StartObject();
+                    break;
+                case EntryType::Array:
+                    m_hasFailed = !m_writer.StartArray();
+                    break;
+                }
+            }
+            return !m_hasFailed;
+        }
+
+        JsonStreamWriter& m_writer;
+        rapidjson::Document::AllocatorType& m_scratchAllocator;
+        AZStd::vector<Entry> m_staged;
+        size_t m_writtenCount = 0; //!< The number of staged entries, counted from the start, that have been written.
+        bool m_hasFailed = false;
+    };
+
     JsonSerializationResult::ResultCode JsonSerializer::Store(rapidjson::Value& output, const void* object, const void* defaultObject,
         const Uuid& typeId, UseTypeSerializer custom, JsonSerializerContext& context)
     {
@@ -69,6 +197,20 @@ namespace AZ
         }
     }
 
+    JsonSerializationResult::ResultCode JsonSerializer::Store(JsonStreamWriter& output, const void* object, const void* defaultObject,
+        const Uuid& typeId, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        StreamOutput streamOutput(output, context.GetJsonAllocator());
+        ResultCode result = StoreToStream(streamOutput, object, defaultObject, typeId, EmitRule::Always, context);
+        if (streamOutput.HasFailed())
+        {
+            result.Combine(context.Report(Tasks::WriteValue, Outcomes::Catastrophic, "Failed to write json to the output stream."));
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonSerializer::StoreFromPointer(rapidjson::Value& output, const void* object,
         const void* defaultObject, const Uuid& typeId, UseTypeSerializer custom, JsonSerializerContext& context)
     {
@@ -600,4 +742,293 @@ namespace AZ
     {
         return rapidjson::Value(rapidjson::kObjectType);
     }
+
+    JsonSerializer::StreamApproach JsonSerializer::GetStreamApproach(const SerializeContext::ClassData& classData,
+        JsonSerializerContext& context)
+    {
+        // Only classes and basic containers are written while they're being stored. Everything else, such as custom serializers,
+        // enums and pointers, is stored to a json value first as they're typically small or need to see their complete output.
+        JsonRegistrationContext* registrationContext = context.GetRegistrationContext();
+        if (registrationContext->GetSerializerForType(classData.m_typeId))
+        {
+            return StreamApproach::Value;
+        }
+
+        if (classData.m_azRtti)
+        {
+            if ((classData.m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+            {
+                return StreamApproach::Value;
+            }
+
+            if (classData.m_azRtti->GetGenericTypeId() != classData.m_typeId)
+            {
+                if (BaseJsonSerializer* serializer = registrationContext->GetSerializerForType(classData.m_azRtti->GetGenericTypeId()))
+                {
+                    return (azrtti_typeid(serializer) == azrtti_typeid<JsonBasicContainerSerializer>() && classData.m_container)
+                        ? StreamApproach::Container
+                        : StreamApproach::Value;
+                }
+            }
+        }
+
+        return classData.m_container ? StreamApproach::Value : StreamApproach::Class;
+    }
+
+    bool JsonSerializer::ShouldWrite(JsonSerializationResult::ResultCode result, EmitRule emitRule, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        return result.GetProcessing() != Processing::Halted &&
+            (emitRule == EmitRule::Always || context.ShouldKeepDefaults() || result.GetOutcome() != Outcomes::DefaultsUsed);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreToStream(StreamOutput& output, const void* object, const void* defaultObject,
+        const Uuid& typeId, EmitRule emitRule, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        const SerializeContext::ClassData* classData = (object && !context.GetRegistrationContext()->GetSerializerForType(typeId))
+            ? context.GetSerializeContext()->FindClassData(typeId)
+            : nullptr;
+        if (!classData || GetStreamApproach(*classData, context) == StreamApproach::Value)
+        {
+            rapidjson::Value value;
+            ResultCode result = Store(value, object, defaultObject, typeId, UseTypeSerializer::Yes, context);
+            if (ShouldWrite(result, emitRule, context))
+            {
+                output.Write(value);
+            }
+            return result;
+        }
+
+        if (!defaultObject && !context.ShouldKeepDefaults())
+        {
+            ResultCode result(Tasks::WriteValue);
+            AZStd::any defaultObjectInstance = context.GetSerializeContext()->CreateAny(typeId);
+            if (defaultObjectInstance.empty())
+            {
+                result = context.Report(Tasks::CreateDefault, Outcomes::Unsupported,
+                    "No factory available to create a default object for comparison.");
+            }
+            void* defaultObjectPtr = AZStd::any_cast<void>(&defaultObjectInstance);
+            ResultCode conversionResult = StoreWithClassDataToStream(output, object, defaultObjectPtr, *classData, emitRule, context);
+            return ResultCode::Combine(result, conversionResult);
+        }
+        else
+        {
+            return StoreWithClassDataToStream(output, object, defaultObject, *classData, emitRule, context);
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreWithClassDataToStream(StreamOutput& output, const void* object,
+        const void* defaultObject, const SerializeContext::ClassData& classData, EmitRule emitRule, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        switch (GetStreamApproach(classData, context))
+        {
+        case StreamApproach::Class:
+        {
+            output.BeginObject();
+            ResultCode result(Tasks::WriteValue);
+            result.Combine(StoreClassToStream(output, object, defaultObject, classData, context));
+            // Members are only written if they're not defaulted, so if anything has been written the class isn't a default
+            // either and the object is already open. Otherwise it's only written as an explicit default if required.
+            output.EndObject(ShouldWrite(result, emitRule, context));
+            return result;
+        }
+        case StreamApproach::Container:
+            return StoreContainerToStream(output, object, classData, emitRule, context);
+        default:
+        {
+            rapidjson::Value value;
+            ResultCode result = StoreWithClassData(value, object, defaultObject, classData, StoreTypeId::No, UseTypeSerializer::Yes, context);
+            if (ShouldWrite(result, emitRule, context))
+            {
+                output.Write(value);
+            }
+            return result;
+        }
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreWithClassElementToStream(StreamOutput& output, const void* object,
+        const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        ScopedContextPath elementPath(context, classElement.m_name);
+
+        const SerializeContext::ClassData* elementClassData =
+            context.GetSerializeContext()->FindClassData(classElement.m_typeId);
+        if (!elementClassData)
+        {
+            return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
+                AZStd::string::format("Failed to retrieve serialization information for type %s.",
+                    classElement.m_typeId.ToString<AZStd::fixed_string<AZ::Uuid::MaxStringBuffer>>().c_str()));
+        }
+        if (!elementClassData->m_azRtti)
+        {
+            return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
+                AZStd::string::format("Failed to retrieve rtti information for %s.", elementClassData->m_name));
+        }
+
+        if (classElement.m_flags & SerializeContext::ClassElement::FLG_NO_DEFAULT_VALUE)
+        {
+            defaultObject = nullptr;
+        }
+
+        if (classElement.m_flags & SerializeContext::ClassElement::FLG_BASE_CLASS)
+        {
+            // Same as StoreWithClassElement, base classes write their members to the object of the class deriving from it.
+            return StoreClassToStream(output, object, defaultObject, *elementClassData, context);
+        }
+        else if (classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+        {
+            rapidjson::Value value;
+            ResultCode result = StoreWithClassDataFromPointer(value, object, defaultObject, *elementClassData, UseTypeSerializer::Yes, context);
+            if (ShouldWrite(result, EmitRule::WhenNotDefault, context))
+            {
+                output.BeginMember(classElement.m_name);
+                output.Write(value);
+                output.EndMember();
+            }
+            return result;
+        }
+        else
+        {
+            output.BeginMember(classElement.m_name);
+            ResultCode result = StoreWithClassDataToStream(output, object, defaultObject, *elementClassData, EmitRule::WhenNotDefault, context);
+            output.EndMember();
+            return result;
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreClassToStream(StreamOutput& output, const void* object,
+        const void* defaultObject, const SerializeContext::ClassData& classData, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!classData.m_elements.empty())
+        {
+            ResultCode result(Tasks::WriteValue);
+            for (const SerializeContext::ClassElement& element : classData.m_elements)
+            {
+                const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + element.m_offset;
+                const void* elementDefaultPtr = defaultObject ?
+                    (reinterpret_cast<const uint8_t*>(defaultObject) + element.m_offset) : nullptr;
+
+                result.Combine(StoreWithClassElementToStream(output, elementPtr, elementDefaultPtr, element, context));
+            }
+            return result;
+        }
+        else
+        {
+            return context.Report(Tasks::WriteValue, context.ShouldKeepDefaults() ? Outcomes::Success : Outcomes::DefaultsUsed,
+                "Class didn't contain any elements to store.");
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreContainerToStream(StreamOutput& output, const void* object,
+        const SerializeContext::ClassData& classData, EmitRule emitRule, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        // This follows JsonBasicContainerSerializer::Store, but writes every element as soon as it's stored.
+        output.BeginArray();
+        size_t index = 0;
+        ResultCode retVal(Tasks::WriteValue);
+        auto elementCallback = [&output, &retVal, &index, &context]
+            (void* elementPtr, const Uuid& elementId, const SerializeContext::ClassData*, const SerializeContext::ClassElement* classElement)
+        {
+            ScopedContextPath subPath(context, index);
+            index++;
+
+            ResultCode result(Tasks::WriteValue);
+            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            {
+                rapidjson::Value storedValue;
+                result = StoreFromPointer(storedValue, elementPtr, nullptr, elementId, UseTypeSerializer::Yes, context);
+                if (result.GetProcessing() != Processing::Halted)
+                {
+                    output.Write(storedValue);
+                }
+            }
+            else if (!context.ShouldKeepDefaults())
+            {
+                // Elements are compared against a new default instance, just like ContinueStoring does with ReplaceDefault.
+                AZStd::any newDefaultObject = context.GetSerializeContext()->CreateAny(elementId);
+                if (newDefaultObject.empty())
+                {
+                    result = context.Report(Tasks::CreateDefault, Outcomes::Unsupported,
+                        "No factory available to create a default object for comparison.");
+                    if (result.GetProcessing() != Processing::Halted)
+                    {
+                        result.Combine(StoreToStream(output, elementPtr, nullptr, elementId, EmitRule::Always, context));
+                    }
+                }
+                else
+                {
+                    result = StoreToStream(output, elementPtr, AZStd::any_cast<void>(&newDefaultObject), elementId, EmitRule::Always, context);
+                }
+            }
+            else
+            {
+                result = StoreToStream(output, elementPtr, nullptr, elementId, EmitRule::Always, context);
+            }
+
+            if (result.GetProcessing() == Processing::Halted)
+            {
+                retVal = context.Report(result, "Failed to store data for element in basic container.");
+                return false;
+            }
+            retVal.Combine(result);
+            return true;
+        };
+        classData.m_container->EnumElements(const_cast<void*>(object), elementCallback);
+
+        if (retVal.GetProcessing() == Processing::Halted)
+        {
+            output.EndArray(false);
+            return context.Report(retVal, "Processing of basic container was halted.");
+        }
+
+        if (context.ShouldKeepDefaults())
+        {
+            output.EndArray(true);
+            if (retVal.HasDoneWork())
+            {
+                return context.Report(retVal, "Content written to basic container.");
+            }
+            else
+            {
+                return context.Report(Tasks::WriteValue, Outcomes::Success,
+                    "Empty array written because the provided basic container is empty.");
+            }
+        }
+        else
+        {
+            if (retVal.HasDoneWork())
+            {
+                // If at least one value was written, even if it has all defaults, then the array has
+                // a value written to it and is therefore not in a default state anymore.
+                retVal.Combine(ResultCode(Tasks::WriteValue, Outcomes::Success));
+                output.EndArray(true);
+                return context.Report(retVal, "Content written to basic container.");
+            }
+            else
+            {
+                output.EndArray(false);
+                ResultCode result = context.Report(retVal, "No values written because the basic container was empty.");
+                // JsonBasicContainerSerializer leaves the explicit default in place when the container is empty.
+                if (ShouldWrite(result, emitRule, context))
+                {
+                    rapidjson::Value explicitDefault = GetExplicitDefault();
+                    output.Write(explicitDefault);
+                }
+                return result;
+            }
+        }
+    }
 } // namespace AZ
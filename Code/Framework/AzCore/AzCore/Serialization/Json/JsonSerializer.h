@@ -15,6 +15,7 @@
 namespace AZ
 {
     class JsonSerializerContext;
+    class JsonStreamWriter;
 
     class JsonSerializer final
     {
@@ -37,6 +38,19 @@ namespace AZ
             WriteNull,
             ContinueProcessing
         };
+        //! How a type is written when storing to a stream.
+        enum class StreamApproach
+        {
+            Value,      //!< Stored as a json value using the regular store functions, then written as a whole.
+            Class,      //!< Written member by member while the class is being stored.
+            Container   //!< Written element by element while the basic container is being stored.
+        };
+        enum class EmitRule : bool
+        {
+            WhenNotDefault,
+            Always
+        };
+        class StreamOutput;
 
         JsonSerializer() = delete;
         ~JsonSerializer() = delete;
@@ -48,6 +62,10 @@ namespace AZ
         static JsonSerializationResult::ResultCode Store(rapidjson::Value& output, const void* object, const void* defaultObject,
             const Uuid& typeId, UseTypeSerializer useCustom, JsonSerializerContext& context);
 
+        //! Stores the object by writing to the output while it's being stored, rather than first storing it to a json value.
+        static JsonSerializationResult::ResultCode Store(JsonStreamWriter& output, const void* object, const void* defaultObject,
+            const Uuid& typeId, JsonSerializerContext& context);
+
         static JsonSerializationResult::ResultCode StoreFromPointer(rapidjson::Value& output, const void* object, const void* defaultObject,
             const Uuid& typeId, UseTypeSerializer custom, JsonSerializerContext& context);
 
@@ -87,5 +105,23 @@ namespace AZ
             rapidjson::Value& output, const SerializeContext::ClassData& classData, JsonSerializerContext& context);
 
         static rapidjson::Value GetExplicitDefault();
+
+        static StreamApproach GetStreamApproach(const SerializeContext::ClassData& classData, JsonSerializerContext& context);
+        static bool ShouldWrite(JsonSerializationResult::ResultCode result, EmitRule emitRule, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreToStream(StreamOutput& output, const void* object, const void* defaultObject,
+            const Uuid& typeId, EmitRule emitRule, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreWithClassDataToStream(StreamOutput& output, const void* object,
+            const void* defaultObject, const SerializeContext::ClassData& classData, EmitRule emitRule, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreWithClassElementToStream(StreamOutput& output, const void* object,
+            const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreClassToStream(StreamOutput& output, const void* object, const void* defaultObject,
+            const SerializeContext::ClassData& classData, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreContainerToStream(StreamOutput& output, const void* object,
+            const SerializeContext::ClassData& classData, EmitRule emitRule, JsonSerializerContext& context);
     };
 } // namespace AZ
@@ -0,0 +1,730 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <limits>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonStreamLoader.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+
+namespace AZ
+{
+    //
+    // JsonStreamValueBuilder
+    //
+
+    JsonStreamValueBuilder::JsonStreamValueBuilder(rapidjson::Document::AllocatorType& allocator)
+        : m_allocator(allocator)
+    {
+    }
+
+    bool JsonStreamValueBuilder::IsComplete() const
+    {
+        return m_isComplete;
+    }
+
+    rapidjson::Value& JsonStreamValueBuilder::GetValue()
+    {
+        AZ_Assert(m_isComplete, "Json value retrieved from the stream value builder before it was complete.");
+        return m_value;
+    }
+
+    void JsonStreamValueBuilder::Reset()
+    {
+        m_stack.clear();
+        m_value.SetNull();
+        m_isComplete = false;
+    }
+
+    bool JsonStreamValueBuilder::Null()
+    {
+        return Add(rapidjson::Value(rapidjson::kNullType));
+    }
+
+    bool JsonStreamValueBuilder::Bool(bool value)
+    {
+        return Add(rapidjson::Value(value));
+    }
+
+    bool JsonStreamValueBuilder::Int(int value)
+    {
+        return Add(rapidjson::Value(value));
+    }
+
+    bool JsonStreamValueBuilder::Uint(unsigned value)
+    {
+        return Add(rapidjson::Value(value));
+    }
+
+    bool JsonStreamValueBuilder::Int64(int64_t value)
+    {
+        return Add(rapidjson::Value(value));
+    }
+
+    bool JsonStreamValueBuilder::Uint64(uint64_t value)
+    {
+        return Add(rapidjson::Value(value));
+    }
+
+    bool JsonStreamValueBuilder::Double(double value)
+    {
+        return Add(rapidjson::Value(value));
+    }
+
+    bool JsonStreamValueBuilder::RawNumber(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        return String(str, length, copy);
+    }
+
+    bool JsonStreamValueBuilder::String(const Ch* str, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        return Add(rapidjson::Value(str, length, m_allocator));
+    }
+
+    bool JsonStreamValueBuilder::StartObject()
+    {
+        m_stack.emplace_back(rapidjson::kObjectType);
+        return true;
+    }
+
+    bool JsonStreamValueBuilder::Key(const Ch* str, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        m_stack.emplace_back(str, length, m_allocator);
+        return true;
+    }
+
+    bool JsonStreamValueBuilder::EndObject([[maybe_unused]] rapidjson::SizeType memberCount)
+    {
+        AZ_Assert(!m_stack.empty() && m_stack.back().IsObject(), "Json object ended without being started.");
+        rapidjson::Value value(AZStd::move(m_stack.back()));
+        m_stack.pop_back();
+        return Add(AZStd::move(value));
+    }
+
+    bool JsonStreamValueBuilder::StartArray()
+    {
+        m_stack.emplace_back(rapidjson::kArrayType);
+        return true;
+    }
+
+    bool JsonStreamValueBuilder::EndArray([[maybe_unused]] rapidjson::SizeType elementCount)
+    {
+        AZ_Assert(!m_stack.empty() && m_stack.back().IsArray(), "Json array ended without being started.");
+        rapidjson::Value value(AZStd::move(m_stack.back()));
+        m_stack.pop_back();
+        return Add(AZStd::move(value));
+    }
+
+    bool JsonStreamValueBuilder::Add(rapidjson::Value&& value)
+    {
+        if (m_stack.empty())
+        {
+            m_value = AZStd::move(value);
+            m_isComplete = true;
+        }
+        else if (m_stack.back().IsString())
+        {
+            // Strings are only put on the stack as the name of a member, so the object it belongs to is right below it.
+            rapidjson::Value name(AZStd::move(m_stack.back()));
+            m_stack.pop_back();
+            m_stack.back().AddMember(name, value, m_allocator);
+        }
+        else
+        {
+            m_stack.back().PushBack(value, m_allocator);
+        }
+        return true;
+    }
+
+
+    //
+    // JsonStreamLoader
+    //
+
+    JsonStreamLoader::JsonStreamLoader(void* object, const Uuid& objectType, JsonDeserializerContext& context)
+        : m_context(context)
+        , m_allocator(m_allocatorBuffer, sizeof(m_allocatorBuffer))
+        , m_capture(m_allocator)
+    {
+        AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
+        m_target.m_object = object;
+        m_target.m_typeId = objectType;
+    }
+
+    bool JsonStreamLoader::IsComplete() const
+    {
+        return m_hasResult && (m_isHalted || m_skipDepth == 0);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamLoader::GetResult() const
+    {
+        AZ_Assert(m_hasResult, "Result for the json stream loader requested before loading completed.");
+        return m_result;
+    }
+
+    bool JsonStreamLoader::Null()
+    {
+        return OnScalar([](JsonStreamValueBuilder& builder) { return builder.Null(); });
+    }
+
+    bool JsonStreamLoader::Bool(bool value)
+    {
+        return OnScalar([value](JsonStreamValueBuilder& builder) { return builder.Bool(value); });
+    }
+
+    bool JsonStreamLoader::Int(int value)
+    {
+        return OnScalar([value](JsonStreamValueBuilder& builder) { return builder.Int(value); });
+    }
+
+    bool JsonStreamLoader::Uint(unsigned value)
+    {
+        return OnScalar([value](JsonStreamValueBuilder& builder) { return builder.Uint(value); });
+    }
+
+    bool JsonStreamLoader::Int64(int64_t value)
+    {
+        return OnScalar([value](JsonStreamValueBuilder& builder) { return builder.Int64(value); });
+    }
+
+    bool JsonStreamLoader::Uint64(uint64_t value)
+    {
+        return OnScalar([value](JsonStreamValueBuilder& builder) { return builder.Uint64(value); });
+    }
+
+    bool JsonStreamLoader::Double(double value)
+    {
+        return OnScalar([value](JsonStreamValueBuilder& builder) { return builder.Double(value); });
+    }
+
+    bool JsonStreamLoader::RawNumber(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        return OnScalar([str, length, copy](JsonStreamValueBuilder& builder) { return builder.RawNumber(str, length, copy); });
+    }
+
+    bool JsonStreamLoader::String(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        return OnScalar([str, length, copy](JsonStreamValueBuilder& builder) { return builder.String(str, length, copy); });
+    }
+
+    bool JsonStreamLoader::StartObject()
+    {
+        if (m_isCapturing)
+        {
+            return m_capture.StartObject();
+        }
+        switch (OnStart(ValueKind::Object))
+        {
+        case ValueHandling::Capture:
+            return m_capture.StartObject();
+        case ValueHandling::Stop:
+            return false;
+        default:
+            return true;
+        }
+    }
+
+    bool JsonStreamLoader::Key(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (m_isCapturing)
+        {
+            return m_capture.Key(str, length, copy);
+        }
+        BeginMember(AZStd::string_view(str, length));
+        return true;
+    }
+
+    bool JsonStreamLoader::EndObject(rapidjson::SizeType memberCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            --m_skipDepth;
+            return true;
+        }
+        if (m_isCapturing)
+        {
+            m_capture.EndObject(memberCount);
+            if (m_capture.IsComplete())
+            {
+                FinishCapture();
+            }
+        }
+        else
+        {
+            EndClass();
+        }
+        return !m_isHalted;
+    }
+
+    bool JsonStreamLoader::StartArray()
+    {
+        if (m_isCapturing)
+        {
+            return m_capture.StartArray();
+        }
+        switch (OnStart(ValueKind::Array))
+        {
+        case ValueHandling::Capture:
+            return m_capture.StartArray();
+        case ValueHandling::Stop:
+            return false;
+        default:
+            return true;
+        }
+    }
+
+    bool JsonStreamLoader::EndArray(rapidjson::SizeType elementCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            --m_skipDepth;
+            return true;
+        }
+        if (m_isCapturing)
+        {
+            m_capture.EndArray(elementCount);
+            if (m_capture.IsComplete())
+            {
+                FinishCapture();
+            }
+        }
+        else
+        {
+            EndContainer();
+        }
+        return !m_isHalted;
+    }
+
+    template<typename Event>
+    bool JsonStreamLoader::OnScalar(const Event& event)
+    {
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (!m_isCapturing)
+        {
+            switch (BeginValue(ValueKind::Scalar))
+            {
+            case ValueHandling::Skip:
+                return true;
+            case ValueHandling::Stop:
+                return false;
+            default:
+                // Scalars can't be streamed, so they're always captured.
+                m_isCapturing = true;
+                break;
+            }
+        }
+        event(m_capture);
+        if (m_capture.IsComplete())
+        {
+            FinishCapture();
+        }
+        return !m_isHalted;
+    }
+
+    JsonStreamLoader::ValueHandling JsonStreamLoader::OnStart(ValueKind kind)
+    {
+        if (m_skipDepth > 0)
+        {
+            ++m_skipDepth;
+            return ValueHandling::Skip;
+        }
+
+        ValueHandling handling = BeginValue(kind);
+        if (handling == ValueHandling::Skip)
+        {
+            ++m_skipDepth;
+        }
+        else if (handling == ValueHandling::Capture)
+        {
+            m_isCapturing = true;
+        }
+        return handling;
+    }
+
+    JsonStreamLoader::ValueHandling JsonStreamLoader::BeginValue(ValueKind kind)
+    {
+        if (m_hasResult)
+        {
+            AZ_Assert(m_isHalted, "Json stream loader received more json after the value it was loading was completed.");
+            return ValueHandling::Stop;
+        }
+
+        if (!m_frames.empty() && m_frames.back().m_type == FrameType::Container)
+        {
+            PrepareElement(m_frames.back());
+            if (m_isHalted)
+            {
+                return ValueHandling::Stop;
+            }
+        }
+
+        if (m_target.m_skip)
+        {
+            return ValueHandling::Skip;
+        }
+
+        const SerializeContext::ClassData* classData = FindStreamedClassData(kind);
+        if (!classData)
+        {
+            return ValueHandling::Capture;
+        }
+        if (classData->m_container)
+        {
+            return BeginContainer(*classData);
+        }
+
+        Frame frame;
+        frame.m_type = FrameType::Class;
+        frame.m_object = m_target.m_object;
+        frame.m_classData = classData;
+        m_frames.push_back(frame);
+        return ValueHandling::Stream;
+    }
+
+    const SerializeContext::ClassData* JsonStreamLoader::FindStreamedClassData(ValueKind kind) const
+    {
+        // This follows the checks in JsonDeserializer::Load to find the targets that would be loaded by LoadClass or by
+        // JsonBasicContainerSerializer::LoadContainer. Everything else is captured and loaded through JsonDeserializer.
+        if (kind == ValueKind::Scalar || m_target.m_isPointer || !m_target.m_object)
+        {
+            return nullptr;
+        }
+
+        JsonRegistrationContext* registrationContext = m_context.GetRegistrationContext();
+        if (registrationContext->GetSerializerForType(m_target.m_typeId))
+        {
+            return nullptr;
+        }
+
+        const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(m_target.m_typeId);
+        if (!classData)
+        {
+            return nullptr;
+        }
+
+        if (classData->m_azRtti)
+        {
+            if (classData->m_azRtti->GetGenericTypeId() != m_target.m_typeId)
+            {
+                if ((classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{ 0 })
+                {
+                    return nullptr;
+                }
+                if (BaseJsonSerializer* serializer = registrationContext->GetSerializerForType(classData->m_azRtti->GetGenericTypeId()))
+                {
+                    bool isBasicContainer = azrtti_typeid(serializer) == azrtti_typeid<JsonBasicContainerSerializer>();
+                    return (isBasicContainer && classData->m_container && kind == ValueKind::Array) ? classData : nullptr;
+                }
+            }
+            if ((classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+            {
+                return nullptr;
+            }
+        }
+
+        return (!classData->m_container && kind == ValueKind::Object) ? classData : nullptr;
+    }
+
+    JsonStreamLoader::ValueHandling JsonStreamLoader::BeginContainer(const SerializeContext::ClassData& classData)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        // This follows the start of JsonBasicContainerSerializer::LoadContainer.
+        SerializeContext::IDataContainer* container = classData.m_container;
+
+        Frame frame;
+        frame.m_type = FrameType::Container;
+        frame.m_object = m_target.m_object;
+        frame.m_classData = &classData;
+
+        auto typeEnumCallback = [&frame](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            AZ_Assert(!frame.m_containerElement, "There are multiple class elements registered for a basic container where only one was expected.");
+            frame.m_containerElement = genericClassElement;
+            return true;
+        };
+        container->EnumTypes(typeEnumCallback);
+        AZ_Assert(frame.m_containerElement, "No class element found for the type in the basic container.");
+
+        frame.m_capacity = container->IsFixedCapacity() ? container->Capacity(frame.m_object) : std::numeric_limits<size_t>::max();
+
+        size_t containerSize = container->Size(frame.m_object);
+        if (containerSize > 0 && m_context.ShouldClearContainers())
+        {
+            JSR::Result result = m_context.Report(JSR::Tasks::Clear, JSR::Outcomes::Success, "Clearing basic container.");
+            if (result.GetResultCode().GetOutcome() == JSR::Outcomes::Success)
+            {
+                container->ClearElements(frame.m_object, m_context.GetSerializeContext());
+                containerSize = container->Size(frame.m_object);
+                result = m_context.Report(JSR::Tasks::Clear, containerSize == 0 ? JSR::Outcomes::Success : JSR::Outcomes::Unsupported,
+                    containerSize == 0 ? "Cleared basic container." : "Failed to clear basic container.");
+            }
+            if (result.GetResultCode().GetProcessing() != JSR::Processing::Completed)
+            {
+                FinishValue(result);
+                return m_isHalted ? ValueHandling::Stop : ValueHandling::Skip;
+            }
+            frame.m_result.Combine(result);
+        }
+        frame.m_initialSize = containerSize;
+
+        m_frames.push_back(frame);
+        return ValueHandling::Stream;
+    }
+
+    void JsonStreamLoader::BeginMember(AZStd::string_view name)
+    {
+        using namespace JsonSerializationResult;
+
+        // This follows the member loop in JsonDeserializer::LoadClass.
+        AZ_Assert(!m_frames.empty() && m_frames.back().m_type == FrameType::Class, "Json stream loader received a key outside of a class.");
+        Frame& frame = m_frames.back();
+        frame.m_memberCount++;
+
+        m_target = Target{};
+        if (name == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            m_target.m_skip = true;
+            return;
+        }
+
+        JsonDeserializer::ElementDataResult foundElementData = JsonDeserializer::FindElementByNameCrc(
+            *m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, Crc32(name));
+
+        m_context.PushPath(name);
+        if (foundElementData.m_found)
+        {
+            m_target.m_object = foundElementData.m_data;
+            m_target.m_element = foundElementData.m_info;
+            m_target.m_typeId = foundElementData.m_info->m_typeId;
+            m_target.m_isPointer = (foundElementData.m_info->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        }
+        else
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Skipping field as there's no matching variable in the target."));
+            m_context.PopPath();
+            m_target.m_skip = true;
+        }
+    }
+
+    void JsonStreamLoader::PrepareElement(Frame& frame)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        // This follows the element loop in JsonBasicContainerSerializer::LoadContainer.
+        m_target = Target{};
+        size_t index = frame.m_elementCount++;
+        if (frame.m_isFull)
+        {
+            m_target.m_skip = true;
+            return;
+        }
+
+        SerializeContext::IDataContainer* container = frame.m_classData->m_container;
+        m_context.PushPath(index);
+
+        frame.m_expectedSize = container->Size(frame.m_object) + 1;
+        if (frame.m_expectedSize > frame.m_capacity)
+        {
+            frame.m_result.Combine(m_context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                "Unable to load more entries in basic container because it's full."));
+            m_context.PopPath();
+            frame.m_isFull = true;
+            m_target.m_skip = true;
+            return;
+        }
+
+        void* elementAddress = container->ReserveElement(frame.m_object, frame.m_containerElement);
+        if (!elementAddress)
+        {
+            JSR::ResultCode result = m_context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                "Failed to allocate an item in the basic container.");
+            m_context.PopPath();
+            // The container stops loading and directly returns the result, so the rest of its array is ignored.
+            m_frames.pop_back();
+            SkipRemainder();
+            FinishValue(result);
+            m_target.m_skip = true;
+            return;
+        }
+
+        bool isPointer = (frame.m_containerElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        if (isPointer)
+        {
+            *reinterpret_cast<void**>(elementAddress) = nullptr;
+        }
+        frame.m_reservedElement = elementAddress;
+
+        m_target.m_object = elementAddress;
+        m_target.m_typeId = frame.m_containerElement->m_typeId;
+        m_target.m_isPointer = isPointer;
+        m_target.m_isNewInstance = true;
+    }
+
+    void JsonStreamLoader::EndClass()
+    {
+        using namespace JsonSerializationResult;
+
+        AZ_Assert(!m_frames.empty() && m_frames.back().m_type == FrameType::Class, "Json object ended while not loading a class.");
+        Frame frame = m_frames.back();
+        m_frames.pop_back();
+
+        if (frame.m_memberCount == 0)
+        {
+            FinishValue(m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default."));
+            return;
+        }
+
+        ResultCode result = frame.m_result;
+        size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+        if (elementCount > frame.m_numLoads)
+        {
+            result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+        FinishValue(result);
+    }
+
+    void JsonStreamLoader::EndContainer()
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        AZ_Assert(!m_frames.empty() && m_frames.back().m_type == FrameType::Container, "Json array ended while not loading a container.");
+        Frame frame = m_frames.back();
+        m_frames.pop_back();
+
+        // This follows the end of JsonBasicContainerSerializer::LoadContainer.
+        JSR::ResultCode retVal = frame.m_result;
+        if (!retVal.HasDoneWork() && frame.m_elementCount == 0)
+        {
+            FinishValue(m_context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Success, "No values provided for basic container."));
+            return;
+        }
+
+        size_t addedCount = frame.m_classData->m_container->Size(frame.m_object) - frame.m_initialSize;
+        if (addedCount > 0)
+        {
+            // Values were added which means the container is no longer in its default state of being empty.
+            retVal.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
+        }
+        AZStd::string_view message =
+            addedCount >= frame.m_elementCount ? "Successfully read basic container." :
+            addedCount == 0 ? "Unable to read data for basic container." :
+            "Partially read data for basic container.";
+        FinishValue(m_context.Report(retVal, message));
+    }
+
+    void JsonStreamLoader::FinishCapture()
+    {
+        using namespace JsonSerializationResult;
+
+        const rapidjson::Value& value = m_capture.GetValue();
+        ResultCode result(Tasks::ReadField);
+        if (m_target.m_element)
+        {
+            result = JsonDeserializer::LoadWithClassElement(m_target.m_object, value, *m_target.m_element, m_context);
+        }
+        else if (m_target.m_isPointer)
+        {
+            result = JsonDeserializer::LoadToPointer(
+                m_target.m_object, m_target.m_typeId, value, JsonDeserializer::UseTypeDeserializer::Yes, m_context);
+        }
+        else
+        {
+            result = JsonDeserializer::Load(m_target.m_object, m_target.m_typeId, value, m_target.m_isNewInstance,
+                JsonDeserializer::UseTypeDeserializer::Yes, m_context);
+        }
+
+        m_capture.Reset();
+        m_allocator.Clear();
+        m_isCapturing = false;
+        FinishValue(result);
+    }
+
+    void JsonStreamLoader::FinishValue(JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        while (!m_frames.empty())
+        {
+            Frame& frame = m_frames.back();
+            if (frame.m_type == FrameType::Class)
+            {
+                // Same as the handling of a loaded member in JsonDeserializer::LoadClass.
+                frame.m_result.Combine(result);
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    result = m_context.Report(result, "Loading of element has failed.");
+                    m_context.PopPath();
+                    m_frames.pop_back();
+                    SkipRemainder();
+                    continue;
+                }
+                if (result.GetProcessing() != Processing::Altered)
+                {
+                    frame.m_numLoads++;
+                }
+            }
+            else
+            {
+                // Same as the handling of a loaded element in JsonBasicContainerSerializer::LoadContainer.
+                SerializeContext::IDataContainer* container = frame.m_classData->m_container;
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    container->FreeReservedElement(frame.m_object, frame.m_reservedElement, m_context.GetSerializeContext());
+                    result = m_context.Report(frame.m_result, "Failed to read element for basic container.");
+                    m_context.PopPath();
+                    m_frames.pop_back();
+                    SkipRemainder();
+                    continue;
+                }
+                else if (result.GetProcessing() == Processing::Altered)
+                {
+                    container->FreeReservedElement(frame.m_object, frame.m_reservedElement, m_context.GetSerializeContext());
+                    frame.m_result.Combine(result);
+                }
+                else
+                {
+                    container->StoreElement(frame.m_object, frame.m_reservedElement);
+                    if (container->Size(frame.m_object) != frame.m_expectedSize)
+                    {
+                        frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Unavailable,
+                            "Unable to store element to basic container."));
+                    }
+                    else
+                    {
+                        frame.m_result.Combine(result);
+                    }
+                }
+                frame.m_reservedElement = nullptr;
+            }
+            m_context.PopPath();
+            return;
+        }
+
+        m_result = result;
+        m_hasResult = true;
+        m_isHalted = result.GetProcessing() == Processing::Halted;
+    }
+
+    void JsonStreamLoader::SkipRemainder()
+    {
+        // The json for the class or container that stopped loading is still open, so ignore everything up to and including
+        // the end of its object or array.
+        ++m_skipDepth;
+    }
+} // namespace AZ
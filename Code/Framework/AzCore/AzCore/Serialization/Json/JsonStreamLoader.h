@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    class JsonDeserializerContext;
+
+    //! Handler for rapidjson::Reader that builds a single json value from the events it receives. Strings are copied to the
+    //! provided allocator so the value remains valid after the reader moves on.
+    class JsonStreamValueBuilder final
+    {
+    public:
+        using Ch = char;
+
+        explicit JsonStreamValueBuilder(rapidjson::Document::AllocatorType& allocator);
+
+        //! Returns true once a complete json value has been received.
+        bool IsComplete() const;
+        //! Returns the json value that was built. Only valid once IsComplete returns true.
+        rapidjson::Value& GetValue();
+        //! Clears the builder so it can be used to build the next value.
+        void Reset();
+
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool String(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool Key(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+    private:
+        bool Add(rapidjson::Value&& value);
+
+        rapidjson::Document::AllocatorType& m_allocator;
+        //! The objects and arrays that are being built and the names of the members that are waiting for their value.
+        AZStd::vector<rapidjson::Value> m_stack;
+        rapidjson::Value m_value;
+        bool m_isComplete{ false };
+    };
+
+    //! Handler for rapidjson::Reader that loads the json value it receives into an object while the json text is being parsed.
+    //! This gives the same results as JsonSerialization::Load, but without first parsing the entire json text into a document.
+    //! Classes and basic containers are loaded member by member and element by element as they're parsed. All other values,
+    //! such as those for custom serializers, are collected in a json value first and loaded as soon as they're complete.
+    //! If the json text turns out to be malformed, the object may already have been partially loaded.
+    class JsonStreamLoader final
+    {
+    public:
+        using Ch = char;
+
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param context The context the object is loaded with. The serialize and registration contexts have to be set.
+        JsonStreamLoader(void* object, const Uuid& objectType, JsonDeserializerContext& context);
+        JsonStreamLoader(const JsonStreamLoader&) = delete;
+        JsonStreamLoader& operator=(const JsonStreamLoader&) = delete;
+
+        //! Returns true once the json value for the object has been fully received or if loading was halted.
+        bool IsComplete() const;
+        //! Returns the result of the load. Only valid once IsComplete returns true.
+        JsonSerializationResult::ResultCode GetResult() const;
+
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool String(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool Key(const Ch* str, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+    private:
+        enum class ValueKind : u8
+        {
+            Scalar,
+            Object,
+            Array
+        };
+        enum class ValueHandling : u8
+        {
+            Skip,       //!< The value isn't loaded and its events are ignored.
+            Capture,    //!< The value is collected in a json value and loaded once complete.
+            Stream,     //!< The value is loaded while it's being parsed.
+            Stop        //!< Loading has been halted.
+        };
+        enum class FrameType : u8
+        {
+            Class,
+            Container
+        };
+
+        //! Where the next json value will be loaded to.
+        struct Target
+        {
+            void* m_object{ nullptr };
+            const SerializeContext::ClassElement* m_element{ nullptr }; //!< Set if the target is a member of a class.
+            Uuid m_typeId{ Uuid::CreateNull() };
+            bool m_isPointer{ false };
+            bool m_isNewInstance{ false };
+            bool m_skip{ false };
+        };
+
+        //! A class or basic container that's being loaded while its json is parsed.
+        struct Frame
+        {
+            FrameType m_type{ FrameType::Class };
+            void* m_object{ nullptr };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            // Class
+            size_t m_memberCount{ 0 };
+            size_t m_numLoads{ 0 };
+            // Basic container
+            const SerializeContext::ClassElement* m_containerElement{ nullptr };
+            void* m_reservedElement{ nullptr };
+            size_t m_capacity{ 0 };
+            size_t m_initialSize{ 0 };
+            size_t m_expectedSize{ 0 };
+            size_t m_elementCount{ 0 };
+            bool m_isFull{ false };
+        };
+
+        template<typename Event>
+        bool OnScalar(const Event& event);
+        ValueHandling OnStart(ValueKind kind);
+        ValueHandling BeginValue(ValueKind kind);
+        ValueHandling BeginContainer(const SerializeContext::ClassData& classData);
+        void BeginMember(AZStd::string_view name);
+        void PrepareElement(Frame& frame);
+        void EndClass();
+        void EndContainer();
+        void FinishCapture();
+        //! Passes the result of a completed value to the class or container it belongs to.
+        void FinishValue(JsonSerializationResult::ResultCode result);
+        //! Ignores the rest of the json for a class or container that stopped loading before its json ended.
+        void SkipRemainder();
+        const SerializeContext::ClassData* FindStreamedClassData(ValueKind kind) const;
+
+        JsonDeserializerContext& m_context;
+        AZStd::vector<Frame> m_frames;
+        Target m_target;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+        //! Captured values are released right after they're loaded, so the buffer only needs to fit the largest of them.
+        alignas(16) char m_allocatorBuffer[4 * 1024];
+        rapidjson::Document::AllocatorType m_allocator;
+        JsonStreamValueBuilder m_capture;
+        size_t m_skipDepth{ 0 };
+        bool m_isCapturing{ false };
+        bool m_hasResult{ false };
+        bool m_isHalted{ false };
+    };
+} // namespace AZ
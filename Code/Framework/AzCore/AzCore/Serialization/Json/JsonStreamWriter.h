@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //! Receives the json produced by JsonSerialization::Store while an object is being stored. This allows the json to be
+    //! written out as it's produced instead of first being collected into a rapidjson::Document.
+    //! All functions return false if the json couldn't be written, which will stop the store.
+    class JsonStreamWriter
+    {
+    public:
+        virtual ~JsonStreamWriter() = default;
+
+        virtual bool StartObject() = 0;
+        virtual bool Key(AZStd::string_view name) = 0;
+        virtual bool EndObject() = 0;
+        virtual bool StartArray() = 0;
+        virtual bool EndArray() = 0;
+        //! Writes a complete json value, such as a member value or an array element.
+        virtual bool Write(const rapidjson::Value& value) = 0;
+    };
+
+    //! JsonStreamWriter that forwards to a rapidjson::Writer or rapidjson::PrettyWriter.
+    template<typename Writer>
+    class JsonStreamWriterAdapter final
+        : public JsonStreamWriter
+    {
+    public:
+        explicit JsonStreamWriterAdapter(Writer& writer)
+            : m_writer(writer)
+        {
+        }
+
+        bool StartObject() override
+        {
+            return m_writer.StartObject();
+        }
+
+        bool Key(AZStd::string_view name) override
+        {
+            return m_writer.Key(name.data(), aznumeric_caster(name.size()));
+        }
+
+        bool EndObject() override
+        {
+            return m_writer.EndObject();
+        }
+
+        bool StartArray() override
+        {
+            return m_writer.StartArray();
+        }
+
+        bool EndArray() override
+        {
+            return m_writer.EndArray();
+        }
+
+        bool Write(const rapidjson::Value& value) override
+        {
+            return value.Accept(m_writer);
+        }
+
+    private:
+        Writer& m_writer;
+    };
+} // namespace AZ
@@ -13,13 +13,19 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/TextStreamReaders.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/error/error.h>
 #include <AzCore/JSON/error/en.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonStreamLoader.h>
+#include <AzCore/Serialization/Json/JsonStreamWriter.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <AzCore/Serialization/Json/JsonUtils.h>
@@ -40,16 +46,16 @@ namespace AZ::JsonSerializationUtils
 
     AZ::Outcome<void, AZStd::string> WriteJsonFile(const rapidjson::Document& document, AZStd::string_view filePath, WriteJsonSettings settings)
     {
-        // Write the json into memory first and then write the file, rather than passing a file stream to rapidjson.
-        // This should avoid creating a large number of micro-writes to the file.
-        AZStd::string fileContent;
-        auto outcome = WriteJsonString(document, fileContent, settings);
-        if (!outcome.IsSuccess())
+        // The json text is written straight to the file. WriteJsonStream caches the output and writes it in large blocks,
+        // so this doesn't create micro-writes and avoids keeping a copy of the entire text in memory next to the document.
+        AZ::IO::FixedMaxPath filePathFixed = filePath; // Because FileIOStream requires a null-terminated string
+        AZ::IO::FileIOStream stream(filePathFixed.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath);
+        if (!stream.IsOpen())
         {
-            return outcome;
+            return AZ::Failure(AZStd::string::format("Could not write to file '%s'", filePathFixed.c_str()));
         }
 
-        return AZ::Utils::WriteFile(fileContent, filePath);
+        return WriteJsonStream(document, stream, settings);
     }
 
     AZ::Outcome<void, AZStd::string> WriteJsonStream(const rapidjson::Document& document, IO::GenericStream& stream, WriteJsonSettings settings)
@@ -63,14 +69,18 @@ namespace AZ::JsonSerializationUtils
             writer.SetMaxDecimalPlaces(settings.m_maxDecimalPlaces);
         }
 
-        if (document.Accept(writer))
+        if (!document.Accept(writer))
         {
-            return AZ::Success();
+            return AZ::Failure(AZStd::string{"Json Writer failed"});
         }
-        else
+
+        // The text is cached, so a short write to the stream (disk full, I/O error) is only seen once the cache is flushed.
+        jsonStreamWriter.Flush();
+        if (jsonStreamWriter.HasWriteFailed())
         {
-            return AZ::Failure(AZStd::string{"Json Writer failed"});
+            return AZ::Failure(AZStd::string{"Json Writer failed to write all bytes to the stream"});
         }
+        return AZ::Success();
     }
 
     AZ::Outcome<void, AZStd::string> SaveObjectToStreamByType(const void* objectPtr, const Uuid& classId, IO::GenericStream& stream,
@@ -98,53 +108,69 @@ namespace AZ::JsonSerializationUtils
             saveSettings.m_serializeContext = serializeContext;
         }
 
-        rapidjson::Document jsonDocument;
-        jsonDocument.SetObject();
-        jsonDocument.AddMember(rapidjson::StringRef(FileTypeTag), rapidjson::StringRef(FileType), jsonDocument.GetAllocator());
+        const SerializeContext::ClassData* classData = serializeContext->FindClassData(classId);
+        if (!classData)
+        {
+            return AZ::Failure(AZStd::string::format("Try to save class from Id %s", classId.ToString<AZStd::string>().c_str()));
+        }
 
-        rapidjson::Value serializedObject;
+        // The object is written to the stream while it's being stored, so no json document is created for it. The header
+        // is written directly, followed by the stored object as ClassData.
+        AZ::IO::RapidJSONStreamWriter jsonStreamWriter(&stream);
+        rapidjson::PrettyWriter<AZ::IO::RapidJSONStreamWriter> writer(jsonStreamWriter);
+        JsonStreamWriterAdapter<rapidjson::PrettyWriter<AZ::IO::RapidJSONStreamWriter>> jsonOutput(writer);
 
-        JsonSerializationResult::ResultCode jsonResult = JsonSerialization::Store(serializedObject, jsonDocument.GetAllocator(),
-            objectPtr, defaultObjectPtr, classId, saveSettings);
+        bool jsonWriteResult = writer.StartObject()
+            && writer.Key(FileTypeTag) && writer.String(FileType)
+            && writer.Key(VersionTag) && writer.Int(1)
+            && writer.Key(ClassNameTag) && writer.String(classData->m_name)
+            && writer.Key(ClassDataTag);
+        if (!jsonWriteResult)
+        {
+            return AZ::Failure(AZStd::string::format("Unable to write class %s with json serialization format'",
+                classId.ToString<AZStd::string>().data()));
+        }
 
+        JsonSerializationResult::ResultCode jsonResult = JsonSerialization::Store(jsonOutput, objectPtr, defaultObjectPtr, classId, saveSettings);
         if (jsonResult.GetProcessing() != JsonSerializationResult::Processing::Completed)
         {
             return AZ::Failure(jsonResult.ToString(""));
         }
 
-        const SerializeContext::ClassData* classData = serializeContext->FindClassData(classId);
-
-        jsonDocument.AddMember(rapidjson::StringRef(VersionTag), 1, jsonDocument.GetAllocator());
-        jsonDocument.AddMember(rapidjson::StringRef(ClassNameTag), rapidjson::StringRef(classData->m_name), jsonDocument.GetAllocator());
-        jsonDocument.AddMember(rapidjson::StringRef(ClassDataTag), AZStd::move(serializedObject), jsonDocument.GetAllocator());
-
-        AZ::IO::RapidJSONStreamWriter jsonStreamWriter(&stream);
-        rapidjson::PrettyWriter<AZ::IO::RapidJSONStreamWriter> writer(jsonStreamWriter);
-        bool jsonWriteResult = jsonDocument.Accept(writer);
-        if (!jsonWriteResult)
+        if (!writer.EndObject())
         {
             return AZ::Failure(AZStd::string::format("Unable to write class %s with json serialization format'",
                 classId.ToString<AZStd::string>().data()));
         }
 
+        jsonStreamWriter.Flush();
+        if (jsonStreamWriter.HasWriteFailed())
+        {
+            return AZ::Failure(AZStd::string::format("Unable to write all bytes of class %s to the stream",
+                classId.ToString<AZStd::string>().data()));
+        }
+
         return AZ::Success();
     }
 
     AZ::Outcome<void, AZStd::string> SaveObjectToFileByType(const void* classPtr, const Uuid& classId, const AZStd::string& filePath,
         const void* defaultClassPtr, const JsonSerializerSettings* settings)
     {
-        AZStd::vector<char> buffer;
-        buffer.reserve(1024);
-        AZ::IO::ByteContainerStream<AZStd::vector<char> > byteStream(&buffer);
-        auto saveResult = SaveObjectToStreamByType(classPtr, classId, byteStream, defaultClassPtr, settings);
-        if (saveResult.IsSuccess())
+        AZ::IO::FileIOStream outputFileStream;
+        if (!outputFileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeText))
         {
-            AZ::IO::FileIOStream outputFileStream;
-            if (!outputFileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeText))
+            return AZ::Failure(AZStd::string::format("Error opening file '%s' for writing", filePath.c_str()));
+        }
+
+        auto saveResult = SaveObjectToStreamByType(classPtr, classId, outputFileStream, defaultClassPtr, settings);
+        if (!saveResult.IsSuccess())
+        {
+            // The object is written to the file while it's being stored, so a failed save leaves incomplete json behind.
+            outputFileStream.Close();
+            if (AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance())
             {
-                return AZ::Failure(AZStd::string::format("Error opening file '%s' for writing", filePath.c_str()));
+                fileIo->Remove(filePath.c_str());
             }
-            outputFileStream.Write(buffer.size(), buffer.data());
         }
         return saveResult;
     }
@@ -174,6 +200,15 @@ namespace AZ::JsonSerializationUtils
             }
         }
 
+        if (!returnSettings.m_registrationContext)
+        {
+            AZ::ComponentApplicationBus::BroadcastResult(returnSettings.m_registrationContext, &AZ::ComponentApplicationBus::Events::GetJsonRegistrationContext);
+            if (!returnSettings.m_registrationContext)
+            {
+                return AZ::Failure(AZStd::string("Need JsonRegistrationContext for loading"));
+            }
+        }
+
         // Report unused data field as error by default
         auto reporting = returnSettings.m_reporting;
         auto issueReportingCallback = [&deserializeError, reporting](AZStd::string_view message, JsonSerializationResult::ResultCode result, AZStd::string_view target) -> JsonSerializationResult::ResultCode
@@ -236,36 +271,49 @@ namespace AZ::JsonSerializationUtils
 
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
     {
-        IO::SizeType length = stream.GetLength();
+        // Parse while reading the stream in blocks, rather than first loading the entire json text into memory. This keeps
+        // the peak memory usage close to the size of the document instead of the document plus the text it was parsed from.
+        IO::RapidJSONStreamReader jsonStreamReader(&stream);
 
-        AZStd::vector<char> memoryBuffer;
-        memoryBuffer.resize_no_construct(static_cast<AZStd::vector<char>::size_type>(static_cast<AZStd::vector<char>::size_type>(length) + 1));
-
-        IO::SizeType bytesRead = stream.Read(length, memoryBuffer.data());
-        if (bytesRead != length)
+        rapidjson::Document jsonDocument;
+        jsonDocument.ParseStream<rapidjson::kParseCommentsFlag>(jsonStreamReader);
+        if (jsonStreamReader.HasReadFailed())
         {
             return AZ::Failure(AZStd::string{"Cannot to read input stream."});
         }
-
-        memoryBuffer.back() = 0;
-
-        return ReadJsonString(AZStd::string_view{memoryBuffer.data(), memoryBuffer.size()});
+        else if (jsonDocument.HasParseError())
+        {
+            return AZ::Failure(AZStd::string::format("JSON parse error at line %zu: %s", jsonStreamReader.GetLineNumber(),
+                rapidjson::GetParseError_En(jsonDocument.GetParseError())));
+        }
+        else
+        {
+            return AZ::Success(AZStd::move(jsonDocument));
+        }
     }
 
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFile(AZStd::string_view filePath, size_t maxFileSize)
     {
-        // Read into memory first and then parse the json, rather than passing a file stream to rapidjson.
-        // This should avoid creating a large number of micro-reads from the file.
-
-        auto readResult = AZ::Utils::ReadFile<AZStd::string>(filePath, maxFileSize);
-        if(!readResult.IsSuccess())
+        // The file is parsed through ReadJsonStream, which reads it in large blocks so this doesn't create micro-reads
+        // from the file and never holds the entire json text in memory.
+        AZ::IO::FixedMaxPath filePathFixed = filePath; // Because FileIOStream requires a null-terminated string
+        IO::FileIOStream file;
+        if (!file.Open(filePathFixed.c_str(), IO::OpenMode::ModeRead))
         {
-            return AZ::Failure(readResult.GetError());
+            return AZ::Failure(AZStd::string::format("Failed to open '%.*s'.", AZ_STRING_ARG(filePath)));
         }
 
-        AZStd::string jsonContent = readResult.TakeValue();
+        AZ::IO::SizeType length = file.GetLength();
+        if (length > maxFileSize)
+        {
+            return AZ::Failure(AZStd::string{ "Data is too large." });
+        }
+        else if (length == 0)
+        {
+            return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. File is empty.", AZ_STRING_ARG(filePath)));
+        }
 
-        auto result = ReadJsonString(jsonContent);
+        auto result = ReadJsonStream(file);
         if (!result.IsSuccess())
         {
             return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. %s", AZ_STRING_ARG(filePath), result.GetError().c_str()));
@@ -301,6 +349,354 @@ namespace AZ::JsonSerializationUtils
         return AZ::Success();
     }
 
+    namespace
+    {
+        //! Handler for rapidjson::Reader that reads a json file with the standard header for a generic class and loads its
+        //! ClassData into an object while the file is being parsed, so the json for the object is never fully kept in memory.
+        class ClassFileStreamReader
+        {
+        public:
+            using Ch = char;
+            //! Called with the class name from the header to get the object and type the ClassData will be loaded into.
+            using PrepareObjectCallback = AZStd::function<AZ::Outcome<void, AZStd::string>(const char* className, void*& object, Uuid& objectType)>;
+
+            ClassFileStreamReader(JsonDeserializerSettings& settings, PrepareObjectCallback prepareObject)
+                : m_context(settings)
+                , m_prepareObject(AZStd::move(prepareObject))
+                , m_capture(m_captureAllocator)
+            {
+            }
+
+            //! Reads the json file from the stream. Returns the result of loading the ClassData or an error if the stream couldn't
+            //! be read or parsed, or didn't contain a valid JsonSerialization file.
+            AZ::Outcome<JsonSerializationResult::ResultCode, AZStd::string> Read(IO::GenericStream& stream)
+            {
+                IO::RapidJSONStreamReader jsonStreamReader(&stream);
+                rapidjson::Reader reader;
+                reader.Parse<rapidjson::kParseCommentsFlag>(jsonStreamReader, *this);
+                if (jsonStreamReader.HasReadFailed())
+                {
+                    return AZ::Failure(AZStd::string{"Cannot to read input stream."});
+                }
+                if (!m_error.empty())
+                {
+                    return AZ::Failure(m_error);
+                }
+                if (m_hasLoaded && m_loadResult.GetProcessing() == JsonSerializationResult::Processing::Halted)
+                {
+                    return AZ::Success(m_loadResult);
+                }
+                if (reader.HasParseError())
+                {
+                    return AZ::Failure(AZStd::string::format("JSON parse error at line %zu: %s", jsonStreamReader.GetLineNumber(),
+                        rapidjson::GetParseError_En(reader.GetParseErrorCode())));
+                }
+                if (m_hasLoaded)
+                {
+                    return AZ::Success(m_loadResult);
+                }
+
+                // The ClassData was either missing, in which case it's treated as an empty object, or it came before the
+                // header fields that are needed to load it and has been collected so it can be loaded now.
+                bool hasCapturedClassData = m_hasClassData;
+                auto prepareResult = PrepareLoad(!hasCapturedClassData || m_capture.GetValue().IsObject());
+                if (!prepareResult.IsSuccess())
+                {
+                    return AZ::Failure(prepareResult.GetError());
+                }
+                JsonStreamLoader loader(m_object, m_objectType, m_context);
+                if (hasCapturedClassData)
+                {
+                    m_capture.GetValue().Accept(loader);
+                }
+                else
+                {
+                    loader.StartObject();
+                    loader.EndObject(0);
+                }
+                return AZ::Success(loader.GetResult());
+            }
+
+            bool Null()
+            {
+                return OnScalar([](auto& handler) { return handler.Null(); });
+            }
+            bool Bool(bool value)
+            {
+                return OnScalar([value](auto& handler) { return handler.Bool(value); });
+            }
+            bool Int(int value)
+            {
+                return OnScalar([value](auto& handler) { return handler.Int(value); });
+            }
+            bool Uint(unsigned value)
+            {
+                return OnScalar([value](auto& handler) { return handler.Uint(value); });
+            }
+            bool Int64(int64_t value)
+            {
+                return OnScalar([value](auto& handler) { return handler.Int64(value); });
+            }
+            bool Uint64(uint64_t value)
+            {
+                return OnScalar([value](auto& handler) { return handler.Uint64(value); });
+            }
+            bool Double(double value)
+            {
+                return OnScalar([value](auto& handler) { return handler.Double(value); });
+            }
+            bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy)
+            {
+                return OnScalar([str, length, copy](auto& handler) { return handler.RawNumber(str, length, copy); });
+            }
+            bool String(const Ch* str, rapidjson::SizeType length, bool copy)
+            {
+                return OnScalar([str, length, copy](auto& handler) { return handler.String(str, length, copy); }, AZStd::string_view(str, length));
+            }
+
+            bool StartObject()
+            {
+                auto event = [](auto& handler) { return handler.StartObject(); };
+                if (IsForwarding())
+                {
+                    return Forward(event);
+                }
+                if (m_depth == 0 && m_skipDepth == 0)
+                {
+                    m_depth = 1;
+                    return true;
+                }
+                return OnStart(event, true);
+            }
+
+            bool Key(const Ch* str, rapidjson::SizeType length, bool copy)
+            {
+                if (IsForwarding())
+                {
+                    return Forward([str, length, copy](auto& handler) { return handler.Key(str, length, copy); });
+                }
+                if (m_skipDepth == 0)
+                {
+                    // Like rapidjson's FindMember, only the first field with a name is used.
+                    AZStd::string_view name(str, length);
+                    m_field =
+                        (name == FileTypeTag && !m_hasType) ? Field::Type :
+                        (name == ClassNameTag && !m_hasClassName) ? Field::ClassName :
+                        (name == ClassDataTag && !m_hasClassData) ? Field::ClassData :
+                        Field::Other;
+                }
+                return true;
+            }
+
+            bool EndObject(rapidjson::SizeType memberCount)
+            {
+                if (IsForwarding())
+                {
+                    return Forward([memberCount](auto& handler) { return handler.EndObject(memberCount); });
+                }
+                if (m_skipDepth > 0)
+                {
+                    --m_skipDepth;
+                }
+                return true;
+            }
+
+            bool StartArray()
+            {
+                auto event = [](auto& handler) { return handler.StartArray(); };
+                if (IsForwarding())
+                {
+                    return Forward(event);
+                }
+                if (m_depth == 0)
+                {
+                    return Fail(NotValidFileError);
+                }
+                return OnStart(event, false);
+            }
+
+            bool EndArray(rapidjson::SizeType elementCount)
+            {
+                if (IsForwarding())
+                {
+                    return Forward([elementCount](auto& handler) { return handler.EndArray(elementCount); });
+                }
+                if (m_skipDepth > 0)
+                {
+                    --m_skipDepth;
+                }
+                return true;
+            }
+
+        private:
+            enum class Field : u8
+            {
+                None,
+                Type,
+                ClassName,
+                ClassData,
+                Other
+            };
+
+            static constexpr const char* NotValidFileError = "Not a valid JsonSerialization file";
+
+            bool IsForwarding() const
+            {
+                return m_loader || m_isCapturing;
+            }
+
+            template<typename Event>
+            bool Forward(const Event& event)
+            {
+                if (m_loader)
+                {
+                    bool result = event(*m_loader);
+                    if (m_loader->IsComplete())
+                    {
+                        m_loadResult = m_loader->GetResult();
+                        m_hasLoaded = true;
+                        m_loader.reset();
+                    }
+                    return result;
+                }
+
+                event(m_capture);
+                m_isCapturing = !m_capture.IsComplete();
+                return true;
+            }
+
+            bool Fail(AZStd::string error)
+            {
+                m_error = AZStd::move(error);
+                return false;
+            }
+
+            template<typename Event>
+            bool OnScalar(const Event& event, AZStd::optional<AZStd::string_view> string = AZStd::nullopt)
+            {
+                if (IsForwarding())
+                {
+                    return Forward(event);
+                }
+                if (m_skipDepth > 0)
+                {
+                    return true;
+                }
+                if (m_depth == 0)
+                {
+                    return Fail(NotValidFileError);
+                }
+
+                switch (AZStd::exchange(m_field, Field::None))
+                {
+                case Field::Type:
+                    m_hasType = true;
+                    m_isTypeValid = string.has_value() && azstrnicmp(string->data(), FileType, string->size()) == 0
+                        && string->size() == strlen(FileType);
+                    break;
+                case Field::ClassName:
+                    m_hasClassName = true;
+                    m_isClassNameString = string.has_value();
+                    if (string)
+                    {
+                        m_className = *string;
+                    }
+                    break;
+                case Field::ClassData:
+                    return BeginClassData(event, false);
+                default:
+                    break;
+                }
+                return true;
+            }
+
+            template<typename Event>
+            bool OnStart(const Event& event, bool isObject)
+            {
+                if (m_skipDepth == 0)
+                {
+                    switch (AZStd::exchange(m_field, Field::None))
+                    {
+                    case Field::Type:
+                        m_hasType = true;
+                        m_isTypeValid = false;
+                        break;
+                    case Field::ClassName:
+                        m_hasClassName = true;
+                        m_isClassNameString = false;
+                        break;
+                    case Field::ClassData:
+                        return BeginClassData(event, isObject);
+                    default:
+                        break;
+                    }
+                }
+                ++m_skipDepth;
+                return true;
+            }
+
+            template<typename Event>
+            bool BeginClassData(const Event& event, bool isObject)
+            {
+                m_hasClassData = true;
+                if (!m_hasType || !m_hasClassName)
+                {
+                    // The header fields needed to load the ClassData come after it, so collect it to load it once they're read.
+                    m_isCapturing = true;
+                    return Forward(event);
+                }
+
+                auto prepareResult = PrepareLoad(isObject);
+                if (!prepareResult.IsSuccess())
+                {
+                    return Fail(prepareResult.TakeError());
+                }
+                m_loader = AZStd::make_unique<JsonStreamLoader>(m_object, m_objectType, m_context);
+                return Forward(event);
+            }
+
+            // Validates the header, the same way as ValidateJsonClassHeader, and retrieves the object to load the ClassData into.
+            AZ::Outcome<void, AZStd::string> PrepareLoad(bool isClassDataObject)
+            {
+                if (!m_hasType || !m_isTypeValid)
+                {
+                    return AZ::Failure(AZStd::string(NotValidFileError));
+                }
+                if (!m_hasClassName || !m_isClassNameString)
+                {
+                    return AZ::Failure(AZStd::string::format("File should contain ClassName"));
+                }
+                // data can be empty but it should be an object
+                if (!isClassDataObject)
+                {
+                    return AZ::Failure(AZStd::string::format("ClassData should be an object"));
+                }
+                return m_prepareObject(m_className.c_str(), m_object, m_objectType);
+            }
+
+            JsonDeserializerContext m_context;
+            PrepareObjectCallback m_prepareObject;
+            AZStd::unique_ptr<JsonStreamLoader> m_loader;
+            rapidjson::Document::AllocatorType m_captureAllocator;
+            JsonStreamValueBuilder m_capture;
+            JsonSerializationResult::ResultCode m_loadResult{ JsonSerializationResult::Tasks::ReadField };
+            AZStd::string m_className;
+            AZStd::string m_error;
+            void* m_object{ nullptr };
+            Uuid m_objectType{ Uuid::CreateNull() };
+            size_t m_depth{ 0 };
+            size_t m_skipDepth{ 0 };
+            Field m_field{ Field::None };
+            bool m_hasType{ false };
+            bool m_isTypeValid{ false };
+            bool m_hasClassName{ false };
+            bool m_isClassNameString{ false };
+            bool m_hasClassData{ false };
+            bool m_hasLoaded{ false };
+            bool m_isCapturing{ false };
+        };
+    } // namespace
+
     AZ::Outcome<void, AZStd::string> LoadObjectFromStringByType(void* objectToLoad, const Uuid& classId, AZStd::string_view stream,
         AZStd::string& deserializeErrors, const JsonDeserializerSettings* settings)
     {
@@ -374,37 +770,35 @@ namespace AZ::JsonSerializationUtils
             return AZ::Failure(prepare.GetError());
         }
 
-        auto parseResult = ReadJsonStream(stream);
-        if (!parseResult.IsSuccess())
+        auto prepareObject = [objectToLoad, &classId, &loadSettings](const char* className, void*& object, Uuid& objectType)
+            -> AZ::Outcome<void, AZStd::string>
         {
-            return AZ::Failure(parseResult.GetError());
-        }
-
-        const rapidjson::Document& jsonDocument = parseResult.GetValue();
-
-        auto validateResult = ValidateJsonClassHeader(jsonDocument);
-        if (!validateResult.IsSuccess())
-        {
-            return AZ::Failure(validateResult.GetError());
-        }
+            // validate class name
+            auto classData = loadSettings.m_serializeContext->FindClassData(classId);
+            if (!classData)
+            {
+                return AZ::Failure(AZStd::string::format("Try to load class from Id %s", classId.ToString<AZStd::string>().c_str()));
+            }
 
-        const char* className = jsonDocument.FindMember(ClassNameTag)->value.GetString();
+            if (azstricmp(classData->m_name, className) != 0)
+            {
+                return AZ::Failure(AZStd::string::format("Try to load class %s from class %s data", classData->m_name, className));
+            }
 
-        // validate class name
-        auto classData = loadSettings.m_serializeContext->FindClassData(classId);
-        if (!classData)
-        {
-            return AZ::Failure(AZStd::string::format("Try to load class from Id %s", classId.ToString<AZStd::string>().c_str()));
-        }
+            object = objectToLoad;
+            objectType = classId;
+            return AZ::Success();
+        };
 
-        if (azstricmp(classData->m_name, className) != 0)
+        // The object is loaded while the stream is parsed, so the json for it is never fully kept in memory.
+        ClassFileStreamReader reader(loadSettings, AZStd::move(prepareObject));
+        auto readResult = reader.Read(stream);
+        if (!readResult.IsSuccess())
         {
-            return AZ::Failure(AZStd::string::format("Try to load class %s from class %s data", classData->m_name, className));
+            return AZ::Failure(readResult.GetError());
         }
 
-        JsonSerializationResult::ResultCode result = JsonSerialization::Load(objectToLoad, classId, jsonDocument.FindMember(ClassDataTag)->value, loadSettings);
-
-        if (!WasLoadSuccess(result.GetOutcome()))
+        if (!WasLoadSuccess(readResult.GetValue().GetOutcome()))
         {
             return AZ::Failure(deserializeErrors);
         }
@@ -435,40 +829,36 @@ namespace AZ::JsonSerializationUtils
             return AZ::Failure(prepare.GetError());
         }
 
-        auto parseResult = ReadJsonStream(stream);
-        if (!parseResult.IsSuccess())
+        AZStd::any anyData;
+        auto prepareObject = [&anyData, &loadSettings](const char* className, void*& object, Uuid& objectType)
+            -> AZ::Outcome<void, AZStd::string>
         {
-            return AZ::Failure(parseResult.GetError());
-        }
+            AZStd::vector<AZ::Uuid> ids = loadSettings.m_serializeContext->FindClassId(AZ::Crc32(className));
+            if (ids.empty())
+            {
+                return AZ::Failure(AZStd::string::format("Can't find serialize context for class %s", className));
+            }
 
-        const rapidjson::Document& jsonDocument = parseResult.GetValue();
+            // Load with first found class id
+            objectType = ids[0];
+            anyData = loadSettings.m_serializeContext->CreateAny(objectType);
+            object = AZStd::any_cast<void>(&anyData);
+            return AZ::Success();
+        };
 
-        auto validateResult = ValidateJsonClassHeader(jsonDocument);
-        if (!parseResult.IsSuccess())
+        ClassFileStreamReader reader(loadSettings, AZStd::move(prepareObject));
+        auto readResult = reader.Read(stream);
+        if (!readResult.IsSuccess())
         {
-            return AZ::Failure(parseResult.GetError());
+            return AZ::Failure(readResult.GetError());
         }
 
-        const char* className = jsonDocument.FindMember(ClassNameTag)->value.GetString();
-        AZStd::vector<AZ::Uuid> ids = loadSettings.m_serializeContext->FindClassId(AZ::Crc32(className));
-
-        // Load with first found class id
-        if (ids.size() >= 1)
+        if (!WasLoadSuccess(readResult.GetValue().GetOutcome()) || !deserializeErrors.empty())
         {
-            auto classId = ids[0];
-            AZStd::any anyData = loadSettings.m_serializeContext->CreateAny(classId);
-            auto& objectData = jsonDocument.FindMember(ClassDataTag)->value;
-            JsonSerializationResult::ResultCode result = JsonSerialization::Load(AZStd::any_cast<void>(&anyData), classId, objectData, loadSettings);
-
-            if (!WasLoadSuccess(result.GetOutcome()) || !deserializeErrors.empty())
-            {
-                return AZ::Failure(deserializeErrors);
-            }
-
-            return AZ::Success(anyData);
+            return AZ::Failure(deserializeErrors);
         }
 
-        return AZ::Failure(AZStd::string::format("Can't find serialize context for class %s", className));
+        return AZ::Success(anyData);
     }
 
     AZ::Outcome<AZStd::any, AZStd::string> LoadAnyObjectFromFile(const AZStd::string& filePath, const JsonDeserializerSettings* settings)
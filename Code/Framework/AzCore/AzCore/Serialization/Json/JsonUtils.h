@@ -45,6 +45,8 @@ namespace AZ
         //! Save a json document to a stream. Otherwise returns a failure with error message.
         AZ::Outcome<void, AZStd::string> WriteJsonStream(const rapidjson::Document& document, IO::GenericStream& stream, WriteJsonSettings settings = WriteJsonSettings{});
 
+        //! Save an object to a stream with the standard header for a generic class. The json is written to the stream while
+        //! the object is being stored, so no json document is created for the object.
         AZ::Outcome<void, AZStd::string> SaveObjectToStreamByType(const void* objectPtr, const Uuid& objectType, IO::GenericStream& stream,
             const void* defaultObjectPtr = nullptr, const JsonSerializerSettings* settings = nullptr);
         AZ::Outcome<void, AZStd::string> SaveObjectToFileByType(const void* objectPtr, const Uuid& objectType, const AZStd::string& filePath,
@@ -80,6 +82,7 @@ namespace AZ
         
         //! Load object with known class type
         //! Even if errorsOut contains errors, the load to an object could have succeeded
+        //! The stream versions load the object while the json text is parsed, so no json document is created for the object.
         AZ::Outcome<void, AZStd::string> LoadObjectFromStringByType(void* objectToLoad, const Uuid& objectType, AZStd::string_view source,
             AZStd::string& errorsOut, const JsonDeserializerSettings* settings = nullptr);
 
@@ -119,9 +119,13 @@ namespace AZ
             bool LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags);
 
             // returns true if an element was found at the requested level
-            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
-            // used during load to skip the rest of the element including any subelements
-            void SkipElement();
+            // loadPlan is the load plan of the parent class if load plans are used, it resolves the class data of elements stored with their reflected type
+            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+                const SerializeContext::ClassLoadPlan* loadPlan = nullptr);
+            // used during load to skip the rest of the element including any subelements, optionally counting the direct subelements
+            void SkipElement(size_t* numChildElements = nullptr);
+            // returns the number of direct subelements of the element being loaded from a binary stream without consuming them
+            size_t CountChildElements();
 
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
@@ -386,6 +390,14 @@ namespace AZ
 
             size_t currentContainerElementIndex = 0;    // used to load container elements
 
+            // Binary streams can use the load plan of the class instead of walking its reflection data for every element
+            const bool useLoadPlans = (m_filterDesc.m_flags & FILTERFLAG_USE_LOAD_PLANS) && GetType() == ST_BINARY;
+            const SerializeContext::ClassLoadPlan* loadPlan = nullptr;
+            if (useLoadPlans && parentClassInfo && !parentClassInfo->m_container)
+            {
+                loadPlan = m_sc->GetClassLoadPlan(parentClassInfo);
+            }
+
             while (true)
             {
                 // reset the class info
@@ -417,7 +429,7 @@ namespace AZ
                 }
                 else // read from the stream
                 {
-                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr))
+                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr, loadPlan))
                     {
                         // we have reached the end of this branch, so exit the loop
                         break;
@@ -520,6 +532,7 @@ namespace AZ
                 // reflected hierarchy.
                 // If it is a pointer type, the node could be of a derived type!
                 const SerializeContext::ClassElement* classElement = nullptr;
+                const SerializeContext::ClassLoadPlan::Element* planElement = nullptr;
                 SerializeContext::IDataContainer* classContainer = nullptr;
                 SerializeContext::ClassElement dynamicElementMetadata;  // we'll point to this if we are loading a DynamicSerializableField
                 if (parentClassInfo)
@@ -598,65 +611,79 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        // Find the reflected element with the name of the stored one, load plans keep them sorted by name
+                        const SerializeContext::ClassElement* childElement = nullptr;
+                        if (loadPlan)
+                        {
+                            planElement = loadPlan->FindElement(element.m_nameCrc);
+                            childElement = planElement ? planElement->m_classElement : nullptr;
+                        }
+                        else
+                        {
+                            for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                            {
+                                if (parentClassInfo->m_elements[i].m_nameCrc == element.m_nameCrc)
+                                {
+                                    childElement = &parentClassInfo->m_elements[i];
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (childElement)
                         {
-                            const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
-                            if (childElement->m_nameCrc == element.m_nameCrc)
+                            // if the member is a pointer type, then the pointer could be a derived type,
+                            // otherwise we need the uuids to be exactly the same.
+                            if (childElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
                             {
-                                // if the member is a pointer type, then the pointer could be a derived type,
-                                // otherwise we need the uuids to be exactly the same.
-                                if (childElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                                bool isCastableToClassElement = m_sc->CanDowncast(element.m_id, childElement->m_typeId, classData->m_azRtti, childElement->m_azRtti);
+                                bool isConvertableToClassElement = false;
+                                if(!isCastableToClassElement)
+                                {
+                                    const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
+                                    isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
+                                }
+                                if (isCastableToClassElement || isConvertableToClassElement)
                                 {
-                                    bool isCastableToClassElement = m_sc->CanDowncast(element.m_id, childElement->m_typeId, classData->m_azRtti, childElement->m_azRtti);
-                                    bool isConvertableToClassElement = false;
-                                    if(!isCastableToClassElement)
-                                    {
-                                        const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
-                                        isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
-                                    }
-                                    if (isCastableToClassElement || isConvertableToClassElement)
-                                    {
-                                        classElement = childElement;
-                                    }
-                                    else
-                                    {
-                                        // Name matched but wrong type, this is an error when conversion function is not supplied.
-                                        AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s and cannot be downcasted to type %s.  File %s",
-                                            element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
-                                            element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
-                                            GetStreamFilename());
-
-                                        result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
-                                        m_errorLogger.ReportError(error.c_str());
-                                    }
+                                    classElement = childElement;
                                 }
                                 else
                                 {
-                                    bool isCastableToClassElement = element.m_id == childElement->m_typeId;
-                                    bool isConvertableToClassElement = false;
-                                    if (!isCastableToClassElement)
-                                    {
-                                        const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
-                                        isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
-                                    }
-
-                                    if (element.m_id == childElement->m_typeId || isConvertableToClassElement)
-                                    {
-                                        classElement = childElement;
-                                    }
-                                    else
-                                    {
-                                        // Name matched but wrong type, this is an error when conversion function is not supplied.
-                                        AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s but needs to be type %s.  File %s",
-                                            element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
-                                            element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
-                                            GetStreamFilename());
-
-                                        result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
-                                        m_errorLogger.ReportError(error.c_str());
-                                    }
+                                    // Name matched but wrong type, this is an error when conversion function is not supplied.
+                                    AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s and cannot be downcasted to type %s.  File %s",
+                                        element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
+                                        element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
+                                        GetStreamFilename());
+
+                                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                                    m_errorLogger.ReportError(error.c_str());
+                                }
+                            }
+                            else
+                            {
+                                bool isCastableToClassElement = element.m_id == childElement->m_typeId;
+                                bool isConvertableToClassElement = false;
+                                if (!isCastableToClassElement)
+                                {
+                                    const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
+                                    isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
+                                }
+
+                                if (element.m_id == childElement->m_typeId || isConvertableToClassElement)
+                                {
+                                    classElement = childElement;
+                                }
+                                else
+                                {
+                                    // Name matched but wrong type, this is an error when conversion function is not supplied.
+                                    AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s but needs to be type %s.  File %s",
+                                        element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
+                                        element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
+                                        GetStreamFilename());
+
+                                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                                    m_errorLogger.ReportError(error.c_str());
                                 }
-                                break;
                             }
                         }
 
@@ -702,6 +729,24 @@ namespace AZ
                     }
                 }
 
+                // Trivially copyable values that are stored with their reflected type are copied straight into their member
+                if (planElement && planElement->m_directLoad && planElement->m_classElement == classElement && planElement->m_classData == classData
+                    && parentClassPtr && !isConvertedData && element.m_stream == &m_inStream && element.m_byteStream.GetLength() == 0
+                    && element.m_version == classData->m_version && element.m_dataSize == planElement->m_directLoadSize)
+                {
+                    void* dataAddress = reinterpret_cast<char*>(parentClassPtr) + classElement->m_offset;
+                    planElement->m_directLoad(dataAddress, m_inStream.GetData()->data());
+
+                    // Values have no child nodes, so the next tag is expected to close the element
+                    u8 endTag = ST_BINARYFLAG_ELEMENT_END;
+                    if (m_stream->Read(sizeof(endTag), &endTag) == sizeof(endTag) && endTag != ST_BINARYFLAG_ELEMENT_END)
+                    {
+                        m_stream->Seek(-static_cast<IO::OffsetType>(sizeof(endTag)), IO::GenericStream::ST_SEEK_CUR);
+                        result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                    }
+                    continue;
+                }
+
                 // Handle version conversions for non-custom serialized classes
                 if (element.m_version < classData->m_version && !classData->m_serializer)
                 {
@@ -820,6 +865,12 @@ namespace AZ
                 if (classData->m_container && dataAddress)
                 {
                     classData->m_container->ClearElements(dataAddress, m_sc);
+
+                    // Reserve storage for all elements up front rather than growing the container one element at a time
+                    if (useLoadPlans && convertedNode->m_classData == nullptr && m_sc->GetClassLoadPlan(classData)->m_canReserveCapacity)
+                    {
+                        classData->m_container->ReserveCapacity(dataAddress, CountChildElements());
+                    }
                 }
 
                 // Read child nodes
@@ -1010,7 +1061,8 @@ namespace AZ
         // [4/19/2012]
         //=========================================================================
         bool
-        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement)
+        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+            const SerializeContext::ClassLoadPlan* loadPlan)
         {
             AZ_Assert(element.m_stream != nullptr, "You must provide a stream to store the values!");
             element.m_version = 0;
@@ -1341,15 +1393,24 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
-
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
+                // elements stored with their reflected type have their class data resolved by the load plan of the parent
+                const SerializeContext::ClassLoadPlan::Element* planElement = loadPlan ? loadPlan->FindElement(element.m_nameCrc) : nullptr;
+                if (planElement && planElement->m_classData && planElement->m_classElement->m_typeId == element.m_id)
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    cd = planElement->m_classData;
+                    element.m_id = planElement->m_typeId;
+                }
+                else
+                {
+                    // find the registered class data
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd)
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
@@ -1419,7 +1480,7 @@ namespace AZ
         // SkipElement
         // [1/19/2013]
         //=========================================================================
-        void ObjectStreamImpl::SkipElement()
+        void ObjectStreamImpl::SkipElement(size_t* numChildElements)
         {
             if (GetType() == ST_BINARY)
             {
@@ -1437,6 +1498,10 @@ namespace AZ
                     }
                     else
                     {
+                        if (numChildElements && endTagsNeeded == 1)
+                        {
+                            ++(*numChildElements);
+                        }
                         ++endTagsNeeded;
                         size_t bytesToSkip = sizeof(Uuid);  // this field is guaranteed to be there
                         if (flagsSize & ST_BINARYFLAG_HAS_NAME)
@@ -1499,6 +1564,19 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // CountChildElements
+        //=========================================================================
+        size_t ObjectStreamImpl::CountChildElements()
+        {
+            AZ_Assert(GetType() == ST_BINARY, "Child elements can only be counted ahead in binary streams!");
+            const IO::SizeType elementPosition = m_stream->GetCurPos();
+            size_t numChildElements = 0;
+            SkipElement(&numChildElements);
+            m_stream->Seek(static_cast<IO::OffsetType>(elementPosition), IO::GenericStream::ST_SEEK_BEGIN);
+            return numChildElements;
+        }
+
         //=========================================================================
         // WriteClass
         // [6/22/2012]
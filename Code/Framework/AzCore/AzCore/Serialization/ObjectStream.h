@@ -160,6 +160,13 @@ namespace AZ
             * this is only to be rarely used, when reading data you know contains classes that you want to ignore silently, not for ignoring errors in general.
             */ 
             FILTERFLAG_IGNORE_UNKNOWN_CLASSES   = 1 << 1, 
+
+            /**
+            * if FILTERFLAG_USE_LOAD_PLANS is set, binary streams are loaded with the class load plans cached in the SerializeContext.
+            * Element lookups use the precompiled tables of the plans, trivially copyable values are copied straight into their members
+            * and containers reserve storage for all their elements before loading them. The loaded data is the same as without the flag.
+            */
+            FILTERFLAG_USE_LOAD_PLANS           = 1 << 2,
             
         };
 
@@ -23,6 +23,7 @@
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/Math/MathUtils.h>
@@ -345,6 +346,37 @@ namespace AZ
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Class load plans
+
+    // Direct counterpart of BinaryValueSerializer::Load for a value stored in a big endian binary stream.
+    template<class T>
+    static void DirectLoadBinaryValue(void* storage, const void* streamData)
+    {
+        T value;
+        memcpy(&value, streamData, sizeof(T));
+        AZStd::endian_swap(value);
+        memcpy(storage, &value, sizeof(T));
+    }
+
+    // Sets up the direct load of a plan element if the element type is one of the supplied types, which all use a BinaryValueSerializer.
+    template<class... T>
+    static bool SetupDirectLoad(SerializeContext::ClassLoadPlan::Element& planElement, const Uuid& typeId, size_t dataSize)
+    {
+        auto setupType = [&planElement, &typeId, dataSize](auto* typePtr)
+        {
+            using ValueType = AZStd::remove_pointer_t<decltype(typePtr)>;
+            if (typeId != AzTypeInfo<ValueType>::Uuid() || dataSize != sizeof(ValueType))
+            {
+                return false;
+            }
+            planElement.m_directLoad = &DirectLoadBinaryValue<ValueType>;
+            planElement.m_directLoadSize = sizeof(ValueType);
+            return true;
+        };
+        return (setupType(static_cast<T*>(nullptr)) || ...);
+    }
+
     // serializer without any data write
     class EmptySerializer
         : public SerializeContext::IDataSerializer
@@ -709,6 +741,80 @@ namespace AZ
         return enumToUnderlyingTypeIdIter != m_enumTypeIdToUnderlyingTypeIdMap.end() ? enumToUnderlyingTypeIdIter->second : enumTypeId;
     }
 
+    //=========================================================================
+    // ClassLoadPlan::FindElement
+    //=========================================================================
+    const SerializeContext::ClassLoadPlan::Element* SerializeContext::ClassLoadPlan::FindElement(u32 nameCrc) const
+    {
+        auto elementIt = AZStd::lower_bound(m_elements.begin(), m_elements.end(), nameCrc,
+            [](const Element& element, u32 elementNameCrc) { return element.m_nameCrc < elementNameCrc; });
+        return elementIt != m_elements.end() && elementIt->m_nameCrc == nameCrc ? &(*elementIt) : nullptr;
+    }
+
+    //=========================================================================
+    // GetClassLoadPlan
+    //=========================================================================
+    const SerializeContext::ClassLoadPlan* SerializeContext::GetClassLoadPlan(const ClassData* classData) const
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_classLoadPlanMutex);
+            auto planIt = m_classLoadPlans.find(classData);
+            if (planIt != m_classLoadPlans.end())
+            {
+                return planIt->second.get();
+            }
+        }
+
+        // The plan is built outside of the lock. If another thread builds the same plan at the same time, the first one stored is used.
+        auto plan = AZStd::make_unique<ClassLoadPlan>();
+        if (classData->m_container)
+        {
+            // Container elements are resolved by the container itself, the plan only tells if storage can be reserved up front.
+            plan->m_canReserveCapacity = classData->m_container->CanReserveCapacity();
+        }
+        else
+        {
+            plan->m_elements.reserve(classData->m_elements.size());
+            for (const ClassElement& classElement : classData->m_elements)
+            {
+                ClassLoadPlan::Element& planElement = plan->m_elements.emplace_back();
+                planElement.m_nameCrc = classElement.m_nameCrc;
+                planElement.m_classElement = &classElement;
+                planElement.m_typeId = classElement.m_typeId;
+                // Same lookup the ObjectStream does for an element stored with the reflected type
+                planElement.m_classData = FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+                if (planElement.m_classData)
+                {
+                    if (GenericClassInfo* genericClassInfo = FindGenericClassInfo(planElement.m_classData->m_typeId))
+                    {
+                        planElement.m_typeId = genericClassInfo->GetSpecializedTypeId();
+                    }
+
+                    if ((classElement.m_flags & ClassElement::FLG_POINTER) == 0)
+                    {
+                        SetupDirectLoad<char, AZ::s8, short, int, long, AZ::s64, unsigned char, unsigned short, unsigned int, unsigned long, AZ::u64, float, double, bool>(
+                            planElement, planElement.m_classData->m_typeId, classElement.m_dataSize);
+                    }
+                }
+            }
+            // Stable, so elements sharing a name are found in reflection order
+            AZStd::stable_sort(plan->m_elements.begin(), plan->m_elements.end(),
+                [](const ClassLoadPlan::Element& lhs, const ClassLoadPlan::Element& rhs) { return lhs.m_nameCrc < rhs.m_nameCrc; });
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_classLoadPlanMutex);
+        return m_classLoadPlans.emplace(classData, AZStd::move(plan)).first->second.get();
+    }
+
+    //=========================================================================
+    // ClearClassLoadPlans
+    //=========================================================================
+    void SerializeContext::ClearClassLoadPlans()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_classLoadPlanMutex);
+        m_classLoadPlans.clear();
+    }
+
     void SerializeContext::RegisterGenericClassInfo(const Uuid& classId, GenericClassInfo* genericClassInfo, const CreateAnyFunc& createAnyFunc)
     {
         if (!genericClassInfo)
@@ -733,6 +839,7 @@ namespace AZ
 
             if (scGenericInfoFoundIt == scGenericClassInfoRange.second)
             {
+                ClearClassLoadPlans();
                 m_uuidGenericMap.emplace(classId, genericClassInfo);
                 m_uuidAnyCreationMap.emplace(classId, createAnyFunc);
                 m_classNameToUuid.emplace(genericClassInfo->GetClassData()->m_name, classId);
@@ -1635,6 +1742,8 @@ namespace AZ
     //=========================================================================
     SerializeContext::ClassBuilder::~ClassBuilder()
     {
+        // Fields are added through the builder, plans built in between would miss them
+        m_context->ClearClassLoadPlans();
 #if defined(AZ_ENABLE_TRACING)
         if (!m_context->IsRemovingReflection())
         {
@@ -2799,6 +2908,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        ClearClassLoadPlans();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
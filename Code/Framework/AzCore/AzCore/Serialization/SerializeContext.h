@@ -28,6 +28,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -650,6 +651,37 @@ namespace AZ
             }
         };
 
+        /**
+         * Load plan of a class, used by the binary ObjectStream reader.
+         * It flattens the reflected elements of a class (including the ones of its base classes) into a table sorted by
+         * name crc and resolves the class data of every element up front, so loading an instance neither walks the
+         * reflection data nor looks up the element types again. Plans are built on first use and cached per SerializeContext.
+         */
+        class ClassLoadPlan
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(ClassLoadPlan, SystemAllocator, 0);
+
+            /// Copies a value of a trivially copyable type from its big endian stream representation into its storage.
+            using DirectLoadFunction = void(*)(void* storage, const void* streamData);
+
+            struct Element
+            {
+                u32                 m_nameCrc = 0;
+                const ClassElement* m_classElement = nullptr;   ///< Reflected element in the class data the plan was built for.
+                const ClassData*    m_classData = nullptr;      ///< Class data of the element type, null if the type isn't registered.
+                Uuid                m_typeId;                   ///< Element type id after the generic class info specialization has been applied.
+                DirectLoadFunction  m_directLoad = nullptr;     ///< Set if the value can be copied into its member without going through its serializer.
+                size_t              m_directLoadSize = 0;       ///< Number of bytes the value occupies in the stream if m_directLoad is set.
+            };
+
+            /// Returns the element with the supplied name crc, or null if the class has no such element.
+            const Element* FindElement(u32 nameCrc) const;
+
+            AZStd::vector<Element>  m_elements;                 ///< Elements sorted by name crc.
+            bool                    m_canReserveCapacity = false; ///< True if the class is a container that can reserve storage for all elements before loading them.
+        };
+
         /**
          * Interface for creating and destroying object from the serializer.
          */
@@ -808,6 +840,14 @@ namespace AZ
             {
                 RemoveElement(instance, element, deletePointerDataContext);
             }
+            /// Returns true if the container can reserve storage for a known number of elements with ReserveCapacity.
+            virtual bool    CanReserveCapacity() const { return false; }
+            /// Reserve storage for numElements elements (called before the elements are reserved and loaded one by one).
+            virtual void    ReserveCapacity(void* instance, size_t numElements)
+            {
+                (void)instance;
+                (void)numElements;
+            }
             /// Get an element's address by its index (called before the element is loaded).
             virtual void*   GetElementByIndex(void* instance, const ClassElement* classElement, size_t index) = 0;
             /// Store the element that was reserved before (called post loading)
@@ -1062,6 +1102,10 @@ namespace AZ
         /// Find a class data (stored information) based on a class name
         AZStd::vector<AZ::Uuid> FindClassId(const AZ::Crc32& classNameCrc) const;
 
+        /// Returns the load plan of a class for the binary ObjectStream reader, the plan is built on first use.
+        /// Plans are discarded whenever the reflection changes, so they must not be held past the load that requested them.
+        const ClassLoadPlan* GetClassLoadPlan(const ClassData* classData) const;
+
         /// Find GenericClassData data based on the supplied class ID
         GenericClassInfo* FindGenericClassInfo(const Uuid& classId) const;
 
@@ -1112,6 +1156,8 @@ namespace AZ
         void RemoveClassData(ClassData* classData);
         /// Removes the GenericClassInfo from the GenericClassInfoMap
         void RemoveGenericClassInfo(GenericClassInfo* genericClassInfo);
+        /// Discards the cached class load plans, called whenever the reflected data changes
+        void ClearClassLoadPlans();
 
         /// Adds class data, including base class element data
         template<class T, class BaseClass>
@@ -1345,6 +1391,8 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        mutable AZStd::shared_mutex m_classLoadPlanMutex; ///< Guards m_classLoadPlans, plans are built lazily by the loading threads
+        mutable AZStd::unordered_map<const ClassData*, AZStd::unique_ptr<ClassLoadPlan>> m_classLoadPlans; ///< Class data to load plan map used by the binary ObjectStream reader
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
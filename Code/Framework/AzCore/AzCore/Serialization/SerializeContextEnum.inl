@@ -174,6 +174,7 @@ namespace AZ
                 enumTypeIter->second.m_name, underlyingTypeId.ToString<AZStd::string>().data(), name);
             if (enumTypeIter == m_uuidMap.end())
             {
+                ClearClassLoadPlans();
                 typename UuidToClassMap::pair_iter_bool enumTypeInsertIter = m_uuidMap.emplace(enumTypeId, ClassData::Create<EnumType>(name, enumTypeId, factory));
                 ClassData& enumClassData = enumTypeInsertIter.first->second;
                 enumClassData.m_serializer = IDataSerializerPtr{ new SerializeContextEnumInternal::EnumSerializer<EnumType>(), IDataSerializer::CreateDefaultDeleteDeleter() };
@@ -386,6 +386,16 @@ namespace AZ
         //! @param useFileIo If true the FileIOBase instance will attempted to be used for FileIOBase
         //! operations before falling back to use SystemFile
         virtual void SetUseFileIO(bool useFileIo) = 0;
+
+        //! Sets the number of threads MergeSettingsFolder may use to read and parse the files of a folder.
+        //! Files are always merged into the registry in their sorted order on the calling thread, only reading and parsing
+        //! is spread out. A count of 0 or 1 reads and parses every file on the calling thread.
+        virtual void SetMergeThreadCount(AZ::u32 threadCount) = 0;
+        //! Sets the folder where MergeSettingsFolder caches the parsed contents of registry folders in a binary format.
+        //! A cached folder is only used if the names, sizes and modification times of its files match the ones recorded in
+        //! the cache, otherwise the folder is parsed again and its cache entry is replaced.
+        //! @param cacheFolder The folder to store cache entries in. An empty path disables the cache.
+        virtual void SetMergeCacheFolder(AZStd::string_view cacheFolder) = 0;
     };
 
     inline SettingsRegistryInterface::Visitor::~Visitor() = default;
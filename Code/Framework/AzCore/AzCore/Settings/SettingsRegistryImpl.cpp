@@ -9,17 +9,24 @@
 #include <cctype>
 #include <cerrno>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/DOM/Backends/Binary/BinarySerializationUtils.h>
+#include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
+#include <AzCore/DOM/DomPath.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/JSON/error/en.h>
+#include <AzCore/Math/Uuid.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ::SettingsRegistryImplInternal
 {
@@ -888,6 +895,53 @@ namespace AZ
                 return false;
             }
 
+            if (m_mergeThreadCount > 1 || !m_mergeCacheFolder.empty())
+            {
+                // Read and parse all files up front, either from the merge cache or spread out over multiple threads. The
+                // documents are still merged one at a time in the sorted order so the result is identical to the serial merge.
+                ParsedRegistryFileList parsedFiles(fileList.size());
+                for (size_t i = 0; i < fileList.size(); ++i)
+                {
+                    folderPath.Native().erase(platformKeyOffset);
+                    if (fileList[i].m_isPlatformFile)
+                    {
+                        folderPath /= PlatformFolder;
+                        folderPath /= platform;
+                    }
+                    folderPath /= fileList[i].m_relativePath;
+                    parsedFiles[i].m_path = folderPath.Native();
+                    parsedFiles[i].m_isPatch = fileList[i].m_isPatch;
+                }
+
+                AZStd::string cacheKey;
+                AZ::IO::FixedMaxPathString cacheName;
+                bool useCache = !m_mergeCacheFolder.empty() && GetMergeCacheKey(cacheKey, cacheName, path, platform, parsedFiles);
+                if (!useCache || !LoadMergeCache(cacheName, cacheKey, parsedFiles))
+                {
+                    ReadRegistryFiles(parsedFiles);
+                    if (useCache)
+                    {
+                        StoreMergeCache(cacheName, cacheKey, parsedFiles);
+                    }
+                }
+
+                for (ParsedRegistryFile& parsedFile : parsedFiles)
+                {
+                    if (parsedFile.m_result != ReadSettingsFileResult::Success)
+                    {
+                        ReportReadSettingsFileError(parsedFile.m_path.c_str(), parsedFile.m_result, parsedFile.m_document);
+                    }
+                    else
+                    {
+                        MergeSettingsDocument(parsedFile.m_path.c_str(),
+                            parsedFile.m_isPatch ? Format::JsonPatch : Format::JsonMergePatch, rootKey, parsedFile.m_document);
+                    }
+                    // Release the memory as soon as the file has been merged instead of keeping every document alive.
+                    parsedFile = ParsedRegistryFile{};
+                }
+                return true;
+            }
+
             // Load the registry files in the sorted order.
             for (RegistryFile& registryFile : fileList)
             {
@@ -1173,61 +1227,97 @@ namespace AZ
 
     bool SettingsRegistryImpl::MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey,
         AZStd::vector<char>& scratchBuffer)
+    {
+        rapidjson::Document jsonPatch;
+        ReadSettingsFileResult readResult = ReadSettingsFile(path, m_useFileIo, scratchBuffer, jsonPatch);
+        if (readResult != ReadSettingsFileResult::Success)
+        {
+            ReportReadSettingsFileError(path, readResult, jsonPatch);
+            return false;
+        }
+        return MergeSettingsDocument(path, format, rootKey, jsonPatch);
+    }
+
+    auto SettingsRegistryImpl::ReadSettingsFile(const char* path, bool useFileIo, AZStd::vector<char>& scratchBuffer,
+        rapidjson::Document& document) -> ReadSettingsFileResult
     {
         using namespace AZ::IO;
+
+        FileReader fileReader(useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr, path);
+        if (!fileReader.IsOpen())
+        {
+            return ReadSettingsFileResult::OpenFailed;
+        }
+
+        u64 fileSize = fileReader.Length();
+        if (fileSize == 0)
+        {
+            return ReadSettingsFileResult::EmptyFile;
+        }
+
+        scratchBuffer.clear();
+        scratchBuffer.resize_no_construct(fileSize + 1);
+        if (fileReader.Read(fileSize, scratchBuffer.data()) != fileSize)
+        {
+            return ReadSettingsFileResult::ReadFailed;
+        }
+        scratchBuffer[fileSize] = 0;
+
+        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
+        document.ParseInsitu<flags>(scratchBuffer.data());
+        return document.HasParseError() ? ReadSettingsFileResult::ParseFailed : ReadSettingsFileResult::Success;
+    }
+
+    void SettingsRegistryImpl::ReportReadSettingsFileError(const char* path, ReadSettingsFileResult result,
+        const rapidjson::Document& document)
+    {
         using namespace rapidjson;
 
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
-        FileReader fileReader(m_useFileIo ? AZ::IO::FileIOBase::GetInstance(): nullptr, path);
-        if (!fileReader.IsOpen())
+        switch (result)
+        {
+        case ReadSettingsFileResult::OpenFailed:
         {
             AZ_Error("Settings Registry", false, R"(Unable to open registry file "%s".)", path);
+            AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
-            return false;
+            break;
         }
-
-        u64 fileSize = fileReader.Length();
-        if (fileSize == 0)
+        case ReadSettingsFileResult::EmptyFile:
         {
             AZ_Warning("Settings Registry", false, R"(Registry file "%s" is 0 bytes in length. There is no nothing to merge)", path);
+            AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator())
                 .SetObject()
                 .AddMember(StringRef("Error"), StringRef("registry file is 0 bytes."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
-            return false;
+            break;
         }
-
-        scratchBuffer.clear();
-        scratchBuffer.resize_no_construct(fileSize + 1);
-        if (fileReader.Read(fileSize, scratchBuffer.data()) != fileSize)
+        case ReadSettingsFileResult::ReadFailed:
         {
             AZ_Error("Settings Registry", false, R"(Unable to read registry file "%s".)", path);
+            AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
-            return false;
+            break;
         }
-        scratchBuffer[fileSize] = 0;
-
-        rapidjson::Document jsonPatch;
-        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
-        jsonPatch.ParseInsitu<flags>(scratchBuffer.data());
-        if (jsonPatch.HasParseError())
+        case ReadSettingsFileResult::ParseFailed:
         {
             auto nativeUI = AZ::Interface<NativeUI::NativeUIRequests>::Get();
-            if (jsonPatch.GetParseError() == rapidjson::kParseErrorDocumentEmpty)
+            if (document.GetParseError() == rapidjson::kParseErrorDocumentEmpty)
             {
                 AZ_Warning("Settings Registry", false, R"(Unable to parse registry file "%s" due to json error "%s" at offset %zu.)",
-                    path, GetParseError_En(jsonPatch.GetParseError()), jsonPatch.GetErrorOffset());
+                    path, GetParseError_En(document.GetParseError()), document.GetErrorOffset());
             }
             else
             {
                 using ErrorString = AZStd::fixed_string<4096>;
                 auto jsonError = ErrorString::format(R"(Unable to parse registry file "%s" due to json error "%s" at offset %zu.)", path,
-                    GetParseError_En(jsonPatch.GetParseError()), jsonPatch.GetErrorOffset());
+                    GetParseError_En(document.GetParseError()), document.GetErrorOffset());
                 AZ_Error("Settings Registry", false, "%s", jsonError.c_str());
 
                 if (nativeUI)
@@ -1235,15 +1325,26 @@ namespace AZ
                     nativeUI->DisplayOkDialog("Setreg(Patch) Merge Issue", AZStd::string_view(jsonError), false);
                 }
             }
-            
+
             AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to parse registry file due to invalid json."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator())
-                .AddMember(StringRef("Message"), StringRef(GetParseError_En(jsonPatch.GetParseError())), m_settings.GetAllocator())
-                .AddMember(StringRef("Offset"), aznumeric_cast<uint64_t>(jsonPatch.GetErrorOffset()), m_settings.GetAllocator());
-            return false;
+                .AddMember(StringRef("Message"), StringRef(GetParseError_En(document.GetParseError())), m_settings.GetAllocator())
+                .AddMember(StringRef("Offset"), aznumeric_cast<uint64_t>(document.GetErrorOffset()), m_settings.GetAllocator());
+            break;
         }
+        default:
+            break;
+        }
+    }
+
+    bool SettingsRegistryImpl::MergeSettingsDocument(const char* path, Format format, AZStd::string_view rootKey,
+        const rapidjson::Document& jsonPatch)
+    {
+        using namespace rapidjson;
+
+        Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
         JsonMergeApproach mergeApproach;
         switch (format)
@@ -1340,4 +1441,198 @@ namespace AZ
     {
         m_useFileIo = useFileIo;
     }
+
+    void SettingsRegistryImpl::SetMergeThreadCount(AZ::u32 threadCount)
+    {
+        m_mergeThreadCount = threadCount;
+    }
+
+    void SettingsRegistryImpl::SetMergeCacheFolder(AZStd::string_view cacheFolder)
+    {
+        if (cacheFolder.size() >= m_mergeCacheFolder.max_size())
+        {
+            AZ_Error("Settings Registry", false, R"(Merge cache folder "%.*s" is too long, the merge cache will not be used.)",
+                AZ_STRING_ARG(cacheFolder));
+            m_mergeCacheFolder.clear();
+            return;
+        }
+        m_mergeCacheFolder = cacheFolder;
+    }
+
+    void SettingsRegistryImpl::ReadRegistryFiles(ParsedRegistryFileList& files) const
+    {
+        AZStd::atomic<size_t> nextFile{ 0 };
+        auto readFiles = [&files, &nextFile, useFileIo = m_useFileIo]()
+        {
+            for (size_t i = nextFile++; i < files.size(); i = nextFile++)
+            {
+                ParsedRegistryFile& file = files[i];
+                file.m_result = ReadSettingsFile(file.m_path.c_str(), useFileIo, file.m_buffer, file.m_document);
+            }
+        };
+
+        // The calling thread reads files as well, so only spawn the additional threads that can be kept busy.
+        size_t threadCount = AZStd::min(static_cast<size_t>(AZStd::max(m_mergeThreadCount, 1u)), files.size());
+        AZStd::vector<AZStd::thread> threads;
+        if (threadCount > 1)
+        {
+            threads.reserve(threadCount - 1);
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "Settings Registry Reader";
+            for (size_t i = 1; i < threadCount; ++i)
+            {
+                threads.emplace_back(threadDesc, readFiles);
+            }
+        }
+        readFiles();
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    bool SettingsRegistryImpl::GetMergeCacheKey(AZStd::string& cacheKey, AZ::IO::FixedMaxPathString& cacheName,
+        AZStd::string_view folderPath, AZStd::string_view platform, const ParsedRegistryFileList& files) const
+    {
+        AZ::IO::FileIOBase* fileIo = m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr;
+
+        size_t nameHash = AZStd::hash<AZStd::string_view>{}(folderPath);
+        AZStd::hash_combine(nameHash, platform);
+        for (const ParsedRegistryFile& file : files)
+        {
+            AZ::u64 size = 0;
+            AZ::u64 modificationTime = 0;
+            if (fileIo)
+            {
+                if (!fileIo->Size(file.m_path.c_str(), size))
+                {
+                    return false;
+                }
+                modificationTime = fileIo->ModificationTime(file.m_path.c_str());
+            }
+            else
+            {
+                size = AZ::IO::SystemFile::Length(file.m_path.c_str());
+                modificationTime = AZ::IO::SystemFile::ModificationTime(file.m_path.c_str());
+            }
+            if (modificationTime == 0)
+            {
+                // Without a modification time there's no way to tell if the cache is stale.
+                return false;
+            }
+
+            AZStd::hash_combine(nameHash, AZStd::string_view(file.m_path));
+            cacheKey += AZStd::string::format("%s|%llu|%llu|%c\n", file.m_path.c_str(), static_cast<unsigned long long>(size),
+                static_cast<unsigned long long>(modificationTime), file.m_isPatch ? 'p' : 'm');
+        }
+
+        AZ::IO::FixedMaxPath cachePath(m_mergeCacheFolder);
+        cachePath /= AZ::IO::FixedMaxPathString::format("%016llx.setregcache", static_cast<unsigned long long>(nameHash));
+        cacheName = cachePath.Native();
+        return true;
+    }
+
+    bool SettingsRegistryImpl::LoadMergeCache(AZStd::string_view cacheName, AZStd::string_view cacheKey,
+        ParsedRegistryFileList& files) const
+    {
+        AZ::IO::FixedMaxPathString cachePath(cacheName);
+        AZ::u64 cacheSize = AZ::IO::SystemFile::Length(cachePath.c_str());
+        if (cacheSize == 0)
+        {
+            return false;
+        }
+        AZStd::string buffer;
+        buffer.resize_no_construct(cacheSize);
+        if (AZ::IO::SystemFile::Read(cachePath.c_str(), buffer.data(), cacheSize) != cacheSize ||
+            !Dom::Binary::IsSerializedBinary(buffer))
+        {
+            return false;
+        }
+
+        // The cache is stored as an array of the cache key followed by one document per registry file.
+        auto storedKey = Dom::Json::WriteToRapidJsonDocument(
+            [&buffer](Dom::Visitor& visitor)
+            {
+                return Dom::Binary::VisitSerializedBinaryAtPath(buffer, Dom::Path({ Dom::PathEntry(0) }), Dom::Lifetime::Temporary, visitor);
+            });
+        if (!storedKey.IsSuccess() || !storedKey.GetValue().IsString() ||
+            AZStd::string_view(storedKey.GetValue().GetString(), storedKey.GetValue().GetStringLength()) != cacheKey)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < files.size(); ++i)
+        {
+            ParsedRegistryFile& file = files[i];
+            auto result = Dom::Json::WriteToRapidJsonValue(file.m_document, file.m_document.GetAllocator(),
+                [&buffer, i](Dom::Visitor& visitor)
+                {
+                    return Dom::Binary::VisitSerializedBinaryAtPath(buffer, Dom::Path({ Dom::PathEntry(i + 1) }), Dom::Lifetime::Temporary, visitor);
+                });
+            if (!result.IsSuccess())
+            {
+                AZ_Warning("Settings Registry", false, R"(Merge cache "%s" is corrupt and will be rebuilt.)", cachePath.c_str());
+                for (ParsedRegistryFile& resetFile : files)
+                {
+                    resetFile.m_document = rapidjson::Document{};
+                }
+                return false;
+            }
+            file.m_result = ReadSettingsFileResult::Success;
+        }
+        return true;
+    }
+
+    void SettingsRegistryImpl::StoreMergeCache(AZStd::string_view cacheName, AZStd::string_view cacheKey,
+        const ParsedRegistryFileList& files) const
+    {
+        for (const ParsedRegistryFile& file : files)
+        {
+            if (file.m_result != ReadSettingsFileResult::Success)
+            {
+                // Don't cache folders with broken files so the errors are reported every time the folder is merged.
+                return;
+            }
+        }
+
+        AZStd::string buffer;
+        auto result = Dom::Binary::WriteToBinaryBuffer(buffer,
+            [&files, cacheKey](Dom::Visitor& visitor)
+            {
+                Dom::Visitor::Result visitResult = visitor.StartArray();
+                if (visitResult.IsSuccess())
+                {
+                    visitResult = visitor.String(cacheKey, Dom::Lifetime::Temporary);
+                }
+                for (size_t i = 0; i < files.size() && visitResult.IsSuccess(); ++i)
+                {
+                    visitResult = Dom::Json::VisitRapidJsonValue(files[i].m_document, visitor, Dom::Lifetime::Temporary);
+                }
+                return visitResult.IsSuccess() ? visitor.EndArray(files.size() + 1) : visitResult;
+            });
+        if (!result.IsSuccess())
+        {
+            return;
+        }
+
+        // Write to a temporary file first so a concurrently running process never sees a partially written cache.
+        AZ::IO::FixedMaxPathString cachePath(cacheName);
+        char tempId[64];
+        AZ::Uuid::CreateRandom().ToString(tempId, false, false);
+        AZ::IO::FixedMaxPathString tempPath = AZ::IO::FixedMaxPathString::format("%s.%s.tmp", cachePath.c_str(), tempId);
+        AZ::IO::SystemFile cacheFile;
+        if (!cacheFile.Open(tempPath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to create merge cache "%s".)", tempPath.c_str());
+            return;
+        }
+        bool written = cacheFile.Write(buffer.data(), buffer.size()) == buffer.size();
+        cacheFile.Close();
+        if (!written || !AZ::IO::SystemFile::Rename(tempPath.c_str(), cachePath.c_str(), true))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to write merge cache "%s".)", cachePath.c_str());
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+        }
+    }
 } // namespace AZ
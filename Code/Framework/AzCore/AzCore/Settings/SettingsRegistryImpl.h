@@ -88,6 +88,8 @@ namespace AZ
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
         void SetUseFileIO(bool useFileIo) override;
+        void SetMergeThreadCount(AZ::u32 threadCount) override;
+        void SetMergeCacheFolder(AZStd::string_view cacheFolder) override;
 
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
@@ -100,6 +102,26 @@ namespace AZ
         };
         using RegistryFileList = AZStd::fixed_vector<RegistryFile, MaxRegistryFolderEntries>;
 
+        enum class ReadSettingsFileResult
+        {
+            Success,
+            OpenFailed,
+            EmptyFile,
+            ReadFailed,
+            ParseFailed
+        };
+        //! A registry file that has been read ahead of being merged.
+        struct ParsedRegistryFile
+        {
+            AZ::IO::FixedMaxPathString m_path;
+            //! Backing storage for the strings in m_document when it was parsed in place.
+            AZStd::vector<char> m_buffer;
+            rapidjson::Document m_document;
+            ReadSettingsFileResult m_result{ ReadSettingsFileResult::Success };
+            bool m_isPatch{ false };
+        };
+        using ParsedRegistryFileList = AZStd::vector<ParsedRegistryFile>;
+
         template<typename T>
         bool SetValueInternal(AZStd::string_view path, T value);
         template<typename T>
@@ -112,6 +134,20 @@ namespace AZ
             const rapidjson::Pointer& historyPointer, AZStd::string_view folderPath);
         bool ExtractFileDescription(RegistryFile& output, AZStd::string_view filename, const Specializations& specializations);
         bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
+        //! Reads and parses a registry file without touching the registry, so it can be called from any thread.
+        static ReadSettingsFileResult ReadSettingsFile(
+            const char* path, bool useFileIo, AZStd::vector<char>& scratchBuffer, rapidjson::Document& document);
+        void ReportReadSettingsFileError(const char* path, ReadSettingsFileResult result, const rapidjson::Document& document);
+        bool MergeSettingsDocument(const char* path, Format format, AZStd::string_view rootKey, const rapidjson::Document& jsonPatch);
+
+        //! Reads and parses the files in the list, spreading them over up to m_mergeThreadCount threads.
+        void ReadRegistryFiles(ParsedRegistryFileList& files) const;
+        //! Builds the string that identifies the exact state of the files in a registry folder for the merge cache.
+        //! @param cacheName Set to a name for the cache entry that only depends on the folder and the names of its files.
+        bool GetMergeCacheKey(AZStd::string& cacheKey, AZ::IO::FixedMaxPathString& cacheName, AZStd::string_view folderPath,
+            AZStd::string_view platform, const ParsedRegistryFileList& files) const;
+        bool LoadMergeCache(AZStd::string_view cacheName, AZStd::string_view cacheKey, ParsedRegistryFileList& files) const;
+        void StoreMergeCache(AZStd::string_view cacheName, AZStd::string_view cacheKey, const ParsedRegistryFileList& files) const;
 
         void SignalNotifier(AZStd::string_view jsonPath, Type type);
         
@@ -140,5 +176,7 @@ namespace AZ
         JsonApplyPatchSettings m_applyPatchSettings;
 
         bool m_useFileIo{};
+        AZ::u32 m_mergeThreadCount{};
+        AZ::IO::FixedMaxPathString m_mergeCacheFolder;
     };
 } // namespace AZ
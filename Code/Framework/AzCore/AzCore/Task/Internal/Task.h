@@ -132,6 +132,15 @@ namespace AZ::Internal
 
         ~Task();
 
+        // Replace the embedded lambda while keeping the descriptor and dependency information intact. This allows a
+        // retained graph to bind new per-submission parameters to its tasks without recompiling or allocating.
+        // NOTE: The task must not be in flight
+        template<typename Lambda>
+        void Rebind(Lambda& lambda) = delete;
+
+        template<typename Lambda>
+        void Rebind(Lambda&& lambda) noexcept;
+
         void Link(Task& other);
 
         // Indicates if this task is a root of the graph (with no dependencies)
@@ -145,10 +154,17 @@ namespace AZ::Internal
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        // Mask of the task workers allowed to run this task (0 if any worker may run it)
+        uint32_t GetWorkerMask() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
 
+        // Type erase the lambda and relocate it into the inline buffer
+        template<typename Lambda>
+        void Bind(Lambda&& lambda) noexcept;
+
         // This relocation avoids branches needed if the lambda type is unknown
         template<typename Lambda>
         void TypedRelocate(Lambda&& lambda, char* destination);
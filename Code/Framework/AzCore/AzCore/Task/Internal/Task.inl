@@ -11,6 +11,23 @@ namespace AZ::Internal
     template<typename Lambda>
     Task::Task(TaskDescriptor const& desc, Lambda&& lambda) noexcept
         : m_descriptor{ desc }
+    {
+        Bind(AZStd::forward<Lambda>(lambda));
+    }
+
+    template<typename Lambda>
+    void Task::Rebind(Lambda&& lambda) noexcept
+    {
+        if (m_destroyer)
+        {
+            m_destroyer(m_lambda);
+        }
+
+        Bind(AZStd::forward<Lambda>(lambda));
+    }
+
+    template<typename Lambda>
+    void Task::Bind(Lambda&& lambda) noexcept
     {
         static_assert(
             sizeof(Lambda) <= BufferSize,
@@ -71,6 +88,11 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline uint32_t Task::GetWorkerMask() const noexcept
+    {
+        return m_descriptor.cpuMask;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
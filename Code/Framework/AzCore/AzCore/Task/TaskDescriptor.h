@@ -42,8 +42,9 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
-        // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
-        // corresponding to a set bit. 0 is synonymous with all bits set
+        // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on the task workers
+        // corresponding to a set bit (bit N is worker N, workers are not pinned to cores). Restricted
+        // tasks are never stolen by other workers. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
     };
 }
@@ -41,6 +41,10 @@ namespace AZ
             {
                 Task& task = m_tasks[i];
                 task.m_graph = this;
+                if (task.IsRoot())
+                {
+                    m_roots.push_back(&task);
+                }
                 task.m_successorOffset = static_cast<uint32_t>(cursor - m_successors.data());
                 cursor += task.m_outboundLinkCount;
 
@@ -187,6 +191,97 @@ namespace AZ
             return nullptr;
         }
 
+        // Fixed capacity Chase-Lev work stealing deque (see "Correct and Efficient Work-Stealing for Weak
+        // Memory Models", Le et al. 2013). Only the owning task worker pushes and pops at the bottom of the deque,
+        // which keeps recently released successor tasks hot in that worker's cache. Any other worker may steal
+        // from the top. Push fails when the deque is full, in which case the caller falls back to the task queue.
+        class WorkStealingDeque final
+        {
+        public:
+            constexpr static int64_t Capacity = 4096;
+            constexpr static int64_t Mask = Capacity - 1;
+            static_assert((Capacity & Mask) == 0, "Work stealing deque capacity must be a power of two");
+
+            WorkStealingDeque() = default;
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            // Owner only
+            bool Push(Task* task);
+            // Owner only
+            Task* Pop();
+            // Any thread
+            Task* Steal();
+
+        private:
+            // The top and bottom indices are written by different threads so keep them on separate cache lines
+            alignas(64) AZStd::atomic<int64_t> m_top{ 0 };
+            alignas(64) AZStd::atomic<int64_t> m_bottom{ 0 };
+            alignas(64) AZStd::atomic<Task*> m_buffer[Capacity] = {};
+        };
+
+        bool WorkStealingDeque::Push(Task* task)
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            if (bottom - top >= Capacity)
+            {
+                return false;
+            }
+
+            m_buffer[bottom & Mask].store(task, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        Task* WorkStealingDeque::Pop()
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Deque empty
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                return nullptr;
+            }
+
+            Task* task = m_buffer[bottom & Mask].load(AZStd::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last element, race against any thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        Task* WorkStealingDeque::Steal()
+        {
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            Task* task = m_buffer[top & Mask].load(AZStd::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+            {
+                // Lost the race against the owner or another thief
+                return nullptr;
+            }
+            return task;
+        }
+
         class TaskWorker
         {
         public:
@@ -195,6 +290,7 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 AZStd::string threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -237,46 +333,104 @@ namespace AZ
                 m_thread.join();
             }
 
+            // Queue a task that may only be run by this worker. Safe to call from any thread.
             void Enqueue(Task* task)
             {
                 m_queue.Enqueue(task);
 
-                m_semaphore.release();
+                Wake();
             }
 
-        private:
-            void Run()
+            // Push a task on this worker's stealable deque. Must be called from this worker's thread.
+            void Push(Task* task)
             {
-                while (m_active)
+                if (!m_deques[task->GetPriorityNumber()].Push(task))
+                {
+                    // The local deque is full, spill over to the queue which will only be drained by this worker
+                    m_queue.Enqueue(task);
+                }
+            }
+
+            Task* Steal(uint8_t priority)
+            {
+                return m_deques[priority].Steal();
+            }
+
+            // Returns true if this call woke up the worker
+            bool Wake()
+            {
+                if (m_sleeping.exchange(false))
                 {
-                    m_semaphore.acquire();
+                    --m_executor->m_sleepingWorkers;
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
 
-                    if (!m_active)
+        private:
+            Task* FindTask()
+            {
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_deques[priority].Pop(); task)
                     {
-                        return;
+                        return task;
                     }
+                }
+
+                if (Task* task = m_queue.TryDequeue(); task)
+                {
+                    return task;
+                }
+
+                return m_executor->StealTask(m_id);
+            }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+            void Run()
+            {
+                while (m_active)
+                {
+                    Task* task = FindTask();
+                    if (!task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        // Advertise that this worker is about to sleep before checking for work a final time. A submitter
+                        // either sees this worker sleeping and wakes it up, or this worker sees the submitted task.
+                        m_sleeping = true;
+                        ++m_executor->m_sleepingWorkers;
+
+                        task = FindTask();
+                        if (!task)
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
+                            m_semaphore.acquire();
                         }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                        if (m_sleeping.exchange(false))
                         {
-                            m_executor->ReleaseGraph();
+                            --m_executor->m_sleepingWorkers;
                         }
 
-                        task = m_queue.TryDequeue();
+                        if (!task)
+                        {
+                            continue;
+                        }
+                    }
+
+                    task->Invoke();
+                    // Decrement counts for all task successors
+                    for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                    {
+                        Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                        if (--successor->m_dependencyCount == 0)
+                        {
+                            m_executor->Submit(*successor);
+                        }
+                    }
+
+                    bool isRetained = task->m_graph->m_parent != nullptr;
+                    if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                    {
+                        m_executor->ReleaseGraph();
                     }
                 }
             }
@@ -284,9 +438,14 @@ namespace AZ
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_sleeping = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
+            // Tasks released by this worker that any worker may run
+            WorkStealingDeque m_deques[TaskQueue::PriorityLevelCount];
+            // Tasks submitted from other threads, tasks restricted to this worker and deque overflow
             TaskQueue m_queue;
             friend class ::AZ::TaskExecutor;
         };
@@ -323,7 +482,8 @@ namespace AZ
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
 
-        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
+        m_workers = reinterpret_cast<Internal::TaskWorker*>(
+            azmalloc(m_threadCount * sizeof(Internal::TaskWorker), alignof(Internal::TaskWorker)));
 
         AZStd::semaphore initSemaphore;
 
@@ -370,29 +530,105 @@ namespace AZ
         }
 
         // Submit all tasks that have no inbound edges
-        for (Internal::Task& task : graph.Tasks())
+        for (Internal::Task* task : graph.Roots())
         {
-            if (task.IsRoot())
-            {
-                Submit(task);
-            }
+            Submit(*task);
         }
     }
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
-        uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
-        while (!m_workers[nextWorker].Enabled())
+        // Restrict the worker mask to the workers that exist. Bits are only available for the first 32 workers,
+        // so a mask that only references nonexistent workers is treated as unrestricted.
+        uint32_t workerMask = task.GetWorkerMask();
+        if (m_threadCount < 32)
+        {
+            workerMask &= (1u << m_threadCount) - 1;
+        }
+
+        Internal::TaskWorker* worker = GetTaskWorker();
+        if (worker && worker->Enabled())
         {
+            if (workerMask == 0)
+            {
+                // Tasks released from a task worker stay local to that worker, idle workers will steal them
+                worker->Push(&task);
+                WakeIdleWorker();
+                return;
+            }
+            else if (worker->m_id < 32 && (workerMask & (1u << worker->m_id)))
+            {
+                worker->Enqueue(&task);
+                return;
+            }
+        }
+
+        // Distribute the remaining tasks round-robin over the enabled workers that are allowed to run the task
+        const uint32_t firstWorker = ++m_lastSubmission;
+        uint32_t fallbackWorker = m_threadCount;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            const uint32_t nextWorker = (firstWorker + i) % m_threadCount;
+            if (workerMask != 0 && (nextWorker >= 32 || (workerMask & (1u << nextWorker)) == 0))
+            {
+                continue;
+            }
+
             // Graphs that are waiting for the completion of a task graph cannot enqueue tasks onto
             // the thread issuing the wait.
-            nextWorker = ++m_lastSubmission % m_threadCount;
+            if (m_workers[nextWorker].Enabled())
+            {
+                m_workers[nextWorker].Enqueue(&task);
+                return;
+            }
+
+            if (fallbackWorker == m_threadCount)
+            {
+                fallbackWorker = nextWorker;
+            }
+        }
+
+        // Every worker allowed to run the task is waiting, queue it on one of them anyway rather than waiting for a worker
+        // to be reenabled. The queue is drained once the worker finishes its wait.
+        AZ_Assert(fallbackWorker != m_threadCount, "No task worker is allowed to run the task");
+        m_workers[fallbackWorker].Enqueue(&task);
+    }
+
+    Internal::Task* TaskExecutor::StealTask(uint32_t thiefIndex)
+    {
+        // Prefer higher priority tasks from any worker over lower priority tasks
+        for (uint8_t priority = 0; priority != static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT); ++priority)
+        {
+            for (uint32_t i = 1; i != m_threadCount; ++i)
+            {
+                uint32_t victim = (thiefIndex + i) % m_threadCount;
+                if (Internal::Task* task = m_workers[victim].Steal(priority); task)
+                {
+                    return task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void TaskExecutor::WakeIdleWorker()
+    {
+        // Order the preceding push against the load below, pairs with the sleeping worker advertising
+        // itself before its final check for work
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_sleepingWorkers.load() == 0)
+        {
+            return;
         }
 
-        m_workers[nextWorker].Enqueue(&task);
+        uint32_t start = ++m_lastWake;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[(start + i) % m_threadCount].Wake())
+            {
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
@@ -400,6 +636,11 @@ namespace AZ
         --m_graphsRemaining;
     }
 
+    void TaskExecutor::DeactivateTaskWorker()
+    {
+        GetTaskWorker()->Disable();
+    }
+
     void TaskExecutor::ReactivateTaskWorker()
     {
         GetTaskWorker()->Enable();
@@ -16,6 +16,11 @@
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
+namespace UnitTest
+{
+    class TaskExecutorTester;
+}
+
 namespace AZ
 {
     class TaskGraphEvent;
@@ -39,6 +44,12 @@ namespace AZ
                 return m_tasks;
             }
 
+            // Tasks without inbound edges, gathered once at compile time so resubmission doesn't need to scan all tasks
+            AZStd::vector<Task*>& Roots() noexcept
+            {
+                return m_roots;
+            }
+
             // Indicate that a constituent task has finished and decrement a counter to determine if the
             // graph should be freed (returns the value after atomic decrement)
             uint32_t Release();
@@ -49,6 +60,7 @@ namespace AZ
 
             AZStd::vector<Task> m_tasks;
             AZStd::vector<Task*> m_successors;
+            AZStd::vector<Task*> m_roots;
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
             TaskGraph* m_parent = nullptr;
@@ -81,14 +93,24 @@ namespace AZ
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
+        friend UnitTest::TaskExecutorTester;
 
         Internal::TaskWorker* GetTaskWorker();
         void ReleaseGraph();
+        // Disqualifies the calling task worker from receiving tasks until it is reactivated
+        void DeactivateTaskWorker();
         void ReactivateTaskWorker();
 
+        // Steal a task from the deque of any worker other than the thief, highest priority first
+        Internal::Task* StealTask(uint32_t thiefIndex);
+        // Wake up a single sleeping worker, if any, so it can steal newly pushed tasks
+        void WakeIdleWorker();
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_lastWake{ 0 };
+        AZStd::atomic<uint32_t> m_sleepingWorkers{ 0 };
         AZStd::atomic<uint64_t> m_graphsRemaining;
     };
 } // namespace AZ
@@ -63,6 +63,7 @@ namespace AZ
     void TaskToken::PrecedesInternal(TaskToken& comesAfter)
     {
         AZ_Assert(!m_parent.m_submitted, "Cannot mutate a TaskGraph that was previously submitted.");
+        AZ_Assert(!m_parent.m_compiledTaskGraph, "Cannot add links to a TaskGraph that was already compiled, call Reset first.");
 
         // Increment inbound/outbound edge counts
         m_parent.m_tasks[m_index].Link(m_parent.m_tasks[comesAfter.m_index]);
@@ -97,6 +98,11 @@ namespace AZ
         m_linkCount = 0;
     }
 
+    Internal::Task& TaskGraph::GetTask(uint32_t index)
+    {
+        return m_compiledTaskGraph ? m_compiledTaskGraph->Tasks()[index] : m_tasks[index];
+    }
+
     void TaskGraph::Submit(TaskGraphEvent* waitEvent)
     {
         // If this is a new empty task graph (and not a retained taskgraph that was previously run),
@@ -119,6 +125,7 @@ namespace AZ
             m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr);
         }
 
+        // Re-arming only resets counters, the compiled graph is reused without allocation when retained
         m_compiledTaskGraph->m_waitEvent = waitEvent;
         uint32_t taskCount = aznumeric_cast<uint32_t>(m_compiledTaskGraph->m_tasks.size());
         m_compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
@@ -127,14 +134,15 @@ namespace AZ
             m_compiledTaskGraph->m_tasks[i].Init();
         }
 
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
         if (m_retained)
         {
+            // Mark the graph as submitted before any task can run, the last task to finish clears the flag
             m_submitted = true;
+            executor.Submit(*m_compiledTaskGraph, waitEvent);
         }
         else
         {
+            executor.Submit(*m_compiledTaskGraph, waitEvent);
             m_compiledTaskGraph = nullptr;
             Reset();
         }
@@ -123,6 +123,9 @@ namespace AZ
         // modifications. TaskTokens that were created as a result of adding tasks used to
         // mark dependencies DO NOT need to outlive the task graph.
         //
+        // A retained graph is compiled once on first submission. Subsequent submissions only reset the per-task
+        // dependency counters, so a graph with a fixed shape can be replayed every frame without allocating.
+        //
         // Invoking Detach PRIOR to submission indicates you wish the tasks associated with this
         // TaskGraph to deallocate upon completion. After invoking Detach, you may let this TaskGraph
         // go out of scope or deallocate after submission.
@@ -134,6 +137,13 @@ namespace AZ
         // NOTE: This operation is invalid if the graph is in-flight
         void Detach();
 
+        // Replace the lambda of a previously added task, keeping its descriptor and dependencies. Use this to bind
+        // new per-submission parameters to the tasks of a retained graph instead of resetting and rebuilding it.
+        // No allocation takes place and the compiled graph is reused as-is.
+        // NOTE: This operation is invalid if the graph is in-flight
+        template<typename Lambda>
+        void RebindTask(TaskToken const& token, Lambda&& lambda);
+
         // Invoke the task graph, asserting if there are dependency violations. Note that
         // submitting the same graph multiple times to process simultaneously is VALID
         // behavior. This is, for example, a mechanism that allows a task graph to loop
@@ -153,6 +163,9 @@ namespace AZ
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        // Returns the task either from the recorded tasks or from the compiled graph if it was compiled already
+        Internal::Task& GetTask(uint32_t index);
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
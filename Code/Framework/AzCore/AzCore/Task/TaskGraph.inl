@@ -37,6 +37,7 @@ namespace AZ
     TaskToken TaskGraph::AddTask(TaskDescriptor const& desc, Lambda&& lambda)
     {
         AZ_Assert(!m_submitted, "Cannot mutate a TaskGraph that was previously submitted or in flight.");
+        AZ_Assert(!m_compiledTaskGraph, "Cannot add tasks to a TaskGraph that was already compiled, call Reset first.");
 
         m_tasks.emplace_back(desc, AZStd::forward<Lambda>(lambda));
 
@@ -49,6 +50,15 @@ namespace AZ
         return { AddTask(descriptor, AZStd::forward<Lambdas>(lambdas))... };
     }
 
+    template<typename Lambda>
+    void TaskGraph::RebindTask(TaskToken const& token, Lambda&& lambda)
+    {
+        AZ_Assert(!m_submitted, "Cannot rebind a task of a TaskGraph that is in flight.");
+        AZ_Assert(&token.m_parent == this, "Cannot rebind a task using a token of another TaskGraph.");
+
+        GetTask(token.m_index).Rebind(AZStd::forward<Lambda>(lambda));
+    }
+
     inline bool TaskGraph::IsEmpty()
     {
         return m_tasks.empty();
@@ -58,6 +58,8 @@ namespace AZ
         MOCK_METHOD1(SetApplyPatchSettings, void(const JsonApplyPatchSettings&));
         MOCK_METHOD1(GetApplyPatchSettings, void(JsonApplyPatchSettings&));
         MOCK_METHOD1(SetUseFileIO, void(bool));
+        MOCK_METHOD1(SetMergeThreadCount, void(AZ::u32));
+        MOCK_METHOD1(SetMergeCacheFolder, void(AZStd::string_view));
     };
 } // namespace AZ
 
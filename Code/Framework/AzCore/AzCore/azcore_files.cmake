@@ -132,6 +132,9 @@ set(FILES
     DOM/DomComparison.h
     DOM/DomPrefixTree.h
     DOM/DomPrefixTree.inl
+    DOM/Backends/Binary/BinaryBackend.h
+    DOM/Backends/Binary/BinarySerializationUtils.cpp
+    DOM/Backends/Binary/BinarySerializationUtils.h
     DOM/Backends/JSON/JsonBackend.h
     DOM/Backends/JSON/JsonSerializationUtils.cpp
     DOM/Backends/JSON/JsonSerializationUtils.h
@@ -157,11 +160,14 @@ set(FILES
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/LocklessClosureQueue.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
     IO/ByteContainerStream.h
     IO/CompressionBus.h
     IO/CompressionBus.cpp
+    IO/CompressionSeekTable.h
+    IO/CompressionSeekTable.cpp
     IO/Compressor.cpp
     IO/Compressor.h
     IO/CompressorStream.cpp
@@ -192,9 +198,12 @@ set(FILES
     IO/Path/Path_fwd.h
     IO/SystemFile.cpp
     IO/SystemFile.h
+    IO/TextStreamReaders.h
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/BlockDecompressor.h
+    IO/Streamer/BlockDecompressor.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -268,6 +277,8 @@ set(FILES
     Math/Geometry2DUtils.h
     Math/Guid.h
     Math/Internal/MathTypes.h
+    Math/Internal/BatchMath_avx2.cpp
+    Math/Internal/BatchMath_avx2.h
     Math/Internal/SimdMathVec1_neon.inl
     Math/Internal/SimdMathVec1_scalar.inl
     Math/Internal/SimdMathVec1_sse.inl
@@ -280,6 +291,7 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx2.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -332,11 +344,14 @@ set(FILES
     Math/Sfmt.h
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SimdCpuFeatures.cpp
+    Math/SimdCpuFeatures.h
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -347,6 +362,9 @@ set(FILES
     Math/Transform.inl
     Math/TransformSerializer.cpp
     Math/TransformSerializer.h
+    Math/TransformArray.cpp
+    Math/TransformArray.h
+    Math/TransformArray.inl
     Math/Uuid.cpp
     Math/Uuid.h
     Math/UuidSerializer.h
@@ -357,6 +375,9 @@ set(FILES
     Math/Vector3.cpp
     Math/Vector3.h
     Math/Vector3.inl
+    Math/Vector3Array.cpp
+    Math/Vector3Array.h
+    Math/Vector3Array.inl
     Math/Vector4.cpp
     Math/Vector4.h
     Math/Vector4.inl
@@ -383,6 +404,9 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.h
+    Memory/FrameArenaSchema.cpp
+    Memory/FrameArenaSchema.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -537,6 +561,9 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamLoader.h
+    Serialization/Json/JsonStreamLoader.cpp
+    Serialization/Json/JsonStreamWriter.h
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -108,10 +108,18 @@ namespace AZStd
         ///Pushes a value onto the top of the stack
         void push(const_reference value);
 
+        ///Pushes a chain of values with a single atomic operation. The values must already be linked from first to
+        ///last through their hook nodes, the next pointer of last is overwritten.
+        void push_chain(reference first, reference last);
+
         ///Attempts to pop a value from the top of the stack. Returns NULL if the stack was empty, otherwise returns
         ///a pointer to the popped value
         pointer pop();
 
+        ///Detaches all values from the stack with a single atomic operation. Returns the former top of the stack (NULL if
+        ///the stack was empty), the remaining values can be reached through the next pointers of their hook nodes.
+        pointer pop_all();
+
         ///Tests if the stack is empty, limited utility for a concurrent container.
         bool empty() const;
 
@@ -172,6 +180,26 @@ namespace AZStd
         }
     }
 
+    template<typename T, typename Hook>
+    inline void lock_free_intrusive_stack<T, Hook>::push_chain(T& first, T& last)
+    {
+        hook_node_type* lastHookNode = Hook::to_node_ptr(&last);
+        exponential_backoff backoff;
+        while (true)
+        {
+            node_type* oldTop = m_top.load(memory_order_acquire);
+            lastHookNode->m_next = oldTop;
+            if (m_top.compare_exchange_weak(oldTop, &first, memory_order_acq_rel, memory_order_acquire))
+            {
+                break;
+            }
+            else
+            {
+                backoff.wait();
+            }
+        }
+    }
+
     template<typename T, typename Hook>
     inline typename lock_free_intrusive_stack<T, Hook>::pointer lock_free_intrusive_stack<T, Hook>::pop()
     {
@@ -196,6 +224,12 @@ namespace AZStd
         }
     }
 
+    template<typename T, typename Hook>
+    inline typename lock_free_intrusive_stack<T, Hook>::pointer lock_free_intrusive_stack<T, Hook>::pop_all()
+    {
+        return m_top.exchange(NULL, memory_order_acq_rel);
+    }
+
     template<typename T, typename Hook>
     inline bool lock_free_intrusive_stack<T, Hook>::empty() const
     {
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ::IO
+{
+    namespace IoUringInternal
+    {
+        static int Setup(u32 entries, io_uring_params& parameters)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, &parameters));
+        }
+
+        static int Enter(int ringFileDescriptor, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringFileDescriptor, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ringFileDescriptor, u32 opcode, void* arguments, u32 argumentCount)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringFileDescriptor, opcode, arguments, argumentCount));
+        }
+
+        template<typename T>
+        T* Offset(void* base, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(base) + offset);
+        }
+    } // namespace IoUringInternal
+
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+    bool IoUring::IsSupported()
+    {
+        static const bool isSupported = []() -> bool
+        {
+            IoUring ring;
+            if (!ring.Initialize(2))
+            {
+                return false;
+            }
+
+            // Reads with IORING_OP_READ are only available from kernel 5.6 onwards, which is also the version that introduced probing.
+            constexpr u32 OperationCount = IORING_OP_LAST;
+            alignas(io_uring_probe) u8 probeBuffer[sizeof(io_uring_probe) + OperationCount * sizeof(io_uring_probe_op)]{};
+            auto probe = reinterpret_cast<io_uring_probe*>(probeBuffer);
+            if (IoUringInternal::Register(ring.m_ringFileDescriptor, IORING_REGISTER_PROBE, probe, OperationCount) < 0)
+            {
+                return false;
+            }
+            auto isOperationSupported = [probe](u32 operation)
+            {
+                return operation <= probe->last_op && (probe->ops[operation].flags & IO_URING_OP_SUPPORTED) != 0;
+            };
+            return isOperationSupported(IORING_OP_READ) && isOperationSupported(IORING_OP_ASYNC_CANCEL);
+        }();
+        return isSupported;
+    }
+
+    bool IoUring::Initialize(u32 entryCount)
+    {
+        AZ_Assert(!IsInitialized(), "io_uring instance is already initialized.");
+
+        io_uring_params parameters{};
+        int ringFileDescriptor = IoUringInternal::Setup(entryCount, parameters);
+        if (ringFileDescriptor < 0)
+        {
+            return false;
+        }
+        m_ringFileDescriptor = ringFileDescriptor;
+
+        m_submissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(u32);
+        m_completionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFileDescriptor, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFileDescriptor, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFileDescriptor, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        using namespace IoUringInternal;
+        m_submissionHead = Offset<u32>(m_submissionRing, parameters.sq_off.head);
+        m_submissionTail = Offset<u32>(m_submissionRing, parameters.sq_off.tail);
+        m_submissionArray = Offset<u32>(m_submissionRing, parameters.sq_off.array);
+        m_submissionMask = *Offset<u32>(m_submissionRing, parameters.sq_off.ring_mask);
+        m_submissionEntryCount = parameters.sq_entries;
+        m_localSubmissionTail = *m_submissionTail;
+
+        m_completionHead = Offset<u32>(m_completionRing, parameters.cq_off.head);
+        m_completionTail = Offset<u32>(m_completionRing, parameters.cq_off.tail);
+        m_completionMask = *Offset<u32>(m_completionRing, parameters.cq_off.ring_mask);
+        m_completionEntries = Offset<io_uring_cqe>(m_completionRing, parameters.cq_off.cqes);
+
+        return true;
+    }
+
+    void IoUring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringFileDescriptor >= 0)
+        {
+            ::close(m_ringFileDescriptor);
+        }
+
+        m_submissionRing = nullptr;
+        m_completionRing = nullptr;
+        m_submissionEntries = nullptr;
+        m_completionEntries = nullptr;
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_submissionArray = nullptr;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_submissionRingSize = 0;
+        m_completionRingSize = 0;
+        m_submissionEntriesSize = 0;
+        m_submissionMask = 0;
+        m_completionMask = 0;
+        m_submissionEntryCount = 0;
+        m_localSubmissionTail = 0;
+        m_ringFileDescriptor = -1;
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringFileDescriptor >= 0;
+    }
+
+    bool IoUring::RegisterEventFileDescriptor(int eventFileDescriptor)
+    {
+        AZ_Assert(IsInitialized(), "Registering an eventfd on an io_uring instance that's not initialized.");
+        return IoUringInternal::Register(m_ringFileDescriptor, IORING_REGISTER_EVENTFD, &eventFileDescriptor, 1) == 0;
+    }
+
+    io_uring_sqe* IoUring::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_localSubmissionTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_localSubmissionTail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        m_localSubmissionTail++;
+        return entry;
+    }
+
+    s32 IoUring::Submit()
+    {
+        // Publish the new entries to the kernel before asking it to consume them.
+        __atomic_store_n(m_submissionTail, m_localSubmissionTail, __ATOMIC_RELEASE);
+
+        const u32 toSubmit = GetUnsubmittedCount();
+        if (toSubmit == 0)
+        {
+            return 0;
+        }
+
+        int result;
+        do
+        {
+            result = IoUringInternal::Enter(m_ringFileDescriptor, toSubmit, 0, 0);
+        } while (result < 0 && errno == EINTR);
+        return result < 0 ? -errno : result;
+    }
+
+    u32 IoUring::GetUnsubmittedCount() const
+    {
+        return m_localSubmissionTail - __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+    }
+
+    bool IoUring::PopCompletion(u64& userData, s32& result)
+    {
+        const u32 head = *m_completionHead;
+        if (head == __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE))
+        {
+            return false;
+        }
+
+        const io_uring_cqe& completion = m_completionEntries[head & m_completionMask];
+        userData = completion.user_data;
+        result = completion.res;
+        __atomic_store_n(m_completionHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    void IoUring::PrepareRead(io_uring_sqe& entry, int fileDescriptor, void* buffer, u32 size, u64 offset, u64 userData)
+    {
+        entry.opcode = IORING_OP_READ;
+        entry.fd = fileDescriptor;
+        entry.addr = reinterpret_cast<u64>(buffer);
+        entry.len = size;
+        entry.off = offset;
+        entry.user_data = userData;
+    }
+
+    void IoUring::PrepareCancel(io_uring_sqe& entry, u64 targetUserData, u64 userData)
+    {
+        entry.opcode = IORING_OP_ASYNC_CANCEL;
+        entry.fd = -1;
+        entry.addr = targetUserData;
+        entry.user_data = userData;
+    }
+} // namespace AZ::IO
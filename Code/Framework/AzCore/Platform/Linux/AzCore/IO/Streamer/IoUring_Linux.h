@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <linux/io_uring.h>
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around the io_uring system calls. This avoids a dependency on liburing and only exposes
+    //! the functionality needed by AZ::IO::Streamer. The ring is owned by a single thread and is not thread safe.
+    class IoUring
+    {
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        //! Checks if the kernel supports io_uring and the operations used by the Streamer. The result is cached
+        //! so this can be called multiple times. io_uring may be unavailable on older kernels or be blocked by
+        //! sandboxes such as container seccomp profiles.
+        static bool IsSupported();
+
+        bool Initialize(u32 entryCount);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! Registers an eventfd that will be signaled whenever a completion is posted.
+        bool RegisterEventFileDescriptor(int eventFileDescriptor);
+
+        //! Returns the next free submission queue entry or nullptr if the submission queue is full. The entry is
+        //! zero-initialized and will be submitted with the next call to Submit.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Submits all entries retrieved with GetSubmissionEntry with a single system call.
+        //! @return The number of submitted entries or a negative errno value.
+        s32 Submit();
+        //! Number of entries that have been claimed but not yet consumed by the kernel.
+        u32 GetUnsubmittedCount() const;
+
+        //! Retrieves a single completion if available.
+        //! @return True if a completion was retrieved, otherwise false.
+        bool PopCompletion(u64& userData, s32& result);
+
+        static void PrepareRead(io_uring_sqe& entry, int fileDescriptor, void* buffer, u32 size, u64 offset, u64 userData);
+        static void PrepareCancel(io_uring_sqe& entry, u64 targetUserData, u64 userData);
+
+    private:
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32 m_submissionMask{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        u32 m_localSubmissionTail{ 0 };
+
+        int m_ringFileDescriptor{ -1 };
+    };
+} // namespace AZ::IO
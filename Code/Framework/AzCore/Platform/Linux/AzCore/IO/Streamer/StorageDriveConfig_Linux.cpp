@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!IoUring::IsSupported())
+        {
+            // If this drive is stacked on top of another drive, let that drive handle all requests, otherwise
+            // fall back to the generic storage drive.
+            AZ_Warning("Streamer", false, "io_uring isn't available on this system. Falling back to the generic storage drive.\n");
+            return parent ? parent : AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableDirectReads = m_enableDirectReads;
+        options.m_minimalReporting = m_minimalReporting;
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(m_maxFileHandles, m_maxMetaDataCache,
+            hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, m_ioChannelCount, m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("IoChannelCount", &LinuxStorageDriveConfig::m_ioChannelCount)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ::IO
+{
+    static size_t ReadBlockQueueValue(const char* deviceName, const char* property)
+    {
+        char path[256];
+        azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/block/%s/queue/%s", deviceName, property);
+        size_t value = 0;
+        if (FILE* file = fopen(path, "r"); file != nullptr)
+        {
+            if (fscanf(file, "%zu", &value) != 1)
+            {
+                value = 0;
+            }
+            fclose(file);
+        }
+        return value;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& info, bool reportHardware)
+    {
+        DIR* blockDevices = opendir("/sys/block");
+        if (!blockDevices)
+        {
+            return false;
+        }
+
+        bool foundDevice = false;
+        while (dirent* entry = readdir(blockDevices))
+        {
+            // Skip virtual devices such as loop devices and ram disks as they don't have meaningful hardware limits.
+            if (entry->d_name[0] == '.' || strncmp(entry->d_name, "loop", 4) == 0 || strncmp(entry->d_name, "ram", 3) == 0 ||
+                strncmp(entry->d_name, "zram", 4) == 0)
+            {
+                continue;
+            }
+
+            size_t physicalSectorSize = ReadBlockQueueValue(entry->d_name, "physical_block_size");
+            size_t logicalSectorSize = ReadBlockQueueValue(entry->d_name, "logical_block_size");
+            size_t maxTransfer = ReadBlockQueueValue(entry->d_name, "max_sectors_kb") * 1_kib;
+            if (physicalSectorSize == 0 || logicalSectorSize == 0 ||
+                !IStreamerTypes::IsPowerOf2(physicalSectorSize) || !IStreamerTypes::IsPowerOf2(logicalSectorSize))
+            {
+                continue;
+            }
+
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "Drive '%s' found.\n", entry->d_name);
+                AZ_Printf("Streamer", "    Physical sector size: %zu\n", physicalSectorSize);
+                AZ_Printf("Streamer", "    Logical sector size: %zu\n", logicalSectorSize);
+                AZ_Printf("Streamer", "    Max transfer: %zu\n", maxTransfer);
+            }
+
+            info.m_maxPhysicalSectorSize = AZStd::max(info.m_maxPhysicalSectorSize, physicalSectorSize);
+            info.m_maxLogicalSectorSize = AZStd::max(info.m_maxLogicalSectorSize, logicalSectorSize);
+            info.m_maxTransfer = AZStd::max(info.m_maxTransfer, maxTransfer);
+            foundDevice = true;
+        }
+        closedir(blockDevices);
+
+        if (foundDevice)
+        {
+            long pageSize = sysconf(_SC_PAGESIZE);
+            info.m_maxPageSize = pageSize > 0 ? aznumeric_cast<size_t>(pageSize) : 4096;
+            info.m_profile = "Generic";
+        }
+        return foundDevice;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::Platform
+{
+    static void DrainEventFileDescriptor(int eventFileDescriptor)
+    {
+        eventfd_t value;
+        // The file descriptors are non-blocking so this returns EAGAIN if the event was already drained.
+        [[maybe_unused]] int result = ::eventfd_read(eventFileDescriptor, &value);
+    }
+
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0].fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        m_events[0].events = POLLIN;
+        AZ_Assert(m_events[0].fd >= 0, "Failed to create the event required for the IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_events[0].fd >= 0)
+        {
+            ::close(m_events[0].fd);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        int result;
+        do
+        {
+            result = ::poll(m_events, m_eventCount, -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            for (nfds_t i = 0; i < m_eventCount; ++i)
+            {
+                if (m_events[i].revents & POLLIN)
+                {
+                    DrainEventFileDescriptor(m_events[i].fd);
+                }
+                m_events[i].revents = 0;
+            }
+        }
+        else
+        {
+            AZ_Assert(false, "Unexpected wait result: %i (Error: %i).", result, errno);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0].fd, 1);
+    }
+
+    void StreamerContextThreadSync::RegisterEventFileDescriptor(int eventFileDescriptor)
+    {
+        AZ_Assert(m_eventCount < AZ_ARRAY_SIZE(m_events), "There are no more slots available to register a new IO event in.");
+        m_events[m_eventCount].fd = eventFileDescriptor;
+        m_events[m_eventCount].events = POLLIN;
+        m_events[m_eventCount].revents = 0;
+        m_eventCount++;
+    }
+
+    void StreamerContextThreadSync::UnregisterEventFileDescriptor(int eventFileDescriptor)
+    {
+        AZ_Assert(m_eventCount > 1, "There are no more IO events that can be unregistered.");
+
+        for (nfds_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i].fd == eventFileDescriptor)
+            {
+                m_eventCount--;
+                AZStd::swap(m_events[i], m_events[m_eventCount]);
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be unregistered as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetEventFileDescriptorCount() const
+    {
+        return m_eventCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreEventFileDescriptorsAvailable() const
+    {
+        return m_eventCount < AZ_ARRAY_SIZE(m_events);
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <poll.h>
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        //! The maximum number of file descriptors, in addition to the internal wake up event, the scheduler thread can wait on.
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds an eventfd, such as one that's signaled by io_uring completions, to the list of file descriptors that
+        //! wake up the scheduler thread. The file descriptor will be drained when it wakes up the thread.
+        void RegisterEventFileDescriptor(int eventFileDescriptor);
+        void UnregisterEventFileDescriptor(int eventFileDescriptor);
+        size_t GetEventFileDescriptorCount() const;
+        bool AreEventFileDescriptorsAvailable() const;
+
+    private:
+        // Note: The first file descriptor is reserved for the synchronization of the
+        // scheduler thread with the rest of the engine. The remaining file descriptors
+        // can be freely used by Streamer's internals.
+        pollfd m_events[MaxIoEvents + 1]{};
+        nfds_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+} // namespace AZ::Platform
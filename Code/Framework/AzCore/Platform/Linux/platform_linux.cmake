@@ -20,3 +20,10 @@ set(LY_BUILD_DEPENDENCIES
     PUBLIC
         ${CMAKE_DL_LIBS}
 )
+
+# The AVX2 batch math implementations are only called after checking for AVX2 support at runtime, see AzCore/Math/SimdCpuFeatures.h
+ly_add_source_properties(
+    SOURCES AzCore/Math/Internal/BatchMath_avx2.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES -mavx2 -mfma
+)
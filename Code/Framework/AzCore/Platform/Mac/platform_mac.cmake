@@ -14,3 +14,10 @@ set(LY_BUILD_DEPENDENCIES
         ${APPKIT_LIBRARY}
         ${FOUNDATION_LIBRARY}
 )
+
+# The AVX2 batch math implementations are only called after checking for AVX2 support at runtime, see AzCore/Math/SimdCpuFeatures.h
+ly_add_source_properties(
+    SOURCES AzCore/Math/Internal/BatchMath_avx2.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES -mavx2 -mfma
+)
@@ -11,3 +11,15 @@
 # NOTE: functions in cmake are global, therefore adding functions to this file
 # is being avoided to prevent overriding functions declared in other targets platfrom
 # specific cmake files
+
+# The AVX2 batch math implementations are only called after checking for AVX2 support at runtime, see AzCore/Math/SimdCpuFeatures.h
+if(PAL_TRAIT_COMPILER_ID STREQUAL "MSVC")
+    set(LY_AZCORE_AVX2_COMPILE_OPTIONS /arch:AVX2)
+else()
+    set(LY_AZCORE_AVX2_COMPILE_OPTIONS -mavx2 -mfma)
+endif()
+ly_add_source_properties(
+    SOURCES AzCore/Math/Internal/BatchMath_avx2.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES ${LY_AZCORE_AVX2_COMPILE_OPTIONS}
+)
@@ -246,7 +246,36 @@ namespace UnitTest
             AZ_TEST_ASSERT(stack.empty());
         }
     }
-    
+
+    TEST_F(LockFreeIntrusiveStack, MyIntrusiveStackBase_PushChainPopAll)
+    {
+        MyIntrusiveStackBase stack;
+
+        MyStackItem item1(100);
+        MyStackItem item2(200);
+        MyStackItem item3(300);
+
+        AZ_TEST_ASSERT(!stack.pop_all());
+
+        stack.push(item1);
+        item2.m_next = &item3;
+        stack.push_chain(item2, item3);
+        AZ_TEST_ASSERT(!stack.empty());
+
+        MyStackItem* top = stack.pop_all();
+        AZ_TEST_ASSERT(stack.empty());
+        AZ_TEST_ASSERT(top == &item2);
+        AZ_TEST_ASSERT(top->m_next == &item3);
+        AZ_TEST_ASSERT(top->m_next->m_next == &item1);
+        AZ_TEST_ASSERT(top->m_next->m_next->m_next == nullptr);
+
+#ifdef AZ_DEBUG_BUILD
+        // The nodes were detached without pop, reset them so the node destructors don't assert.
+        item1.m_next = nullptr;
+        item2.m_next = nullptr;
+        item3.m_next = nullptr;
+#endif
+    }
 
     TEST_F(LockFreeIntrusiveStack, MyIntrusiveStackMember)
     {
@@ -30,6 +30,7 @@
 #include <AZTestShared/Utils/Utils.h>
 #include <Streamer/IStreamerMock.h>
 #include <Tests/Asset/BaseAssetManagerTest.h>
+#include <Tests/Asset/MockLoadAssetCatalogAndHandler.h>
 #include <Tests/Asset/TestAssetTypes.h>
 #include <Tests/SerializeContextFixture.h>
 #include <Tests/TestCatalog.h>
@@ -1708,6 +1709,130 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+    // With the preload graph enabled the container queues the whole tree ordered by dependency depth.  The same readiness
+    // guarantees as the default ordering have to hold: every asset signals once its own preloads are ready, and the
+    // container only once the entire tree is.
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_PreloadGraphThreeLevels_OnAssetReadyFollowsPreloads)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_PreloadGraphThreeLevels_OnAssetReadyFollowsPreloads)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        m_testAssetManager->SetPreloadGraphEnabled(true);
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            ContainerReadyListener readyListener(PreloadAssetRootId);
+            OnAssetReadyListener preLoadRootListener(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadAListener(PreloadAssetAId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadBListener(PreloadAssetBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadCListener(PreloadAssetCId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener queueLoadAListener(QueueLoadAssetAId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener queueLoadBListener(QueueLoadAssetBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener queueLoadCListener(QueueLoadAssetCId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            preLoadRootListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (preLoadAListener.m_ready && preLoadBListener.m_ready);
+            };
+
+            preLoadAListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (preLoadBListener.m_ready > 0);
+            };
+
+            queueLoadAListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (preLoadCListener.m_ready > 0);
+            };
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset);
+
+            auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::system_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+            EXPECT_EQ(containerReady->GetDependencies().size(), 6);
+            EXPECT_EQ(containerReady->GetInvalidDependencies(), 0);
+
+            EXPECT_EQ(preLoadRootListener.m_ready, 1);
+            EXPECT_EQ(preLoadAListener.m_ready, 1);
+            EXPECT_EQ(preLoadBListener.m_ready, 1);
+            EXPECT_EQ(preLoadCListener.m_ready, 1);
+            EXPECT_EQ(queueLoadAListener.m_ready, 1);
+            EXPECT_EQ(queueLoadBListener.m_ready, 1);
+            EXPECT_EQ(queueLoadCListener.m_ready, 1);
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
+    // Cycles in the catalog can't be ordered by depth, the preload graph has to ignore the edge that closes the loop and load
+    // the remaining assets just like the default ordering does.
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_PreloadGraphCircularPreLoadBelowRoot_LoadCompletes)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_PreloadGraphCircularPreLoadBelowRoot_LoadCompletes)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        m_testAssetManager->SetPreloadGraphEnabled(true);
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            ContainerReadyListener readyListener(CircularDId);
+            OnAssetReadyListener circularDListener(CircularDId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener circularBListener(CircularBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener circularCListener(CircularCId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            auto asset = m_testAssetManager->FindOrCreateAsset(CircularDId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset);
+            // One error in SetupPreloads - Two of the assets create a dependency loop
+            AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+            auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::system_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+            EXPECT_EQ(containerReady->GetDependencies().size(), 2);
+            EXPECT_EQ(containerReady->GetInvalidDependencies(), 0);
+            EXPECT_EQ(circularDListener.m_ready, 1);
+            EXPECT_EQ(circularBListener.m_ready, 1);
+            EXPECT_EQ(circularCListener.m_ready, 1);
+
+            // Break the circular reference so that the test can clean up correctly without leaking memory.
+            {
+                auto assetDataD = asset.GetAs<AssetWithQueueAndPreLoadReferences>();
+                auto assetDataB = assetDataD->m_preLoad.GetAs<AssetWithQueueAndPreLoadReferences>();
+                assetDataB->m_preLoad.Reset();
+            }
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
     // If our preload list contains assets we can't load we should catch the errors and load what we can
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_RootHasBrokenPreloads_LoadsRoot)
@@ -2548,6 +2673,186 @@ namespace UnitTest
         ParallelDeepAssetReferences();
     }
 
+    /**
+    * Load a large number of tiny assets from every core at once to stress the sharded asset table and the lock-free status
+    * transitions of the AssetManager.
+    */
+    class AssetManagerConcurrentLoadStressTest
+        : public DisklessAssetManagerBase
+    {
+    public:
+        static constexpr AZ::u32 NumAssets = 100000;
+        // The first assets are requested by every thread to make them race on creating the same entries.
+        static constexpr AZ::u32 NumContendedAssets = 1000;
+        static constexpr size_t TinyAssetSize = 16;
+        static constexpr char TinyAssetStreamName[] = "TinyAsset.bin";
+        static inline const AZ::Uuid TinyAssetGuid{ "{7D1C0A52-4B65-4C38-9F0A-52E1D5C1B8F3}" };
+
+        static inline AZStd::atomic_int s_numCreations{ 0 };
+        static inline AZStd::atomic_int s_numDestructions{ 0 };
+
+        // Mock catalog and handler that provides a non-zero size and stream name so that every load goes through the streamer.
+        class TinyAssetCatalogAndHandler
+            : public MockLoadAssetCatalogAndHandler
+        {
+        public:
+            using MockLoadAssetCatalogAndHandler::MockLoadAssetCatalogAndHandler;
+
+            AZ::Data::AssetInfo GetAssetInfoById(const AZ::Data::AssetId& id) override
+            {
+                AZ::Data::AssetInfo result = MockLoadAssetCatalogAndHandler::GetAssetInfoById(id);
+                if (result.m_assetId.IsValid())
+                {
+                    result.m_sizeBytes = TinyAssetSize;
+                }
+                return result;
+            }
+
+            AZ::Data::AssetStreamInfo GetStreamInfoForLoad([[maybe_unused]] const AZ::Data::AssetId& id,
+                [[maybe_unused]] const AZ::Data::AssetType& type) override
+            {
+                AZ::Data::AssetStreamInfo info;
+                info.m_dataLen = TinyAssetSize;
+                info.m_streamFlags = AZ::IO::OpenMode::ModeRead;
+                info.m_streamName = TinyAssetStreamName;
+                return info;
+            }
+        };
+
+        // Use as many job threads as there are cores so that loads are processed on all of them.
+        size_t GetNumJobManagerThreads() const override
+        {
+            return AZStd::max(2u, AZStd::thread::hardware_concurrency());
+        }
+
+        void SetUp() override
+        {
+            DisklessAssetManagerBase::SetUp();
+
+            AssetManager::Descriptor desc;
+            m_testAssetManager = aznew TestAssetManager(desc);
+            AssetManager::SetInstance(m_testAssetManager);
+
+            s_numCreations = 0;
+            s_numDestructions = 0;
+
+            m_assetIds.reserve(NumAssets);
+            for (AZ::u32 subId = 0; subId < NumAssets; ++subId)
+            {
+                m_assetIds.emplace_back(TinyAssetGuid, subId);
+            }
+
+            // All assets share the same tiny file, only the asset table and the load pipeline are of interest here.
+            m_streamerWrapper->m_virtualFiles[TinyAssetStreamName] = AZStd::vector<char>(TinyAssetSize, 0);
+
+            m_catalogAndHandler = AZStd::make_unique<TinyAssetCatalogAndHandler>(
+                AZStd::unordered_set<AssetId>(m_assetIds.begin(), m_assetIds.end()), azrtti_typeid<EmptyAsset>(),
+                []()
+                {
+                    ++s_numCreations;
+                    return AZ::Data::AssetPtr(aznew EmptyAsset());
+                },
+                [](AZ::Data::AssetPtr asset)
+                {
+                    ++s_numDestructions;
+                    delete asset;
+                });
+        }
+
+        void TearDown() override
+        {
+            m_catalogAndHandler.reset();
+            m_assetIds = {};
+            AssetManager::Destroy();
+            DisklessAssetManagerBase::TearDown();
+        }
+
+        TestAssetManager* m_testAssetManager{ nullptr };
+        AZStd::unique_ptr<TinyAssetCatalogAndHandler> m_catalogAndHandler;
+        AZStd::vector<AssetId> m_assetIds;
+    };
+
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS || AZ_TRAIT_DISABLE_ASSET_JOB_PARALLEL_TESTS
+    TEST_F(AssetManagerConcurrentLoadStressTest, DISABLED_LoadTinyAssetsFromAllCores_AllAssetsLoadOnceAndRelease)
+#else
+    TEST_F(AssetManagerConcurrentLoadStressTest, LoadTinyAssetsFromAllCores_AllAssetsLoadOnceAndRelease)
+#endif // AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS || AZ_TRAIT_DISABLE_ASSET_JOB_PARALLEL_TESTS
+    {
+        const size_t numThreads = GetNumJobManagerThreads();
+
+        AZStd::atomic_bool keepDispatching(true);
+        AZStd::thread dispatchThread([&keepDispatching]()
+            {
+                while (keepDispatching)
+                {
+                    AssetManager::Instance().DispatchEvents();
+                }
+            });
+
+        AZStd::vector<AZStd::vector<Asset<AssetData>>> threadAssets(numThreads);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, threadIndex, numThreads, &threadAssets]()
+                {
+                    auto& assets = threadAssets[threadIndex];
+                    auto requestAsset = [this, &assets](const AssetId& assetId)
+                    {
+                        assets.push_back(AssetManager::Instance().GetAsset(assetId, azrtti_typeid<EmptyAsset>(), AssetLoadBehavior::Default));
+                    };
+
+                    for (AZ::u32 index = 0; index < NumContendedAssets; ++index)
+                    {
+                        requestAsset(m_assetIds[index]);
+                    }
+                    // Interleave the remaining ids between the threads so that every thread touches every shard.
+                    for (size_t index = NumContendedAssets + threadIndex; index < NumAssets; index += numThreads)
+                    {
+                        requestAsset(m_assetIds[index]);
+                    }
+
+                    for (auto& asset : assets)
+                    {
+                        asset.BlockUntilLoadComplete();
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        size_t numReady = 0;
+        size_t numRequests = 0;
+        for (const auto& assets : threadAssets)
+        {
+            numRequests += assets.size();
+            numReady += AZStd::count_if(assets.begin(), assets.end(), [](const Asset<AssetData>& asset) { return asset.IsReady(); });
+        }
+        EXPECT_EQ(numRequests, NumAssets + NumContendedAssets * (numThreads - 1));
+        EXPECT_EQ(numReady, numRequests);
+
+        // Every asset has to be created exactly once, no matter how many threads requested it at the same time.
+        EXPECT_EQ(s_numCreations.load(), aznumeric_cast<int>(NumAssets));
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), NumAssets);
+
+        threadAssets = {};
+        BlockUntilAssetJobsAreComplete();
+
+        auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+        while (m_testAssetManager->GetAssetCount() > 0 && AZStd::chrono::system_clock::now() < maxTimeout)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        keepDispatching = false;
+        dispatchThread.join();
+
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 0);
+        EXPECT_EQ(s_numDestructions.load(), s_numCreations.load());
+    }
+
     class AssetManagerTests
         : public DisklessAssetManagerBase
     {
@@ -38,10 +38,11 @@ namespace UnitTest
     */
     AZ::Data::AssetData::AssetStatus TestAssetManager::GetReloadStatus(const AssetId& assetId)
     {
-        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
 
-        auto reloadInfo = m_reloads.find(assetId);
-        if (reloadInfo != m_reloads.end())
+        auto reloadInfo = shard.m_reloads.find(assetId);
+        if (reloadInfo != shard.m_reloads.end())
         {
             return reloadInfo->second.GetStatus();
         }
@@ -58,9 +59,22 @@ namespace UnitTest
         return m_ownedAssetContainers;
     }
 
-    const AssetManager::AssetMap& TestAssetManager::GetAssets() const
+    size_t TestAssetManager::GetAssetCount()
     {
-        return m_assets;
+        size_t assetCount = 0;
+        for (AssetShard& shard : m_assetShards)
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+            assetCount += shard.m_assets.size();
+        }
+        return assetCount;
+    }
+
+    bool TestAssetManager::HasAsset(const AssetId& assetId)
+    {
+        AssetShard& shard = GetAssetShard(assetId);
+        AZStd::lock_guard<AZStd::recursive_mutex> assetLock(shard.m_mutex);
+        return shard.m_assets.contains(assetId);
     }
 
     void BaseAssetManagerTest::SetUp()
@@ -40,7 +40,11 @@ namespace UnitTest
 
         const AZ::Data::AssetManager::OwnedAssetContainerMap& GetAssetContainers() const;
 
-        const AssetMap& GetAssets() const;
+        // Get the number of assets in the asset table
+        size_t GetAssetCount();
+
+        // Check whether the asset table has an entry for the given asset id
+        bool HasAsset(const AssetId& assetId);
 
         // Expose these methods so that they can be queried by the unit tests.
         using AssetManager::GetAssetInternal;
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/DOM/Backends/Binary/BinaryBackend.h>
+#include <AzCore/DOM/Backends/JSON/JsonBackend.h>
+#include <AzCore/DOM/DomUtils.h>
+#include <AzCore/DOM/DomValue.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/DOM/DomFixtures.h>
+
+namespace AZ::Dom::Tests
+{
+    class DomBinaryTests : public DomTestFixture
+    {
+    public:
+        AZStd::string Serialize(const Value& value)
+        {
+            AZStd::string buffer;
+            auto result = Utils::ValueToSerializedString(m_backend, value, buffer);
+            EXPECT_TRUE(result.IsSuccess());
+            return buffer;
+        }
+
+        // Validate round-trip serialization to and from a binary buffer, both copying strings and reading them in place
+        void PerformSerializationChecks(const Value& value)
+        {
+            AZStd::string buffer = Serialize(value);
+            EXPECT_TRUE(Binary::IsSerializedBinary(buffer));
+
+            auto result = Utils::SerializedStringToValue(m_backend, buffer, Lifetime::Temporary);
+            ASSERT_TRUE(result.IsSuccess());
+            EXPECT_TRUE(Utils::DeepCompareIsEqual(value, result.GetValue()));
+
+            auto inPlaceResult = Utils::WriteToValue(
+                [&](Visitor& visitor)
+                {
+                    return Utils::ReadFromStringInPlace(m_backend, buffer, visitor);
+                });
+            ASSERT_TRUE(inPlaceResult.IsSuccess());
+            EXPECT_TRUE(Utils::DeepCompareIsEqual(value, inPlaceResult.GetValue()));
+
+            // Serializing the same value again must produce an identical buffer
+            EXPECT_EQ(buffer, Serialize(result.GetValue()));
+        }
+
+        BinaryBackend m_backend;
+    };
+
+    TEST_F(DomBinaryTests, Scalars)
+    {
+        PerformSerializationChecks(Value());
+        PerformSerializationChecks(Value(true));
+        PerformSerializationChecks(Value(false));
+        PerformSerializationChecks(Value(aznumeric_cast<int64_t>(-42)));
+        PerformSerializationChecks(Value(AZStd::numeric_limits<uint64_t>::max()));
+        PerformSerializationChecks(Value(3.25));
+        PerformSerializationChecks(Value("a string", false));
+        PerformSerializationChecks(Value("", false));
+    }
+
+    TEST_F(DomBinaryTests, EmptyContainers)
+    {
+        PerformSerializationChecks(Value(Type::Array));
+        PerformSerializationChecks(Value(Type::Object));
+        PerformSerializationChecks(Value::CreateNode("Empty"));
+    }
+
+    TEST_F(DomBinaryTests, NestedContainers)
+    {
+        Value value(Type::Object);
+        Value array(Type::Array);
+        for (int i = 0; i < 5; ++i)
+        {
+            Value entry(Type::Object);
+            entry["index"] = Value(i);
+            entry["name"] = Value(AZStd::string::format("entry%i", i), true);
+            entry["even"] = Value(i % 2 == 0);
+            array.ArrayPushBack(entry);
+        }
+        value["entries"] = array;
+        value["empty"] = Value(Type::Array);
+        value["nothing"] = Value();
+        PerformSerializationChecks(value);
+    }
+
+    TEST_F(DomBinaryTests, Nodes)
+    {
+        Value node = Value::CreateNode("Root");
+        node["attribute"] = Value(7);
+        Value child = Value::CreateNode("Child");
+        child["text"] = Value("child text", false);
+        child.ArrayPushBack(Value(1.5));
+        node.ArrayPushBack(child);
+        node.ArrayPushBack(Value("trailing", false));
+        PerformSerializationChecks(node);
+    }
+
+    TEST_F(DomBinaryTests, RepeatedStrings_AreStoredOnce)
+    {
+        const AZStd::string longString(256, 'x');
+        Value single(Type::Array);
+        single.ArrayPushBack(Value(longString, true));
+        Value repeated(Type::Array);
+        for (int i = 0; i < 16; ++i)
+        {
+            repeated.ArrayPushBack(Value(longString, true));
+        }
+
+        const size_t singleSize = Serialize(single).size();
+        const size_t repeatedSize = Serialize(repeated).size();
+        EXPECT_LT(repeatedSize, singleSize + longString.size());
+        PerformSerializationChecks(repeated);
+    }
+
+    TEST_F(DomBinaryTests, JsonRoundTrip)
+    {
+        const char* json = R"({"name": "test", "values": [1, -2, 3.5, true, false, null], "nested": {"inner": ["a", "b"]}})";
+        JsonBackend jsonBackend;
+        auto fromJson = Utils::SerializedStringToValue(jsonBackend, json, Lifetime::Temporary);
+        ASSERT_TRUE(fromJson.IsSuccess());
+
+        // JSON -> binary, read straight from the JSON visitor without an intermediate Value
+        AZStd::string binaryBuffer;
+        auto writeResult = m_backend.WriteToBuffer(
+            binaryBuffer,
+            [&](Visitor& visitor)
+            {
+                return Utils::ReadFromString(jsonBackend, json, Lifetime::Temporary, visitor);
+            });
+        ASSERT_TRUE(writeResult.IsSuccess());
+
+        // binary -> JSON
+        AZStd::string jsonBuffer;
+        auto jsonResult = jsonBackend.WriteToBuffer(
+            jsonBuffer,
+            [&](Visitor& visitor)
+            {
+                return Utils::ReadFromString(m_backend, binaryBuffer, Lifetime::Temporary, visitor);
+            });
+        ASSERT_TRUE(jsonResult.IsSuccess());
+
+        auto toJson = Utils::SerializedStringToValue(jsonBackend, jsonBuffer, Lifetime::Temporary);
+        ASSERT_TRUE(toJson.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(fromJson.GetValue(), toJson.GetValue()));
+    }
+
+    TEST_F(DomBinaryTests, VisitAtPath_VisitsOnlyTheRequestedValue)
+    {
+        Value value(Type::Object);
+        value["skipped"] = Value(Type::Array);
+        value["skipped"].ArrayPushBack(Value("not visited", false));
+        value["target"] = Value(Type::Array);
+        value["target"].ArrayPushBack(Value(1));
+        value["target"].ArrayPushBack(Value::CreateNode("Node"));
+        value["target"][1]["attr"] = Value("found", false);
+
+        AZStd::string buffer = Serialize(value);
+
+        auto visitPath = [&](const Path& path)
+        {
+            return Utils::WriteToValue(
+                [&](Visitor& visitor)
+                {
+                    return Binary::VisitSerializedBinaryAtPath(buffer, path, Lifetime::Temporary, visitor);
+                });
+        };
+
+        auto root = visitPath(Path());
+        ASSERT_TRUE(root.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(value, root.GetValue()));
+
+        auto target = visitPath(Path("/target"));
+        ASSERT_TRUE(target.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(value["target"], target.GetValue()));
+
+        auto attr = visitPath(Path("/target/1/attr"));
+        ASSERT_TRUE(attr.IsSuccess());
+        EXPECT_EQ(attr.GetValue().GetString(), "found");
+
+        EXPECT_FALSE(visitPath(Path("/missing")).IsSuccess());
+        EXPECT_FALSE(visitPath(Path("/target/2")).IsSuccess());
+        EXPECT_FALSE(visitPath(Path("/target/0/child")).IsSuccess());
+    }
+
+    TEST_F(DomBinaryTests, InvalidBuffers_AreRejected)
+    {
+        Value value(Type::Object);
+        value["array"] = Value(Type::Array);
+        value["array"].ArrayPushBack(Value("string", false));
+        value["array"].ArrayPushBack(Value(42));
+        AZStd::string buffer = Serialize(value);
+
+        auto read = [&](AZStd::string_view data)
+        {
+            return Utils::SerializedStringToValue(m_backend, data, Lifetime::Temporary);
+        };
+
+        ASSERT_TRUE(read(buffer).IsSuccess());
+        EXPECT_FALSE(read("").IsSuccess());
+        EXPECT_FALSE(read("{\"json\": true}").IsSuccess());
+
+        // Every truncation must fail cleanly rather than reading out of bounds
+        for (size_t size = 0; size < buffer.size(); ++size)
+        {
+            EXPECT_FALSE(read(AZStd::string_view(buffer.data(), size)).IsSuccess());
+        }
+
+        // Unknown version
+        AZStd::string badVersion = buffer;
+        badVersion[4] = 0x7f;
+        EXPECT_FALSE(read(badVersion).IsSuccess());
+
+        // Unknown token for the root value
+        AZStd::string badToken = buffer;
+        badToken[Binary::HeaderSize] = static_cast<char>(0xff);
+        EXPECT_FALSE(read(badToken).IsSuccess());
+    }
+} // namespace AZ::Dom::Tests
@@ -175,6 +175,45 @@ namespace AZ::Dom::Tests
         return root;
     }
 
+    Value DomBenchmarkFixture::GenerateDomEntityBenchmarkPayload(int64_t entityCount)
+    {
+        Value entities(Type::Object);
+        for (int64_t i = 0; i < entityCount; ++i)
+        {
+            Value translate(Type::Array);
+            translate.ArrayPushBack(Value(aznumeric_cast<double>(i)));
+            translate.ArrayPushBack(Value(0.0));
+            translate.ArrayPushBack(Value(0.0));
+
+            Value transform(Type::Object);
+            transform["Translate"] = translate;
+            transform["UniformScale"] = Value(1.0);
+            transform["Parent"] = Value(AZStd::string::format("Entity_%" PRId64, i / 10), true);
+
+            Value components(Type::Object);
+            components["TransformComponent"] = transform;
+            components["EditorOnlyEntityComponent"] = Value(Type::Object);
+            components["EditorOnlyEntityComponent"]["IsEditorOnly"] = Value(false);
+
+            Value entity(Type::Object);
+            entity["Id"] = Value(AZStd::string::format("Entity_%" PRId64, i), true);
+            entity["Name"] = Value(AZStd::string::format("Entity %" PRId64, i), true);
+            entity["Components"] = components;
+
+            entities.AddMember(AZ::Name(AZStd::string::format("Entity_%" PRId64, i)), AZStd::move(entity));
+        }
+
+        Value root(Type::Object);
+        root["ContainerEntity"] = Value(Type::Object);
+        root["Entities"] = AZStd::move(entities);
+        return root;
+    }
+
+    Path DomBenchmarkFixture::GetEntityBenchmarkTranslationPath(int64_t entityIndex)
+    {
+        return Path(AZStd::string::format("/Entities/Entity_%" PRId64 "/Components/TransformComponent/Translate/0", entityIndex));
+    }
+
     void DomTestFixture::SetUp()
     {
         UnitTest::AllocatorsFixture::SetUp();
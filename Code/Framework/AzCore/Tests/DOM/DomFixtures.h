@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/DOM/DomPath.h>
 #include <AzCore/DOM/DomUtils.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -18,6 +19,8 @@
     DOM_REGISTER_SERIALIZATION_BENCHMARK(BaseClass, Method)->Unit(benchmark::kMillisecond);
 #define DOM_REGISTER_SERIALIZATION_BENCHMARK_NS(BaseClass, Method)                                                                         \
     DOM_REGISTER_SERIALIZATION_BENCHMARK(BaseClass, Method)->Unit(benchmark::kNanosecond);
+#define DOM_REGISTER_ENTITY_BENCHMARK_MS(BaseClass, Method)                                                                                \
+    BENCHMARK_REGISTER_F(BaseClass, Method)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
 
 namespace AZ::Dom::Tests
 {
@@ -43,6 +46,10 @@ namespace AZ::Dom::Tests
         rapidjson::Document GenerateDomJsonBenchmarkDocument(int64_t entryCount, int64_t stringTemplateLength);
         AZStd::string GenerateDomJsonBenchmarkPayload(int64_t entryCount, int64_t stringTemplateLength);
         Value GenerateDomBenchmarkPayload(int64_t entryCount, int64_t stringTemplateLength);
+        //! Generates a document shaped like a prefab, with entityCount entities each holding a few components.
+        Value GenerateDomEntityBenchmarkPayload(int64_t entityCount);
+        //! Returns the path to the translation of the transform component of an entity in a GenerateDomEntityBenchmarkPayload document.
+        static Path GetEntityBenchmarkTranslationPath(int64_t entityIndex);
 
         template<class T>
         static void TakeAndDiscardWithoutTimingDtor(T&& value, benchmark::State& state)
@@ -8,6 +8,7 @@
 
 #if defined(HAVE_BENCHMARK)
 
+#include <AzCore/DOM/Backends/Binary/BinaryBackend.h>
 #include <AzCore/DOM/Backends/JSON/JsonBackend.h>
 #include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
 #include <AzCore/DOM/DomUtils.h>
@@ -22,6 +23,36 @@ namespace AZ::Dom::Benchmark
 {
     class DomJsonBenchmark : public Tests::DomBenchmarkFixture
     {
+    public:
+        AZStd::string GenerateDomBinaryBenchmarkPayload(int64_t entryCount, int64_t stringTemplateLength)
+        {
+            AZ::Dom::BinaryBackend backend;
+            AZStd::string serializedPayload;
+            auto result = AZ::Dom::Utils::ValueToSerializedString(
+                backend, GenerateDomBenchmarkPayload(entryCount, stringTemplateLength), serializedPayload);
+            AZ_Assert(result.IsSuccess(), "Failed to serialize generated binary DOM");
+            return serializedPayload;
+        }
+
+        // Records the size of the serialized payload and the heap held by a Value read from it, to compare the memory
+        // footprint of materializing a document against visiting it in place.
+        template<class ReadFn>
+        static void RecordMemoryCounters(benchmark::State& state, const AZStd::string& serializedPayload, ReadFn&& readFn)
+        {
+            auto allocatedBytes = []()
+            {
+                return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes() +
+                    AZ::AllocatorInstance<AZ::Dom::ValueAllocator>::Get().NumAllocatedBytes();
+            };
+
+            const size_t bytesBefore = allocatedBytes();
+            {
+                auto result = AZ::Dom::Utils::WriteToValue(readFn);
+                const size_t bytesAfter = allocatedBytes();
+                state.counters["ValueHeapBytes"] = aznumeric_cast<double>(bytesAfter > bytesBefore ? bytesAfter - bytesBefore : 0);
+            }
+            state.counters["PayloadBytes"] = aznumeric_cast<double>(serializedPayload.size());
+        }
     };
 
     BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomDeserializeToRapidjsonInPlace)(benchmark::State& state)
@@ -96,6 +127,12 @@ namespace AZ::Dom::Benchmark
     {
         AZ::Dom::JsonBackend backend;
         AZStd::string serializedPayload = GenerateDomJsonBenchmarkPayload(state.range(0), state.range(1));
+        RecordMemoryCounters(
+            state, serializedPayload,
+            [&](AZ::Dom::Visitor& visitor)
+            {
+                return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Temporary, visitor);
+            });
 
         for ([[maybe_unused]] auto _ : state)
         {
@@ -112,6 +149,134 @@ namespace AZ::Dom::Benchmark
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomDeserializeToAzDomValue)
 
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomBinaryDeserializeToAzDomValue)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend backend;
+        AZStd::string serializedPayload = GenerateDomBinaryBenchmarkPayload(state.range(0), state.range(1));
+        RecordMemoryCounters(
+            state, serializedPayload,
+            [&](AZ::Dom::Visitor& visitor)
+            {
+                return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Temporary, visitor);
+            });
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::Dom::Utils::WriteToValue(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Temporary, visitor);
+                });
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomBinaryDeserializeToAzDomValue)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomBinaryDeserializeToAzDomValueInPlace)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend backend;
+        AZStd::string serializedPayload = GenerateDomBinaryBenchmarkPayload(state.range(0), state.range(1));
+        RecordMemoryCounters(
+            state, serializedPayload,
+            [&](AZ::Dom::Visitor& visitor)
+            {
+                return AZ::Dom::Utils::ReadFromStringInPlace(backend, serializedPayload, visitor);
+            });
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // The binary format is never modified while being read, so unlike the JSON case no copy is needed per iteration
+            auto result = AZ::Dom::Utils::WriteToValue(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromStringInPlace(backend, serializedPayload, visitor);
+                });
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomBinaryDeserializeToAzDomValueInPlace)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomBinaryToJson)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend binaryBackend;
+        AZ::Dom::JsonBackend jsonBackend;
+        AZStd::string serializedPayload = GenerateDomBinaryBenchmarkPayload(state.range(0), state.range(1));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::string jsonBuffer;
+            auto result = jsonBackend.WriteToBuffer(
+                jsonBuffer,
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromString(binaryBackend, serializedPayload, AZ::Dom::Lifetime::Persistent, visitor);
+                });
+            benchmark::DoNotOptimize(result);
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(jsonBuffer), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomBinaryToJson)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomBinaryVisitLastEntryInPlace)(benchmark::State& state)
+    {
+        const int64_t lastEntry = state.range(0) - 1;
+        AZStd::string serializedPayload = GenerateDomBinaryBenchmarkPayload(state.range(0), state.range(1));
+        const AZ::Dom::Path path(AZStd::string::format("/entries/Key%" PRId64 "/%" PRId64 "/string", lastEntry, lastEntry));
+        RecordMemoryCounters(
+            state, serializedPayload,
+            [&](AZ::Dom::Visitor& visitor)
+            {
+                return AZ::Dom::Binary::VisitSerializedBinaryAtPath(serializedPayload, path, AZ::Dom::Lifetime::Persistent, visitor);
+            });
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::Dom::Utils::WriteToValue(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Binary::VisitSerializedBinaryAtPath(
+                        serializedPayload, path, AZ::Dom::Lifetime::Persistent, visitor);
+                });
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_NS(DomJsonBenchmark, AzDomBinaryVisitLastEntryInPlace)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomDeserializeAndLookupLastEntry)(benchmark::State& state)
+    {
+        const int64_t lastEntry = state.range(0) - 1;
+        AZ::Dom::JsonBackend backend;
+        AZStd::string serializedPayload = GenerateDomJsonBenchmarkPayload(state.range(0), state.range(1));
+        const AZ::Dom::Path path(AZStd::string::format("/entries/Key%" PRId64 "/%" PRId64 "/string", lastEntry, lastEntry));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::Dom::Utils::WriteToValue(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Temporary, visitor);
+                });
+            AZ::Dom::Value document = result.TakeValue();
+            benchmark::DoNotOptimize(document.FindChild(path));
+
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(document), state);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomDeserializeAndLookupLastEntry)
+
     BENCHMARK_DEFINE_F(DomJsonBenchmark, RapidjsonDeserializeToRapidjson)(benchmark::State& state)
     {
         AZ::Dom::JsonBackend backend;
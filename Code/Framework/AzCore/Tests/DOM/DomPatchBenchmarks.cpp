@@ -72,6 +72,28 @@ namespace AZ::Dom::Benchmark
             RunBenchmarkInternal(state, apply);
         }
 
+        void SnapshotAndPatchEntity(benchmark::State& state, bool testBeforeReplace)
+        {
+            m_before = GenerateDomEntityBenchmarkPayload(state.range(0));
+            const Path path = GetEntityBenchmarkTranslationPath(state.range(0) / 2);
+
+            Patch patch;
+            if (testBeforeReplace)
+            {
+                patch.PushBack(PatchOperation::TestOperation(path, *m_before.FindChild(path)));
+            }
+            patch.PushBack(PatchOperation::ReplaceOperation(path, Value(42.0)));
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // m_before is the snapshot, applying the patch only detaches the replaced path from it
+                auto patchResult = patch.Apply(m_before);
+                TakeAndDiscardWithoutTimingDtor(patchResult.TakeValue(), state);
+            }
+
+            state.SetItemsProcessed(state.iterations());
+        }
+
     private:
         void RunBenchmarkInternal(benchmark::State& state, bool apply)
         {
@@ -177,4 +199,16 @@ namespace AZ::Dom::Benchmark
         ArrayPrepend(state, true, true);
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomPatchBenchmark, AzDomPatch_Apply_ArrayPrepend)
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Apply_SnapshotAndReplaceEntity)(benchmark::State& state)
+    {
+        SnapshotAndPatchEntity(state, false);
+    }
+    DOM_REGISTER_ENTITY_BENCHMARK_MS(DomPatchBenchmark, AzDomPatch_Apply_SnapshotAndReplaceEntity)
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Apply_SnapshotAndTestReplaceEntity)(benchmark::State& state)
+    {
+        SnapshotAndPatchEntity(state, true);
+    }
+    DOM_REGISTER_ENTITY_BENCHMARK_MS(DomPatchBenchmark, AzDomPatch_Apply_SnapshotAndTestReplaceEntity)
 } // namespace AZ::Dom::Benchmark
@@ -560,4 +560,28 @@ namespace AZ::Dom::Tests
         m_deltaDataset.ArrayPushBack(Value(6));
         GenerateAndVerifyDelta();
     }
+
+    TEST_F(DomPatchTests, ApplyInPlace_OnlyDetachesTouchedPathFromSnapshot)
+    {
+        const Value snapshot = m_dataset;
+        const Value& dataset = m_dataset;
+
+        // Test operations are read-only and must not detach anything from the snapshot
+        Patch testPatch({ PatchOperation::TestOperation(Path("/obj/foo"), Value(true)) });
+        ASSERT_TRUE(testPatch.ApplyInPlace(m_dataset).IsSuccess());
+        EXPECT_EQ(dataset.GetInternalValue(), snapshot.GetInternalValue());
+
+        Patch replacePatch({ PatchOperation::ReplaceOperation(Path("/arr/0"), Value(42)) });
+        ASSERT_TRUE(replacePatch.ApplyInPlace(m_dataset).IsSuccess());
+        EXPECT_EQ(dataset["arr"][0].GetInt64(), 42);
+        EXPECT_EQ(snapshot["arr"][0].GetInt64(), 0);
+        EXPECT_NE(dataset["arr"].GetInternalValue(), snapshot["arr"].GetInternalValue());
+        EXPECT_EQ(dataset["node"].GetInternalValue(), snapshot["node"].GetInternalValue());
+        EXPECT_EQ(dataset["obj"].GetInternalValue(), snapshot["obj"].GetInternalValue());
+
+        // A failed operation leaves the snapshot's containers shared
+        Patch failingPatch({ PatchOperation::ReplaceOperation(Path("/node/missing/0"), Value(1)) });
+        EXPECT_FALSE(failingPatch.ApplyInPlace(m_dataset).IsSuccess());
+        EXPECT_EQ(dataset["node"].GetInternalValue(), snapshot["node"].GetInternalValue());
+    }
 } // namespace AZ::Dom::Tests
@@ -188,6 +188,39 @@ namespace AZ::Dom::Benchmark
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomValueBenchmark, AzDomValueDeepCopy)
 
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueSnapshotAndMutateEntity)(benchmark::State& state)
+    {
+        Value document = GenerateDomEntityBenchmarkPayload(state.range(0));
+        const Path path = GetEntityBenchmarkTranslationPath(state.range(0) / 2);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Taking the snapshot only shares the document's containers, the mutation then detaches the path it touches
+            Value snapshot = document;
+            document[path] = Value(aznumeric_cast<double>(state.iterations()));
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(snapshot), state);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    DOM_REGISTER_ENTITY_BENCHMARK_MS(DomValueBenchmark, AzDomValueSnapshotAndMutateEntity)
+
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueDeepCopySnapshotAndMutateEntity)(benchmark::State& state)
+    {
+        Value document = GenerateDomEntityBenchmarkPayload(state.range(0));
+        const Path path = GetEntityBenchmarkTranslationPath(state.range(0) / 2);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Value snapshot = Utils::DeepCopy(document);
+            document[path] = Value(aznumeric_cast<double>(state.iterations()));
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(snapshot), state);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    DOM_REGISTER_ENTITY_BENCHMARK_MS(DomValueBenchmark, AzDomValueDeepCopySnapshotAndMutateEntity)
+
     BENCHMARK_DEFINE_F(DomValueBenchmark, LookupMemberByName)(benchmark::State& state)
     {
         Value value(Type::Object);
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <gtest/gtest.h>
+
+namespace UnitTest
+{
+    class ContiguousNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::MultipleContiguous;
+        using MutexType = AZStd::recursive_mutex;
+
+        virtual void OnEvent(int32_t value) = 0;
+        virtual int32_t GetId() const = 0;
+    };
+    using ContiguousNotificationBus = AZ::EBus<ContiguousNotifications>;
+
+    // Records the handlers in the order they receive events
+    using ContiguousCallLog = AZStd::vector<AZStd::pair<int32_t, int32_t>>;
+
+    class ContiguousHandlerA
+        : public ContiguousNotificationBus::Handler
+    {
+    public:
+        ContiguousHandlerA(int32_t id, ContiguousCallLog& log)
+            : m_id(id)
+            , m_log(log)
+        {
+        }
+
+        ~ContiguousHandlerA() override
+        {
+            ContiguousNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnEvent(int32_t value) override
+        {
+            m_log.emplace_back(m_id, value);
+            if (m_onEvent)
+            {
+                m_onEvent();
+            }
+        }
+
+        int32_t GetId() const override
+        {
+            return m_id;
+        }
+
+        int32_t m_id;
+        ContiguousCallLog& m_log;
+        AZStd::function<void()> m_onEvent;
+    };
+
+    class ContiguousHandlerB
+        : public ContiguousHandlerA
+    {
+    public:
+        using ContiguousHandlerA::ContiguousHandlerA;
+
+        void OnEvent(int32_t value) override
+        {
+            ContiguousHandlerA::OnEvent(value);
+        }
+    };
+
+    class EBusContiguousHandlerTest
+        : public AllocatorsFixture
+    {
+    protected:
+        ContiguousCallLog m_log;
+    };
+
+    TEST_F(EBusContiguousHandlerTest, Broadcast_HandlersOfDifferentTypes_DispatchedGroupedByType)
+    {
+        ContiguousHandlerA a1(1, m_log);
+        ContiguousHandlerB b1(2, m_log);
+        ContiguousHandlerA a2(3, m_log);
+        ContiguousHandlerB b2(4, m_log);
+        a1.BusConnect();
+        b1.BusConnect();
+        a2.BusConnect();
+        b2.BusConnect();
+        EXPECT_EQ(4, ContiguousNotificationBus::GetTotalNumOfEventHandlers());
+
+        ContiguousNotificationBus::Broadcast(&ContiguousNotifications::OnEvent, 7);
+        const ContiguousCallLog expected = { { 1, 7 }, { 3, 7 }, { 2, 7 }, { 4, 7 } };
+        EXPECT_EQ(expected, m_log);
+
+        m_log.clear();
+        ContiguousNotificationBus::BroadcastReverse(&ContiguousNotifications::OnEvent, 8);
+        const ContiguousCallLog expectedReverse = { { 4, 8 }, { 2, 8 }, { 3, 8 }, { 1, 8 } };
+        EXPECT_EQ(expectedReverse, m_log);
+    }
+
+    TEST_F(EBusContiguousHandlerTest, Disconnect_OutsideDispatch_RemainingHandlersStillReceiveEvents)
+    {
+        ContiguousHandlerA a1(1, m_log);
+        ContiguousHandlerA a2(2, m_log);
+        ContiguousHandlerA a3(3, m_log);
+        a1.BusConnect();
+        a2.BusConnect();
+        a3.BusConnect();
+
+        a1.BusDisconnect();
+        EXPECT_EQ(2, ContiguousNotificationBus::GetTotalNumOfEventHandlers());
+        // The last handler moves into the slot of the disconnected one, so disconnecting it again has to find it there
+        a3.BusDisconnect();
+        EXPECT_EQ(1, ContiguousNotificationBus::GetTotalNumOfEventHandlers());
+
+        ContiguousNotificationBus::Broadcast(&ContiguousNotifications::OnEvent, 1);
+        const ContiguousCallLog expected = { { 2, 1 } };
+        EXPECT_EQ(expected, m_log);
+    }
+
+    TEST_F(EBusContiguousHandlerTest, Disconnect_DuringDispatch_DisconnectedHandlersAreSkipped)
+    {
+        ContiguousHandlerA a1(1, m_log);
+        ContiguousHandlerA a2(2, m_log);
+        ContiguousHandlerA a3(3, m_log);
+        a1.BusConnect();
+        a2.BusConnect();
+        a3.BusConnect();
+
+        // The first handler disconnects itself and the next one, then connects it again which must not deliver the current event
+        a1.m_onEvent = [&a1, &a2]()
+        {
+            a1.BusDisconnect();
+            a2.BusDisconnect();
+            a2.BusConnect();
+        };
+
+        ContiguousNotificationBus::Broadcast(&ContiguousNotifications::OnEvent, 1);
+        const ContiguousCallLog expected = { { 1, 1 }, { 3, 1 } };
+        EXPECT_EQ(expected, m_log);
+        EXPECT_EQ(2, ContiguousNotificationBus::GetTotalNumOfEventHandlers());
+
+        m_log.clear();
+        a3.BusDisconnect();
+        ContiguousNotificationBus::Broadcast(&ContiguousNotifications::OnEvent, 2);
+        const ContiguousCallLog expectedAfterDispatch = { { 2, 2 } };
+        EXPECT_EQ(expectedAfterDispatch, m_log);
+    }
+
+    TEST_F(EBusContiguousHandlerTest, BroadcastBatch_MultipleValues_EachHandlerReceivesAllValuesInOrder)
+    {
+        ContiguousHandlerA a1(1, m_log);
+        ContiguousHandlerB b1(2, m_log);
+        a1.BusConnect();
+        b1.BusConnect();
+
+        const int32_t values[] = { 10, 20, 30 };
+        ContiguousNotificationBus::BroadcastBatch(&ContiguousNotifications::OnEvent, AZStd::begin(values), AZStd::end(values));
+        const ContiguousCallLog expected = { { 1, 10 }, { 1, 20 }, { 1, 30 }, { 2, 10 }, { 2, 20 }, { 2, 30 } };
+        EXPECT_EQ(expected, m_log);
+    }
+
+    TEST_F(EBusContiguousHandlerTest, EnumerateHandlers_CallbackReturnsFalse_StopsEnumeration)
+    {
+        ContiguousHandlerA a1(1, m_log);
+        ContiguousHandlerA a2(2, m_log);
+        a1.BusConnect();
+        a2.BusConnect();
+
+        int32_t visited = 0;
+        ContiguousNotificationBus::EnumerateHandlers([&visited](ContiguousNotifications*)
+        {
+            ++visited;
+            return false;
+        });
+        EXPECT_EQ(1, visited);
+
+        AZ::EBusAggregateResults<int32_t> results;
+        ContiguousNotificationBus::BroadcastResult(results, &ContiguousNotifications::GetId);
+        EXPECT_EQ((AZStd::vector<int32_t>{ 1, 2 }), results.values);
+    }
+} // namespace UnitTest
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <gtest/gtest.h>
+
+namespace UnitTest
+{
+    class LocklessQueueNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static constexpr bool EnableEventQueue = true;
+        static constexpr bool LocklessEventQueue = true;
+        using MutexType = AZStd::recursive_mutex;
+
+        virtual void OnEvent(int32_t producer, int32_t value) = 0;
+    };
+    using LocklessQueueNotificationBus = AZ::EBus<LocklessQueueNotifications>;
+
+    class LocklessQueueHandler
+        : public LocklessQueueNotificationBus::Handler
+    {
+    public:
+        LocklessQueueHandler()
+        {
+            LocklessQueueNotificationBus::Handler::BusConnect();
+        }
+
+        ~LocklessQueueHandler() override
+        {
+            LocklessQueueNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnEvent(int32_t producer, int32_t value) override
+        {
+            if (producer >= static_cast<int32_t>(m_values.size()))
+            {
+                m_values.resize(producer + 1);
+            }
+            m_values[producer].push_back(value);
+        }
+
+        // Values received from each producer, in the order they were received
+        AZStd::vector<AZStd::vector<int32_t>> m_values;
+    };
+
+    class EBusLocklessQueueTest
+        : public AllocatorsFixture
+    {
+    protected:
+        void TearDown() override
+        {
+            LocklessQueueNotificationBus::ClearQueuedEvents();
+            AllocatorsFixture::TearDown();
+        }
+    };
+
+    TEST_F(EBusLocklessQueueTest, ExecuteQueuedEvents_EventsSpanningSeveralBlocks_ExecutedInOrder)
+    {
+        LocklessQueueHandler handler;
+
+        // Queue enough events to fill several blocks, and execute them more than once so the blocks are recycled
+        constexpr int32_t NumEvents = 1000;
+        for (int32_t pass = 0; pass < 3; ++pass)
+        {
+            handler.m_values.clear();
+            for (int32_t i = 0; i < NumEvents; ++i)
+            {
+                LocklessQueueNotificationBus::QueueBroadcast(&LocklessQueueNotifications::OnEvent, 0, i);
+            }
+            EXPECT_EQ(NumEvents, LocklessQueueNotificationBus::QueuedEventCount());
+            EXPECT_TRUE(handler.m_values.empty());
+
+            LocklessQueueNotificationBus::ExecuteQueuedEvents();
+            EXPECT_EQ(0, LocklessQueueNotificationBus::QueuedEventCount());
+            ASSERT_EQ(1, handler.m_values.size());
+            ASSERT_EQ(NumEvents, handler.m_values[0].size());
+            for (int32_t i = 0; i < NumEvents; ++i)
+            {
+                EXPECT_EQ(i, handler.m_values[0][i]);
+            }
+        }
+    }
+
+    TEST_F(EBusLocklessQueueTest, QueueFunction_ClosureLargerThanSlot_Executed)
+    {
+        AZStd::array<int32_t, 64> largeCapture;
+        largeCapture.fill(3);
+        int32_t sum = 0;
+        LocklessQueueNotificationBus::QueueFunction([largeCapture, &sum]()
+        {
+            for (int32_t value : largeCapture)
+            {
+                sum += value;
+            }
+        });
+
+        LocklessQueueNotificationBus::ExecuteQueuedEvents();
+        EXPECT_EQ(3 * 64, sum);
+    }
+
+    TEST_F(EBusLocklessQueueTest, QueueFunction_QueuedWhileExecuting_ExecutedByNextCall)
+    {
+        int32_t calls = 0;
+        LocklessQueueNotificationBus::QueueFunction([&calls]()
+        {
+            ++calls;
+            LocklessQueueNotificationBus::QueueFunction([&calls]() { ++calls; });
+        });
+
+        LocklessQueueNotificationBus::ExecuteQueuedEvents();
+        EXPECT_EQ(1, calls);
+        LocklessQueueNotificationBus::ExecuteQueuedEvents();
+        EXPECT_EQ(2, calls);
+    }
+
+    TEST_F(EBusLocklessQueueTest, ClearQueuedEvents_QueuedFunctions_DestroyedWithoutExecuting)
+    {
+        auto token = AZStd::make_shared<int32_t>(0);
+        LocklessQueueNotificationBus::QueueFunction([token]() { ++(*token); });
+        EXPECT_EQ(2, token.use_count());
+
+        LocklessQueueNotificationBus::ClearQueuedEvents();
+        EXPECT_EQ(1, token.use_count());
+        EXPECT_EQ(0, *token);
+        EXPECT_EQ(0, LocklessQueueNotificationBus::QueuedEventCount());
+    }
+
+    TEST_F(EBusLocklessQueueTest, QueueBroadcast_MultipleThreads_AllEventsExecutedInOrderPerThread)
+    {
+        LocklessQueueHandler handler;
+
+        constexpr int32_t NumThreads = 4;
+        constexpr int32_t NumEvents = 5000;
+        AZStd::atomic_int finishedThreads{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (int32_t producer = 0; producer < NumThreads; ++producer)
+        {
+            threads.emplace_back([producer, &finishedThreads]()
+            {
+                for (int32_t i = 0; i < NumEvents; ++i)
+                {
+                    LocklessQueueNotificationBus::QueueBroadcast(&LocklessQueueNotifications::OnEvent, producer, i);
+                }
+                ++finishedThreads;
+            });
+        }
+
+        // Execute while the threads are still queueing events
+        while (finishedThreads < NumThreads)
+        {
+            LocklessQueueNotificationBus::ExecuteQueuedEvents();
+            AZStd::this_thread::yield();
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        LocklessQueueNotificationBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(NumThreads, handler.m_values.size());
+        for (int32_t producer = 0; producer < NumThreads; ++producer)
+        {
+            ASSERT_EQ(NumEvents, handler.m_values[producer].size());
+            for (int32_t i = 0; i < NumEvents; ++i)
+            {
+                EXPECT_EQ(i, handler.m_values[producer][i]);
+            }
+        }
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace EBusLocklessQueue
+    {
+        static constexpr int32_t NumEventsPerIteration = 64;
+
+        template <bool lockless>
+        class QueueNotifications
+            : public AZ::EBusTraits
+        {
+        public:
+            static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+            static constexpr bool EnableEventQueue = true;
+            static constexpr bool LocklessEventQueue = lockless;
+            using MutexType = AZStd::recursive_mutex;
+
+            virtual void OnEvent(int32_t value) = 0;
+        };
+
+        template <bool lockless>
+        using QueueNotificationBus = AZ::EBus<QueueNotifications<lockless>>;
+
+        template <bool lockless>
+        class QueueHandler
+            : public QueueNotificationBus<lockless>::Handler
+        {
+        public:
+            QueueHandler()
+            {
+                QueueNotificationBus<lockless>::Handler::BusConnect();
+            }
+
+            ~QueueHandler() override
+            {
+                QueueNotificationBus<lockless>::Handler::BusDisconnect();
+            }
+
+            void OnEvent(int32_t value) override
+            {
+                m_sum.fetch_add(value, AZStd::memory_order_relaxed);
+            }
+
+            AZStd::atomic<int64_t> m_sum{ 0 };
+        };
+
+        // Every thread queues events, the first thread also executes them like the main thread would once per frame
+        template <bool lockless>
+        static void BM_EBusQueueThroughput(benchmark::State& state)
+        {
+            using Bus = QueueNotificationBus<lockless>;
+
+            static QueueHandler<lockless>* handler = nullptr;
+            if (state.thread_index == 0)
+            {
+                handler = new QueueHandler<lockless>();
+            }
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (int32_t i = 0; i < NumEventsPerIteration; ++i)
+                {
+                    Bus::QueueBroadcast(&Bus::Events::OnEvent, i);
+                }
+
+                if (state.thread_index == 0)
+                {
+                    Bus::ExecuteQueuedEvents();
+                }
+            }
+
+            if (state.thread_index == 0)
+            {
+                Bus::ClearQueuedEvents();
+                delete handler;
+                handler = nullptr;
+            }
+            state.SetItemsProcessed(state.iterations() * NumEventsPerIteration);
+        }
+
+        BENCHMARK_TEMPLATE(BM_EBusQueueThroughput, false)->ThreadRange(1, 8)->UseRealTime();
+        BENCHMARK_TEMPLATE(BM_EBusQueueThroughput, true)->ThreadRange(1, 8)->UseRealTime();
+    } // namespace EBusLocklessQueue
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace EBusContiguous
+    {
+        static constexpr int32_t NumHandlers = 10000;
+        static constexpr int32_t NumBatchValues = 16;
+
+        // Buses with the same interface that only differ by how the handlers are stored and how the bus is locked
+        template <AZ::EBusHandlerPolicy handlerPolicy, typename Mutex>
+        class Notifications
+            : public AZ::EBusTraits
+        {
+        public:
+            static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+            static constexpr AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
+            using MutexType = Mutex;
+
+            virtual void OnSignal(int32_t value) = 0;
+        };
+
+        using IntrusiveBus = AZ::EBus<Notifications<AZ::EBusHandlerPolicy::Multiple, AZStd::recursive_mutex>>;
+        using ContiguousBus = AZ::EBus<Notifications<AZ::EBusHandlerPolicy::MultipleContiguous, AZStd::recursive_mutex>>;
+        using IntrusiveSingleThreadedBus = AZ::EBus<Notifications<AZ::EBusHandlerPolicy::Multiple, AZ::NullMutex>>;
+        using ContiguousSingleThreadedBus = AZ::EBus<Notifications<AZ::EBusHandlerPolicy::MultipleContiguous, AZ::NullMutex>>;
+
+        // A few handler types, allocated interleaved like components of different types on a set of entities
+        template <typename Bus, int32_t TypeIndex>
+        class Handler
+            : public Bus::Handler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Handler, AZ::SystemAllocator, 0);
+
+            explicit Handler(int32_t* counter)
+                : m_counter(counter)
+            {
+            }
+
+            ~Handler() override
+            {
+                Bus::Handler::BusDisconnect();
+            }
+
+            void OnSignal(int32_t value) override
+            {
+                *m_counter += value + TypeIndex;
+            }
+
+            int32_t* m_counter;
+        };
+
+        template <typename Bus>
+        class EBusContiguousBenchmarkFixture
+            : public ::UnitTest::AllocatorsBenchmarkFixture
+        {
+        public:
+            void SetUp(const benchmark::State& state) override
+            {
+                ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                internalSetUp();
+            }
+            void SetUp(benchmark::State& state) override
+            {
+                ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                internalSetUp();
+            }
+
+            void TearDown(const benchmark::State& state) override
+            {
+                internalTearDown();
+                ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+            void TearDown(benchmark::State& state) override
+            {
+                internalTearDown();
+                ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+
+        protected:
+            void internalSetUp()
+            {
+                Bus::GetOrCreateContext();
+                m_handlers.reserve(NumHandlers);
+                for (int32_t i = 0; i < NumHandlers; ++i)
+                {
+                    switch (i % 4)
+                    {
+                    case 0: m_handlers.emplace_back(aznew Handler<Bus, 0>(&m_counter)); break;
+                    case 1: m_handlers.emplace_back(aznew Handler<Bus, 1>(&m_counter)); break;
+                    case 2: m_handlers.emplace_back(aznew Handler<Bus, 2>(&m_counter)); break;
+                    default: m_handlers.emplace_back(aznew Handler<Bus, 3>(&m_counter)); break;
+                    }
+                    m_handlers.back()->BusConnect();
+                }
+                for (int32_t i = 0; i < NumBatchValues; ++i)
+                {
+                    m_values[i] = i;
+                }
+            }
+
+            void internalTearDown()
+            {
+                m_handlers.clear();
+                m_handlers.shrink_to_fit();
+            }
+
+            void Broadcast(benchmark::State& state)
+            {
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    Bus::Broadcast(&Bus::Events::OnSignal, 1);
+                }
+                benchmark::DoNotOptimize(m_counter);
+                state.SetItemsProcessed(state.iterations() * NumHandlers);
+            }
+
+            void BroadcastPerValue(benchmark::State& state)
+            {
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    for (int32_t value : m_values)
+                    {
+                        Bus::Broadcast(&Bus::Events::OnSignal, value);
+                    }
+                }
+                benchmark::DoNotOptimize(m_counter);
+                state.SetItemsProcessed(state.iterations() * NumHandlers * NumBatchValues);
+            }
+
+            AZStd::vector<AZStd::unique_ptr<typename Bus::Handler>> m_handlers;
+            int32_t m_values[NumBatchValues];
+            int32_t m_counter = 0;
+        };
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, Broadcast_Intrusive, IntrusiveBus)(benchmark::State& state)
+        {
+            Broadcast(state);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, Broadcast_Contiguous, ContiguousBus)(benchmark::State& state)
+        {
+            Broadcast(state);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, Broadcast_IntrusiveSingleThreaded, IntrusiveSingleThreadedBus)(benchmark::State& state)
+        {
+            Broadcast(state);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, Broadcast_ContiguousSingleThreaded, ContiguousSingleThreadedBus)(benchmark::State& state)
+        {
+            Broadcast(state);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, BroadcastPerValue_Intrusive, IntrusiveBus)(benchmark::State& state)
+        {
+            BroadcastPerValue(state);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, BroadcastPerValue_Contiguous, ContiguousBus)(benchmark::State& state)
+        {
+            BroadcastPerValue(state);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, BroadcastBatch_Contiguous, ContiguousBus)(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                ContiguousBus::BroadcastBatch(&ContiguousBus::Events::OnSignal, AZStd::begin(m_values), AZStd::end(m_values));
+            }
+            benchmark::DoNotOptimize(m_counter);
+            state.SetItemsProcessed(state.iterations() * NumHandlers * NumBatchValues);
+        }
+
+        BENCHMARK_TEMPLATE_F(EBusContiguousBenchmarkFixture, BroadcastBatch_ContiguousSingleThreaded, ContiguousSingleThreadedBus)(benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                ContiguousSingleThreadedBus::BroadcastBatch(
+                    &ContiguousSingleThreadedBus::Events::OnSignal, AZStd::begin(m_values), AZStd::end(m_values));
+            }
+            benchmark::DoNotOptimize(m_counter);
+            state.SetItemsProcessed(state.iterations() * NumHandlers * NumBatchValues);
+        }
+    } // namespace EBusContiguous
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/Vector3Array.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -21,6 +23,12 @@ namespace Benchmark
     {
         void internalSetUp()
         {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
             m_testFrustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
 
             m_dataArray.resize(1000);
@@ -38,6 +46,25 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            m_aabbMinimums.Resize(m_dataArray.size());
+            m_aabbMaximums.Resize(m_dataArray.size());
+            for (size_t index = 0; index < m_dataArray.size(); ++index)
+            {
+                m_aabbMinimums.SetElement(index, m_dataArray[index].aabbMin);
+                m_aabbMaximums.SetElement(index, m_dataArray[index].aabbMax);
+            }
+            m_results.resize(m_dataArray.size());
+        }
+
+        void internalTearDown()
+        {
+            m_aabbMinimums = {};
+            m_aabbMaximums = {};
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -49,6 +76,15 @@ namespace Benchmark
             internalSetUp();
         }
 
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
         struct Data
         {
             AZ::Vector3 sphereCenter;
@@ -57,8 +93,12 @@ namespace Benchmark
             AZ::Vector3 aabbMax;
         };
 
+        bool m_ownsSystemAllocator = false;
         std::vector<Data> m_dataArray;
         AZ::Frustum m_testFrustum;
+        AZ::Vector3Array m_aabbMinimums;
+        AZ::Vector3Array m_aabbMaximums;
+        std::vector<AZ::IntersectResult> m_results;
     };
 
     BENCHMARK_F(BM_MathFrustum, SphereIntersect)(benchmark::State& state)
@@ -84,6 +124,28 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, AabbIntersectBatch)(benchmark::State& state)
+    {
+        state.SetLabel(AZ::Simd::IsAvx2Enabled() ? "AVX2" : "Vec4");
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_testFrustum.IntersectAabbs(m_aabbMinimums, m_aabbMaximums, m_results.data());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathFrustum, AabbIntersectBatchVec4)(benchmark::State& state)
+    {
+        // Baseline for AabbIntersectBatch on cpus with AVX2 support
+        AZ::Simd::SetAvx2Enabled(false);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_testFrustum.IntersectAabbs(m_aabbMinimums, m_aabbMaximums, m_results.data());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        AZ::Simd::SetAvx2Enabled(true);
+    }
 }
 
 #endif
@@ -8,6 +8,8 @@
 
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/Vector3Array.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 
@@ -245,6 +247,76 @@ namespace UnitTest
         }
     }
 
+    // Boxes in every direction from inside the frustum to outside, in a count that isn't a multiple of the SIMD width
+    static void CreateTestAabbs(AZ::Vector3Array& minimums, AZ::Vector3Array& maximums)
+    {
+        for (float x = -60.0f; x <= 60.0f; x += 15.0f)
+        {
+            for (float y = -10.0f; y <= 110.0f; y += 15.0f)
+            {
+                for (float z = -60.0f; z <= 60.0f; z += 20.0f)
+                {
+                    const AZ::Vector3 center(x, y, z);
+                    minimums.PushBack(center - AZ::Vector3(2.0f, 1.0f, 3.0f));
+                    maximums.PushBack(center + AZ::Vector3(2.0f, 1.0f, 3.0f));
+                }
+            }
+        }
+        minimums.PushBack(AZ::Vector3(-1.0f, 49.0f, -1.0f));
+        maximums.PushBack(AZ::Vector3(1.0f, 51.0f, 1.0f));
+    }
+
+    TEST(MATH_Frustum, TestFrustumAabbBatch_MatchesIntersectAabb)
+    {
+        AZ::Vector3Array minimums;
+        AZ::Vector3Array maximums;
+        CreateTestAabbs(minimums, maximums);
+
+        for (const AZ::Frustum& frustum : { testFrustum1, testFrustum2 })
+        {
+            AZStd::vector<AZ::IntersectResult> results(minimums.GetSize());
+            frustum.IntersectAabbs(minimums, maximums, results.data());
+
+            size_t numResults[3] = {};
+            for (size_t index = 0; index < minimums.GetSize(); ++index)
+            {
+                const AZ::IntersectResult expected = frustum.IntersectAabb(minimums.GetElement(index), maximums.GetElement(index));
+                EXPECT_EQ(results[index], expected);
+                ++numResults[static_cast<int>(expected)];
+            }
+
+            // Make sure every kind of result was covered.
+            EXPECT_GT(numResults[static_cast<int>(AZ::IntersectResult::Interior)], 0);
+            EXPECT_GT(numResults[static_cast<int>(AZ::IntersectResult::Overlaps)], 0);
+            EXPECT_GT(numResults[static_cast<int>(AZ::IntersectResult::Exterior)], 0);
+        }
+    }
+
+    TEST(MATH_Frustum, TestFrustumAabbBatch_Avx2MatchesVec4)
+    {
+        if (!AZ::Simd::IsAvx2Supported())
+        {
+            GTEST_SKIP() << "AVX2 is not supported on this cpu";
+        }
+
+        AZ::Vector3Array minimums;
+        AZ::Vector3Array maximums;
+        CreateTestAabbs(minimums, maximums);
+
+        for (const AZ::Frustum& frustum : { testFrustum1, testFrustum2 })
+        {
+            AZ::Simd::SetAvx2Enabled(false);
+            AZStd::vector<AZ::IntersectResult> vec4Results(minimums.GetSize());
+            frustum.IntersectAabbs(minimums, maximums, vec4Results.data());
+
+            AZ::Simd::SetAvx2Enabled(true);
+            AZStd::vector<AZ::IntersectResult> avx2Results(minimums.GetSize());
+            frustum.IntersectAabbs(minimums, maximums, avx2Results.data());
+
+            EXPECT_EQ(avx2Results, vec4Results);
+        }
+    }
+
     TEST(MATH_Frustum, CalculateViewFrustumAttributesExample1)
     {
         const AZ::Vector3 translation(0.1f, 0.2f, 0.3f);
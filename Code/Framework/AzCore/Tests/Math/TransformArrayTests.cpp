@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/TransformArray.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    // A size that is not a multiple of the SIMD width, so the padding in the last block is exercised.
+    static constexpr size_t TestTransformCount = 3 * TransformArray::LaneCount + 1;
+
+    static Transform CreateTestTransform(size_t index)
+    {
+        const float value = static_cast<float>(index);
+        return Transform(
+            Vector3(value, -2.0f * value, 0.5f * value),
+            Quaternion::CreateRotationY(0.3f * value) * Quaternion::CreateRotationX(1.0f - 0.2f * value),
+            1.0f + 0.25f * value);
+    }
+
+    static Vector3 CreateTestPoint(size_t index)
+    {
+        const float value = static_cast<float>(index);
+        return Vector3(1.0f - value, value * 0.5f, 3.0f);
+    }
+
+    static TransformArray CreateTestTransformArray()
+    {
+        TransformArray transforms;
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            transforms.PushBack(CreateTestTransform(index));
+        }
+        return transforms;
+    }
+
+    TEST(MATH_TransformArray, TestResize_NewTransformsAreIdentity)
+    {
+        TransformArray transforms(TestTransformCount);
+        EXPECT_EQ(transforms.GetSize(), TestTransformCount);
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            EXPECT_THAT(transforms.GetElement(index), IsClose(Transform::CreateIdentity()));
+        }
+
+        transforms.SetElement(0, CreateTestTransform(5));
+        transforms.SetElement(1, CreateTestTransform(6));
+        transforms.Resize(1);
+        transforms.Resize(2);
+        EXPECT_THAT(transforms.GetElement(0), IsClose(CreateTestTransform(5)));
+        EXPECT_THAT(transforms.GetElement(1), IsClose(Transform::CreateIdentity()));
+    }
+
+    TEST(MATH_TransformArray, TestSetGetElement)
+    {
+        const TransformArray transforms = CreateTestTransformArray();
+        ASSERT_EQ(transforms.GetSize(), TestTransformCount);
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            EXPECT_THAT(transforms.GetElement(index), IsClose(CreateTestTransform(index)));
+        }
+    }
+
+    TEST(MATH_TransformArray, TestTransformPoints)
+    {
+        const TransformArray transforms = CreateTestTransformArray();
+        Vector3Array points(TestTransformCount);
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            points.SetElement(index, CreateTestPoint(index));
+        }
+
+        Vector3Array results;
+        transforms.TransformPoints(points, results);
+        ASSERT_EQ(results.GetSize(), TestTransformCount);
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            const Vector3 expected = CreateTestTransform(index).TransformPoint(CreateTestPoint(index));
+            EXPECT_THAT(results.GetElement(index), IsCloseTolerance(expected, 0.001f));
+        }
+
+        // The results may alias the points.
+        transforms.TransformPoints(points, points);
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            EXPECT_THAT(points.GetElement(index), IsClose(results.GetElement(index)));
+        }
+    }
+
+    TEST(MATH_TransformArray, TestTransformPoint)
+    {
+        const TransformArray transforms = CreateTestTransformArray();
+        const Vector3 point(0.5f, -1.5f, 2.0f);
+
+        Vector3Array results;
+        transforms.TransformPoint(point, results);
+        ASSERT_EQ(results.GetSize(), TestTransformCount);
+        for (size_t index = 0; index < TestTransformCount; ++index)
+        {
+            EXPECT_THAT(results.GetElement(index), IsCloseTolerance(CreateTestTransform(index).TransformPoint(point), 0.001f));
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/TransformArray.h>
+#include <AzCore/Math/Vector3Array.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the batch operations of Vector3Array and TransformArray against the same operations done one AZ::Vector3
+    //! at a time on an array of structures.
+    class BM_MathVector3Array
+        : public benchmark::Fixture
+    {
+        static constexpr size_t NumElements = 10000;
+
+        void internalSetUp()
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+            m_vectors1.resize(NumElements);
+            m_vectors2.resize(NumElements);
+            m_transforms.resize(NumElements);
+            m_results.resize(NumElements);
+            m_floatResults.resize(NumElements);
+            m_array1.Resize(NumElements);
+            m_array2.Resize(NumElements);
+            m_transformArray.Resize(NumElements);
+            for (size_t index = 0; index < NumElements; ++index)
+            {
+                m_vectors1[index] = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                m_vectors2[index] = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                const AZ::Quaternion rotation = AZ::Quaternion(unif(rng), unif(rng), unif(rng), unif(rng)).GetNormalized();
+                m_transforms[index] = AZ::Transform(m_vectors2[index], rotation, 1.0f + unif(rng) * 0.5f);
+
+                m_array1.SetElement(index, m_vectors1[index]);
+                m_array2.SetElement(index, m_vectors2[index]);
+                m_transformArray.SetElement(index, m_transforms[index]);
+            }
+            m_transform = m_transforms[0];
+        }
+
+        void internalTearDown()
+        {
+            m_vectors1 = {};
+            m_vectors2 = {};
+            m_transforms = {};
+            m_results = {};
+            m_floatResults = {};
+            m_array1 = {};
+            m_array2 = {};
+            m_arrayResults = {};
+            m_transformArray = {};
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        bool m_ownsSystemAllocator = false;
+        std::vector<AZ::Vector3> m_vectors1;
+        std::vector<AZ::Vector3> m_vectors2;
+        std::vector<AZ::Transform> m_transforms;
+        std::vector<AZ::Vector3> m_results;
+        std::vector<float> m_floatResults;
+        AZ::Transform m_transform;
+        AZ::Vector3Array m_array1;
+        AZ::Vector3Array m_array2;
+        AZ::Vector3Array m_arrayResults;
+        AZ::TransformArray m_transformArray;
+    };
+
+    BENCHMARK_F(BM_MathVector3Array, TransformPoints_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_vectors1.size(); ++index)
+            {
+                m_results[index] = m_transform.TransformPoint(m_vectors1[index]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors1.size());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, TransformPoints_Batch)(benchmark::State& state)
+    {
+        state.SetLabel(AZ::Simd::IsAvx2Enabled() ? "AVX2" : "Vec4");
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_array1.TransformPoints(m_transform, m_arrayResults);
+            benchmark::DoNotOptimize(m_arrayResults.GetXData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_array1.GetSize());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, TransformPoints_BatchVec4)(benchmark::State& state)
+    {
+        // Baseline for TransformPoints_Batch on cpus with AVX2 support
+        AZ::Simd::SetAvx2Enabled(false);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_array1.TransformPoints(m_transform, m_arrayResults);
+            benchmark::DoNotOptimize(m_arrayResults.GetXData());
+        }
+        AZ::Simd::SetAvx2Enabled(true);
+        state.SetItemsProcessed(state.iterations() * m_array1.GetSize());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, TransformArrayTransformPoints_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_vectors1.size(); ++index)
+            {
+                m_results[index] = m_transforms[index].TransformPoint(m_vectors1[index]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors1.size());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, TransformArrayTransformPoints_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_transformArray.TransformPoints(m_array1, m_arrayResults);
+            benchmark::DoNotOptimize(m_arrayResults.GetXData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_array1.GetSize());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, Dot_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_vectors1.size(); ++index)
+            {
+                m_floatResults[index] = m_vectors1[index].Dot(m_vectors2[index]);
+            }
+            benchmark::DoNotOptimize(m_floatResults.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors1.size());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, Dot_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_array1.Dot(m_array2, m_floatResults.data());
+            benchmark::DoNotOptimize(m_floatResults.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_array1.GetSize());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, Cross_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_vectors1.size(); ++index)
+            {
+                m_results[index] = m_vectors1[index].Cross(m_vectors2[index]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors1.size());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, Cross_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_array1.Cross(m_array2, m_arrayResults);
+            benchmark::DoNotOptimize(m_arrayResults.GetXData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_array1.GetSize());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, NormalizeSafe_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_vectors1.size(); ++index)
+            {
+                m_results[index] = m_vectors1[index].GetNormalizedSafe();
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectors1.size());
+    }
+
+    BENCHMARK_F(BM_MathVector3Array, NormalizeSafe_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Normalizing is idempotent, so the same array can be normalized in place every iteration.
+            m_array1.NormalizeSafe();
+            benchmark::DoNotOptimize(m_array1.GetXData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_array1.GetSize());
+    }
+} // namespace Benchmark
+
+#endif
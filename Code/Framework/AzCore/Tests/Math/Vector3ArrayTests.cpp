@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3Array.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    // Sizes that are not a multiple of the SIMD width, so the padding in the last block is exercised.
+    static constexpr size_t TestArraySize = 4 * Vector3Array::LaneCount + 3;
+
+    static Vector3 CreateTestVector(size_t index)
+    {
+        const float value = static_cast<float>(index);
+        return Vector3(value * 0.5f - 3.0f, 2.0f - value * 0.25f, value * value * 0.125f);
+    }
+
+    static Vector3Array CreateTestArray(size_t size, size_t offset = 0)
+    {
+        Vector3Array result(size);
+        for (size_t index = 0; index < size; ++index)
+        {
+            result.SetElement(index, CreateTestVector(index + offset));
+        }
+        return result;
+    }
+
+    TEST(MATH_Vector3Array, TestResize)
+    {
+        Vector3Array vectors;
+        EXPECT_TRUE(vectors.IsEmpty());
+
+        vectors.Resize(TestArraySize);
+        EXPECT_EQ(vectors.GetSize(), TestArraySize);
+        EXPECT_EQ(vectors.GetBlockCount(), (TestArraySize + Vector3Array::LaneCount - 1) / Vector3Array::LaneCount);
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(vectors.GetElement(index), IsClose(Vector3::CreateZero()));
+        }
+
+        vectors.Clear();
+        EXPECT_TRUE(vectors.IsEmpty());
+        EXPECT_EQ(vectors.GetBlockCount(), 0);
+    }
+
+    TEST(MATH_Vector3Array, TestSetGetElement)
+    {
+        Vector3Array vectors = CreateTestArray(TestArraySize);
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(vectors.GetElement(index), IsClose(CreateTestVector(index)));
+            EXPECT_FLOAT_EQ(vectors.GetXData()[index], CreateTestVector(index).GetX());
+            EXPECT_FLOAT_EQ(vectors.GetYData()[index], CreateTestVector(index).GetY());
+            EXPECT_FLOAT_EQ(vectors.GetZData()[index], CreateTestVector(index).GetZ());
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestGrowAfterShrink_NewElementsAreZero)
+    {
+        Vector3Array vectors = CreateTestArray(TestArraySize);
+        vectors.Resize(1);
+        vectors.Resize(TestArraySize);
+        EXPECT_THAT(vectors.GetElement(0), IsClose(CreateTestVector(0)));
+        for (size_t index = 1; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(vectors.GetElement(index), IsClose(Vector3::CreateZero()));
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestPushBack)
+    {
+        Vector3Array vectors;
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            vectors.PushBack(CreateTestVector(index));
+        }
+        ASSERT_EQ(vectors.GetSize(), TestArraySize);
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(vectors.GetElement(index), IsClose(CreateTestVector(index)));
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestDot)
+    {
+        const Vector3Array lhs = CreateTestArray(TestArraySize);
+        const Vector3Array rhs = CreateTestArray(TestArraySize, 7);
+
+        AZStd::vector<float> results(TestArraySize);
+        lhs.Dot(rhs, results.data());
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_NEAR(results[index], CreateTestVector(index).Dot(CreateTestVector(index + 7)), 0.001f);
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestCross)
+    {
+        const Vector3Array lhs = CreateTestArray(TestArraySize);
+        const Vector3Array rhs = CreateTestArray(TestArraySize, 7);
+
+        Vector3Array results;
+        lhs.Cross(rhs, results);
+        ASSERT_EQ(results.GetSize(), TestArraySize);
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(results.GetElement(index), IsClose(CreateTestVector(index).Cross(CreateTestVector(index + 7))));
+        }
+
+        // The results may alias the inputs.
+        Vector3Array inPlace = lhs;
+        inPlace.Cross(rhs, inPlace);
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(inPlace.GetElement(index), IsClose(results.GetElement(index)));
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestNormalizeSafe)
+    {
+        Vector3Array vectors = CreateTestArray(TestArraySize);
+        vectors.SetElement(1, Vector3::CreateZero());
+        vectors.SetElement(2, Vector3(0.0001f, 0.0f, 0.0f));
+
+        Vector3Array normalized = vectors;
+        normalized.NormalizeSafe();
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(normalized.GetElement(index), IsClose(vectors.GetElement(index).GetNormalizedSafe()));
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestTransformPoints)
+    {
+        const Transform transform = Transform::CreateFromQuaternionAndTranslation(
+            Quaternion::CreateRotationZ(0.7f) * Quaternion::CreateRotationX(-1.1f), Vector3(3.0f, -4.0f, 5.0f)) *
+            Transform::CreateUniformScale(2.5f);
+        const Vector3Array points = CreateTestArray(TestArraySize);
+
+        Vector3Array results;
+        points.TransformPoints(transform, results);
+        ASSERT_EQ(results.GetSize(), TestArraySize);
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(results.GetElement(index), IsCloseTolerance(transform.TransformPoint(points.GetElement(index)), 0.001f));
+        }
+    }
+
+    TEST(MATH_Vector3Array, TestTransformPoints_Avx2MatchesVec4)
+    {
+        if (!Simd::IsAvx2Supported())
+        {
+            GTEST_SKIP() << "AVX2 is not supported on this cpu";
+        }
+
+        const Transform transform = Transform::CreateFromQuaternionAndTranslation(
+            Quaternion::CreateRotationY(0.3f), Vector3(-1.0f, 2.0f, 0.5f));
+        Vector3Array points = CreateTestArray(TestArraySize);
+
+        Simd::SetAvx2Enabled(false);
+        EXPECT_FALSE(Simd::IsAvx2Enabled());
+        Vector3Array vec4Results;
+        points.TransformPoints(transform, vec4Results);
+
+        Simd::SetAvx2Enabled(true);
+        EXPECT_TRUE(Simd::IsAvx2Enabled());
+        points.TransformPoints(transform, points);
+
+        for (size_t index = 0; index < TestArraySize; ++index)
+        {
+            EXPECT_THAT(points.GetElement(index), IsCloseTolerance(vec4Results.GetElement(index), 0.0001f));
+        }
+    }
+} // namespace UnitTest
@@ -9,6 +9,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/BestFitExternalMapAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/HeapSchema.h>
 #include <AzCore/Memory/HphaSchema.h>
 
@@ -23,6 +24,7 @@
 
 #include <AzCore/std/containers/intrusive_slist.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/chrono/clocks.h>
 
@@ -774,6 +776,48 @@ namespace UnitTest
         run();
     }
 
+    TEST_F(ThreadPoolAllocatorTest, CrossThreadDeAllocation_ElementsAreCachedAndReturnedToOwner)
+    {
+        IAllocator& poolAllocator = AllocatorInstance<ThreadPoolAllocator>::Get();
+
+        const size_t numAllocations = 1000;
+        AZStd::vector<void*> addresses(numAllocations, nullptr);
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            addresses[i] = poolAllocator.Allocate(32, 8);
+            EXPECT_NE(nullptr, addresses[i]);
+        }
+        EXPECT_EQ(numAllocations * 32, poolAllocator.NumAllocatedBytes());
+
+        AZStd::thread thread([&poolAllocator, &addresses]()
+        {
+            // make the thread use the pool so it gets its own caches
+            poolAllocator.DeAllocate(poolAllocator.Allocate(32, 8));
+
+            for (void* address : addresses)
+            {
+                poolAllocator.DeAllocate(address);
+            }
+
+            // elements freed by this thread are reused by this thread, even if they belong to pages of another thread
+            void* reused = poolAllocator.Allocate(32, 8);
+            EXPECT_NE(addresses.end(), AZStd::find(addresses.begin(), addresses.end(), reused));
+            poolAllocator.DeAllocate(reused);
+        });
+        thread.join();
+
+        // returns the elements handed back by the other thread to their pages
+        poolAllocator.GarbageCollect();
+        EXPECT_EQ(0, poolAllocator.NumAllocatedBytes());
+
+        if (poolAllocator.GetRecords())
+        {
+            poolAllocator.GetRecords()->lock();
+            EXPECT_EQ(0, poolAllocator.GetRecords()->GetMap().size());
+            poolAllocator.GetRecords()->unlock();
+        }
+    }
+
     class ThreadPoolAllocatorDynamicWithStaticPagesTest
         : public ThreadPoolAllocatorTest
     {
@@ -847,6 +891,82 @@ namespace UnitTest
         AllocatorInstance<SystemAllocator>::Destroy();
     }
 
+    TEST(FrameArenaAllocator, Test)
+    {
+        AllocatorInstance<SystemAllocator>::Create();
+
+        FrameArenaAllocator::Descriptor desc;
+        desc.m_pageSize = 4 * 1024;
+        AllocatorInstance<FrameArenaAllocator>::Create(desc);
+        FrameArenaAllocator& frameAlloc = static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get());
+
+        EXPECT_EQ(0, frameAlloc.NumAllocatedBytes());
+
+        // Allocations are linear and respect the requested alignment
+        char* first = reinterpret_cast<char*>(frameAlloc.Allocate(100, 8));
+        char* second = reinterpret_cast<char*>(frameAlloc.Allocate(100, 64));
+        EXPECT_NE(nullptr, first);
+        EXPECT_NE(nullptr, second);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) & 63);
+        EXPECT_LT(first, second);
+        memset(first, 0xaa, 100);
+        memset(second, 0xbb, 100);
+
+        // Only the most recent allocation can be resized or returned
+        EXPECT_EQ(0, frameAlloc.Resize(first, 200));
+        EXPECT_EQ(200, frameAlloc.Resize(second, 200));
+        frameAlloc.DeAllocate(second, 200);
+        void* third = frameAlloc.Allocate(100, 64);
+        EXPECT_EQ(second, third);
+
+        // Allocations larger than the page size get a page of their own
+        void* big = frameAlloc.Allocate(desc.m_pageSize * 4, 16);
+        EXPECT_NE(nullptr, big);
+        memset(big, 0xcc, desc.m_pageSize * 4);
+        EXPECT_GE(frameAlloc.Capacity(), desc.m_pageSize * 5);
+
+        // Resetting the frame releases everything at once and the pages are reused
+        const size_t capacity = frameAlloc.Capacity();
+        frameAlloc.ResetFrame();
+        EXPECT_EQ(0, frameAlloc.NumAllocatedBytes());
+        EXPECT_EQ(first, frameAlloc.Allocate(100, 8));
+        EXPECT_EQ(capacity, frameAlloc.Capacity());
+
+        // Each thread allocates from its own pages
+        constexpr int numThreads = 4;
+        void* threadAllocations[numThreads] = {};
+        AZStd::thread threads[numThreads];
+        for (int i = 0; i < numThreads; ++i)
+        {
+            threads[i] = AZStd::thread([&frameAlloc, &threadAllocations, i]()
+            {
+                threadAllocations[i] = frameAlloc.Allocate(1024, 16);
+                memset(threadAllocations[i], i, 1024);
+            });
+        }
+        for (int i = 0; i < numThreads; ++i)
+        {
+            threads[i].join();
+            EXPECT_NE(nullptr, threadAllocations[i]);
+            EXPECT_EQ(i, reinterpret_cast<char*>(threadAllocations[i])[1023]);
+        }
+        EXPECT_GE(frameAlloc.NumAllocatedBytes(), numThreads * 1024 + 100);
+
+        // The AZStd allocator wrapper can be used for transient containers
+        {
+            AZStd::vector<int, FrameArenaStdAllocator> transient;
+            for (int i = 0; i < 1000; ++i)
+            {
+                transient.push_back(i);
+            }
+            EXPECT_EQ(999, transient.back());
+        }
+
+        frameAlloc.ResetFrame();
+        AllocatorInstance<FrameArenaAllocator>::Destroy();
+        AllocatorInstance<SystemAllocator>::Destroy();
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
@@ -12,10 +12,12 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Memory/BestFitExternalMapAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/HeapSchema.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/Memory/MallocSchema.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/PoolSchema.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/array.h>
@@ -195,6 +197,18 @@ namespace Benchmark
         }
     };
 
+    // Thread safe pool with its own thread local storage, so the global ThreadPoolAllocator doesn't affect the benchmark
+    class TestThreadPoolAllocator : public AZ::ThreadPoolBase<TestThreadPoolAllocator>
+    {
+    public:
+        AZ_TYPE_INFO(TestThreadPoolAllocator, "{7C0A5E0B-2F7D-4B0E-9C1B-8E4D2A6F3B51}");
+
+        TestThreadPoolAllocator()
+            : AZ::ThreadPoolBase<TestThreadPoolAllocator>("TestThreadPoolAllocator", "")
+        {
+        }
+    };
+
     // Allocated bytes reported by the allocator
     static const char* s_counterAllocatorMemory = "Allocator_Memory";
 
@@ -372,6 +386,97 @@ namespace Benchmark
         }
     };
 
+    /// <summary>
+    /// Simulates the per frame churn of transient data (view work lists, debug draw queues, etc.): every iteration is a
+    /// frame that allocates a batch of short lived blocks which are all released at the end of the frame. General purpose
+    /// allocators free every block individually, the frame arena releases everything at once.
+    /// </summary>
+    template <typename TAllocator, AllocationSize TAllocationSize>
+    class FrameChurnBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+        using TestAllocatorType = typename base::TestAllocatorType;
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            AZStd::vector<void*>& perThreadAllocations = base::GetPerThreadAllocations(state.thread_index);
+            const size_t numberOfAllocations = perThreadAllocations.size();
+            const AllocationSizeArray& allocationArray = s_allocationSizes[TAllocationSize];
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    perThreadAllocations[allocationIndex] = TestAllocatorType::Allocate(allocationSize, 0);
+                }
+
+                // End of the frame
+                if constexpr (AZStd::is_same_v<TAllocator, AZ::FrameArenaAllocator>)
+                {
+                    static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get()).ResetFrame();
+                }
+                else
+                {
+                    for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                    {
+                        const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                        TestAllocatorType::DeAllocate(perThreadAllocations[allocationIndex], allocationSize);
+                    }
+                }
+            }
+
+            state.counters[s_counterAllocatorMemory] = benchmark::Counter(static_cast<double>(TestAllocatorType::NumAllocatedBytes()), benchmark::Counter::kDefaults);
+            state.SetItemsProcessed(state.iterations() * numberOfAllocations);
+        }
+    };
+
+    /// <summary>
+    /// Simulates small object churn (EBus handlers, AZStd::function storage, job objects, etc.) from several threads at once:
+    /// every iteration each thread allocates a batch of small blocks and releases them again in a different order.
+    /// Reports the allocation throughput per thread count.
+    /// </summary>
+    template <typename TAllocator>
+    class SmallObjectChurnBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+        using TestAllocatorType = typename base::TestAllocatorType;
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            AZStd::vector<void*>& perThreadAllocations = base::GetPerThreadAllocations(state.thread_index);
+            const size_t numberOfAllocations = perThreadAllocations.size();
+            const AllocationSizeArray& allocationArray = s_allocationSizes[SMALL];
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    perThreadAllocations[allocationIndex] = TestAllocatorType::Allocate(allocationSize, 0);
+                }
+
+                // release every other block first, then the rest, so the free lists don't come back in allocation order
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; allocationIndex += 2)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    TestAllocatorType::DeAllocate(perThreadAllocations[allocationIndex], allocationSize);
+                }
+                for (size_t allocationIndex = 1; allocationIndex < numberOfAllocations; allocationIndex += 2)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    TestAllocatorType::DeAllocate(perThreadAllocations[allocationIndex], allocationSize);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * numberOfAllocations);
+        }
+    };
+
     template<typename TAllocator>
     class RecordedAllocationBenchmarkFixture : public ::benchmark::Fixture
     {
@@ -580,6 +685,24 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(MallocSchemaAllocator, MallocSchemaAllocator);
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
+
+    // Per frame churn patterns, comparing the frame arena against the general purpose allocators
+    namespace BM_FrameChurn
+    {
+        BM_REGISTER_TEMPLATE(FrameChurnBenchmarkFixture, SystemAllocator_SMALL, TestSystemAllocator, SMALL)->Apply(RunRanges);
+        BM_REGISTER_TEMPLATE(FrameChurnBenchmarkFixture, SystemAllocator_MIXED, TestSystemAllocator, MIXED)->Apply(RunRanges);
+        BM_REGISTER_TEMPLATE(FrameChurnBenchmarkFixture, HphaSchemaAllocator_SMALL, HphaSchemaAllocator, SMALL)->Apply(RunRanges);
+        BM_REGISTER_TEMPLATE(FrameChurnBenchmarkFixture, FrameArenaAllocator_SMALL, AZ::FrameArenaAllocator, SMALL)->Apply(RunRanges);
+        BM_REGISTER_TEMPLATE(FrameChurnBenchmarkFixture, FrameArenaAllocator_MIXED, AZ::FrameArenaAllocator, MIXED)->Apply(RunRanges);
+    }
+
+    // Small object throughput from 1 to MaxThreadRange threads, comparing the thread pool against the general purpose allocators
+    namespace BM_SmallObjectChurn
+    {
+        BM_REGISTER_TEMPLATE(SmallObjectChurnBenchmarkFixture, SystemAllocator, TestSystemAllocator)->Arg(1000)->ThreadRange(1, MaxThreadRange)->UseRealTime();
+        BM_REGISTER_TEMPLATE(SmallObjectChurnBenchmarkFixture, HphaSchemaAllocator, HphaSchemaAllocator)->Arg(1000)->ThreadRange(1, MaxThreadRange)->UseRealTime();
+        BM_REGISTER_TEMPLATE(SmallObjectChurnBenchmarkFixture, ThreadPoolAllocator, TestThreadPoolAllocator)->Arg(1000)->ThreadRange(1, MaxThreadRange)->UseRealTime();
+    }
     
     //BM_REGISTER_ALLOCATOR(BestFitExternalMapAllocator, BestFitExternalMapAllocator); // Requires to pre-allocate blocks and cannot work as a general-purpose allocator
     //BM_REGISTER_ALLOCATOR(HeapSchemaAllocator, TestHeapSchemaAllocator); // Requires to pre-allocate blocks and cannot work as a general-purpose allocator
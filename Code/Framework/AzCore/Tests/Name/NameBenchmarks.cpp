@@ -9,6 +9,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ::NameBenchmarks
 {
@@ -176,4 +177,161 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    //! Fixture for benchmarks that run on multiple threads. Only the first thread sets up and tears down the
+    //! allocators and the dictionary, the other threads wait for it before entering the benchmark loop.
+    class NameMultiThreadedBenchmarkFixture : public NameBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 1000;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                NameBenchmarkFixture::SetUp(st);
+                CreateNamePool();
+            }
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                NameBenchmarkFixture::SetUp(st);
+                CreateNamePool();
+            }
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                DestroyNamePool();
+                NameBenchmarkFixture::TearDown(st);
+            }
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            if (st.thread_index == 0)
+            {
+                DestroyNamePool();
+                NameBenchmarkFixture::TearDown(st);
+            }
+        }
+
+    protected:
+        void CreateNamePool()
+        {
+            m_existingNames.reserve(PoolSize);
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                m_existingNames.emplace_back(AZStd::string::format("shared_name%zu", i));
+            }
+        }
+
+        void DestroyNamePool()
+        {
+            m_existingNames = {};
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_CreateNameCacheHit)(::benchmark::State& state)
+    {
+        // All threads resolve the same set of names that are already in the dictionary.
+        const size_t offset = state.thread_index * (PoolSize / 8);
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(m_existingNames[(i + offset) % PoolSize].GetStringView()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_CreateNameCacheHit)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_FindNameByHash)(::benchmark::State& state)
+    {
+        AZ::NameDictionary& dictionary = AZ::NameDictionary::Instance();
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(dictionary.FindName(m_existingNames[i].GetHash()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_FindNameByHash)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_CreateAndDestroyUniqueNames)(::benchmark::State& state)
+    {
+        // Every thread interns and releases its own names, so each iteration inserts into and removes from the dictionary.
+        constexpr size_t namesPerThread = 100;
+        AZStd::vector<AZStd::string> namesToCreate;
+        for (size_t i = 0; i < namesPerThread; ++i)
+        {
+            namesToCreate.emplace_back(AZStd::string::format("thread%d_name%zu", state.thread_index, i));
+        }
+
+        AZStd::vector<AZ::Name> names;
+        names.resize(namesPerThread);
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < namesPerThread; ++i)
+            {
+                names[i] = AZ::Name(namesToCreate[i]);
+            }
+            for (size_t i = 0; i < namesPerThread; ++i)
+            {
+                names[i] = AZ::Name();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * namesPerThread);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_CreateAndDestroyUniqueNames)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_CreateNameMixedHitAndMiss)(::benchmark::State& state)
+    {
+        // Mostly lookups of existing names with an occasional new name, which is the typical pattern during asset loading.
+        constexpr size_t newNameInterval = 16;
+        AZStd::vector<AZStd::string> newNames;
+        for (size_t i = 0; i < PoolSize / newNameInterval; ++i)
+        {
+            newNames.emplace_back(AZStd::string::format("thread%d_new_name%zu", state.thread_index, i));
+        }
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                if (i % newNameInterval == 0)
+                {
+                    benchmark::DoNotOptimize(AZ::Name(newNames[i / newNameInterval]));
+                }
+                else
+                {
+                    benchmark::DoNotOptimize(AZ::Name(m_existingNames[i].GetStringView()));
+                }
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameMultiThreadedBenchmarkFixture, MultiThreaded_CreateNameMixedHitAndMiss)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
 } // namespace AZ::NameBenchmarks
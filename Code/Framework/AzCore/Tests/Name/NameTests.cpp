@@ -50,9 +50,16 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            // Collect the entries of all shards.
+            AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> dictionary;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+                dictionary.insert(shard.m_dictionary.begin(), shard.m_dictionary.end());
+            }
+            return dictionary;
         }
         
         static size_t GetEntryCount()
@@ -73,7 +80,7 @@ namespace UnitTest
                     break;
                 }
             }
-            return GetDictionary().size() - staticNameCount;
+            return AZ::NameDictionary::Instance().GetEntryCount() - staticNameCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -298,7 +305,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
+            const auto globalDictionary = NameDictionaryTester::GetDictionary();
             auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
                 return entry.second->GetName() == nameString;
             });
@@ -438,6 +445,29 @@ namespace UnitTest
         }
     }
 
+    TEST_F(NameTest, NameConstructFromHash_NameReleasedAndRecreated_LookupDoesNotReturnReleasedEntry)
+    {
+        constexpr AZStd::string_view nameString = "released name";
+
+        AZ::Name::Hash hash;
+        {
+            AZ::Name name{ nameString };
+            hash = name.GetHash();
+
+            // Resolve by hash and by string so the entry is cached in the dictionary's lookup table.
+            EXPECT_EQ(nameString, AZ::Name{ hash }.GetStringView());
+            EXPECT_EQ(name, AZ::Name{ nameString });
+        }
+
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+        EXPECT_TRUE(AZ::Name{ hash }.IsEmpty());
+
+        AZ::Name recreatedName{ nameString };
+        EXPECT_EQ(hash, recreatedName.GetHash());
+        EXPECT_EQ(recreatedName, AZ::Name{ hash });
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
     TEST_F(NameTest, NameComparisonTest)
     {
         AZ::Name a{"a"};
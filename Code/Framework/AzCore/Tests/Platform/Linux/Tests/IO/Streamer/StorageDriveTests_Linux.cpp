@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestMaxIOChannels = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr bool TestEnableDirectReads = false;
+    constexpr bool HasSeekPenalty = false;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableDirectReads = TestEnableDirectReads;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestMaxIOChannels, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        // Data...
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+
+        // Methods...
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetupStorageDrive(bool enableDirectReads)
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            ASSERT_FALSE(m_dummyFilepath.empty());
+
+            m_configurationOptions.m_hasSeekPenalty = HasSeekPenalty;
+            m_configurationOptions.m_enableDirectReads = enableDirectReads;
+            m_configurationOptions.m_minimalReporting = true;
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestMaxIOChannels, TestOverCommit, m_configurationOptions);
+            m_storageDriveLinux->SetContext(*m_context);
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            SetupStorageDrive(TestEnableDirectReads);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            RemoveDummyFiles();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            using namespace AZ::IO;
+
+            SystemFile file;
+            bool fileCreated = file.Open(m_dummyFilepath.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+
+            ASSERT_TRUE(fileCreated);
+
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void RemoveDummyFiles()
+        {
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        void ReadWholeFile(size_t fileSize)
+        {
+            char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+            CreateDummyFile(fileSize, 0, true);
+
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+            request->SetCompletionCallback([](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                });
+            m_storageDriveLinux->QueueRequest(request);
+
+            WaitTillCompleted();
+
+            EXPECT_EQ(buffer[0], s_beginCharacter);
+            EXPECT_EQ(buffer[1], s_fileCharacter);
+            EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+            EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+
+            azfree(buffer);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+            // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, IsIdle_NoRequestsQueued_DriveIsIdleAndReportsSlots)
+    {
+        StreamStackEntry::Status status;
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_TRUE(status.m_isIdle);
+        EXPECT_EQ(static_cast<s32>(TestMaxIOChannels) + TestOverCommit, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_FileFoundReported)
+    {
+        CreateDummyFile(1_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& check = AZStd::get<AZ::IO::Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_TRUE(check.m_found);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_FileNotFoundReported)
+    {
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& check = AZStd::get<AZ::IO::Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_FALSE(check.m_found);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_FileSizeReported)
+    {
+        constexpr size_t fileSize = 3_kib;
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([fileSize](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                auto& meta = AZStd::get<AZ::IO::Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(meta.m_found);
+                EXPECT_EQ(meta.m_fileSize, fileSize);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_StorageDriveHandledRequest)
+    {
+        ReadWholeFile(16_kib);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_DirectReads_StorageDriveHandledRequest)
+    {
+        SetupStorageDrive(true);
+        ReadWholeFile(16_kib);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_DirectReadsUnalignedOffset_ReturnsCorrectData)
+    {
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+        constexpr char unexpectedChar = 'Z';
+
+        SetupStorageDrive(true);
+
+        // Give the destination buffer a few extra bytes and mark the first one to make sure nothing past the
+        // requested size is written.
+        char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestPhysicalSectorSize));
+        buffer[unalignedSize] = unexpectedChar;
+
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReads_DataIsCorrect)
+    {
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = 5;
+        static_assert(numChunks > 1, "Number of chunks for this test need to be 2 or more!");
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([i](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    auto& readRequest = AZStd::get<AZ::IO::Requests::ReadData>(request.GetCommand());
+                    EXPECT_EQ(readRequest.m_offset, i * chunkSize);
+                });
+            m_storageDriveLinux->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_RequestIsForwarded)
+    {
+        constexpr AZ::u64 readSize = TestPhysicalSectorSize;
+        char buffer[readSize];
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        AZ::IO::RequestPath path{ AZ::IO::PathView{ m_dummyFilepath + "/Broken/Path.txt" } };
+
+        request->CreateRead(nullptr, buffer, readSize, path, 0, readSize);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_AfterRead_StatisticsAreReported)
+    {
+        ReadWholeFile(16_kib);
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+} // namespace AZ::IO
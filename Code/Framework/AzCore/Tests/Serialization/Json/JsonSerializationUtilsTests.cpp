@@ -6,6 +6,8 @@
  *
  */
 
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/TextStreamReaders.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
@@ -13,6 +15,10 @@
 
 #include <AzTest/AzTest.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 #include <AzCore/Serialization/Json/JsonUtils.h>
 
 namespace UnitTest
@@ -92,6 +98,93 @@ namespace UnitTest
         };
     }
 
+    namespace Test3
+    {
+        // Classes shaped like a prefab, with nested classes and containers
+        class EntityData
+        {
+        public:
+            AZ_TYPE_INFO(EntityData, "{5F0E07C4-0C5B-4A1C-9E43-2B4B7D3E8A61}");
+            static void Reflect(AZ::ReflectContext* context)
+            {
+                if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+                {
+                    serializeContext->Class<EntityData>()
+                        ->Version(1)
+                        ->Field("Id", &EntityData::m_id)
+                        ->Field("Name", &EntityData::m_name)
+                        ->Field("Translate", &EntityData::m_translate)
+                        ->Field("Tags", &EntityData::m_tags)
+                        ;
+                }
+            }
+
+            AZ::u64 m_id = 0;
+            AZStd::string m_name;
+            AZStd::vector<float> m_translate;
+            AZStd::vector<AZStd::string> m_tags;
+
+            bool operator==(const EntityData& other) const
+            {
+                return m_id == other.m_id
+                    && m_name == other.m_name
+                    && m_translate == other.m_translate
+                    && m_tags == other.m_tags
+                    ;
+            }
+        };
+
+        class PrefabData
+        {
+        public:
+            AZ_TYPE_INFO(PrefabData, "{B7A3D5E2-6C1F-4F8A-8D29-4E6C0A1B9F37}");
+            static void Reflect(AZ::ReflectContext* context)
+            {
+                if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+                {
+                    serializeContext->Class<PrefabData>()
+                        ->Version(1)
+                        ->Field("Name", &PrefabData::m_name)
+                        ->Field("Root", &PrefabData::m_root)
+                        ->Field("Entities", &PrefabData::m_entities)
+                        ->Field("Links", &PrefabData::m_links)
+                        ;
+                }
+            }
+
+            static PrefabData Create(int numEntities)
+            {
+                PrefabData prefab;
+                prefab.m_name = "Prefab";
+                prefab.m_root.m_name = "Root";
+                for (int i = 0; i < numEntities; ++i)
+                {
+                    EntityData& entity = prefab.m_entities.emplace_back();
+                    entity.m_id = static_cast<AZ::u64>(i) * 7919;
+                    entity.m_name = AZStd::string::format("Entity_%i", i);
+                    entity.m_translate = { i * 0.5f, i * 0.25f, -i * 0.125f };
+                    entity.m_tags = { "Static", entity.m_name };
+                    prefab.m_links.push_back({ i, i + 1 });
+                }
+                return prefab;
+            }
+
+            AZStd::string m_name;
+            EntityData m_root;
+            AZStd::vector<EntityData> m_entities;
+            AZStd::vector<AZStd::vector<int>> m_links;
+
+            bool operator==(const PrefabData& other) const
+            {
+                return m_name == other.m_name
+                    && m_root == other.m_root
+                    && m_entities == other.m_entities
+                    && m_links == other.m_links
+                    ;
+            }
+        };
+    }
+
     class JsonSerializationUtilsTests
         : public AllocatorsTestFixture
     {
@@ -113,6 +206,8 @@ namespace UnitTest
             m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
             Test1::TestClass::Reflect(m_serializeContext.get());
             Test2::TestClass::Reflect(m_serializeContext.get());
+            Test3::EntityData::Reflect(m_serializeContext.get());
+            Test3::PrefabData::Reflect(m_serializeContext.get());
         }
 
         void TearDown() override
@@ -124,6 +219,8 @@ namespace UnitTest
             m_serializeContext->EnableRemoveReflection(); 
             Test1::TestClass::Reflect(m_serializeContext.get());
             Test2::TestClass::Reflect(m_serializeContext.get());
+            Test3::EntityData::Reflect(m_serializeContext.get());
+            Test3::PrefabData::Reflect(m_serializeContext.get());
             m_serializeContext->DisableRemoveReflection();
 
             m_jsonRegistrationContext.reset();
@@ -212,6 +309,204 @@ namespace UnitTest
         // Unfortunately we can't unit test WriteJsonFile because core unit tests don't have access to the local file IO system.
     }
 
+    //! Stream that accepts a limited number of bytes and then reports short writes, like a full disk.
+    class ShortWriteStream
+        : public IO::GenericStream
+    {
+    public:
+        explicit ShortWriteStream(IO::SizeType capacity)
+            : m_capacity(capacity)
+        {
+        }
+
+        bool IsOpen() const override { return true; }
+        bool CanSeek() const override { return false; }
+        bool CanRead() const override { return false; }
+        bool CanWrite() const override { return true; }
+        void Seek(IO::OffsetType, SeekMode) override {}
+        IO::SizeType Read(IO::SizeType, void*) override { return 0; }
+        IO::SizeType Write(IO::SizeType bytes, const void*) override
+        {
+            const IO::SizeType written = AZStd::min(bytes, m_capacity - m_length);
+            m_length += written;
+            return written;
+        }
+        IO::SizeType GetCurPos() const override { return m_length; }
+        IO::SizeType GetLength() const override { return m_length; }
+
+        IO::SizeType m_capacity;
+        IO::SizeType m_length = 0;
+    };
+
+    TEST_F(JsonSerializationUtilsTests, WriteJsonStream_ShortWrite_Fails)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        document.AddMember("a", 1, document.GetAllocator());
+
+        ShortWriteStream stream(4);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::Outcome<void, AZStd::string> result = JsonSerializationUtils::WriteJsonStream(document, stream);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_FALSE(result.IsSuccess());
+        EXPECT_EQ(stream.GetLength(), 4);
+    }
+
+    TEST_F(JsonSerializationUtilsTests, SaveObjectToStream_ShortWrite_Fails)
+    {
+        Test1::TestClass dataToSave;
+        dataToSave.Init();
+
+        ShortWriteStream stream(16);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        Outcome<void, AZStd::string> saveResult =
+            JsonSerializationUtils::SaveObjectToStream(&dataToSave, stream, (Test1::TestClass*)nullptr, &m_serializationSettings);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_FALSE(saveResult.IsSuccess());
+    }
+
+    TEST_F(JsonSerializationUtilsTests, SaveObjectToStream_MatchesStoreToDocument)
+    {
+        const Test3::PrefabData defaultPrefab = Test3::PrefabData::Create(2);
+        Test3::PrefabData prefab = Test3::PrefabData::Create(3);
+        prefab.m_entities[1].m_tags.clear();
+        prefab.m_links.emplace_back();
+
+        for (bool keepDefaults : { false, true })
+        {
+            for (const Test3::PrefabData* defaultObject : { static_cast<const Test3::PrefabData*>(nullptr), &defaultPrefab })
+            {
+                m_serializationSettings.m_keepDefaults = keepDefaults;
+
+                // Store to a document and write it out, like SaveObjectToStream did before it streamed the object.
+                rapidjson::Document document;
+                document.SetObject();
+                rapidjson::Value classData;
+                JsonSerialization::Store(classData, document.GetAllocator(), &prefab, defaultObject,
+                    azrtti_typeid<Test3::PrefabData>(), m_serializationSettings);
+                document.AddMember("Type", "JsonSerialization", document.GetAllocator());
+                document.AddMember("Version", 1, document.GetAllocator());
+                document.AddMember("ClassName", "PrefabData", document.GetAllocator());
+                document.AddMember("ClassData", AZStd::move(classData), document.GetAllocator());
+                AZStd::string expectedJsonText;
+                ASSERT_TRUE(JsonSerializationUtils::WriteJsonString(document, expectedJsonText).IsSuccess());
+
+                AZStd::string jsonText;
+                IO::ByteContainerStream<AZStd::string> stream(&jsonText);
+                Outcome<void, AZStd::string> saveResult =
+                    JsonSerializationUtils::SaveObjectToStream(&prefab, stream, defaultObject, &m_serializationSettings);
+                ASSERT_TRUE(saveResult.IsSuccess());
+                EXPECT_STREQ(expectedJsonText.c_str(), jsonText.c_str());
+            }
+        }
+    }
+
+    TEST_F(JsonSerializationUtilsTests, SaveLoadObjectToStream_NestedObject_Success)
+    {
+        Test3::PrefabData dataToSave = Test3::PrefabData::Create(3);
+        dataToSave.m_entities[1].m_tags.clear();
+        dataToSave.m_links.emplace_back();
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        Outcome<void, AZStd::string> saveResult =
+            JsonSerializationUtils::SaveObjectToStream(&dataToSave, stream, (Test3::PrefabData*)nullptr, &m_serializationSettings);
+        ASSERT_TRUE(saveResult.IsSuccess());
+
+        // Start from different data to make sure the containers are cleared before they're loaded.
+        Test3::PrefabData loadedData = Test3::PrefabData::Create(5);
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        Outcome<void, AZStd::string> loadResult = JsonSerializationUtils::LoadObjectFromStream(loadedData, stream, &m_deserializationSettings);
+
+        EXPECT_TRUE(loadResult.IsSuccess());
+        EXPECT_TRUE(dataToSave == loadedData);
+    }
+
+    TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_ClassDataBeforeHeader_Success)
+    {
+        char buffer[1024] =
+            "{                                                   "
+            "    \"ClassData\" : { \"int\": 10, \"vector\": [\"a\"] },"
+            "    \"ClassName\": \"TestClass\",                   "
+            "    \"Type\": \"JsonSerialization\"                 "
+            "}                                                   ";
+        IO::MemoryStream stream(buffer, strlen(buffer));
+
+        Test1::TestClass loadedData;
+        Outcome<void, AZStd::string> loadResult = JsonSerializationUtils::LoadObjectFromStream(loadedData, stream, &m_deserializationSettings);
+
+        EXPECT_TRUE(loadResult.IsSuccess());
+        EXPECT_EQ(10, loadedData.m_int);
+        ASSERT_EQ(1, loadedData.m_vector.size());
+        EXPECT_STREQ("a", loadedData.m_vector[0].c_str());
+    }
+
+    //! Stream that returns a limited number of bytes while reporting a larger length, like a file that fails to be read.
+    class ShortReadStream
+        : public IO::GenericStream
+    {
+    public:
+        ShortReadStream(const char* data, IO::SizeType readableBytes, IO::SizeType length)
+            : m_data(data)
+            , m_readableBytes(readableBytes)
+            , m_length(length)
+        {
+        }
+
+        bool IsOpen() const override { return true; }
+        bool CanSeek() const override { return false; }
+        bool CanRead() const override { return true; }
+        bool CanWrite() const override { return false; }
+        void Seek(IO::OffsetType, SeekMode) override {}
+        IO::SizeType Read(IO::SizeType bytes, void* oBuffer) override
+        {
+            const IO::SizeType read = AZStd::min(bytes, m_readableBytes - m_position);
+            memcpy(oBuffer, m_data + m_position, static_cast<size_t>(read));
+            m_position += read;
+            return read;
+        }
+        IO::SizeType Write(IO::SizeType, const void*) override { return 0; }
+        IO::SizeType GetCurPos() const override { return m_position; }
+        IO::SizeType GetLength() const override { return m_length; }
+
+        const char* m_data;
+        IO::SizeType m_readableBytes;
+        IO::SizeType m_length;
+        IO::SizeType m_position = 0;
+    };
+
+    TEST_F(JsonSerializationUtilsTests, ReadJsonStream_ShortRead_Fails)
+    {
+        const char* jsonText = R"({ "a": 1, "b": 2 })";
+        ShortReadStream stream(jsonText, 8, strlen(jsonText));
+
+        auto result = JsonSerializationUtils::ReadJsonStream(stream);
+        ASSERT_FALSE(result.IsSuccess());
+        EXPECT_STREQ("Cannot to read input stream.", result.GetError().c_str());
+    }
+
+    TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_ShortRead_Fails)
+    {
+        Test1::TestClass dataToSave;
+        dataToSave.Init();
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(JsonSerializationUtils::SaveObjectToStream(
+            &dataToSave, saveStream, (Test1::TestClass*)nullptr, &m_serializationSettings).IsSuccess());
+
+        // Cut the text off right after an element of the vector, where the json parsed so far is still valid.
+        AZStd::string_view jsonText(buffer.data(), buffer.size());
+        ShortReadStream stream(buffer.data(), jsonText.find("\"anything\"") + strlen("\"anything\","), buffer.size());
+
+        Test1::TestClass loadedData;
+        Outcome<void, AZStd::string> loadResult = JsonSerializationUtils::LoadObjectFromStream(loadedData, stream, &m_deserializationSettings);
+        ASSERT_FALSE(loadResult.IsSuccess());
+        EXPECT_STREQ("Cannot to read input stream.", loadResult.GetError().c_str());
+    }
+
     TEST_F(JsonSerializationUtilsTests, ReadJsonString)
     {
         const char* jsonText =
@@ -294,6 +589,89 @@ namespace UnitTest
         EXPECT_TRUE(result.GetError().find("JSON parse error at line 5:") == 0);
     }
     
+    TEST_F(JsonSerializationUtilsTests, RapidJSONStreamReader_SmallReadCache_ParsesAcrossBlocks)
+    {
+        const char* jsonText =
+            R"(
+            {
+                // Comments are allowed.
+                "a": 1,
+                "b": [ "two", 2.5, true, null ],
+                "c": { "d": "three" }
+            })";
+
+        IO::MemoryStream stream(jsonText, strlen(jsonText));
+        // Use a cache smaller than most tokens so every token is split between reads from the stream.
+        IO::RapidJSONStreamReader reader(&stream, 3);
+
+        rapidjson::Document document;
+        document.ParseStream<rapidjson::kParseCommentsFlag>(reader);
+
+        ASSERT_FALSE(document.HasParseError());
+        EXPECT_EQ(reader.Tell(), strlen(jsonText));
+        EXPECT_EQ(document["a"].GetInt(), 1);
+        ASSERT_TRUE(document["b"].IsArray());
+        ASSERT_EQ(document["b"].Size(), 4);
+        EXPECT_STREQ(document["b"][0].GetString(), "two");
+        EXPECT_DOUBLE_EQ(document["b"][1].GetDouble(), 2.5);
+        EXPECT_TRUE(document["b"][2].GetBool());
+        EXPECT_TRUE(document["b"][3].IsNull());
+        EXPECT_STREQ(document["c"]["d"].GetString(), "three");
+    }
+
+    TEST_F(JsonSerializationUtilsTests, RapidJSONStreamReader_NullCharacter_StopsReading)
+    {
+        char buffer[64] = "[1, 2]";
+        IO::MemoryStream stream(buffer, sizeof(buffer));
+        IO::RapidJSONStreamReader reader(&stream, 4);
+
+        rapidjson::Document document;
+        document.ParseStream(reader);
+
+        ASSERT_FALSE(document.HasParseError());
+        ASSERT_TRUE(document.IsArray());
+        EXPECT_EQ(document.Size(), 2);
+    }
+
+    TEST_F(JsonSerializationUtilsTests, RapidJSONStreamReader_ParseError_ReportsLineNumber)
+    {
+        const char* jsonText = "{\n\"a\": 1,\n\"b\": 2\n\"c\": 3\n}";
+
+        IO::MemoryStream stream(jsonText, strlen(jsonText));
+        IO::RapidJSONStreamReader reader(&stream, 1);
+
+        rapidjson::Document document;
+        document.ParseStream(reader);
+
+        EXPECT_TRUE(document.HasParseError());
+        EXPECT_EQ(reader.GetLineNumber(), 4);
+    }
+
+    TEST_F(JsonSerializationUtilsTests, SaveLoadObjectToStream_LargeObject_Success)
+    {
+        // Larger than the read and write caches so the text is streamed in multiple blocks in both directions.
+        Test1::TestClass dataToSave;
+        dataToSave.Init();
+        for (int i = 0; i < 20000; ++i)
+        {
+            dataToSave.m_vector.push_back(AZStd::string::format("Element %i", i));
+        }
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        Outcome<void, AZStd::string> saveResult =
+            JsonSerializationUtils::SaveObjectToStream(&dataToSave, stream, (Test1::TestClass*)nullptr, &m_serializationSettings);
+        ASSERT_TRUE(saveResult.IsSuccess());
+        EXPECT_GT(buffer.size(), 256 * 1024);
+
+        Test1::TestClass loadedData;
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        Outcome<void, AZStd::string> loadResult = JsonSerializationUtils::LoadObjectFromStream(loadedData, stream, &m_deserializationSettings);
+
+        EXPECT_TRUE(loadResult.IsSuccess());
+        EXPECT_TRUE(dataToSave == loadedData);
+    }
+
     TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_Failed_ParseError)
     {
         char buffer[1024] = "Not a Json";
@@ -486,7 +864,363 @@ namespace UnitTest
 
         EXPECT_TRUE(!loadResult.IsSuccess());
     }
+} // namespace UnitTest
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Stream wrapper that samples the allocated bytes every time data is read or written.
+    class SamplingStream
+        : public AZ::IO::GenericStream
+    {
+    public:
+        explicit SamplingStream(AZ::IO::GenericStream* stream)
+            : m_stream(stream)
+            , m_baseline(AllocatedBytes())
+        {
+        }
 
-} // namespace UnitTest
+        static size_t AllocatedBytes()
+        {
+            return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        }
+
+        void Sample()
+        {
+            const size_t allocatedBytes = AllocatedBytes();
+            m_peakBytes = AZStd::max(m_peakBytes, allocatedBytes > m_baseline ? allocatedBytes - m_baseline : 0);
+        }
+
+        bool IsOpen() const override { return m_stream->IsOpen(); }
+        bool CanSeek() const override { return m_stream->CanSeek(); }
+        bool CanRead() const override { return m_stream->CanRead(); }
+        bool CanWrite() const override { return m_stream->CanWrite(); }
+        void Seek(AZ::IO::OffsetType bytes, SeekMode mode) override { m_stream->Seek(bytes, mode); }
+        AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override
+        {
+            Sample();
+            return m_stream->Read(bytes, oBuffer);
+        }
+        AZ::IO::SizeType Write(AZ::IO::SizeType bytes, const void* iBuffer) override
+        {
+            Sample();
+            return m_stream->Write(bytes, iBuffer);
+        }
+        AZ::IO::SizeType GetCurPos() const override { return m_stream->GetCurPos(); }
+        AZ::IO::SizeType GetLength() const override { return m_stream->GetLength(); }
+
+        AZ::IO::GenericStream* m_stream;
+        size_t m_baseline;
+        size_t m_peakBytes = 0;
+    };
+
+    //! Stream that only counts the bytes written to it, standing in for a file.
+    class NullStream
+        : public AZ::IO::GenericStream
+    {
+    public:
+        bool IsOpen() const override { return true; }
+        bool CanSeek() const override { return false; }
+        bool CanRead() const override { return false; }
+        bool CanWrite() const override { return true; }
+        void Seek(AZ::IO::OffsetType, SeekMode) override {}
+        AZ::IO::SizeType Read(AZ::IO::SizeType, void*) override { return 0; }
+        AZ::IO::SizeType Write(AZ::IO::SizeType bytes, const void*) override
+        {
+            m_length += bytes;
+            return bytes;
+        }
+        AZ::IO::SizeType GetCurPos() const override { return m_length; }
+        AZ::IO::SizeType GetLength() const override { return m_length; }
+
+        AZ::IO::SizeType m_length = 0;
+    };
+
+    //! Compares reading and writing json text through a fully materialized text buffer against streaming it in blocks, and
+    //! loading and storing objects through a json document against streaming them through the serializers. Besides the time, the peak number of bytes allocated from the SystemAllocator while a document is read or written
+    //! is reported. The peak is sampled every time the source or destination stream is accessed and once more while the
+    //! results are still alive.
+    class BM_JsonStreaming
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            // Roughly shaped like a prefab with a large number of entities.
+            m_document = AZStd::make_unique<rapidjson::Document>();
+            m_document->SetObject();
+            auto& allocator = m_document->GetAllocator();
+            rapidjson::Value entities(rapidjson::kObjectType);
+            for (int i = 0; i < NumEntities; ++i)
+            {
+                rapidjson::Value translate(rapidjson::kArrayType);
+                translate.PushBack(i * 0.5, allocator).PushBack(i * 0.25, allocator).PushBack(-i * 0.125, allocator);
+
+                rapidjson::Value transform(rapidjson::kObjectType);
+                transform.AddMember("$type", "EditorTransformComponent", allocator);
+                transform.AddMember("Id", static_cast<uint64_t>(i) * 7919, allocator);
+                transform.AddMember("Translate", AZStd::move(translate), allocator);
+
+                rapidjson::Value components(rapidjson::kObjectType);
+                components.AddMember("TransformComponent", AZStd::move(transform), allocator);
+
+                rapidjson::Value entity(rapidjson::kObjectType);
+                AZStd::string name = AZStd::string::format("Entity_%i", i);
+                entity.AddMember("Id", rapidjson::Value(name.c_str(), allocator), allocator);
+                entity.AddMember("Name", rapidjson::Value(name.c_str(), allocator), allocator);
+                entity.AddMember("Components", AZStd::move(components), allocator);
+
+                entities.AddMember(rapidjson::Value(name.c_str(), allocator), AZStd::move(entity), allocator);
+            }
+            m_document->AddMember("Entities", AZStd::move(entities), allocator);
+
+            AZ::JsonSerializationUtils::WriteJsonString(*m_document, m_jsonText);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent = AZStd::make_unique<AZ::JsonSystemComponent>();
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            UnitTest::Test3::EntityData::Reflect(m_serializeContext.get());
+            UnitTest::Test3::PrefabData::Reflect(m_serializeContext.get());
+
+            m_serializationSettings.m_serializeContext = m_serializeContext.get();
+            m_serializationSettings.m_registrationContext = m_jsonRegistrationContext.get();
+            m_deserializationSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializationSettings.m_registrationContext = m_jsonRegistrationContext.get();
+
+            m_prefab = AZStd::make_unique<UnitTest::Test3::PrefabData>(UnitTest::Test3::PrefabData::Create(NumEntities));
+            AZ::IO::ByteContainerStream<AZStd::string> prefabStream(&m_prefabJsonText);
+            AZ::JsonSerializationUtils::SaveObjectToStream(m_prefab.get(), prefabStream,
+                static_cast<const UnitTest::Test3::PrefabData*>(nullptr), &m_serializationSettings);
+        }
+
+        void internalTearDown()
+        {
+            m_prefabJsonText = AZStd::string();
+            m_prefab.reset();
+
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            m_serializeContext->EnableRemoveReflection();
+            UnitTest::Test3::EntityData::Reflect(m_serializeContext.get());
+            UnitTest::Test3::PrefabData::Reflect(m_serializeContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+            m_jsonSystemComponent.reset();
+
+            m_jsonText = AZStd::string();
+            m_document.reset();
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void ReportCounters(benchmark::State& state, size_t peakBytes)
+        {
+            ReportCounters(state, peakBytes, m_jsonText.size());
+        }
+
+        void ReportCounters(benchmark::State& state, size_t peakBytes, size_t jsonBytes)
+        {
+            state.SetBytesProcessed(state.iterations() * jsonBytes);
+            state.counters["JsonBytes"] = aznumeric_cast<double>(jsonBytes);
+            state.counters["PeakBytes"] = aznumeric_cast<double>(peakBytes);
+        }
+
+        static constexpr int NumEntities = 20000;
+
+        bool m_ownsSystemAllocator = false;
+        AZStd::unique_ptr<rapidjson::Document> m_document;
+        AZStd::string m_jsonText;
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZStd::unique_ptr<AZ::JsonSystemComponent> m_jsonSystemComponent;
+        AZ::JsonSerializerSettings m_serializationSettings;
+        AZ::JsonDeserializerSettings m_deserializationSettings;
+        AZStd::unique_ptr<UnitTest::Test3::PrefabData> m_prefab;
+        AZStd::string m_prefabJsonText;
+    };
+
+    BENCHMARK_F(BM_JsonStreaming, ReadFromTextBuffer)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream memoryStream(m_jsonText.data(), m_jsonText.size());
+            SamplingStream stream(&memoryStream);
+
+            // Reads the entire text into memory before parsing it, like ReadJsonStream used to.
+            AZStd::string buffer;
+            buffer.resize_no_construct(stream.GetLength());
+            stream.Read(buffer.size(), buffer.data());
+            auto result = AZ::JsonSerializationUtils::ReadJsonString(buffer);
+            stream.Sample();
+
+            benchmark::DoNotOptimize(result.GetValue().IsObject());
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes);
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, ReadStreaming)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream memoryStream(m_jsonText.data(), m_jsonText.size());
+            SamplingStream stream(&memoryStream);
+
+            auto result = AZ::JsonSerializationUtils::ReadJsonStream(stream);
+            stream.Sample();
+
+            benchmark::DoNotOptimize(result.GetValue().IsObject());
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes);
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, WriteToTextBuffer)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            NullStream nullStream;
+            SamplingStream stream(&nullStream);
 
+            // Writes the entire text into memory before writing it out, like WriteJsonFile used to.
+            AZStd::string buffer;
+            AZ::JsonSerializationUtils::WriteJsonString(*m_document, buffer);
+            stream.Write(buffer.size(), buffer.data());
+
+            benchmark::DoNotOptimize(nullStream.m_length);
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes);
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, WriteStreaming)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            NullStream nullStream;
+            SamplingStream stream(&nullStream);
+
+            AZ::JsonSerializationUtils::WriteJsonStream(*m_document, stream);
+
+            benchmark::DoNotOptimize(nullStream.m_length);
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes);
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, StoreToDocument)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            NullStream nullStream;
+            SamplingStream stream(&nullStream);
+
+            // Stores the entire object into a document before writing it out, like SaveObjectToStream used to.
+            rapidjson::Document document;
+            document.SetObject();
+            rapidjson::Value classData;
+            AZ::JsonSerialization::Store(classData, document.GetAllocator(), m_prefab.get(), nullptr,
+                azrtti_typeid<UnitTest::Test3::PrefabData>(), m_serializationSettings);
+            document.AddMember("Type", "JsonSerialization", document.GetAllocator());
+            document.AddMember("Version", 1, document.GetAllocator());
+            document.AddMember("ClassName", "PrefabData", document.GetAllocator());
+            document.AddMember("ClassData", AZStd::move(classData), document.GetAllocator());
+            AZ::JsonSerializationUtils::WriteJsonStream(document, stream);
+
+            benchmark::DoNotOptimize(nullStream.m_length);
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes, m_prefabJsonText.size());
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, StoreStreaming)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            NullStream nullStream;
+            SamplingStream stream(&nullStream);
+
+            AZ::JsonSerializationUtils::SaveObjectToStream(m_prefab.get(), stream,
+                static_cast<const UnitTest::Test3::PrefabData*>(nullptr), &m_serializationSettings);
+
+            benchmark::DoNotOptimize(nullStream.m_length);
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes, m_prefabJsonText.size());
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, LoadFromDocument)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream memoryStream(m_prefabJsonText.data(), m_prefabJsonText.size());
+            SamplingStream stream(&memoryStream);
+
+            // Parses the entire text into a document before loading the object from it, like LoadObjectFromStream used to.
+            UnitTest::Test3::PrefabData prefab;
+            auto document = AZ::JsonSerializationUtils::ReadJsonStream(stream);
+            AZ::JsonSerialization::Load(prefab, document.GetValue()["ClassData"], m_deserializationSettings);
+            stream.Sample();
+
+            benchmark::DoNotOptimize(prefab.m_entities.size());
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes, m_prefabJsonText.size());
+    }
+
+    BENCHMARK_F(BM_JsonStreaming, LoadStreaming)(benchmark::State& state)
+    {
+        size_t peakBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream memoryStream(m_prefabJsonText.data(), m_prefabJsonText.size());
+            SamplingStream stream(&memoryStream);
+
+            UnitTest::Test3::PrefabData prefab;
+            AZ::JsonSerializationUtils::LoadObjectFromStream(prefab, stream, &m_deserializationSettings);
+            stream.Sample();
+
+            benchmark::DoNotOptimize(prefab.m_entities.size());
+            peakBytes = stream.m_peakBytes;
+        }
+        ReportCounters(state, peakBytes, m_prefabJsonText.size());
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <Tests/SerializeContextFixture.h>
+
+namespace UnitTest
+{
+    namespace LoadPlanTestTypes
+    {
+        // Intentionally without type info, so the field is stored with the type id of the underlying type
+        enum class ComponentMode : AZ::u8
+        {
+            Disabled,
+            Static,
+            Dynamic,
+        };
+
+        struct Component
+        {
+            AZ_TYPE_INFO(Component, "{6C0B6A0E-2C4A-4E0B-9B6B-6B7E1A0B5F21}");
+
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+            float m_z = 0.0f;
+            AZ::s32 m_layer = 0;
+            bool m_enabled = false;
+            ComponentMode m_mode = ComponentMode::Disabled;
+            AZ::u64 m_flags = 0;
+            double m_weight = 0.0;
+            AZStd::string m_tag;
+        };
+
+        struct Entity
+        {
+            AZ_TYPE_INFO(Entity, "{0B9E3E43-5E1F-4D5A-8C0E-7C3A4E3F1C62}");
+
+            AZ::u64 m_id = 0;
+            AZStd::string m_name;
+            AZStd::vector<Component> m_components;
+            AZStd::vector<float> m_weights;
+        };
+
+        struct Scene
+        {
+            AZ_TYPE_INFO(Scene, "{3D6B7E8C-1E0D-4B8C-A7F3-2E5B1C9D0A43}");
+
+            AZ::u32 m_version = 0;
+            AZStd::vector<Entity> m_entities;
+        };
+
+        inline void Reflect(AZ::SerializeContext* serializeContext)
+        {
+            serializeContext->Class<Component>()
+                ->Field("X", &Component::m_x)
+                ->Field("Y", &Component::m_y)
+                ->Field("Z", &Component::m_z)
+                ->Field("Layer", &Component::m_layer)
+                ->Field("Enabled", &Component::m_enabled)
+                ->Field("Mode", &Component::m_mode)
+                ->Field("Flags", &Component::m_flags)
+                ->Field("Weight", &Component::m_weight)
+                ->Field("Tag", &Component::m_tag);
+
+            serializeContext->Class<Entity>()
+                ->Field("Id", &Entity::m_id)
+                ->Field("Name", &Entity::m_name)
+                ->Field("Components", &Entity::m_components)
+                ->Field("Weights", &Entity::m_weights);
+
+            serializeContext->Class<Scene>()
+                ->Field("Version", &Scene::m_version)
+                ->Field("Entities", &Scene::m_entities);
+        }
+
+        inline Scene CreateScene(size_t numEntities)
+        {
+            Scene scene;
+            scene.m_version = 7;
+            scene.m_entities.resize(numEntities);
+            for (size_t entityIndex = 0; entityIndex < numEntities; ++entityIndex)
+            {
+                Entity& entity = scene.m_entities[entityIndex];
+                entity.m_id = 0x100000000ull + entityIndex;
+                entity.m_name = AZStd::string::format("Entity%zu", entityIndex);
+                entity.m_components.resize(2);
+                for (size_t componentIndex = 0; componentIndex < entity.m_components.size(); ++componentIndex)
+                {
+                    Component& component = entity.m_components[componentIndex];
+                    component.m_x = static_cast<float>(entityIndex) * 0.5f;
+                    component.m_y = static_cast<float>(componentIndex) - 1.25f;
+                    component.m_z = -static_cast<float>(entityIndex);
+                    component.m_layer = static_cast<AZ::s32>(entityIndex % 32) - 16;
+                    component.m_enabled = (entityIndex + componentIndex) % 2 == 0;
+                    component.m_mode = static_cast<ComponentMode>((entityIndex + componentIndex) % 3);
+                    component.m_flags = 0xF0F0F0F000000000ull | entityIndex;
+                    component.m_weight = 1.0 / static_cast<double>(entityIndex + 1);
+                    component.m_tag = componentIndex == 0 ? "Transform" : "Mesh";
+                }
+                entity.m_weights = { 0.25f, 0.5f, static_cast<float>(entityIndex) };
+            }
+            return scene;
+        }
+
+        inline AZStd::vector<char> SaveScene(const Scene& scene, AZ::SerializeContext* serializeContext)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &scene, serializeContext);
+            return buffer;
+        }
+
+        inline bool LoadScene(const AZStd::vector<char>& buffer, Scene& scene, AZ::SerializeContext* serializeContext, bool useLoadPlans)
+        {
+            AZ::IO::MemoryStream stream(buffer.data(), buffer.size());
+            AZ::ObjectStream::FilterDescriptor filterDesc(nullptr, useLoadPlans ? AZ::ObjectStream::FILTERFLAG_USE_LOAD_PLANS : 0);
+            return AZ::Utils::LoadObjectFromStreamInPlace(stream, scene, serializeContext, filterDesc);
+        }
+    } // namespace LoadPlanTestTypes
+
+    class ObjectStreamLoadPlanTest
+        : public SerializeContextFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            SerializeContextFixture::SetUp();
+            LoadPlanTestTypes::Reflect(m_serializeContext);
+        }
+    };
+
+    TEST_F(ObjectStreamLoadPlanTest, GetClassLoadPlan_ClassWithValueFields_ElementsSortedWithDirectLoadForValues)
+    {
+        using namespace LoadPlanTestTypes;
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<Component>());
+        ASSERT_NE(nullptr, classData);
+
+        const AZ::SerializeContext::ClassLoadPlan* plan = m_serializeContext->GetClassLoadPlan(classData);
+        ASSERT_NE(nullptr, plan);
+        EXPECT_EQ(plan, m_serializeContext->GetClassLoadPlan(classData));
+        ASSERT_EQ(classData->m_elements.size(), plan->m_elements.size());
+        EXPECT_FALSE(plan->m_canReserveCapacity);
+
+        for (size_t index = 1; index < plan->m_elements.size(); ++index)
+        {
+            EXPECT_LE(plan->m_elements[index - 1].m_nameCrc, plan->m_elements[index].m_nameCrc);
+        }
+
+        const AZ::SerializeContext::ClassLoadPlan::Element* weight = plan->FindElement(AZ::Crc32("Weight"));
+        ASSERT_NE(nullptr, weight);
+        EXPECT_EQ(offsetof(Component, m_weight), weight->m_classElement->m_offset);
+        EXPECT_NE(nullptr, weight->m_directLoad);
+        EXPECT_EQ(sizeof(double), weight->m_directLoadSize);
+
+        const AZ::SerializeContext::ClassLoadPlan::Element* mode = plan->FindElement(AZ::Crc32("Mode"));
+        ASSERT_NE(nullptr, mode);
+        EXPECT_NE(nullptr, mode->m_directLoad);
+        EXPECT_EQ(sizeof(ComponentMode), mode->m_directLoadSize);
+
+        const AZ::SerializeContext::ClassLoadPlan::Element* tag = plan->FindElement(AZ::Crc32("Tag"));
+        ASSERT_NE(nullptr, tag);
+        EXPECT_EQ(nullptr, tag->m_directLoad);
+
+        EXPECT_EQ(nullptr, plan->FindElement(AZ::Crc32("NotReflected")));
+    }
+
+    TEST_F(ObjectStreamLoadPlanTest, GetClassLoadPlan_VectorClass_CanReserveCapacity)
+    {
+        using namespace LoadPlanTestTypes;
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<AZStd::vector<Entity>>());
+        ASSERT_NE(nullptr, classData);
+
+        const AZ::SerializeContext::ClassLoadPlan* plan = m_serializeContext->GetClassLoadPlan(classData);
+        ASSERT_NE(nullptr, plan);
+        EXPECT_TRUE(plan->m_canReserveCapacity);
+        EXPECT_TRUE(plan->m_elements.empty());
+    }
+
+    TEST_F(ObjectStreamLoadPlanTest, LoadBinaryStream_WithLoadPlans_MatchesLoadWithoutLoadPlans)
+    {
+        using namespace LoadPlanTestTypes;
+        const Scene savedScene = CreateScene(200);
+        const AZStd::vector<char> buffer = SaveScene(savedScene, m_serializeContext);
+        ASSERT_FALSE(buffer.empty());
+
+        Scene genericScene;
+        ASSERT_TRUE(LoadScene(buffer, genericScene, m_serializeContext, false));
+        Scene planScene;
+        ASSERT_TRUE(LoadScene(buffer, planScene, m_serializeContext, true));
+
+        EXPECT_EQ(savedScene.m_version, planScene.m_version);
+        ASSERT_EQ(savedScene.m_entities.size(), planScene.m_entities.size());
+        ASSERT_EQ(genericScene.m_entities.size(), planScene.m_entities.size());
+        for (size_t entityIndex = 0; entityIndex < planScene.m_entities.size(); ++entityIndex)
+        {
+            const Entity& expected = savedScene.m_entities[entityIndex];
+            const Entity& loaded = planScene.m_entities[entityIndex];
+            EXPECT_EQ(expected.m_id, loaded.m_id);
+            EXPECT_EQ(expected.m_name, loaded.m_name);
+            EXPECT_EQ(expected.m_weights, loaded.m_weights);
+            EXPECT_EQ(genericScene.m_entities[entityIndex].m_weights, loaded.m_weights);
+            ASSERT_EQ(expected.m_components.size(), loaded.m_components.size());
+            for (size_t componentIndex = 0; componentIndex < loaded.m_components.size(); ++componentIndex)
+            {
+                const Component& expectedComponent = expected.m_components[componentIndex];
+                const Component& loadedComponent = loaded.m_components[componentIndex];
+                EXPECT_EQ(expectedComponent.m_x, loadedComponent.m_x);
+                EXPECT_EQ(expectedComponent.m_y, loadedComponent.m_y);
+                EXPECT_EQ(expectedComponent.m_z, loadedComponent.m_z);
+                EXPECT_EQ(expectedComponent.m_layer, loadedComponent.m_layer);
+                EXPECT_EQ(expectedComponent.m_enabled, loadedComponent.m_enabled);
+                EXPECT_EQ(expectedComponent.m_mode, loadedComponent.m_mode);
+                EXPECT_EQ(expectedComponent.m_flags, loadedComponent.m_flags);
+                EXPECT_EQ(expectedComponent.m_weight, loadedComponent.m_weight);
+                EXPECT_EQ(expectedComponent.m_tag, loadedComponent.m_tag);
+            }
+        }
+    }
+
+    TEST_F(ObjectStreamLoadPlanTest, LoadBinaryStream_WithLoadPlans_ReservesVectorStorageUpFront)
+    {
+        using namespace LoadPlanTestTypes;
+        const AZStd::vector<char> buffer = SaveScene(CreateScene(100), m_serializeContext);
+
+        Scene scene;
+        ASSERT_TRUE(LoadScene(buffer, scene, m_serializeContext, true));
+        EXPECT_EQ(100u, scene.m_entities.size());
+        EXPECT_EQ(scene.m_entities.size(), scene.m_entities.capacity());
+        EXPECT_EQ(3u, scene.m_entities.front().m_weights.capacity());
+    }
+
+    TEST_F(ObjectStreamLoadPlanTest, LoadBinaryStream_WithLoadPlansAfterReflectionChange_DiscardsRemovedElement)
+    {
+        using namespace LoadPlanTestTypes;
+        const AZStd::vector<char> buffer = SaveScene(CreateScene(4), m_serializeContext);
+
+        Scene scene;
+        ASSERT_TRUE(LoadScene(buffer, scene, m_serializeContext, true));
+
+        // Reflect the component again without its tag, the cached plans must not resolve the removed element anymore
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<Component>();
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<Component>()
+            ->Field("X", &Component::m_x)
+            ->Field("Y", &Component::m_y)
+            ->Field("Z", &Component::m_z)
+            ->Field("Layer", &Component::m_layer)
+            ->Field("Enabled", &Component::m_enabled)
+            ->Field("Mode", &Component::m_mode)
+            ->Field("Flags", &Component::m_flags)
+            ->Field("Weight", &Component::m_weight);
+
+        Scene reloadedScene;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_TRUE(LoadScene(buffer, reloadedScene, m_serializeContext, true));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        ASSERT_EQ(4u, reloadedScene.m_entities.size());
+        EXPECT_TRUE(reloadedScene.m_entities[0].m_components[0].m_tag.empty());
+        EXPECT_EQ(scene.m_entities[3].m_components[1].m_weight, reloadedScene.m_entities[3].m_components[1].m_weight);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Loads a synthetic binary ObjectStream of 100k entities with and without the class load plans.
+    class BM_ObjectStreamLoadPlan
+        : public benchmark::Fixture
+    {
+        static constexpr size_t NumEntities = 100000;
+
+        void internalSetUp()
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            UnitTest::LoadPlanTestTypes::Reflect(m_serializeContext.get());
+            m_buffer = UnitTest::LoadPlanTestTypes::SaveScene(UnitTest::LoadPlanTestTypes::CreateScene(NumEntities), m_serializeContext.get());
+        }
+
+        void internalTearDown()
+        {
+            m_buffer = {};
+            m_serializeContext.reset();
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void Load(benchmark::State& state, bool useLoadPlans)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                UnitTest::LoadPlanTestTypes::Scene scene;
+                UnitTest::LoadPlanTestTypes::LoadScene(m_buffer, scene, m_serializeContext.get(), useLoadPlans);
+                benchmark::DoNotOptimize(scene.m_entities.data());
+            }
+
+            state.SetBytesProcessed(state.iterations() * m_buffer.size());
+            state.SetItemsProcessed(state.iterations() * NumEntities);
+        }
+
+        bool m_ownsSystemAllocator = false;
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<char> m_buffer;
+    };
+
+    BENCHMARK_F(BM_ObjectStreamLoadPlan, LoadWithoutLoadPlans)(benchmark::State& state)
+    {
+        Load(state, false);
+    }
+
+    BENCHMARK_F(BM_ObjectStreamLoadPlan, LoadWithLoadPlans)(benchmark::State& state)
+    {
+        Load(state, true);
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
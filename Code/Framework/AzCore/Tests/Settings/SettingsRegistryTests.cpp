@@ -1792,4 +1792,119 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_MultipleThreads_FilesAppliedInAlphabeticAndSpecializationOrder)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true })");
+        CreateTestFile("Memory.editor.test.setreg", R"({ "Memory": 3, "MemoryEditorTest": true })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "MemoryEditor": true })");
+        CreateTestFile("Memory.test.setregpatch", R"(
+            [
+                { "op": "replace", "path": "/Memory", "value": 2 },
+                { "op": "add", "path": "/MemoryTest", "value": true }
+            ])");
+
+        size_t counter = 0;
+        auto callback = [this, &counter](AZStd::string_view path, AZ::SettingsRegistryInterface::Type)
+        {
+            const char* fileIds[] =
+            {
+                "/MemoryRoot",
+                "/MemoryEditor",
+                "/MemoryTest",
+                "/MemoryEditorTest"
+            };
+
+            MergeNotify(path, counter, AZ_ARRAY_SIZE(fileIds), "/Memory", fileIds);
+            counter++;
+        };
+        auto testNotifier1 = m_registry->RegisterNotifier(callback);
+
+        m_registry->SetMergeThreadCount(4);
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        bool result = m_registry->MergeSettingsFolder(*m_testFolder, { "editor", "test" }, {});
+        EXPECT_TRUE(result);
+        EXPECT_EQ(4, counter);
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/0")); // Folder and specialization settings.
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/2"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/3"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/4"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/5"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_MultipleThreadsWithInvalidFile_ErrorReportedInFileOrder)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "MemoryEditor": )");
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 2, "MemoryTest": true })");
+
+        m_registry->SetMergeThreadCount(4);
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        bool result = m_registry->MergeSettingsFolder(*m_testFolder, { "editor", "test" }, {});
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(result);
+
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(m_registry->Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/2/Error"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/3"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/4"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_WithMergeCache_CacheReusedUntilFileChanges)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true, "Name": "Root" })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "MemoryEditor": true })");
+        CreateTestFile("Memory.test.setregpatch", R"([ { "op": "replace", "path": "/Memory", "value": 2 } ])");
+
+        const AZStd::string cacheFolder = AZStd::string::format("%s/Cache", m_testFolder->c_str());
+        const AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(),
+            AZ::SettingsRegistryInterface::RegistryFolder);
+
+        auto mergeWithCache = [&cacheFolder, &registryFolder]()
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            registry->SetMergeCacheFolder(cacheFolder);
+            EXPECT_TRUE(registry->MergeSettingsFolder(registryFolder, { "editor", "test" }, {}));
+            return registry;
+        };
+
+        auto checkValues = [](AZ::SettingsRegistryInterface& registry, AZ::s64 expectedMemory, AZStd::string_view expectedName)
+        {
+            AZ::s64 memory = -1;
+            EXPECT_TRUE(registry.Get(memory, "/Memory"));
+            EXPECT_EQ(expectedMemory, memory);
+            AZStd::string name;
+            EXPECT_TRUE(registry.Get(name, "/Name"));
+            EXPECT_EQ(expectedName, name);
+            bool editor = false;
+            EXPECT_TRUE(registry.Get(editor, "/MemoryEditor"));
+            EXPECT_TRUE(editor);
+        };
+
+        // The first merge parses the files and creates the cache, the second merge is served from the cache.
+        checkValues(*mergeWithCache(), 2, "Root");
+        bool cacheCreated = false;
+        AZ::IO::SystemFile::FindFiles(AZStd::string::format("%s/*.setregcache", cacheFolder.c_str()).c_str(),
+            [&cacheCreated](const char*, bool isFile)
+            {
+                cacheCreated = cacheCreated || isFile;
+                return true;
+            });
+        EXPECT_TRUE(cacheCreated);
+        checkValues(*mergeWithCache(), 2, "Root");
+
+        // Changing a file invalidates the cache.
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true, "Name": "Changed root" })");
+        checkValues(*mergeWithCache(), 2, "Changed root");
+        checkValues(*mergeWithCache(), 2, "Changed root");
+    }
 } // namespace SettingsRegistryTests
@@ -0,0 +1,530 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/CompressionSeekTable.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class BlockDecompressorTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<BlockDecompressor>
+    {
+    public:
+        static constexpr u32 m_arbitrarilyLargeAlignment = 4096;
+
+        BlockDecompressor CreateInstance() override
+        {
+            return BlockDecompressor(2, 2, m_arbitrarilyLargeAlignment);
+        }
+
+        void SetUp() override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_BlockDecompressorConformityTests, StreamStackEntryConformityTests, BlockDecompressorTestDescription);
+
+    class Streamer_CompressionSeekTableTest
+        : public UnitTest::AllocatorsFixture
+    {
+    };
+
+    TEST_F(Streamer_CompressionSeekTableTest, StoreAndLoad_RoundTrip_BlocksAreIdentical)
+    {
+        CompressionSeekTable table;
+        table.AddBlock(100, 256);
+        table.AddBlock(50, 256);
+        table.AddBlock(25, 10);
+
+        AZStd::vector<u8> data(175, 0);
+        data.resize(175 + table.GetStoredSize());
+        ASSERT_EQ(table.GetStoredSize(), table.Store(data.data() + 175, table.GetStoredSize()));
+        EXPECT_EQ(table.GetStoredSize(), CompressionSeekTable::GetTableSize(data.data() + data.size() - CompressionSeekTable::FooterSize));
+
+        CompressionSeekTable loaded;
+        ASSERT_TRUE(loaded.Load(data.data() + 175, table.GetStoredSize(), data.size(), 522));
+        ASSERT_EQ(3, loaded.GetNumBlocks());
+        for (size_t i = 0; i <= loaded.GetNumBlocks(); ++i)
+        {
+            EXPECT_EQ(table.GetBlock(i).m_compressedOffset, loaded.GetBlock(i).m_compressedOffset);
+            EXPECT_EQ(table.GetBlock(i).m_uncompressedOffset, loaded.GetBlock(i).m_uncompressedOffset);
+        }
+    }
+
+    TEST_F(Streamer_CompressionSeekTableTest, FindBlock_OffsetsInAndPastBlocks_ReturnsContainingBlock)
+    {
+        CompressionSeekTable table;
+        table.AddBlock(100, 256);
+        table.AddBlock(50, 256);
+        table.AddBlock(25, 10);
+
+        EXPECT_EQ(0, table.FindBlock(0));
+        EXPECT_EQ(0, table.FindBlock(255));
+        EXPECT_EQ(1, table.FindBlock(256));
+        EXPECT_EQ(2, table.FindBlock(521));
+        EXPECT_EQ(2, table.FindBlock(10000));
+    }
+
+    TEST_F(Streamer_CompressionSeekTableTest, Load_InvalidTables_ReturnsFalse)
+    {
+        CompressionSeekTable table;
+        table.AddBlock(100, 256);
+        AZStd::vector<u8> data(100 + table.GetStoredSize(), 0);
+        table.Store(data.data() + 100, table.GetStoredSize());
+        const u8* tableStart = data.data() + 100;
+        size_t tableSize = table.GetStoredSize();
+
+        CompressionSeekTable loaded;
+        EXPECT_FALSE(loaded.Load(tableStart, tableSize, data.size() + 1, 256)); // Compressed size doesn't match.
+        EXPECT_FALSE(loaded.Load(tableStart, tableSize, data.size(), 255)); // Uncompressed size doesn't match.
+        EXPECT_FALSE(loaded.Load(tableStart, tableSize - 1, data.size(), 256)); // Truncated.
+
+        AZStd::vector<u8> badMagic = data;
+        badMagic.back() ^= 0xFF;
+        EXPECT_EQ(0, CompressionSeekTable::GetTableSize(badMagic.data() + badMagic.size() - CompressionSeekTable::FooterSize));
+        EXPECT_FALSE(loaded.Load(badMagic.data() + 100, tableSize, badMagic.size(), 256));
+
+        EXPECT_TRUE(loaded.Load(tableStart, tableSize, data.size(), 256));
+    }
+
+    class Streamer_BlockDecompressorTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        struct MockRead
+        {
+            u64 m_offset;
+            u64 m_size;
+        };
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            m_decompressor.reset();
+            m_mock.reset();
+
+            m_archive = {};
+            m_reads = {};
+            m_heldReads = {};
+            m_buffer.reset();
+
+            delete m_context;
+            m_context = nullptr;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, u32 seekTableCacheSize = 256)
+        {
+            m_buffer = AZStd::unique_ptr<u32[]>(new u32[m_fakeFileLength >> 2]);
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            // Use a minimum seekable size of 0 so even the small test archive is checked for a seek table.
+            m_decompressor = AZStd::make_shared<BlockDecompressor>(maxNumReads, maxNumJobs,
+                BlockDecompressorTestDescription::m_arbitrarilyLargeAlignment, 0, seekTableCacheSize);
+
+            m_context = new StreamerContext();
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+        }
+
+        // Creates an archive with the uncompressed data stored in blocks using a copying "compression" followed by an
+        // optional seek table.
+        void CreateArchive(bool withSeekTable)
+        {
+            m_archive.resize(m_fakeFileLength);
+            u32* data = reinterpret_cast<u32*>(m_archive.data());
+            for (u64 i = 0; i < (m_fakeFileLength >> 2); ++i)
+            {
+                data[i] = aznumeric_caster(i << 2);
+            }
+
+            if (withSeekTable)
+            {
+                CompressionSeekTable table;
+                for (u64 offset = 0; offset < m_fakeFileLength; offset += m_blockSize)
+                {
+                    u32 size = aznumeric_caster(AZStd::min(m_blockSize, m_fakeFileLength - offset));
+                    table.AddBlock(size, size);
+                }
+                m_archive.resize(m_fakeFileLength + table.GetStoredSize());
+                table.Store(m_archive.data() + m_fakeFileLength, table.GetStoredSize());
+            }
+        }
+
+        void MockReadCalls(bool fail = false)
+        {
+            MockReadCalls(fail ? &Streamer_BlockDecompressorTest::FailReadRequest : &Streamer_BlockDecompressorTest::ServeReadRequest);
+        }
+
+        void MockReadCalls(void (Streamer_BlockDecompressorTest::*handler)(FileRequest*))
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AnyNumber());
+
+            ON_CALL(*m_mock, QueueRequest(_)).WillByDefault(Invoke(this, handler));
+        }
+
+        void ServeReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            ASSERT_LE(data->m_offset + data->m_size, m_archive.size());
+
+            m_reads.push_back(MockRead{ data->m_offset, data->m_size });
+            memcpy(data->m_output, m_archive.data() + data->m_offset, data->m_size);
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void FailReadRequest(FileRequest* request)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        // Serves the first m_numServedReads reads and cancels any after that, as the next entry does when a request is canceled.
+        void CancelReadRequest(FileRequest* request)
+        {
+            if (m_reads.size() < m_numServedReads)
+            {
+                ServeReadRequest(request);
+                return;
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        // Keeps reads in flight until they're explicitly served with ServeHeldReads.
+        void HoldReadRequest(FileRequest* request)
+        {
+            m_heldReads.push_back(request);
+        }
+
+        void ServeHeldReads()
+        {
+            AZStd::vector<FileRequest*> heldReads = AZStd::move(m_heldReads);
+            m_heldReads.clear();
+            for (FileRequest* request : heldReads)
+            {
+                ServeReadRequest(request);
+            }
+        }
+
+        static bool CopyDecompressor(const CompressionInfo&, const void* compressed, size_t compressedSize, void* uncompressed,
+            size_t uncompressedBufferSize)
+        {
+            // The seek table is stored in a skippable frame, so a decompressor that doesn't know about the table would skip it.
+            if (compressedSize < uncompressedBufferSize)
+            {
+                return false;
+            }
+            memcpy(uncompressed, compressed, uncompressedBufferSize);
+            return true;
+        }
+
+        static bool CorruptedDecompressor(const CompressionInfo&, const void*, size_t, void*, size_t)
+        {
+            return false;
+        }
+
+        CompressionInfo CreateCompressionInfo(bool corrupted = false) const
+        {
+            CompressionInfo compressionInfo;
+            compressionInfo.m_archiveFilename = RequestPath("test.pak");
+            compressionInfo.m_compressedSize = aznumeric_caster(m_archive.size());
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_decompressor = corrupted ? &Streamer_BlockDecompressorTest::CorruptedDecompressor
+                                                       : &Streamer_BlockDecompressorTest::CopyDecompressor;
+            return compressionInfo;
+        }
+
+        void QueueCompressedRead(const CompressionInfo& compressionInfo, const MockRead& read, FileRequest::OnCompletionCallback completed)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, compressionInfo, reinterpret_cast<u8*>(m_buffer.get()) + read.m_offset,
+                read.m_offset, read.m_size);
+            request->SetCompletionCallback(AZStd::move(completed));
+            m_decompressor->QueueRequest(request);
+        }
+
+        void ProcessCompressedReads(AZStd::initializer_list<MockRead> reads, IStreamerTypes::RequestStatus expectedResult,
+            bool corrupted = false)
+        {
+            CompressionInfo compressionInfo = CreateCompressionInfo(corrupted);
+
+            bool result = true;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = result && request.GetStatus() == expectedResult;
+            };
+
+            for (const MockRead& read : reads)
+            {
+                QueueCompressedRead(compressionInfo, read, completed);
+            }
+
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_TRUE(result);
+        }
+
+        void VerifyReadBuffer(u64 offset, u64 size)
+        {
+            const u32* buffer = m_buffer.get() + (offset >> 2);
+            size = size >> 2;
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would
+                // cause a large amount of log noise.
+                ASSERT_EQ(buffer[i], offset + (i << 2));
+            }
+        }
+
+        size_t CountTableReads() const
+        {
+            size_t count = 0;
+            for (const MockRead& read : m_reads)
+            {
+                if (read.m_offset + read.m_size == m_archive.size() && read.m_offset >= m_fakeFileLength - 4_kib)
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        AZStd::unique_ptr<u32[]> m_buffer;
+        AZStd::vector<u8> m_archive;
+        AZStd::vector<MockRead> m_reads;
+        AZStd::vector<FileRequest*> m_heldReads;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<BlockDecompressor> m_decompressor;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u64 m_blockSize{ 64 * 1024 };
+        size_t m_numServedReads{ 0 };
+    };
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FullReadWithSeekTable_SuccessfullyReadData)
+    {
+        SetupEnvironment(2, 4);
+        CreateArchive(true);
+        MockReadCalls();
+        ProcessCompressedReads({ { 0, m_fakeFileLength } }, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_PartialReadWithSeekTable_OnlyOverlappingBlocksAreRead)
+    {
+        SetupEnvironment(2, 4);
+        CreateArchive(true);
+        MockReadCalls();
+        // Starts in the middle of the second block and ends in the middle of the fourth block.
+        u64 offset = m_blockSize + 256;
+        u64 size = 2 * m_blockSize;
+        ProcessCompressedReads({ { offset, size } }, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, size);
+
+        ASSERT_EQ(2, m_reads.size());
+        EXPECT_EQ(m_blockSize, m_reads[1].m_offset);
+        EXPECT_EQ(3 * m_blockSize, m_reads[1].m_size);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleReadsFromSameFile_SeekTableIsOnlyReadOnce)
+    {
+        SetupEnvironment(1, 2);
+        CreateArchive(true);
+        MockReadCalls();
+        ProcessCompressedReads({ { 0, 4096 }, { 8192, 4096 }, { m_fakeFileLength - 4096, 4096 } }, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, 4096);
+        VerifyReadBuffer(8192, 4096);
+        VerifyReadBuffer(m_fakeFileLength - 4096, 4096);
+        EXPECT_EQ(1, CountTableReads());
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_NoSeekTableCache_FileIsReadAsSingleBlock)
+    {
+        SetupEnvironment(2, 2, 0);
+        CreateArchive(true);
+        MockReadCalls();
+        ProcessCompressedReads({ { 256, m_fakeFileLength - 512 } }, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+        ASSERT_EQ(1, m_reads.size());
+        EXPECT_EQ(m_archive.size(), m_reads[0].m_size);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FileWithoutSeekTable_FileIsReadAsSingleBlock)
+    {
+        SetupEnvironment(2, 2);
+        CreateArchive(false);
+        MockReadCalls();
+        ProcessCompressedReads({ { 256, m_fakeFileLength - 512 } }, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+        ASSERT_EQ(2, m_reads.size());
+        EXPECT_EQ(m_archive.size(), m_reads[1].m_size);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FailedRead_FailureIsDetectedAndReported)
+    {
+        SetupEnvironment(2, 2);
+        CreateArchive(true);
+        MockReadCalls(true);
+        ProcessCompressedReads({ { 0, m_fakeFileLength } }, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_CorruptedBlock_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(2, 4);
+        CreateArchive(true);
+        MockReadCalls();
+        ProcessCompressedReads({ { 0, m_fakeFileLength } }, IStreamerTypes::RequestStatus::Failed, true);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithSingleReadAndJob_AllRequestsComplete)
+    {
+        SetupEnvironment(1, 1);
+        CreateArchive(true);
+        MockReadCalls();
+        ProcessCompressedReads({ { 0, 64 * 1024 }, { 128 * 1024, 256 * 1024 }, { 512 * 1024, 512 * 1024 } },
+            IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, 64 * 1024);
+        VerifyReadBuffer(128 * 1024, 256 * 1024);
+        VerifyReadBuffer(512 * 1024, 512 * 1024);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_CanceledSeekTableRead_RequestIsCanceledAndSlotIsReleased)
+    {
+        SetupEnvironment(1, 2);
+        CreateArchive(true);
+        MockReadCalls(&Streamer_BlockDecompressorTest::CancelReadRequest);
+        ProcessCompressedReads({ { 0, m_fakeFileLength } }, IStreamerTypes::RequestStatus::Canceled);
+
+        StreamStackEntry::Status status;
+        m_decompressor->UpdateStatus(status);
+        EXPECT_TRUE(status.m_isIdle);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_CanceledBlockRead_RequestIsCanceledAndSlotIsReleased)
+    {
+        SetupEnvironment(1, 2);
+        CreateArchive(true);
+        // The seek table is read, but the read of the blocks is canceled.
+        m_numServedReads = 1;
+        MockReadCalls(&Streamer_BlockDecompressorTest::CancelReadRequest);
+        ProcessCompressedReads({ { 0, m_fakeFileLength } }, IStreamerTypes::RequestStatus::Canceled);
+        EXPECT_EQ(1, CountTableReads());
+
+        StreamStackEntry::Status status;
+        m_decompressor->UpdateStatus(status);
+        EXPECT_TRUE(status.m_isIdle);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+
+        // The slot can be used again and the seek table that was read is reused.
+        MockReadCalls();
+        ProcessCompressedReads({ { 0, m_fakeFileLength } }, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(1, CountTableReads());
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_SeekTableReadInFlight_TakesUpReadSlot)
+    {
+        SetupEnvironment(1, 2);
+        CreateArchive(true);
+        MockReadCalls(&Streamer_BlockDecompressorTest::HoldReadRequest);
+
+        // Two files in the same archive that don't have a known seek table yet.
+        CompressionInfo firstFile = CreateCompressionInfo();
+        CompressionInfo secondFile = CreateCompressionInfo();
+        secondFile.m_archiveFilename = RequestPath("other.pak");
+
+        size_t numCompleted = 0;
+        auto completed = [&numCompleted](const FileRequest& request)
+        {
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            ++numCompleted;
+        };
+        QueueCompressedRead(firstFile, { 0, 4096 }, completed);
+        QueueCompressedRead(secondFile, { 8192, 4096 }, completed);
+
+        // Only one seek table read can be in flight as it uses the only read slot.
+        m_decompressor->ExecuteRequests();
+        EXPECT_EQ(1, m_heldReads.size());
+        StreamStackEntry::Status status;
+        m_decompressor->UpdateStatus(status);
+        EXPECT_EQ(0, status.m_numAvailableSlots);
+        EXPECT_FALSE(status.m_isIdle);
+
+        m_decompressor->ExecuteRequests();
+        EXPECT_EQ(1, m_heldReads.size());
+
+        while (numCompleted < 2)
+        {
+            ServeHeldReads();
+            m_context->FinalizeCompletedRequests();
+            m_decompressor->ExecuteRequests();
+
+            // No more than the single read slot is ever used.
+            EXPECT_LE(m_heldReads.size(), 1);
+        }
+
+        VerifyReadBuffer(0, 4096);
+        VerifyReadBuffer(8192, 4096);
+        EXPECT_EQ(2, CountTableReads());
+    }
+} // namespace AZ::IO
@@ -9,11 +9,20 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <random>
 
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Jobs/Job.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#endif
+
 using AZ::TaskDescriptor;
 using AZ::TaskGraph;
 using AZ::TaskGraphEvent;
@@ -623,6 +632,187 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+    TEST_F(TaskGraphTestFixture, RetainedGraph_RebindTask)
+    {
+        AZStd::atomic<int> x = 0;
+        int source = 1;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&x, value = source]
+            {
+                x = value;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = x.load() * 10;
+            });
+        a.Precedes(b);
+
+        for (int i = 0; i != 3; ++i)
+        {
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(source * 10, x);
+
+            // Bind a new parameter to the root task, the dependency on b must be preserved
+            source += 1;
+            graph.RebindTask(
+                a,
+                [&x, value = source]
+                {
+                    x = value;
+                });
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, WideForkJoin)
+    {
+        // A single root releasing many successors exercises stealing from the deque of the worker that ran the root
+        constexpr int FanOut = 1000;
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> joined = 0;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                joined = x.load();
+            });
+        for (int i = 0; i != FanOut; ++i)
+        {
+            auto leaf = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++x;
+                });
+            root.Precedes(leaf);
+            join.Follows(leaf);
+        }
+
+        for (int i = 0; i != 4; ++i)
+        {
+            x = 0;
+            joined = 0;
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(FanOut, joined);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, WorkerMask_TasksOnlyRunOnSelectedWorker)
+    {
+        TaskExecutor executor(4);
+        TaskDescriptor pinnedTD{ "TaskGraphTestTask", "TaskGraphTests", TaskPriority::MEDIUM, 0b0100 };
+
+        constexpr int FanOut = 64;
+        AZStd::thread_id ids[FanOut];
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        for (int i = 0; i != FanOut; ++i)
+        {
+            auto leaf = graph.AddTask(
+                pinnedTD,
+                [&ids, i]
+                {
+                    ids[i] = AZStd::this_thread::get_id();
+                });
+            root.Precedes(leaf);
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        for (int i = 1; i != FanOut; ++i)
+        {
+            EXPECT_EQ(ids[0], ids[i]);
+        }
+    }
+
+    class TaskExecutorTester
+    {
+    public:
+        static void DeactivateTaskWorker(TaskExecutor& executor)
+        {
+            executor.DeactivateTaskWorker();
+        }
+
+        static void ReactivateTaskWorker(TaskExecutor& executor)
+        {
+            executor.ReactivateTaskWorker();
+        }
+    };
+
+    TEST_F(TaskGraphTestFixture, WorkerMask_SubmitWhileSelectedWorkerIsDisabled)
+    {
+        TaskExecutor executor(2);
+        TaskDescriptor pinnedTD{ "TaskGraphTestTask", "TaskGraphTests", TaskPriority::MEDIUM, 0b01 };
+
+        AZStd::atomic_bool workerDisabled = false;
+        AZStd::atomic_bool pinnedSubmitted = false;
+        AZStd::thread_id waitingId;
+        AZStd::thread_id pinnedId;
+
+        // Occupies the selected worker and disqualifies it from receiving tasks, as if it were waiting on another graph
+        TaskGraph waitingGraph;
+        waitingGraph.AddTask(
+            pinnedTD,
+            [&]
+            {
+                waitingId = AZStd::this_thread::get_id();
+                TaskExecutorTester::DeactivateTaskWorker(executor);
+                workerDisabled = true;
+                while (!pinnedSubmitted)
+                {
+                    AZStd::this_thread::yield();
+                }
+                TaskExecutorTester::ReactivateTaskWorker(executor);
+            });
+
+        TaskGraph pinnedGraph;
+        pinnedGraph.AddTask(
+            pinnedTD,
+            [&pinnedId]
+            {
+                pinnedId = AZStd::this_thread::get_id();
+            });
+
+        TaskGraphEvent waitingEvent;
+        waitingGraph.SubmitOnExecutor(executor, &waitingEvent);
+        while (!workerDisabled)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        // Must not wait for the selected worker to be reenabled
+        TaskGraphEvent pinnedEvent;
+        pinnedGraph.SubmitOnExecutor(executor, &pinnedEvent);
+        pinnedSubmitted = true;
+
+        waitingEvent.Wait();
+        pinnedEvent.Wait();
+        EXPECT_EQ(waitingId, pinnedId);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -736,5 +926,220 @@ namespace Benchmark
             ev.Wait();
         }
     }
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FanOut_RebuildEachSubmission)(benchmark::State& state)
+    {
+        // Baseline for the retained benchmark below: the graph is recorded and compiled on every submission
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraph frameGraph;
+            auto root = frameGraph.AddTask(
+                descriptors[2],
+                []
+                {
+                });
+            for (int i = 0; i != 64; ++i)
+            {
+                auto leaf = frameGraph.AddTask(
+                    descriptors[2],
+                    [i]
+                    {
+                        benchmark::DoNotOptimize(i);
+                    });
+                root.Precedes(leaf);
+            }
+
+            TaskGraphEvent ev;
+            frameGraph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FanOut_RetainedWithRebind)(benchmark::State& state)
+    {
+        auto root = graph->AddTask(
+            descriptors[2],
+            []
+            {
+            });
+        for (int i = 0; i != 64; ++i)
+        {
+            auto leaf = graph->AddTask(
+                descriptors[2],
+                [i]
+                {
+                    benchmark::DoNotOptimize(i);
+                });
+            root.Precedes(leaf);
+        }
+
+        int frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Bind new per-frame data without recompiling the graph
+            graph->RebindTask(
+                root,
+                [frame]
+                {
+                    benchmark::DoNotOptimize(frame);
+                });
+            ++frame;
+
+            TaskGraphEvent ev;
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+
+    // Fan-out/fan-in benchmarks: a root task releases N leaf tasks which are joined by a final task. This is the typical
+    // shape of parallel-for style work such as culling, and stresses how quickly the released leaves are spread over
+    // the workers. The same shape is built with the job system for comparison.
+    constexpr int64_t FanOutLeafWork = 256;
+
+    static void FanOutLeaf()
+    {
+        int64_t sum = 0;
+        for (int64_t i = 0; i != FanOutLeafWork; ++i)
+        {
+            benchmark::DoNotOptimize(sum += i);
+        }
+    }
+
+    class FanOutFanInBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            executor = aznew TaskExecutor;
+
+            AZ::JobManagerDesc desc;
+            for (uint32_t i = 0; i != AZStd::thread::hardware_concurrency(); ++i)
+            {
+                desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc{});
+            }
+            jobManager = aznew AZ::JobManager(desc);
+            jobContext = aznew AZ::JobContext(*jobManager);
+        }
+
+        void internalTearDown()
+        {
+            azdestroy(jobContext);
+            azdestroy(jobManager);
+            azdestroy(executor);
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        TaskExecutor* executor = nullptr;
+        AZ::JobManager* jobManager = nullptr;
+        AZ::JobContext* jobContext = nullptr;
+    };
+
+    class FanOutJob : public AZ::Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FanOutJob, AZ::ThreadPoolAllocator, 0)
+
+        FanOutJob(int64_t leafCount, AZ::JobContext* context)
+            : AZ::Job(true, context)
+            , m_leafCount(leafCount)
+        {
+        }
+
+        void Process() override
+        {
+            // The leaves continue this job so the dependent completion only fires once all of them finished
+            for (int64_t i = 0; i != m_leafCount; ++i)
+            {
+                AZ::Job* leaf = AZ::CreateJobFunction(&FanOutLeaf, true, GetContext());
+                SetContinuation(leaf);
+                leaf->Start();
+            }
+        }
+
+    private:
+        int64_t m_leafCount;
+    };
+
+    BENCHMARK_DEFINE_F(FanOutFanInBenchmarkFixture, TaskGraph_FanOutFanIn)(benchmark::State& state)
+    {
+        const int64_t leafCount = state.range(0);
+        TaskDescriptor descriptor{ "FanOutFanIn", "benchmark" };
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            descriptor,
+            []
+            {
+            });
+        auto join = graph.AddTask(
+            descriptor,
+            []
+            {
+            });
+        for (int64_t i = 0; i != leafCount; ++i)
+        {
+            auto leaf = graph.AddTask(
+                descriptor,
+                []
+                {
+                    FanOutLeaf();
+                });
+            root.Precedes(leaf);
+            join.Follows(leaf);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+
+        state.SetItemsProcessed(state.iterations() * leafCount);
+    }
+    BENCHMARK_REGISTER_F(FanOutFanInBenchmarkFixture, TaskGraph_FanOutFanIn)->RangeMultiplier(8)->Range(8, 4096);
+
+    BENCHMARK_DEFINE_F(FanOutFanInBenchmarkFixture, JobManager_FanOutFanIn)(benchmark::State& state)
+    {
+        const int64_t leafCount = state.range(0);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::JobCompletion completion(jobContext);
+            FanOutJob* root = aznew FanOutJob(leafCount, jobContext);
+            root->SetDependent(&completion);
+            root->Start();
+            completion.StartAndWaitForCompletion();
+        }
+
+        state.SetItemsProcessed(state.iterations() * leafCount);
+    }
+    BENCHMARK_REGISTER_F(FanOutFanInBenchmarkFixture, JobManager_FanOutFanIn)->RangeMultiplier(8)->Range(8, 4096);
 } // namespace Benchmark
 #endif
@@ -271,6 +271,24 @@ namespace UnitTest
         m_loadDelay = loadDelay;
     }
 
+    Outcome<AZStd::vector<ProductDependency>, AZStd::string> DataDrivenHandlerAndCatalog::GetDirectProductDependencies(const AssetId& assetId)
+    {
+        const auto* def = FindById(assetId);
+
+        if (def)
+        {
+            AZStd::vector<ProductDependency> dependencyList;
+
+            dependencyList.insert(dependencyList.end(), def->m_preloadDependencies.begin(), def->m_preloadDependencies.end());
+            dependencyList.insert(dependencyList.end(), def->m_queueLoadDependencies.begin(), def->m_queueLoadDependencies.end());
+            dependencyList.insert(dependencyList.end(), def->m_noLoadDependencies.begin(), def->m_noLoadDependencies.end());
+
+            return Success(dependencyList);
+        }
+
+        return AZ::Failure<AZStd::string>("Unknown asset");
+    }
+
     Outcome<AZStd::vector<ProductDependency>, AZStd::string> DataDrivenHandlerAndCatalog::GetAllProductDependencies(const AssetId& assetId)
     {
         const auto* def = FindById(assetId);
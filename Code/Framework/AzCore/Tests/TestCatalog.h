@@ -75,6 +75,7 @@ namespace UnitTest
 
         AssetStreamInfo GetStreamInfoForLoad(const AssetId& id, const AssetType& /*type*/) override;
         AssetStreamInfo GetStreamInfoForSave(const AssetId& id, const AssetType& /*type*/) override;
+        Outcome<AZStd::vector<ProductDependency>, AZStd::string> GetDirectProductDependencies(const AssetId& assetId) override;
         Outcome<AZStd::vector<ProductDependency>, AZStd::string> GetAllProductDependencies(const AssetId& assetId) override;
         Outcome<AZStd::vector<ProductDependency>, AZStd::string> GetLoadBehaviorProductDependencies(const AssetId& assetId,
             AZStd::unordered_set<AssetId>& noloadSet, PreloadAssetListType& preloadList) override;
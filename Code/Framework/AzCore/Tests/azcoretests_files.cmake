@@ -17,6 +17,8 @@ set(FILES
     Asset/MockLoadAssetCatalogAndHandler.h
     Asset/TestAssetTypes.h
     AssetJsonSerializerTests.cpp
+    EBus/EBusContiguousHandlerTests.cpp
+    EBus/EBusLocklessQueueTests.cpp
     EBus/EBusSharedDispatchMutexTests.cpp
     EBus/ScheduledEventTests.cpp
     AssetManager.cpp
@@ -31,6 +33,7 @@ set(FILES
     Debug.cpp
     DLL.cpp
     EBus.cpp
+    EBusContiguousBenchmarks.cpp
     EntityIdTests.cpp
     EntityTests.cpp
     EnumTests.cpp
@@ -87,6 +90,7 @@ set(FILES
     Settings/SettingsRegistryScriptUtilsTests.cpp
     Settings/SettingsRegistryVisitorUtilsTests.cpp
     Streamer/BlockCacheTests.cpp
+    Streamer/BlockDecompressorTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
@@ -136,6 +140,7 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/ObjectStreamLoadPlanTests.cpp
     Time/TimeTests.cpp
     Math/AabbTests.cpp
     Math/ColorTests.cpp
@@ -171,10 +176,13 @@ set(FILES
     Math/SplineTests.cpp
     Math/TransformPerformanceTests.cpp
     Math/TransformTests.cpp
+    Math/TransformArrayTests.cpp
     Math/Vector2PerformanceTests.cpp
     Math/Vector2Tests.cpp
     Math/Vector3PerformanceTests.cpp
     Math/Vector3Tests.cpp
+    Math/Vector3ArrayPerformanceTests.cpp
+    Math/Vector3ArrayTests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
     Memory/AllocatorBenchmarks.cpp
@@ -228,6 +236,7 @@ set(FILES
     AZStd/VectorAndArray.cpp
     DOM/DomFixtures.cpp
     DOM/DomFixtures.h
+    DOM/DomBinaryTests.cpp
     DOM/DomJsonTests.cpp
     DOM/DomJsonBenchmarks.cpp
     DOM/DomPathTests.cpp
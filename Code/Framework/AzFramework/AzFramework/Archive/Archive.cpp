@@ -51,6 +51,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, az_archive_memory_map, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, read-only archives are memory mapped when opened so that stored (uncompressed) entries\n"
+        "are returned without per-read file IO or intermediate copies");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -1445,14 +1448,15 @@ namespace AZ::IO
     {
         m_nArchiveFlags = nArchiveFlags;
         m_pFileData = nullptr;
+        m_ownsFileData = false;
         m_pZip = pZip;
         m_pFileEntry = pFileEntry;
     }
 
     CCachedFileData::~CCachedFileData()
     {
-        // forced destruction
-        if (m_pFileData)
+        // forced destruction, data that points into a mapped archive is owned by the archive
+        if (m_pFileData && m_ownsFileData)
         {
             AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
             m_pFileData = nullptr;
@@ -1514,6 +1518,14 @@ namespace AZ::IO
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             if (!m_pFileData)
             {
+                // stored entries in a mapped archive can be handed out directly without allocating or copying
+                if (AZStd::span<const uint8_t> storedData = m_pZip->GetStoredFileView(m_pFileEntry); !storedData.empty())
+                {
+                    m_pFileData = const_cast<uint8_t*>(storedData.data());
+                    m_ownsFileData = false;
+                    return m_pFileData;
+                }
+
                 // don't try to decompress if its not actually compressed
                 decompress = decompress && m_pFileEntry->IsCompressed();
 
@@ -1534,6 +1546,7 @@ namespace AZ::IO
                 else
                 {
                     m_pFileData = fileData;
+                    m_ownsFileData = true;
                 }
             }
         }
@@ -1566,8 +1579,8 @@ namespace AZ::IO
         if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
-            // Uncompressed read.
-            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
+            // Uncompressed read of only the requested range, copied out of the mapping when the archive is mapped.
+            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadStoredFileRange(m_pFileEntry, nFileOffset, nReadSize, pBuffer))
             {
                 return -1;
             }
@@ -1625,6 +1638,10 @@ namespace AZ::IO
         if (nFlags & INestedArchive::FLAGS_READ_ONLY)
         {
             nFactoryFlags |= ZipDir::CacheFactory::FLAGS_READ_ONLY;
+            if (az_archive_memory_map)
+            {
+                nFactoryFlags |= ZipDir::CacheFactory::FLAGS_MEMORY_MAP;
+            }
         }
 
 
@@ -2042,10 +2059,12 @@ namespace AZ::IO
                     break;
                 }
 
-                info.m_decompressor = []([[maybe_unused]] const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
+                // keep the archive's dictionary alive for as long as the streamer holds on to the decompressor
+                info.m_decompressor = [dictionary = archive->GetCompressionDictionary()]([[maybe_unused]] const AZ::IO::CompressionInfo& info,
+                    const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
                 {
                     size_t nSizeUncompressed = uncompressedBufferSize;
-                    return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
+                    return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize, dictionary.get()) == 0;
                 };
             }
         }
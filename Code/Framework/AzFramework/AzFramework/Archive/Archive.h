@@ -69,6 +69,8 @@ namespace AZ::IO
         uint32_t GetFileDataOffset();
 
         void* m_pFileData;
+        // false if m_pFileData points into the memory mapped archive instead of an allocation
+        bool m_ownsFileData;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
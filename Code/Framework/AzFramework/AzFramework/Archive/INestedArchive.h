@@ -137,6 +137,17 @@ namespace AZ::IO
         //   Deletes all files and directories in the archive.
         virtual int RemoveAll() = 0;
 
+        // Summary:
+        //   Stores a shared zstd dictionary in the archive.
+        // Description:
+        //   Files added afterwards with the ZSTD codec are compressed against it, which greatly improves the
+        //   ratio of small files. Only one dictionary can be set per archive, and it should be set before adding files.
+        virtual int SetCompressionDictionary(const void* pDictionary, size_t nSize) = 0;
+
+        // Summary:
+        //   Returns true if the archive contains a shared compression dictionary.
+        virtual bool HasCompressionDictionary() const = 0;
+
         // Summary:
         //   Lists all the files in the archive.
         virtual int ListAllFiles(AZStd::vector<AZ::IO::Path>& outFileEntries) = 0;
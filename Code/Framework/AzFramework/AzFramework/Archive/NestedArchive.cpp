@@ -95,6 +95,22 @@ namespace AZ::IO
         return m_pCache->RemoveAll();
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    int NestedArchive::SetCompressionDictionary(const void* pDictionary, size_t nSize)
+    {
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            return ZipDir::ZD_ERROR_INVALID_CALL;
+        }
+
+        return m_pCache->SetCompressionDictionary(pDictionary, nSize);
+    }
+
+    bool NestedArchive::HasCompressionDictionary() const
+    {
+        return m_pCache->GetCompressionDictionary() != nullptr;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Helper for 'ListAllFiles' to recursively traverse the FileEntryTree and gather all the files
     void EnumerateFilesRecursive(AZ::IO::Path currentPath, ZipDir::FileEntryTree* currentTree, AZStd::vector<AZ::IO::Path>& fileList)
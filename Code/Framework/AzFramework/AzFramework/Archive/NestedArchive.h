@@ -68,6 +68,11 @@ namespace AZ::IO
         // deletes all files from the archive
         int RemoveAll() override;
 
+        // stores a shared zstd dictionary in the archive, used when compressing files with the ZSTD codec
+        int SetCompressionDictionary(const void* pDictionary, size_t nSize) override;
+
+        bool HasCompressionDictionary() const override;
+
         // lists all the files in the archive
         int ListAllFiles(AZStd::vector<AZ::IO::Path>& outFileEntries) override;
 
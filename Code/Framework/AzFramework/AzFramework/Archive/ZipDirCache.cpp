@@ -172,6 +172,8 @@ namespace AZ::IO::ZipDir
                     }
             }
 
+            m_mappedFile.Unmap();
+
             if (m_fileHandle != AZ::IO::InvalidHandle)                      // RelinkZip() might have closed the file
             {
                 AZ::IO::FileIOBase::GetDirectInstance()->Close(m_fileHandle);
@@ -245,6 +247,8 @@ namespace AZ::IO::ZipDir
             return ZSTD_compressBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
+        case CompressionCodec::Codec::ZSTD_SEEKABLE:
+            return GetZSTDSeekableCompressBound(uncompressedSize);
         default:
             AZ_Assert(false, "Unknown codec passed in for size estimate");
             break;
@@ -279,7 +283,7 @@ namespace AZ::IO::ZipDir
             switch (codec)
             {
             case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel, m_compressionDictionary.get());
                 break;
 
             case CompressionCodec::Codec::ZLIB:
@@ -289,6 +293,10 @@ namespace AZ::IO::ZipDir
             case CompressionCodec::Codec::LZ4:
                 nError = ZipRawCompressLZ4(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
                 break;
+
+            case CompressionCodec::Codec::ZSTD_SEEKABLE:
+                nError = ZipRawCompressZSTDSeekable(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                break;
             }
             if (Z_OK != nError)
             {
@@ -611,6 +619,10 @@ namespace AZ::IO::ZipDir
         if (e == ZD_ERROR_SUCCESS)
         {
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
+            if (szRelativePath == AZ::IO::PathView(CompressionDictionaryFileName))
+            {
+                m_compressionDictionary.reset();
+            }
 
             if (az_archive_zip_directory_cache_verbosity)
             {
@@ -669,10 +681,51 @@ namespace AZ::IO::ZipDir
         if (e == ZD_ERROR_SUCCESS)
         {
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
+            m_compressionDictionary.reset();
+        }
+        return e;
+    }
+
+    ErrorEnum Cache::SetCompressionDictionary(const void* pDictionary, size_t nSize)
+    {
+        if (m_compressionDictionary || (m_nFlags & FLAGS_READ_ONLY))
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        CompressionDictionaryPtr dictionary = CompressionDictionary::Create(pDictionary, nSize);
+        if (!dictionary)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        // the dictionary is stored uncompressed so it can be read before any other entry is decompressed
+        ErrorEnum e = UpdateFile(CompressionDictionaryFileName, pDictionary, nSize, ZipFile::METHOD_STORE);
+        if (e == ZD_ERROR_SUCCESS)
+        {
+            m_compressionDictionary = AZStd::move(dictionary);
         }
         return e;
     }
 
+    void Cache::LoadCompressionDictionary()
+    {
+        FileEntry* pFileEntry = FindFile(CompressionDictionaryFileName);
+        if (!pFileEntry || pFileEntry->desc.lSizeUncompressed == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<uint8_t> dictionaryData(pFileEntry->desc.lSizeUncompressed);
+        if (ReadFile(pFileEntry, nullptr, dictionaryData.data()) != ZD_ERROR_SUCCESS)
+        {
+            AZ_Warning("Archive", false, "Failed to read the compression dictionary from archive %s", m_strFilePath.c_str());
+            return;
+        }
+        m_compressionDictionary = CompressionDictionary::Create(dictionaryData.data(), dictionaryData.size());
+        AZ_Warning("Archive", m_compressionDictionary, "Archive %s contains an invalid compression dictionary", m_strFilePath.c_str());
+    }
+
     ErrorEnum Cache::ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed)
     {
         if (!pFileEntry)
@@ -695,6 +748,22 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
+        if (pFileEntry->nMethod == ZipFile::METHOD_STORE && m_mappedFile.IsMapped())
+        {
+            // stored entries can be copied straight out of the mapped archive without a seek and read
+            void* pDestination = pUncompressed ? pUncompressed : pCompressed;
+            if (!pDestination)
+            {
+                return ZD_ERROR_INVALID_CALL;
+            }
+            AZStd::span<const uint8_t> storedData = GetStoredFileView(pFileEntry);
+            if (!storedData.empty())
+            {
+                memcpy(pDestination, storedData.data(), storedData.size());
+                return ZD_ERROR_SUCCESS;
+            }
+        }
+
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
         {
             return ZD_ERROR_IO_FAILED;
@@ -737,7 +806,7 @@ namespace AZ::IO::ZipDir
             else
             {
                 size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed, m_compressionDictionary.get()))
                 {
                     return ZD_ERROR_CORRUPTED_DATA;
                 }
@@ -757,6 +826,92 @@ namespace AZ::IO::ZipDir
         return ZD_ERROR_SUCCESS;
     }
 
+    ErrorEnum Cache::ReadStoredFileRange(FileEntry* pFileEntry, uint64_t nOffset, uint64_t nSize, void* pBuffer)
+    {
+        if (!pFileEntry || !pBuffer || pFileEntry->nMethod != ZipFile::METHOD_STORE)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        if (nOffset + nSize > pFileEntry->desc.lSizeUncompressed)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        if (nSize == 0)
+        {
+            return ZD_ERROR_SUCCESS;
+        }
+
+        if (AZStd::span<const uint8_t> storedData = GetStoredFileView(pFileEntry); !storedData.empty())
+        {
+            memcpy(pBuffer, storedData.data() + nOffset, nSize);
+            return ZD_ERROR_SUCCESS;
+        }
+
+        ErrorEnum nError = Refresh(pFileEntry);
+        if (nError != ZD_ERROR_SUCCESS)
+        {
+            return nError;
+        }
+
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset + nOffset, AZ::IO::SeekType::SeekFromStart))
+        {
+            return ZD_ERROR_IO_FAILED;
+        }
+
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, nSize, true))
+        {
+            return ZD_ERROR_IO_FAILED;
+        }
+
+        return ZD_ERROR_SUCCESS;
+    }
+
+    bool Cache::MapArchiveFile()
+    {
+        if (!(m_nFlags & FLAGS_READ_ONLY) || m_fileHandle == AZ::IO::InvalidHandle)
+        {
+            return false;
+        }
+        if (m_mappedFile.IsMapped())
+        {
+            return true;
+        }
+
+        // use the path the file handle was opened with as the stored path may not have been memorized or resolved
+        char filePath[AZ::IO::MaxPathLength];
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->GetFilename(m_fileHandle, filePath, AZ_ARRAY_SIZE(filePath)))
+        {
+            return false;
+        }
+
+        if (!m_mappedFile.Map(filePath))
+        {
+            if (az_archive_zip_directory_cache_verbosity)
+            {
+                AZ_TracePrintf("Archive", "Unable to memory map archive %s, falling back to file reads", filePath);
+            }
+            return false;
+        }
+        return true;
+    }
+
+    AZStd::span<const uint8_t> Cache::GetStoredFileView(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_STORE || !m_mappedFile.IsMapped())
+        {
+            return {};
+        }
+
+        // the data offset is lazily read from the local file header the first time the entry is accessed
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        return m_mappedFile.GetView(pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeUncompressed);
+    }
 
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
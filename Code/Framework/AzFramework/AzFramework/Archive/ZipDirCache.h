@@ -21,6 +21,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -83,6 +84,37 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // reads nSize bytes starting nOffset bytes into the data of a stored (uncompressed and unencrypted) entry.
+        // the range is copied out of the mapping if the archive is mapped, otherwise it's read through the file handle.
+        // the range must lie within the entry
+        ErrorEnum ReadStoredFileRange(FileEntry* pFileEntry, uint64_t nOffset, uint64_t nSize, void* pBuffer);
+
+        // stores the given zstd dictionary in the archive. All files compressed with the ZSTD codec afterwards will
+        // be compressed against it. A dictionary can only be set once for an archive and should be set before
+        // any files are added, as files written earlier won't benefit from it
+        ErrorEnum SetCompressionDictionary(const void* pDictionary, size_t nSize);
+
+        // returns the dictionary the archive was compressed with, or null if it doesn't use one
+        const CompressionDictionaryPtr& GetCompressionDictionary() const
+        {
+            return m_compressionDictionary;
+        }
+
+        // maps the whole archive into memory so stored entries can be read without going through the file handle.
+        // only supported for read-only caches, as writing to the archive would invalidate the mapping.
+        // returns false if the archive couldn't be mapped, in which case all reads continue to use the file handle
+        bool MapArchiveFile();
+
+        bool IsArchiveFileMapped() const
+        {
+            return m_mappedFile.IsMapped();
+        }
+
+        // returns a zero-copy view of the data of a stored (uncompressed and unencrypted) entry if the archive is mapped.
+        // the view remains valid for as long as this cache is alive. An empty span is returned if the entry
+        // is compressed or the archive isn't mapped
+        AZStd::span<const uint8_t> GetStoredFileView(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -128,11 +160,18 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        // loads the compression dictionary entry from the archive, if there is one
+        void LoadCompressionDictionary();
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
         AZ::IO::HandleType m_fileHandle;
+        // optional read-only mapping of the archive, used for zero-copy access to stored entries
+        MappedFile m_mappedFile;
+        // shared zstd dictionary stored in the archive, null if the archive doesn't have one
+        CompressionDictionaryPtr m_compressionDictionary;
         AZ::IAllocator* m_allocator;
         AZ::IO::Path m_strFilePath;
 
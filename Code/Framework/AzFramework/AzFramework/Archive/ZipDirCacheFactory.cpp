@@ -147,6 +147,15 @@ namespace AZ::IO::ZipDir
         // the factory doesn't own it after that
         m_fileExt.m_fileHandle = AZ::IO::InvalidHandle;
 
+        if ((m_nFlags & FLAGS_MEMORY_MAP) && (m_nFlags & FLAGS_READ_ONLY))
+        {
+            // failing to map isn't an error, reads will go through the file handle instead
+            pCache->MapArchiveFile();
+        }
+
+        // archives written with a shared zstd dictionary need it before any of their entries can be decompressed
+        pCache->LoadCompressionDictionary();
+
         return pCache;
     }
 
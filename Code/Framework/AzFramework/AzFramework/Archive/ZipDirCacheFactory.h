@@ -32,6 +32,8 @@ namespace AZ::IO::ZipDir
             FLAGS_DONT_MEMORIZE_ZIP_PATH = 1 << 2,
             // if this is set, the archive will be created anew (the existing file will be overwritten)
             FLAGS_CREATE_NEW = 1 << 3,
+            // if this is set, read-only archives are memory mapped so stored entries can be accessed without file IO
+            FLAGS_MEMORY_MAP = 1 << 4,
 
             // if this is set, zip path will be searched inside other zips
             FLAGS_READ_INSIDE_PAK = 1 << 7,
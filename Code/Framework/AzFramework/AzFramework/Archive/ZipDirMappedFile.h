@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ::IO::ZipDir
+{
+    // Read-only mapping of an entire archive file into the address space of the process.
+    // Used by the Cache to hand out stored (uncompressed) entries without issuing a seek and read per access.
+    // The mapping stays valid until Unmap is called or the object is destroyed, so any view retrieved
+    // from it must not outlive the owner of the MappedFile.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Maps the file at the given absolute path. Returns false if the platform doesn't support mapping
+        // or the file couldn't be mapped, in which case the caller should continue to use regular reads.
+        bool Map(const char* filePath);
+        void Unmap();
+
+        bool IsMapped() const
+        {
+            return m_address != nullptr;
+        }
+
+        uint64_t GetSize() const
+        {
+            return m_size;
+        }
+
+        // Returns a view of the mapped range, or an empty span if the file isn't mapped or the range
+        // doesn't fit in the file.
+        AZStd::span<const uint8_t> GetView(uint64_t offset, uint64_t size) const
+        {
+            if (m_address == nullptr || offset > m_size || size > m_size - offset)
+            {
+                return {};
+            }
+            return { m_address + offset, static_cast<size_t>(size) };
+        }
+
+    private:
+        const uint8_t* m_address{};
+        uint64_t m_size{};
+        // Platform specific handle to the mapping object, if the platform needs one.
+        void* m_mappingHandle{};
+    };
+} // namespace AZ::IO::ZipDir
@@ -9,8 +9,10 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionSeekTable.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -23,6 +25,22 @@
 
 namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 {
+    // Decompressing with a dictionary requires a context. Creating one for every entry is costly, so every thread
+    // that reads from archives keeps one around.
+    static ZSTD_DCtx* GetZstdDecompressionContext()
+    {
+        struct ZstdDecompressionContext
+        {
+            ~ZstdDecompressionContext()
+            {
+                ZSTD_freeDCtx(m_context);
+            }
+            ZSTD_DCtx* m_context{ ZSTD_createDCtx() };
+        };
+        thread_local ZstdDecompressionContext context;
+        return context.m_context;
+    }
+
     static void* ZlibAlloc(void* userData, uint32_t item, uint32_t size)
     {
         auto allocator = reinterpret_cast<AZ::IAllocator*>(userData);
@@ -318,6 +336,43 @@ namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 
 namespace AZ::IO::ZipDir
 {
+    AZStd::intrusive_ptr<CompressionDictionary> CompressionDictionary::Create(const void* pDictionary, size_t nSize)
+    {
+        if (!pDictionary || nSize == 0)
+        {
+            return {};
+        }
+
+        AZStd::intrusive_ptr<CompressionDictionary> dictionary{ aznew CompressionDictionary };
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(pDictionary);
+        dictionary->m_data.assign(data, data + nSize);
+        dictionary->m_decompressionDictionary = ZSTD_createDDict(dictionary->m_data.data(), dictionary->m_data.size());
+        if (!dictionary->m_decompressionDictionary)
+        {
+            AZ_Error("ZipDirStructures", false, "Unable to create a zstd decompression dictionary from %zu bytes.", nSize);
+            return {};
+        }
+        dictionary->m_id = ZSTD_getDictID_fromDDict(dictionary->m_decompressionDictionary);
+        return dictionary;
+    }
+
+    CompressionDictionary::~CompressionDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    const ZSTD_CDict_s* CompressionDictionary::GetCompressionDictionary()
+    {
+        AZStd::scoped_lock lock(m_compressionDictionaryLock);
+        if (!m_compressionDictionary)
+        {
+            // use the same compression level as ZipRawCompressZSTD uses without a dictionary
+            m_compressionDictionary = ZSTD_createCDict(m_data.data(), m_data.size(), 1);
+        }
+        return m_compressionDictionary;
+    }
+
 
     //////////////////////////////////////////////////////////////////////////
     void CZipFile::LoadToMemory(AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData)
@@ -516,14 +571,26 @@ namespace AZ::IO::ZipDir
     // with 2 differences: there are no 16-bit checks, and
     // it initializes the inflation to start without waiting for compression method byte, as this is the
     // way it's stored into zip file
-    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize)
+    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize, const CompressionDictionary* pDictionary)
     {
         int nReturnCode = Z_OK;
 
         //check first 4 bytes to see what compression codec was used
         if (CompressionCodec::TestForZSTDMagic(pCompressed))
         {
-            size_t result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+            size_t result;
+            // Frames only record the id of the dictionary they were compressed with, which is 0 both without a dictionary and
+            // with a raw content dictionary. Raw content only primes the history the frame can refer back to, so a frame that
+            // was compressed without it decompresses to the same data with it.
+            if (pDictionary && ZSTD_getDictID_fromFrame(pCompressed, nSrcSize) == pDictionary->GetId())
+            {
+                result = ZSTD_decompress_usingDDict(ZipDirStructuresInternal::GetZstdDecompressionContext(),
+                    pUncompressed, *pDestSize, pCompressed, nSrcSize, pDictionary->GetDecompressionDictionary());
+            }
+            else
+            {
+                result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+            }
 
             if (ZSTD_isError(result))
             {
@@ -614,9 +681,19 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel, CompressionDictionary* pDictionary)
     {
-        size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
+        size_t result;
+        if (pDictionary)
+        {
+            ZSTD_CCtx* context = ZSTD_createCCtx();
+            result = ZSTD_compress_usingCDict(context, pCompressed, *pDestSize, pUncompressed, nSrcSize, pDictionary->GetCompressionDictionary());
+            ZSTD_freeCCtx(context);
+        }
+        else
+        {
+            result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
+        }
 
         int err = Z_OK;
 
@@ -632,6 +709,45 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
+    static constexpr size_t ZstdSeekableBlockSize = 256 * 1024;
+
+    size_t GetZSTDSeekableCompressBound(size_t nSrcSize)
+    {
+        size_t numBlocks = (nSrcSize + ZstdSeekableBlockSize - 1) / ZstdSeekableBlockSize;
+        return (numBlocks * ZSTD_compressBound(ZstdSeekableBlockSize)) + AZ::IO::CompressionSeekTable::FrameHeaderSize +
+            (numBlocks * 8) + AZ::IO::CompressionSeekTable::FooterSize; // Every seek table entry is 8 bytes.
+    }
+
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    {
+        const uint8_t* source = reinterpret_cast<const uint8_t*>(pUncompressed);
+        uint8_t* destination = reinterpret_cast<uint8_t*>(pCompressed);
+        size_t destinationSize = *pDestSize;
+        size_t written = 0;
+
+        AZ::IO::CompressionSeekTable seekTable;
+        for (size_t offset = 0; offset < nSrcSize; offset += ZstdSeekableBlockSize)
+        {
+            size_t blockSize = AZStd::min(ZstdSeekableBlockSize, nSrcSize - offset);
+            size_t result = ZSTD_compress(destination + written, destinationSize - written, source + offset, blockSize, 1);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error compressing using zstd: %s", ZSTD_getErrorName(result));
+                return Z_BUF_ERROR;
+            }
+            seekTable.AddBlock(aznumeric_cast<uint32_t>(result), aznumeric_cast<uint32_t>(blockSize));
+            written += result;
+        }
+
+        size_t tableSize = seekTable.Store(destination + written, destinationSize - written);
+        if (tableSize == 0)
+        {
+            return Z_BUF_ERROR;
+        }
+        *pDestSize = written + tableSize;
+        return Z_OK;
+    }
+
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
     {
         int returnCode = Z_OK;
@@ -15,6 +15,10 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
@@ -24,6 +28,8 @@
 
 
 struct z_stream_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
 
 namespace AZ::IO
 {
@@ -143,14 +149,55 @@ namespace AZ::IO::ZipDir
         FullValidation,
     };
 
+    // zstd dictionary that's shared by all entries in an archive. Many small files with similar content, such as the
+    // json based products, compress considerably better when the compressor can refer to the common content in a dictionary.
+    // The dictionary is stored in the archive itself as CompressionDictionaryFileName.
+    class CompressionDictionary
+        : public AZStd::intrusive_base
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressionDictionary, AZ::SystemAllocator, 0);
+
+        // returns nullptr if the data isn't a usable dictionary
+        static AZStd::intrusive_ptr<CompressionDictionary> Create(const void* pDictionary, size_t nSize);
+        ~CompressionDictionary() override;
+
+        // the id that's stored in the frame of every entry compressed with this dictionary. 0 for raw content dictionaries
+        uint32_t GetId() const { return m_id; }
+        const AZStd::vector<uint8_t>& GetData() const { return m_data; }
+
+        const ZSTD_DDict_s* GetDecompressionDictionary() const { return m_decompressionDictionary; }
+        // the compression dictionary is only created when the archive is written to, as digesting it is relatively expensive
+        const ZSTD_CDict_s* GetCompressionDictionary();
+
+    private:
+        CompressionDictionary() = default;
+
+        AZStd::vector<uint8_t> m_data;
+        AZStd::mutex m_compressionDictionaryLock;
+        ZSTD_CDict_s* m_compressionDictionary{};
+        ZSTD_DDict_s* m_decompressionDictionary{};
+        uint32_t m_id{};
+    };
+    using CompressionDictionaryPtr = AZStd::intrusive_ptr<CompressionDictionary>;
+
+    // the name of the entry in the root of an archive that holds the compression dictionary
+    inline static constexpr const char* CompressionDictionaryFileName = "zstd_dictionary.bin";
+
     // Uncompresses raw (without wrapping) data that is compressed with method 8 (deflated) in the Zip file
     // returns one of the Z_* errors (Z_OK upon success)
-    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize);
+    // zstd compressed data that was compressed with a dictionary requires the same dictionary to be passed in
+    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize, const CompressionDictionary* pDictionary = nullptr);
 
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     int ZipRawCompress(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+    // compresses with zstd. If a dictionary is provided it's used and the same dictionary is required for decompression
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel, CompressionDictionary* pDictionary = nullptr);
+    // compresses the data as a series of independent zstd frames of ZstdSeekableBlockSize bytes followed by an AZ::IO::CompressionSeekTable.
+    // The result can still be decompressed with ZipRawUncompress as the seek table is stored in a skippable frame.
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+    size_t GetZSTDSeekableCompressBound(size_t nSrcSize);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
     // fseek wrapper with memory in file support.
@@ -32,6 +32,11 @@ namespace AzFramework::AssetBenchmark
     AZ_CVAR(AZ::CVarFixedString, benchmarkLoadAssetLogLabel, "BenchmarkLoadAsset", nullptr, AZ::ConsoleFunctorFlags::Null,
         "Provide a log label for tagging the BenchmarkLoadAsset* outputs to make it easier to distinguish different benchmark runs.");
 
+    //! Optionally order the dependency loads of each requested asset by depth in the preload graph.
+    //! Running the same asset list with this on and off compares the two load orders of the AssetManager.
+    AZ_CVAR(bool, benchmarkLoadAssetUsePreloadGraph, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Controls whether or not the BenchmarkLoadAsset* commands load the dependencies of each asset ordered by dependency depth");
+
     static AZStd::vector<AZStd::pair<AZ::Data::AssetId, AZ::Data::AssetType>> s_benchmarkAssetList;
 
     // Given a list of assets, load them and time the results.
@@ -53,6 +58,12 @@ namespace AzFramework::AssetBenchmark
             AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>> requestedAssets;
             AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>> processedAssets;
 
+            // The AssetManager setting is restored once the run is complete so the benchmark doesn't change the behavior of
+            // any loads that happen afterwards.
+            const bool usePreloadGraph = benchmarkLoadAssetUsePreloadGraph;
+            const bool previousPreloadGraphEnabled = AZ::Data::AssetManager::Instance().GetPreloadGraphEnabled();
+            AZ::Data::AssetManager::Instance().SetPreloadGraphEnabled(usePreloadGraph);
+
             // Start timing.
             auto start = AZStd::chrono::system_clock::now();
 
@@ -170,14 +181,18 @@ namespace AzFramework::AssetBenchmark
                 "NewlyLoaded=%zu "
                 "Errors=%zu "
                 "TotalProcessed=%zu "
+                "PreloadGraph=%s "
                 "Time=%lld ms %s\n",
                 initialRequests,
                 previouslyLoadedAssets,
                 newlyLoadedAssets,
                 loadErrors,
                 (previouslyLoadedAssets + newlyLoadedAssets + loadErrors),
+                usePreloadGraph ? "on" : "off",
                 runMs.count(), (runMs >= maxWaitMs) ? "(request timed out)" : "");
 
+            AZ::Data::AssetManager::Instance().SetPreloadGraphEnabled(previousPreloadGraphEnabled);
+
             AZ_TracePrintf(static_cast<AZ::CVarFixedString>(benchmarkLoadAssetLogLabel).c_str(), "Benchmark run complete.\n");
 
         });
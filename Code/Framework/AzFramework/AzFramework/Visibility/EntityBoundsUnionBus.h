@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/EBus/Event.h>
 
 namespace AZ
 {
@@ -17,6 +18,9 @@ namespace AZ
 
 namespace AzFramework
 {
+    //! Signaled with the id of an entity whose cached local bounds union was recalculated and changed.
+    using EntityBoundsUnionChangedEvent = AZ::Event<AZ::EntityId>;
+
     //! Provides an interface to retrieve and update the union of all Aabbs on a single Entity.
     //! @note This will be the combination/union of all individual Component Aabbs.
     class IEntityBoundsUnion
@@ -43,6 +47,11 @@ namespace AzFramework
         //! @param entity the entity whose transform has been modified.
         virtual void OnTransformUpdated(AZ::Entity* entity) = 0;
 
+        //! Registers a handler to be notified when the cached local bounds union of an entity changes.
+        //! @note Transform changes do not signal this event, only changes to the bounds of the entity components.
+        //! @param handler the handler to receive the id of the entity whose bounds union changed
+        virtual void RegisterEntityBoundsUnionChangedEventHandler(EntityBoundsUnionChangedEvent::Handler& handler) = 0;
+
     protected:
         ~IEntityBoundsUnion() = default;
     };
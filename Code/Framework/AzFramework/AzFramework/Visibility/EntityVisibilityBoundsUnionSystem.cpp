@@ -156,8 +156,15 @@ namespace AzFramework
             if (auto instance_it = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
                 instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
-                instance_it->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
+                const AZ::Aabb localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
+                const bool boundsChanged = !localEntityBoundsUnion.IsClose(instance_it->second.m_localEntityBoundsUnion);
+                instance_it->second.m_localEntityBoundsUnion = localEntityBoundsUnion;
                 UpdateVisibilitySystem(entity, instance_it->second);
+
+                if (boundsChanged)
+                {
+                    m_entityBoundsUnionChangedEvent.Signal(entity->GetId());
+                }
             }
         }
 
@@ -175,6 +182,11 @@ namespace AzFramework
         }
     }
 
+    void EntityVisibilityBoundsUnionSystem::RegisterEntityBoundsUnionChangedEventHandler(EntityBoundsUnionChangedEvent::Handler& handler)
+    {
+        handler.Connect(m_entityBoundsUnionChangedEvent);
+    }
+
     void EntityVisibilityBoundsUnionSystem::OnTick(
         [[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
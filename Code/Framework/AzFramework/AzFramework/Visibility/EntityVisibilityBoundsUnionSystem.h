@@ -34,6 +34,7 @@ namespace AzFramework
         AZ::Aabb GetEntityWorldBoundsUnion(AZ::EntityId entityId) const override;
         void ProcessEntityBoundsUnionRequests() override;
         void OnTransformUpdated(AZ::Entity* entity) override;
+        void RegisterEntityBoundsUnionChangedEventHandler(EntityBoundsUnionChangedEvent::Handler& handler) override;
 
     private:
         struct EntityVisibilityBoundsUnionInstance
@@ -56,6 +57,7 @@ namespace AzFramework
 
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
+        EntityBoundsUnionChangedEvent m_entityBoundsUnionChangedEvent;
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
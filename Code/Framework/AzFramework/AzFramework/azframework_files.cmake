@@ -39,6 +39,7 @@ set(FILES
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
     Archive/ZipDirList.h
+    Archive/ZipDirMappedFile.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
     Archive/ZipFileFormat.h
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO::ZipDir
+{
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    bool MappedFile::Map(const char* filePath)
+    {
+        Unmap();
+
+        int fileDescriptor = ::open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStatus;
+        if (::fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+        {
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        const size_t size = static_cast<size_t>(fileStatus.st_size);
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore.
+        ::close(fileDescriptor);
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_address = reinterpret_cast<const uint8_t*>(address);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (m_address)
+        {
+            ::munmap(const_cast<uint8_t*>(m_address), static_cast<size_t>(m_size));
+            m_address = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO::ZipDir
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+namespace AZ::IO::ZipDir
+{
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    bool MappedFile::Map(const char* filePath)
+    {
+        Unmap();
+
+        AZStd::fixed_wstring<AZ::IO::MaxPathLength> filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+
+        HANDLE file = ::CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // The mapping object keeps its own reference to the file, so the file handle isn't needed anymore.
+        ::CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        void* address = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (address == nullptr)
+        {
+            ::CloseHandle(mapping);
+            return false;
+        }
+
+        m_address = reinterpret_cast<const uint8_t*>(address);
+        m_size = aznumeric_cast<uint64_t>(fileSize.QuadPart);
+        m_mappingHandle = mapping;
+        return true;
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (m_address)
+        {
+            ::UnmapViewOfFile(m_address);
+            m_address = nullptr;
+            m_size = 0;
+        }
+        if (m_mappingHandle)
+        {
+            ::CloseHandle(m_mappingHandle);
+            m_mappingHandle = nullptr;
+        }
+    }
+} // namespace AZ::IO::ZipDir
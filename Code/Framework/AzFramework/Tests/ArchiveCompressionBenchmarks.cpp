@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares compressing the small json based products of the AutomatedTesting project with and without
+    //! a shared zstd dictionary. The project's cache has to be built for the benchmarks to run.
+    class BM_ArchiveCompressionDictionary
+        : public benchmark::Fixture
+    {
+        static constexpr size_t MaxNumFiles = 2000;
+        static constexpr size_t MaxFileSize = 128 * 1024;
+        static constexpr size_t DictionarySize = 64 * 1024;
+
+        void internalSetUp()
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+            if (!AZ::AllocatorInstance<AZ::OSAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::OSAllocator>::Create();
+                m_ownsOSAllocator = true;
+            }
+
+            LoadFiles();
+            if (m_files.empty())
+            {
+                return;
+            }
+
+            // train on every other file so half of the files compressed in the benchmarks weren't seen during training
+            AZStd::vector<char> samples;
+            AZStd::vector<size_t> sampleSizes;
+            for (size_t index = 0; index < m_files.size(); index += 2)
+            {
+                samples.insert(samples.end(), m_files[index].begin(), m_files[index].end());
+                sampleSizes.push_back(m_files[index].size());
+            }
+            AZStd::vector<char> dictionary(DictionarySize);
+            size_t dictionarySize = AZ::ZStd::TrainDictionary(
+                dictionary.data(), dictionary.size(), samples.data(), sampleSizes.data(), aznumeric_cast<unsigned int>(sampleSizes.size()));
+            m_dictionary = AZ::IO::ZipDir::CompressionDictionary::Create(dictionary.data(), dictionarySize);
+        }
+
+        void internalTearDown()
+        {
+            m_dictionary.reset();
+            m_files = {};
+            if (m_ownsOSAllocator)
+            {
+                AZ::AllocatorInstance<AZ::OSAllocator>::Destroy();
+            }
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+        void LoadFiles()
+        {
+            AZ::IO::FixedMaxPath cachePath = AZ::IO::FixedMaxPath(AZ::Utils::GetEnginePath()) / "AutomatedTesting" / "Cache" / AZ_TRAIT_OS_PLATFORM_CODENAME_LOWER;
+
+            AZStd::vector<AZ::IO::FixedMaxPath> filePaths;
+            AZStd::vector<AZ::IO::FixedMaxPath> folders{ cachePath };
+            while (!folders.empty())
+            {
+                AZ::IO::FixedMaxPath folder = folders.back();
+                folders.pop_back();
+                AZ::IO::SystemFile::FindFiles((folder / "*").c_str(), [&folder, &folders, &filePaths](const char* item, bool isFile)
+                {
+                    AZStd::string_view name(item);
+                    if (name == "." || name == "..")
+                    {
+                        return true;
+                    }
+                    if (!isFile)
+                    {
+                        folders.push_back(folder / name);
+                    }
+                    else if (name.ends_with(".azmaterial") || name.ends_with(".prefab") || name.ends_with(".spawnable"))
+                    {
+                        filePaths.push_back(folder / name);
+                    }
+                    return true;
+                });
+            }
+
+            // keep the selection stable between runs regardless of the order the file system returns entries in
+            AZStd::sort(filePaths.begin(), filePaths.end());
+            for (const AZ::IO::FixedMaxPath& filePath : filePaths)
+            {
+                if (m_files.size() == MaxNumFiles)
+                {
+                    break;
+                }
+                auto readResult = AZ::Utils::ReadFile<AZStd::vector<char>>(filePath.Native(), MaxFileSize);
+                if (readResult.IsSuccess() && !readResult.GetValue().empty())
+                {
+                    m_files.push_back(readResult.TakeValue());
+                }
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        //! Compresses all files and returns their compressed versions
+        AZStd::vector<AZStd::vector<char>> CompressFiles(AZ::IO::ZipDir::CompressionDictionary* dictionary)
+        {
+            AZStd::vector<AZStd::vector<char>> compressedFiles;
+            compressedFiles.reserve(m_files.size());
+            for (const AZStd::vector<char>& file : m_files)
+            {
+                // generous upper bound of ZSTD_compressBound for files up to MaxFileSize
+                size_t compressedSize = file.size() + (file.size() >> 7) + 256;
+                AZStd::vector<char> compressed(compressedSize);
+                AZ::IO::ZipDir::ZipRawCompressZSTD(file.data(), &compressedSize, compressed.data(), file.size(), 1, dictionary);
+                compressed.resize(compressedSize);
+                compressedFiles.push_back(AZStd::move(compressed));
+            }
+            return compressedFiles;
+        }
+
+        void Compress(benchmark::State& state, AZ::IO::ZipDir::CompressionDictionary* dictionary)
+        {
+            if (m_files.empty() || !m_dictionary)
+            {
+                state.SkipWithError("No products found in the AutomatedTesting cache.");
+                return;
+            }
+
+            size_t uncompressedBytes = 0;
+            size_t compressedBytes = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<AZStd::vector<char>> compressedFiles = CompressFiles(dictionary);
+                uncompressedBytes = 0;
+                compressedBytes = 0;
+                for (size_t index = 0; index < m_files.size(); ++index)
+                {
+                    uncompressedBytes += m_files[index].size();
+                    compressedBytes += compressedFiles[index].size();
+                }
+            }
+
+            state.SetBytesProcessed(state.iterations() * uncompressedBytes);
+            state.counters["Files"] = aznumeric_cast<double>(m_files.size());
+            state.counters["CompressionRatio"] = aznumeric_cast<double>(uncompressedBytes) / aznumeric_cast<double>(compressedBytes);
+        }
+
+        void Decompress(benchmark::State& state, AZ::IO::ZipDir::CompressionDictionary* dictionary)
+        {
+            if (m_files.empty() || !m_dictionary)
+            {
+                state.SkipWithError("No products found in the AutomatedTesting cache.");
+                return;
+            }
+
+            AZStd::vector<AZStd::vector<char>> compressedFiles = CompressFiles(dictionary);
+            AZStd::vector<char> uncompressed(MaxFileSize);
+            size_t uncompressedBytes = 0;
+            for (const AZStd::vector<char>& file : m_files)
+            {
+                uncompressedBytes += file.size();
+            }
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t index = 0; index < compressedFiles.size(); ++index)
+                {
+                    size_t uncompressedSize = m_files[index].size();
+                    AZ::IO::ZipDir::ZipRawUncompress(
+                        uncompressed.data(), &uncompressedSize, compressedFiles[index].data(), compressedFiles[index].size(), dictionary);
+                    benchmark::DoNotOptimize(uncompressed.data());
+                }
+            }
+
+            state.SetBytesProcessed(state.iterations() * uncompressedBytes);
+            state.counters["Files"] = aznumeric_cast<double>(m_files.size());
+        }
+
+        bool m_ownsSystemAllocator = false;
+        bool m_ownsOSAllocator = false;
+        AZStd::vector<AZStd::vector<char>> m_files;
+        AZ::IO::ZipDir::CompressionDictionaryPtr m_dictionary;
+    };
+
+    BENCHMARK_F(BM_ArchiveCompressionDictionary, CompressWithoutDictionary)(benchmark::State& state)
+    {
+        Compress(state, nullptr);
+    }
+
+    BENCHMARK_F(BM_ArchiveCompressionDictionary, CompressWithDictionary)(benchmark::State& state)
+    {
+        Compress(state, m_dictionary.get());
+    }
+
+    BENCHMARK_F(BM_ArchiveCompressionDictionary, DecompressWithoutDictionary)(benchmark::State& state)
+    {
+        Decompress(state, nullptr);
+    }
+
+    BENCHMARK_F(BM_ArchiveCompressionDictionary, DecompressWithDictionary)(benchmark::State& state)
+    {
+        Decompress(state, m_dictionary.get());
+    }
+} // namespace Benchmark
+
+#endif
@@ -7,6 +7,14 @@
  */
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/CompressionSeekTable.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -17,6 +25,7 @@
 #include <AzFramework/Archive/ArchiveFileIO.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 
 namespace UnitTest
 {
@@ -418,6 +427,389 @@ namespace UnitTest
         EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
     }
 
+    class ArchiveCompressionDictionaryTestFixture
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        ArchiveCompressionDictionaryTestFixture()
+            : m_application{ AZStd::make_unique<AzFramework::Application>() }
+        {}
+
+    protected:
+        // small, similar documents are the case dictionaries are meant for
+        static AZStd::string CreateSampleDocument(int index)
+        {
+            return AZStd::string::format(
+                R"({"Type": "JsonSerialization", "Version": 1, "ClassName": "MaterialSourceData", "ClassData": )"
+                R"({"materialType": "Materials/Types/StandardPBR.materialtype", "parentMaterial": "", "propertyLayoutVersion": 3, )"
+                R"("properties": {"baseColor": {"color": [%f, %f, %f, 1.0], "textureMap": "Textures/texture_%d_basecolor.png"}, )"
+                R"("roughness": {"factor": %f}, "metallic": {"factor": %f}}}})",
+                (index % 7) / 7.0f, (index % 11) / 11.0f, (index % 13) / 13.0f, index, (index % 5) / 5.0f, (index % 3) / 3.0f);
+        }
+
+        static AZStd::vector<char> TrainDictionary(size_t dictionarySize)
+        {
+            AZStd::string samples;
+            AZStd::vector<size_t> sampleSizes;
+            for (int index = 0; index < 1000; ++index)
+            {
+                AZStd::string sample = CreateSampleDocument(index);
+                samples += sample;
+                sampleSizes.push_back(sample.size());
+            }
+
+            AZStd::vector<char> dictionary(dictionarySize);
+            size_t trainedSize = AZ::ZStd::TrainDictionary(dictionary.data(), dictionary.size(), samples.data(), sampleSizes.data(), aznumeric_cast<unsigned int>(sampleSizes.size()));
+            dictionary.resize(trainedSize);
+            return dictionary;
+        }
+
+        static AZ::u64 CreateArchive(const char* path, const AZStd::vector<char>* dictionary, int numFiles)
+        {
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            auto pArchive = archive->OpenArchive(path, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            EXPECT_NE(nullptr, pArchive);
+            if (dictionary)
+            {
+                EXPECT_EQ(0, pArchive->SetCompressionDictionary(dictionary->data(), dictionary->size()));
+            }
+
+            // use documents the dictionary wasn't trained on
+            for (int index = 0; index < numFiles; ++index)
+            {
+                AZStd::string document = CreateSampleDocument(index + 5000);
+                auto fileName = AZ::StringFunc::Path::FixedString::format("material-%i.json", index);
+                EXPECT_EQ(0, pArchive->UpdateFile(fileName, document.data(), document.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                    AZ::IO::INestedArchive::LEVEL_NORMAL, CompressionCodec::Codec::ZSTD));
+            }
+            pArchive.reset();
+
+            AZ::u64 archiveSize = 0;
+            AZ::IO::FileIOBase::GetInstance()->Size(path, archiveSize);
+            return archiveSize;
+        }
+
+    private:
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+    };
+
+    TEST_F(ArchiveCompressionDictionaryTestFixture, TestArchivePacking_CompressionWithDictionary_FilesReadBackAndArchiveIsSmaller)
+    {
+        constexpr int numFiles = 64;
+        const char* testArchivePath = "@usercache@/archivedictionarytest.pak";
+        const char* referenceArchivePath = "@usercache@/archivenodictionarytest.pak";
+
+        AZStd::vector<char> dictionary = TrainDictionary(16 * 1024);
+        ASSERT_FALSE(dictionary.empty());
+
+        AZ::u64 dictionaryArchiveSize = CreateArchive(testArchivePath, &dictionary, numFiles);
+        AZ::u64 referenceArchiveSize = CreateArchive(referenceArchivePath, nullptr, numFiles);
+        EXPECT_TRUE(IsPackValid(testArchivePath));
+        EXPECT_LT(dictionaryArchiveSize, referenceArchiveSize);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_TRUE(pArchive->HasCompressionDictionary());
+
+        for (int index = 0; index < numFiles; ++index)
+        {
+            AZStd::string expected = CreateSampleDocument(index + 5000);
+            auto fileName = AZ::StringFunc::Path::FixedString::format("material-%i.json", index);
+            AZ::IO::INestedArchive::Handle hand = pArchive->FindFile(fileName);
+            ASSERT_NE(nullptr, hand);
+            ASSERT_EQ(expected.size(), pArchive->GetFileSize(hand));
+
+            AZStd::string contents(expected.size(), '\0');
+            EXPECT_EQ(0, pArchive->ReadFile(hand, contents.data()));
+            EXPECT_EQ(expected, contents);
+        }
+        pArchive.reset();
+
+        // a dictionary can only be set once as files compressed with the previous one would become unreadable
+        pArchive = archive->OpenArchive(testArchivePath);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_NE(0, pArchive->SetCompressionDictionary(dictionary.data(), dictionary.size()));
+        pArchive.reset();
+
+        AZ::IO::FileIOBase::GetInstance()->Remove(testArchivePath);
+        AZ::IO::FileIOBase::GetInstance()->Remove(referenceArchivePath);
+    }
+
+    TEST_F(ArchiveCompressionDictionaryTestFixture, TestArchivePacking_CompressionWithRawContentDictionary_FilesReadBack)
+    {
+        constexpr int numFiles = 16;
+        const char* testArchivePath = "@usercache@/archiverawdictionarytest.pak";
+
+        // any data that doesn't start with the zstd dictionary magic is used as raw content, and frames compressed with it
+        // store a dictionary id of 0, just like frames compressed without a dictionary
+        AZStd::string rawContent;
+        for (int index = 0; index < 8; ++index)
+        {
+            rawContent += CreateSampleDocument(index);
+        }
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+
+        // compressed before the dictionary is set, so it has to keep decompressing without it
+        AZStd::string plainDocument = CreateSampleDocument(4000);
+        EXPECT_EQ(0, pArchive->UpdateFile("material-nodictionary.json", plainDocument.data(), plainDocument.size(),
+            AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_NORMAL, CompressionCodec::Codec::ZSTD));
+
+        EXPECT_EQ(0, pArchive->SetCompressionDictionary(rawContent.data(), rawContent.size()));
+        for (int index = 0; index < numFiles; ++index)
+        {
+            AZStd::string document = CreateSampleDocument(index + 5000);
+            auto fileName = AZ::StringFunc::Path::FixedString::format("material-%i.json", index);
+            EXPECT_EQ(0, pArchive->UpdateFile(fileName, document.data(), document.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                AZ::IO::INestedArchive::LEVEL_NORMAL, CompressionCodec::Codec::ZSTD));
+        }
+        pArchive.reset();
+        EXPECT_TRUE(IsPackValid(testArchivePath));
+
+        pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_TRUE(pArchive->HasCompressionDictionary());
+
+        auto readFile = [&pArchive](const char* fileName, const AZStd::string& expected)
+        {
+            AZ::IO::INestedArchive::Handle hand = pArchive->FindFile(fileName);
+            ASSERT_NE(nullptr, hand);
+            ASSERT_EQ(expected.size(), pArchive->GetFileSize(hand));
+
+            AZStd::string contents(expected.size(), '\0');
+            EXPECT_EQ(0, pArchive->ReadFile(hand, contents.data()));
+            EXPECT_EQ(expected, contents);
+        };
+
+        readFile("material-nodictionary.json", plainDocument);
+        for (int index = 0; index < numFiles; ++index)
+        {
+            auto fileName = AZ::StringFunc::Path::FixedString::format("material-%i.json", index);
+            readFile(fileName.c_str(), CreateSampleDocument(index + 5000));
+        }
+        pArchive.reset();
+
+        AZ::IO::FileIOBase::GetInstance()->Remove(testArchivePath);
+    }
+
+    class ArchiveCompressionSeekableTestFixture
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        ArchiveCompressionSeekableTestFixture()
+            : m_application{ AZStd::make_unique<AzFramework::Application>() }
+        {}
+
+        void SetUp() override
+        {
+            // the block decompressor runs its decompression on jobs
+            if (!AZ::AllocatorInstance<AZ::PoolAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+                m_createdPoolAllocators = true;
+            }
+            if (!AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+                m_createdThreadPoolAllocators = true;
+            }
+        }
+
+        void TearDown() override
+        {
+            if (m_createdThreadPoolAllocators)
+            {
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            }
+            if (m_createdPoolAllocators)
+            {
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            }
+        }
+
+    protected:
+        // Serves the reads of the block decompressor straight from the archive file, so archives can be decompressed
+        // without setting up a full streamer stack.
+        class ArchiveFileReader
+            : public AZ::IO::StreamStackEntry
+        {
+        public:
+            struct Read
+            {
+                AZ::u64 m_offset;
+                AZ::u64 m_size;
+            };
+
+            ArchiveFileReader()
+                : AZ::IO::StreamStackEntry("Archive file reader")
+            {}
+
+            void QueueRequest(AZ::IO::FileRequest* request) override
+            {
+                bool success = false;
+                if (auto data = AZStd::get_if<AZ::IO::Requests::ReadData>(&request->GetCommand()); data != nullptr)
+                {
+                    m_reads.push_back(Read{ data->m_offset, data->m_size });
+
+                    AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetDirectInstance();
+                    AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+                    if (fileIo->Open(data->m_path.GetAbsolutePathCStr(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle))
+                    {
+                        success = fileIo->Seek(fileHandle, data->m_offset, AZ::IO::SeekType::SeekFromStart) &&
+                            fileIo->Read(fileHandle, data->m_output, data->m_size, true);
+                        fileIo->Close(fileHandle);
+                    }
+                }
+                request->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+
+            AZStd::vector<Read> m_reads;
+        };
+
+        static constexpr size_t BlockSize = 256 * 1024;
+
+        static AZStd::vector<AZ::u8> CreateData(size_t size)
+        {
+            // compressible, but not so much that blocks become trivially small
+            AZStd::vector<AZ::u8> data(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<AZ::u8>((i * 7) ^ (i >> 10));
+            }
+            return data;
+        }
+
+        // reads the range through a block decompressor, returns true if the read completed
+        static bool ReadThroughBlockDecompressor(const AZ::IO::CompressionInfo& info, AZ::u64 offset, AZ::u64 size, AZ::u8* output,
+            ArchiveFileReader& reader)
+        {
+            AZ::IO::StreamerContext context;
+            auto decompressor = AZStd::make_shared<AZ::IO::BlockDecompressor>(2, 2, 4096, 0);
+            decompressor->SetNext(AZStd::shared_ptr<AZ::IO::StreamStackEntry>(&reader, [](AZ::IO::StreamStackEntry*) {}));
+            decompressor->SetContext(context);
+
+            bool completed = false;
+            AZ::IO::IStreamerTypes::RequestStatus status = AZ::IO::IStreamerTypes::RequestStatus::Pending;
+            AZ::IO::FileRequest* request = context.GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, info, output, offset, size);
+            request->SetCompletionCallback([&completed, &status](AZ::IO::FileRequest& request)
+            {
+                completed = true;
+                status = request.GetStatus();
+            });
+            decompressor->QueueRequest(request);
+
+            while (!completed)
+            {
+                decompressor->ExecuteRequests();
+                context.FinalizeCompletedRequests();
+            }
+            return status == AZ::IO::IStreamerTypes::RequestStatus::Completed;
+        }
+
+    private:
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        bool m_createdPoolAllocators{ false };
+        bool m_createdThreadPoolAllocators{ false };
+    };
+
+    TEST_F(ArchiveCompressionSeekableTestFixture, ZipRawCompressZSTDSeekable_MultipleBlocks_BlocksDecompressIndependently)
+    {
+        const AZStd::vector<AZ::u8> source = CreateData(2 * BlockSize + 1000);
+
+        size_t compressedSize = AZ::IO::ZipDir::GetZSTDSeekableCompressBound(source.size());
+        AZStd::vector<AZ::u8> compressed(compressedSize);
+        ASSERT_EQ(0, AZ::IO::ZipDir::ZipRawCompressZSTDSeekable(source.data(), &compressedSize, compressed.data(), source.size(), 1));
+        ASSERT_GE(compressedSize, AZ::IO::CompressionSeekTable::FooterSize);
+        compressed.resize(compressedSize);
+
+        // the seek table is at the end of the compressed data and describes one block per BlockSize bytes
+        size_t tableSize = AZ::IO::CompressionSeekTable::GetTableSize(compressed.data() + compressed.size() - AZ::IO::CompressionSeekTable::FooterSize);
+        ASSERT_NE(0, tableSize);
+        AZ::IO::CompressionSeekTable table;
+        ASSERT_TRUE(table.Load(compressed.data() + compressed.size() - tableSize, tableSize, compressed.size(), source.size()));
+        ASSERT_EQ(3, table.GetNumBlocks());
+
+        for (size_t block = 0; block < table.GetNumBlocks(); ++block)
+        {
+            const AZ::IO::CompressionSeekTable::Block& begin = table.GetBlock(block);
+            const AZ::IO::CompressionSeekTable::Block& end = table.GetBlock(block + 1);
+            EXPECT_EQ(block * BlockSize, begin.m_uncompressedOffset);
+
+            size_t blockSize = aznumeric_cast<size_t>(end.m_uncompressedOffset - begin.m_uncompressedOffset);
+            AZStd::vector<AZ::u8> uncompressed(blockSize);
+            EXPECT_EQ(0, AZ::IO::ZipDir::ZipRawUncompress(uncompressed.data(), &blockSize, compressed.data() + begin.m_compressedOffset,
+                aznumeric_cast<size_t>(end.m_compressedOffset - begin.m_compressedOffset), nullptr));
+            ASSERT_EQ(uncompressed.size(), blockSize);
+            EXPECT_TRUE(AZStd::equal(uncompressed.begin(), uncompressed.end(), source.begin() + begin.m_uncompressedOffset));
+        }
+
+        // decompressors that don't know about the seek table skip it and decompress the whole file
+        size_t uncompressedSize = source.size();
+        AZStd::vector<AZ::u8> uncompressed(uncompressedSize);
+        EXPECT_EQ(0, AZ::IO::ZipDir::ZipRawUncompress(uncompressed.data(), &uncompressedSize, compressed.data(), compressed.size(), nullptr));
+        EXPECT_EQ(source.size(), uncompressedSize);
+        EXPECT_EQ(source, uncompressed);
+    }
+
+    TEST_F(ArchiveCompressionSeekableTestFixture, TestArchivePacking_SeekableCodec_PartialReadsOnlyDecompressOverlappingBlocks)
+    {
+        const char* testArchivePath = "@usercache@/archiveseekabletest.pak";
+        const AZStd::vector<AZ::u8> source = CreateData(4 * BlockSize);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+        archive->ClosePack(testArchivePath);
+        AZ::IO::FileIOBase::GetInstance()->Remove(testArchivePath);
+
+        auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile("seekable.bin", source.data(), source.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+            AZ::IO::INestedArchive::LEVEL_NORMAL, CompressionCodec::Codec::ZSTD_SEEKABLE));
+        pArchive.reset();
+
+        // the whole file path still reads the entry
+        pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        AZ::IO::INestedArchive::Handle hand = pArchive->FindFile("seekable.bin");
+        ASSERT_NE(nullptr, hand);
+        AZStd::vector<AZ::u8> contents(source.size());
+        EXPECT_EQ(0, pArchive->ReadFile(hand, contents.data()));
+        EXPECT_EQ(source, contents);
+        pArchive.reset();
+
+        ASSERT_TRUE(archive->OpenPack(testArchivePath));
+        AZ::IO::CompressionInfo info;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "@usercache@/seekable.bin"));
+        ASSERT_TRUE(info.m_isCompressed);
+
+        // a read that spans the end of the second block and the start of the third block
+        const AZ::u64 readOffset = BlockSize + BlockSize / 2;
+        const AZ::u64 readSize = BlockSize;
+        AZStd::vector<AZ::u8> output(readSize);
+        ArchiveFileReader reader;
+        ASSERT_TRUE(ReadThroughBlockDecompressor(info, readOffset, readSize, output.data(), reader));
+        EXPECT_TRUE(AZStd::equal(output.begin(), output.end(), source.begin() + readOffset));
+
+        // the seek table is read from the end of the entry, followed by only the two blocks that overlap the read
+        ASSERT_EQ(2, reader.m_reads.size());
+        EXPECT_EQ(info.m_offset + info.m_compressedSize, reader.m_reads[0].m_offset + reader.m_reads[0].m_size);
+        EXPECT_GT(reader.m_reads[1].m_offset, info.m_offset);
+        EXPECT_LT(reader.m_reads[1].m_size, info.m_compressedSize * 3 / 4); // two of the four blocks
+
+        // the entire file decompresses through the blocks as well
+        output.resize(source.size());
+        ASSERT_TRUE(ReadThroughBlockDecompressor(info, 0, source.size(), output.data(), reader));
+        EXPECT_EQ(source, output);
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        AZ::IO::FileIOBase::GetInstance()->Remove(testArchivePath);
+    }
+
     INSTANTIATE_TEST_CASE_P(
         ArchiveCompression,
         ArchiveCompressionTestFixture,
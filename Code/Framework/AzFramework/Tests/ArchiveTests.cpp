@@ -23,6 +23,7 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/NestedArchive.h>
 
 namespace UnitTest
 {
@@ -280,6 +281,128 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveStoredFile_MemoryMappedArchive_ReadsCorrectData)
+    {
+        constexpr const char* storedFileInArchive = "levels\\mylevel\\stored.txt";
+        constexpr AZStd::string_view dataString = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        constexpr const char* testArchivePath = "@usercache@/stored.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        // create an archive with an entry that's stored without compression
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(storedFileInArchive, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        pArchive.reset();
+
+        // read-only archives are memory mapped when opened
+        pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_OPTIMIZED_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_TRUE(static_cast<AZ::IO::NestedArchive*>(pArchive.get())->GetCache()->IsArchiveFileMapped());
+        pArchive.reset();
+
+        EXPECT_TRUE(archive->OpenPack("@products@", testArchivePath));
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::FileSearchPriority::PakOnly)) });
+
+        // partial reads at an offset are copied straight out of the mapping
+        AZ::IO::HandleType fileHandle = archive->FOpen(storedFileInArchive, "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        constexpr size_t readOffset = 10;
+        constexpr size_t readSize = 6;
+        char readBuffer[readSize]{};
+        archive->FSeek(fileHandle, readOffset, SEEK_SET);
+        EXPECT_EQ(readSize, archive->FRead(readBuffer, readSize, fileHandle));
+        EXPECT_EQ(dataString.substr(readOffset, readSize), AZStd::string_view(readBuffer, readSize));
+        archive->FClose(fileHandle);
+
+        // the cached file data is handed out without a copy
+        TestFGetCachedFileData(storedFileInArchive, dataString.size(), dataString.data());
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        fileIo->Remove(testArchivePath);
+    }
+
+    TEST_F(ArchiveTestFixture, TestArchiveStoredFile_UnmappedArchive_ReadsOnlyRequestedRange)
+    {
+        constexpr const char* storedFileInArchive = "levels\\mylevel\\stored.txt";
+        constexpr AZStd::string_view dataString = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        bool memoryMapArchives = true;
+        console->GetCvarValue("az_archive_memory_map", memoryMapArchives);
+        console->PerformCommand("az_archive_memory_map", { "false" });
+
+        constexpr const char* testArchivePath = "@usercache@/stored_unmapped.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(storedFileInArchive, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        pArchive.reset();
+
+        // with mapping disabled stored entries are read through the file handle
+        pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_OPTIMIZED_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_FALSE(static_cast<AZ::IO::NestedArchive*>(pArchive.get())->GetCache()->IsArchiveFileMapped());
+        pArchive.reset();
+
+        EXPECT_TRUE(archive->OpenPack("@products@", testArchivePath));
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::FileSearchPriority::PakOnly)) });
+
+        AZ::IO::HandleType fileHandle = archive->FOpen(storedFileInArchive, "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+
+        // a partial read at an offset only writes the requested range, the guard bytes after it must be untouched
+        constexpr size_t readOffset = 10;
+        constexpr size_t readSize = 6;
+        constexpr char guardValue = '#';
+        char readBuffer[readSize * 2];
+        memset(readBuffer, guardValue, sizeof(readBuffer));
+        archive->FSeek(fileHandle, readOffset, SEEK_SET);
+        EXPECT_EQ(readSize, archive->FRead(readBuffer, readSize, fileHandle));
+        EXPECT_EQ(dataString.substr(readOffset, readSize), AZStd::string_view(readBuffer, readSize));
+        EXPECT_EQ(AZStd::string(readSize, guardValue), AZStd::string_view(readBuffer + readSize, readSize));
+
+        // reads past the end of the entry are clamped to the remaining data
+        constexpr size_t tailSize = 4;
+        memset(readBuffer, guardValue, sizeof(readBuffer));
+        archive->FSeek(fileHandle, dataString.size() - tailSize, SEEK_SET);
+        EXPECT_EQ(tailSize, archive->FRead(readBuffer, sizeof(readBuffer), fileHandle));
+        EXPECT_EQ(dataString.substr(dataString.size() - tailSize), AZStd::string_view(readBuffer, tailSize));
+        EXPECT_EQ(guardValue, readBuffer[tailSize]);
+        archive->FClose(fileHandle);
+
+        TestFGetCachedFileData(storedFileInArchive, dataString.size(), dataString.data());
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        fileIo->Remove(testArchivePath);
+
+        console->PerformCommand("az_archive_memory_map", { memoryMapArchives ? "true" : "false" });
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -11,6 +11,7 @@ set(FILES
     Spawnable/SpawnableEntitiesInterfaceTests.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
     Spawnable/SpawnableTests.cpp
+    ArchiveCompressionBenchmarks.cpp
     ArchiveCompressionTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
@@ -46,5 +46,7 @@ namespace AzNetworking
         uint64_t m_recvBytesUncompressed = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
+        //! Returns the total number of received packets that were decoded on the task graph rather than the update thread.
+        uint64_t m_recvPacketsShardDecoded = 0;
     };
 }
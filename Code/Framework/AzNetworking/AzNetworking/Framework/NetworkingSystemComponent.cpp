@@ -200,6 +200,7 @@ namespace AzNetworking
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+            AZLOG_INFO(" - Total received packets decoded on the task graph: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPacketsShardDecoded));
         }
     }
 }
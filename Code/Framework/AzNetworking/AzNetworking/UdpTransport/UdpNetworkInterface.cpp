@@ -18,6 +18,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AzNetworking
 {
@@ -38,8 +39,19 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
+    AZ_CVAR(bool, net_UdpBatchSends, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, packets sent while updating a Udp network interface are coalesced and written to the socket together");
+    AZ_CVAR(uint32_t, net_UdpReceiveShardCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of shards received Udp packets are decrypted and decompressed on in parallel, 0 or 1 decodes them on the network update thread");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
+    // Below this many packets per shard, handing the packets to the task graph costs more than decoding them in place
+    static constexpr uint32_t MinPacketsPerReceiveShard = 8;
+    // Number of packets each shard decodes at once. Decoding in windows just ahead of processing bounds the work spent on packets the
+    // timeslice ends up discarding, at the cost of submitting the shard graph once per window
+    static constexpr uint32_t PacketsPerReceiveShardWindow = 32;
+    // Marks a decoded payload that still points into the received packet and wasn't copied into the shard's storage
+    static constexpr uint32_t UncopiedPayloadOffset = AZStd::numeric_limits<uint32_t>::max();
+    static const AZ::TaskDescriptor ReceiveShardTaskDescriptor{ "UdpNetworkInterface::DecodeShard", "Networking" };
+
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
         const uint64_t intConnectionId = aznumeric_cast<uint64_t>(connectionId);
@@ -65,8 +77,9 @@ namespace AzNetworking
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
-        const AZ::Name compressorName = AZ::Name(compressor);
-        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        m_compressorName = AZ::Name(compressor);
+        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(m_compressorName);
+        m_decoder.m_compressor = m_compressor.get();
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -177,6 +190,25 @@ namespace AzNetworking
             return;
         }
 
+        // Acks, heartbeats, retransmits and connection handshakes generated below go out together at the end of the update
+        const bool batchSends = net_UdpBatchSends;
+        if (batchSends)
+        {
+            m_socket->BeginSendBatch();
+        }
+
+        // Decrypt and decompress the packets of connected connections in parallel, one window ahead of processing them in order below
+        const uint32_t shardCount = net_UdpReceiveShardCount;
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool taskGraphActive = (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+        const bool decodeSharded = taskGraphActive && (shardCount > 1);
+        m_decodedPackets.clear();
+        if (decodeSharded)
+        {
+            m_decodedPackets.resize(packets->size());
+        }
+        uint32_t shardDecodedEnd = 0;
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -190,6 +222,13 @@ namespace AzNetworking
                 break;
             }
 
+            const uint32_t remainingPackets = aznumeric_cast<uint32_t>(packets->size()) - i;
+            if (decodeSharded && (i >= shardDecodedEnd) && (remainingPackets >= shardCount * MinPacketsPerReceiveShard))
+            {
+                shardDecodedEnd = i + AZStd::min(remainingPackets, shardCount * PacketsPerReceiveShardWindow);
+                DecodePacketsSharded(*packets, i, shardDecodedEnd, shardCount);
+            }
+
             UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
             if (connection == nullptr)
             {
@@ -211,50 +250,39 @@ namespace AzNetworking
                 continue;
             }
 
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
+            // Use the result of the receive shards if they already decoded this packet
+            DecodedPacket inlineDecoded;
+            const DecodedPacket* decoded = &inlineDecoded;
+            if ((i < m_decodedPackets.size()) && (m_decodedPackets[i].m_connection == connection))
+            {
+                decoded = &m_decodedPackets[i];
+            }
+            else
+            {
+                DecodePacket(*connection, packet, m_decoder, inlineDecoded);
+            }
 
-            if (decodedPacketSize == 0)
+            if (decoded->m_decryptedSize == 0)
             {
                 // OpenSSL may have consumed packets during handshake negotiation
                 continue;
             }
-            else if (decodedPacketSize < 0)
+            else if (decoded->m_decryptedSize < 0)
             {
                 // Late unencrypted handshake packets or just random garbage can show up, discard and continue
                 continue;
             }
 
             connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
+            GetMetrics().m_recvBytesUncompressed += decoded->m_uncompressedBytes;
+            if (decoded->m_data == nullptr)
             {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+                continue;
             }
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
-            {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
-            }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
+            UdpPacketHeader header = decoded->m_header;
+            const uint8_t* decodedPacketData = decoded->m_data;
+            const int32_t decodedPacketSize = decoded->m_size;
 
             TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
             if (timeoutItem == nullptr)
@@ -335,6 +363,11 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        if (batchSends)
+        {
+            m_socket->EndSendBatch();
+        }
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -430,9 +463,9 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
-    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    bool UdpNetworkInterface::DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
-        if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
+        if (!compressor) // should probably have some compression handshake than relying on existence of compressor
         {
             AZLOG_ERROR("Decompress called without a compressor.");
             return false;
@@ -442,7 +475,7 @@ namespace AzNetworking
         AZStd::size_t bytesConsumed = 0;
 
         packetBufferOut.Resize(packetBufferOut.GetCapacity());
-        const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
+        const CompressorError compErr = compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
 
         if (compErr != CompressorError::Ok)
@@ -459,6 +492,138 @@ namespace AzNetworking
         return true;
     }
 
+    void UdpNetworkInterface::DecodePacket(UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet, PacketDecoder& decoder, DecodedPacket& outDecoded) const
+    {
+        outDecoded.m_connection = &connection;
+
+        int32_t decodedPacketSize = 0;
+        decoder.m_decryptBuffer.Resize(decoder.m_decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, decoder.m_decryptBuffer.GetBuffer(), decodedPacketSize);
+        decoder.m_decryptBuffer.Resize(decodedPacketSize);
+
+        outDecoded.m_decryptedSize = decodedPacketSize;
+        if (decodedPacketSize <= 0)
+        {
+            return;
+        }
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outDecoded.m_header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            outDecoded.m_uncompressedBytes += flagSerializer.GetReadSize();
+        }
+
+        if (decoder.m_compressor && outDecoded.m_header.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(decoder.m_compressor, decodedPacketData, decodedPacketSize, decoder.m_decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return;
+            }
+            decodedPacketData = decoder.m_decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(decoder.m_decompressBuffer.GetSize());
+        }
+        outDecoded.m_uncompressedBytes += decodedPacketSize;
+        outDecoded.m_data = decodedPacketData;
+        outDecoded.m_size = decodedPacketSize;
+    }
+
+    void UdpNetworkInterface::DecodePacketsSharded(const UdpReaderThread::ReceivedPackets& packets, uint32_t begin, uint32_t end, uint32_t shardCount)
+    {
+        if (m_receiveShards.size() != shardCount)
+        {
+            // The shard tasks only capture their shard index, so the graph is built once and resubmitted every update
+            m_receiveShards.clear();
+            m_receiveShardGraph = AZStd::make_unique<AZ::TaskGraph>();
+            for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+            {
+                AZStd::unique_ptr<ReceiveShard> shard = AZStd::make_unique<ReceiveShard>();
+                if (m_compressor)
+                {
+                    shard->m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(m_compressorName);
+                }
+                shard->m_decoder.m_compressor = shard->m_compressor.get();
+                m_receiveShards.push_back(AZStd::move(shard));
+
+                m_receiveShardGraph->AddTask(ReceiveShardTaskDescriptor, [this, shardIndex]()
+                {
+                    ReceiveShard& receiveShard = *m_receiveShards[shardIndex];
+                    receiveShard.m_decodedData.clear();
+                    receiveShard.m_dataOffsets.clear();
+                    for (uint32_t packetIndex : receiveShard.m_packetIndices)
+                    {
+                        const UdpReaderThread::ReceivedPacket& packet = (*m_shardedPackets)[packetIndex];
+                        DecodedPacket& decoded = m_decodedPackets[packetIndex];
+                        DecodePacket(*decoded.m_connection, packet, receiveShard.m_decoder, decoded);
+
+                        // A payload that was neither encrypted nor compressed still points into the received packet, which stays valid
+                        // until the next update. Anything else lives in the decoder buffers, which are reused for the next packet.
+                        const bool payloadInPacket = (decoded.m_data >= packet.m_buffer) && (decoded.m_data <= packet.m_buffer + packet.m_receivedBytes);
+                        if ((decoded.m_data != nullptr) && !payloadInPacket)
+                        {
+                            receiveShard.m_dataOffsets.push_back(aznumeric_cast<uint32_t>(receiveShard.m_decodedData.size()));
+                            receiveShard.m_decodedData.insert(receiveShard.m_decodedData.end(), decoded.m_data, decoded.m_data + decoded.m_size);
+                        }
+                        else
+                        {
+                            receiveShard.m_dataOffsets.push_back(UncopiedPayloadOffset);
+                        }
+                    }
+
+                    // The payload storage has stopped growing, point the copied payloads at it
+                    for (uint32_t i = 0; i < receiveShard.m_packetIndices.size(); ++i)
+                    {
+                        if (receiveShard.m_dataOffsets[i] != UncopiedPayloadOffset)
+                        {
+                            m_decodedPackets[receiveShard.m_packetIndices[i]].m_data = receiveShard.m_decodedData.data() + receiveShard.m_dataOffsets[i];
+                        }
+                    }
+                });
+            }
+        }
+
+        for (AZStd::unique_ptr<ReceiveShard>& shard : m_receiveShards)
+        {
+            shard->m_packetIndices.clear();
+        }
+
+        // Hash connections onto shards so that each connection's packets are decoded in order, and by a single thread
+        uint32_t shardedPacketCount = 0;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if ((connection == nullptr)
+             || (connection->GetConnectionState() != ConnectionState::Connected)
+             || connection->GetDtlsEndpoint().IsConnecting()
+             || (GetDisconnectReasonForSocketResult(packet.m_receivedBytes) != DisconnectReason::MAX))
+            {
+                // Anything that can change connection or encryption state is decoded in order on this thread
+                continue;
+            }
+
+            m_decodedPackets[i].m_connection = connection;
+            const uint32_t shardIndex = aznumeric_cast<uint32_t>(connection->GetConnectionId()) % shardCount;
+            m_receiveShards[shardIndex]->m_packetIndices.push_back(i);
+            ++shardedPacketCount;
+        }
+        GetMetrics().m_recvPacketsShardDecoded += shardedPacketCount;
+
+        m_shardedPackets = &packets;
+        AZ::TaskGraphEvent finishedEvent;
+        m_receiveShardGraph->Submit(&finishedEvent);
+        finishedEvent.Wait();
+        m_shardedPackets = nullptr;
+    }
+
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
         AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
@@ -545,6 +710,7 @@ namespace AzNetworking
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
             ChunkBuffer chunkBuffer;
+            m_socket->BeginSendBatch();
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
@@ -555,6 +721,7 @@ namespace AzNetworking
                 bytesRemaining -= nextChunkSize;
                 chunkStart += nextChunkSize;
             }
+            m_socket->EndSendBatch();
             AZ_Assert(bytesRemaining == 0, "Non-zero bytes remaining (%u) after chunking a packet into fragments", bytesRemaining);
 
             return localPacketId;
@@ -18,6 +18,11 @@
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
 
+namespace AZ
+{
+    class TaskGraph;
+}
+
 namespace AzNetworking
 {
     class IConnectionListener;
@@ -75,6 +80,16 @@ namespace AzNetworking
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement Datagram Layer Transport Security (DTLS) encryption
     //! on UDP traffic. Encryption operates as described in [O3DE Networking Encryption](http://o3de.org/docs/user-guide/networking/encryption)
     //! on the documentation website. Once both endpoints have completed their handshake, all traffic is expected to be fully encrypted.
+    //! 
+    //! ### Parallel receive decoding
+    //! 
+    //! Decrypting and decompressing received packets can be spread over the task graph by setting net_UdpReceiveShardCount. Only the
+    //! decoding is parallel: reliable queues, fragment reassembly, connection state and listener dispatch stay on the calling thread.
+    //! Connections are hashed onto shards by connection id, so the packets of a connection are always decoded in order by a single shard.
+    //! Each shard owns its compressor and scratch buffers, and writes its results into slots no other shard touches, so no locks are
+    //! taken. Packets are decoded in windows just ahead of being processed, so packets discarded by the timeslice are never decoded.
+    //! The decoded packets are processed in the order they were received. Only packets of fully connected connections are decoded
+    //! ahead of time, anything still negotiating a connection or encryption handshake is decoded while being processed.
     class UdpNetworkInterface final
         : public INetworkInterface
     {
@@ -126,11 +141,45 @@ namespace AzNetworking
         void RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics);
 
         //! Decompresses an incoming packet data buffer.
+        //! @param compressor      the compressor to decompress the packet with
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
         //! @param packetBufferOut the decoded data
         //! @return boolean true on success, false on failure
-        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+        bool DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+
+        //! Scratch state used to decode received packets, each receive shard owns one so shards can decode concurrently.
+        struct PacketDecoder
+        {
+            ICompressor* m_compressor = nullptr;
+            UdpPacketEncodingBuffer m_decryptBuffer;
+            UdpPacketEncodingBuffer m_decompressBuffer;
+        };
+
+        //! The result of decoding a received packet.
+        struct DecodedPacket
+        {
+            UdpConnection* m_connection = nullptr; //!< The connection the packet was decoded for, nullptr if it has not been decoded
+            UdpPacketHeader m_header;              //!< The packet header with only the packet flags read
+            const uint8_t* m_data = nullptr;       //!< The decoded payload, nullptr if the packet should be discarded
+            int32_t m_size = 0;                    //!< Size of the decoded payload
+            int32_t m_decryptedSize = 0;           //!< Size of the packet after decryption, <= 0 if decryption consumed or rejected it
+            uint32_t m_uncompressedBytes = 0;      //!< Number of uncompressed bytes read from the packet
+        };
+
+        //! Decrypts a received packet, reads its packet flags and decompresses its payload.
+        //! @param connection the connection that sent the packet
+        //! @param packet     the packet to decode
+        //! @param decoder    the scratch state to decode with, the decoded payload may point into its buffers
+        //! @param outDecoded the decoded packet
+        void DecodePacket(UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet, PacketDecoder& decoder, DecodedPacket& outDecoded) const;
+
+        //! Decodes a window of the received packets of fully connected connections on the receive shards ahead of processing them.
+        //! @param packets    the packets received since the last update
+        //! @param begin      index of the first packet of the window
+        //! @param end        index one past the last packet of the window
+        //! @param shardCount the number of shards to spread the connections over
+        void DecodePacketsSharded(const UdpReaderThread::ReceivedPackets& packets, uint32_t begin, uint32_t end, uint32_t shardCount);
 
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
@@ -178,6 +227,7 @@ namespace AzNetworking
         TimeoutQueue m_packetTimeoutQueue;
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
+        AZ::Name m_compressorName;
         UdpReaderThread& m_readerThread;
 
         struct RemovedConnection
@@ -188,8 +238,21 @@ namespace AzNetworking
         };
         AZStd::vector<RemovedConnection> m_removedConnections;
 
-        UdpPacketEncodingBuffer m_decryptBuffer;
-        UdpPacketEncodingBuffer m_decompressBuffer;
+        PacketDecoder m_decoder;
+
+        //! A receive shard, decodes the packets of the connections hashed onto it.
+        struct ReceiveShard
+        {
+            AZStd::unique_ptr<ICompressor> m_compressor;
+            PacketDecoder m_decoder;
+            AZStd::vector<uint32_t> m_packetIndices; //!< Indices of the received packets assigned to this shard for the current window
+            AZStd::vector<uint32_t> m_dataOffsets;   //!< Offsets of the copied payloads in m_decodedData, parallel to m_packetIndices
+            AZStd::vector<uint8_t> m_decodedData;    //!< Decrypted or decompressed payloads of this shard for the current window
+        };
+        AZStd::vector<AZStd::unique_ptr<ReceiveShard>> m_receiveShards;
+        AZStd::vector<DecodedPacket> m_decodedPackets; //!< Indexed like the received packets, filled in by the receive shards
+        const UdpReaderThread::ReceivedPackets* m_shardedPackets = nullptr; //!< The packets the receive shards are decoding
+        AZStd::unique_ptr<AZ::TaskGraph> m_receiveShardGraph;
 
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
@@ -176,7 +176,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +184,31 @@ namespace AzNetworking
                     break;
                 }
 
+                // Read as many packets as the receive buffer and packet list have room for in a single batch
+                const uint32_t bufferSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t packetSlots = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t maxCount = AZStd::min(AZStd::min(bufferSlots, packetSlots), MaxUdpReceiveBatchCount);
+                if (maxCount == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + maxCount * MaxUdpTransmissionUnit);
+
+                IpAddress addresses[MaxUdpReceiveBatchCount];
+                int32_t receivedBytes[MaxUdpReceiveBatchCount];
+                const uint32_t receivedCount = socket->ReceiveBatch(dstData, MaxUdpTransmissionUnit, addresses, receivedBytes, maxCount);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                // Packets are left at a fixed stride, the buffer is sized to hold MaxUdpReceivePacketCount full size packets
+                for (uint32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    receivedPackets.push_back(ReceivedPacket(addresses[i], dstData + i * MaxUdpTransmissionUnit, receivedBytes[i]));
                 }
-                else
+                receiveBuffer.Resize(bufferHead + receivedCount * MaxUdpTransmissionUnit);
+
+                if (receivedCount < maxCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
                     break;
                 }
             }
@@ -28,6 +28,7 @@ namespace AzNetworking
 
         static constexpr uint32_t MaxUdpReceivePacketCount = 1024;
         static constexpr uint32_t MaxUdpReceiveBufferSize = MaxUdpReceivePacketCount * MaxUdpTransmissionUnit;
+        static constexpr uint32_t MaxUdpReceiveBatchCount = 64;
 
         struct ReceivedPacket
         {
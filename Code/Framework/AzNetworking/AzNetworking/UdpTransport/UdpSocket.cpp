@@ -96,6 +96,10 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        if (m_sendBatch != nullptr)
+        {
+            FlushSendBatch();
+        }
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -224,9 +228,202 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    uint32_t UdpSocket::ReceiveBatch(uint8_t* outData, uint32_t stride, IpAddress* outAddresses, int32_t* outSizes, uint32_t maxCount) const
+    {
+        AZ_Assert(stride > 0, "Invalid stride for batched receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to batched receive");
+
+        if (!IsOpen() || (maxCount == 0))
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        static constexpr uint32_t MaxReceiveBatchCount = 64;
+        sockaddr_in from[MaxReceiveBatchCount];
+        iovec buffers[MaxReceiveBatchCount];
+        mmsghdr messages[MaxReceiveBatchCount];
+
+        uint32_t receivedCount = 0;
+        while (receivedCount < maxCount)
+        {
+            const uint32_t messageCount = AZStd::min(maxCount - receivedCount, MaxReceiveBatchCount);
+            for (uint32_t i = 0; i < messageCount; ++i)
+            {
+                buffers[i].iov_base = outData + (receivedCount + i) * stride;
+                buffers[i].iov_len = stride;
+                memset(&messages[i], 0, sizeof(messages[i]));
+                messages[i].msg_hdr.msg_name = &from[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t result = recvmmsg(static_cast<int32_t>(m_socketFd), messages, messageCount, 0, nullptr);
+            if (result <= 0)
+            {
+                if (result < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                    {
+                        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+                break;
+            }
+
+            uint8_t* const batchData = outData + receivedCount * stride;
+            for (int32_t i = 0; i < result; ++i)
+            {
+                const int32_t receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+                if (receivedBytes <= 0)
+                {
+                    continue;
+                }
+
+                // Keep payloads packed if an empty datagram was skipped earlier in this batch
+                uint8_t* const dstData = outData + receivedCount * stride;
+                if (dstData != batchData + i * stride)
+                {
+                    memmove(dstData, batchData + i * stride, receivedBytes);
+                }
+                outAddresses[receivedCount] = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+                outSizes[receivedCount] = receivedBytes;
+                ++receivedCount;
+                m_recvPackets++;
+                m_recvBytes += receivedBytes;
+            }
+
+            if (static_cast<uint32_t>(result) < messageCount)
+            {
+                // The socket has been drained
+                break;
+            }
+        }
+        return receivedCount;
+#else
+        uint32_t receivedCount = 0;
+        while (receivedCount < maxCount)
+        {
+            const int32_t receivedBytes = Receive(outAddresses[receivedCount], outData + receivedCount * stride, stride);
+            if (receivedBytes <= 0)
+            {
+                break;
+            }
+            outSizes[receivedCount] = receivedBytes;
+            ++receivedCount;
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::BeginSendBatch()
+    {
+        if (m_sendBatch == nullptr)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+        }
+        ++m_sendBatchDepth;
+    }
+
+    void UdpSocket::EndSendBatch()
+    {
+        AZ_Assert(m_sendBatchDepth > 0, "EndSendBatch called without a matching BeginSendBatch");
+        if (--m_sendBatchDepth == 0)
+        {
+            FlushSendBatch();
+        }
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        SendBatch& batch = *m_sendBatch;
+        const uint32_t count = aznumeric_cast<uint32_t>(batch.m_sizes.size());
+        if (count == 0)
+        {
+            return;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        sockaddr_in destAddrs[MaxSendBatchCount];
+        iovec buffers[MaxSendBatchCount];
+        mmsghdr messages[MaxSendBatchCount];
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            memset(&destAddrs[i], 0, sizeof(destAddrs[i]));
+            destAddrs[i].sin_family = AF_INET;
+            destAddrs[i].sin_addr.s_addr = batch.m_addresses[i].GetAddress(ByteOrder::Network);
+            destAddrs[i].sin_port = batch.m_addresses[i].GetPort(ByteOrder::Network);
+            buffers[i].iov_base = batch.m_data + i * MaxUdpTransmissionUnit;
+            buffers[i].iov_len = batch.m_sizes[i];
+            memset(&messages[i], 0, sizeof(messages[i]));
+            messages[i].msg_hdr.msg_name = &destAddrs[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(destAddrs[i]);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        uint32_t sentCount = 0;
+        while (sentCount < count)
+        {
+            const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, count - sentCount, 0);
+            if (result < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error)) // Filter would block messages, the remaining packets are dropped like a single send would
+                {
+                    break;
+                }
+
+                // Skip the packet that failed and keep sending the rest of the batch
+                AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                ++sentCount;
+                continue;
+            }
+            sentCount += static_cast<uint32_t>(result);
+        }
+#else
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            sockaddr_in destAddr;
+            memset(&destAddr, 0, sizeof(destAddr));
+            destAddr.sin_family = AF_INET;
+            destAddr.sin_addr.s_addr = batch.m_addresses[i].GetAddress(ByteOrder::Network);
+            destAddr.sin_port = batch.m_addresses[i].GetPort(ByteOrder::Network);
+            const char* data = reinterpret_cast<const char*>(batch.m_data + i * MaxUdpTransmissionUnit);
+            if (sendto(static_cast<int32_t>(m_socketFd), data, batch.m_sizes[i], 0, (sockaddr*)&destAddr, sizeof(destAddr)) < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+            }
+        }
+#endif
+
+        batch.m_addresses.clear();
+        batch.m_sizes.clear();
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if ((m_sendBatchDepth > 0) && (size <= MaxUdpTransmissionUnit))
+        {
+            // Copy the payload into the batch, it goes out when the batch fills or ends
+            SendBatch& batch = *m_sendBatch;
+            if (batch.m_sizes.full())
+            {
+                FlushSendBatch();
+            }
+            memcpy(batch.m_data + batch.m_sizes.size() * MaxUdpTransmissionUnit, data, size);
+            batch.m_addresses.push_back(address);
+            batch.m_sizes.push_back(size);
+            return static_cast<int32_t>(size);
+        }
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -93,6 +94,23 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to maxCount payloads from the UDP socket with as few system calls as the platform allows.
+        //! Payload i is written to outData + i * stride, its sender to outAddresses[i] and its size to outSizes[i].
+        //! @param outData      address to write the received data to, must hold maxCount * stride bytes
+        //! @param stride       maximum size of a single received payload
+        //! @param outAddresses on success, the addresses of the endpoints that sent the data
+        //! @param outSizes     on success, the number of bytes received for each payload
+        //! @param maxCount     maximum number of payloads to receive
+        //! @return number of payloads received, 0 if no data is pending or on error
+        uint32_t ReceiveBatch(uint8_t* outData, uint32_t stride, IpAddress* outAddresses, int32_t* outSizes, uint32_t maxCount) const;
+
+        //! Starts coalescing sends, payloads are copied and transmitted together when the batch fills or EndSendBatch is called.
+        //! Calls may be nested, sends are only flushed when the outermost batch ends.
+        void BeginSendBatch();
+
+        //! Ends a batch started by BeginSendBatch, transmitting any coalesced sends if this was the outermost batch.
+        void EndSendBatch();
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,7 +148,21 @@ namespace AzNetworking
 
     private:
 
+        //! Transmits all coalesced sends.
+        void FlushSendBatch() const;
+
+        static constexpr uint32_t MaxSendBatchCount = 64;
+
+        struct SendBatch
+        {
+            AZStd::fixed_vector<IpAddress, MaxSendBatchCount> m_addresses;
+            AZStd::fixed_vector<uint32_t, MaxSendBatchCount> m_sizes;
+            uint8_t m_data[MaxSendBatchCount * MaxUdpTransmissionUnit];
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        AZStd::unique_ptr<SendBatch> m_sendBatch;
+        uint32_t m_sendBatchDepth = 0;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    static constexpr uint16_t LoopbackReceivePort = 12347;
+    static constexpr uint32_t PacketsPerIteration = 64;
+    static constexpr uint32_t PacketSize = 256;
+
+    //! Sends packets to a socket on the loopback interface and reads them back on the same thread, so items per second is packets per core.
+    class UdpSocketLoopbackBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp()
+        {
+            SocketLayerInit();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver->Open(LoopbackReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sender->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+            m_payload.resize(PacketSize, 0xAB);
+            m_receiveBuffer.resize(PacketsPerIteration * MaxUdpTransmissionUnit);
+        }
+
+        void internalTearDown()
+        {
+            m_dtlsEndpoint.reset();
+            m_sender.reset();
+            m_receiver.reset();
+            m_payload = {};
+            m_receiveBuffer = {};
+            SocketLayerShutdown();
+        }
+
+        void SendPackets()
+        {
+            const IpAddress receiverAddress(127, 0, 0, 1, LoopbackReceivePort);
+            for (uint32_t i = 0; i < PacketsPerIteration; ++i)
+            {
+                m_sender->Send(receiverAddress, m_payload.data(), PacketSize, false, *m_dtlsEndpoint, ConnectionQuality());
+            }
+        }
+
+        // Stops early if packets were dropped so that a full receive buffer can't stall the benchmark
+        static constexpr uint32_t MaxEmptyReads = 1000;
+
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        AZStd::vector<uint8_t> m_payload;
+        AZStd::vector<uint8_t> m_receiveBuffer;
+    };
+
+    BENCHMARK_F(UdpSocketLoopbackBenchmark, SendReceive_SinglePacket)(benchmark::State& state)
+    {
+        int64_t receivedPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SendPackets();
+
+            IpAddress address;
+            uint32_t received = 0;
+            for (uint32_t emptyReads = 0; (received < PacketsPerIteration) && (emptyReads < MaxEmptyReads);)
+            {
+                if (m_receiver->Receive(address, m_receiveBuffer.data(), MaxUdpTransmissionUnit) > 0)
+                {
+                    ++received;
+                }
+                else
+                {
+                    ++emptyReads;
+                }
+            }
+            receivedPackets += received;
+        }
+        state.SetItemsProcessed(receivedPackets);
+    }
+
+    BENCHMARK_F(UdpSocketLoopbackBenchmark, SendReceive_Batched)(benchmark::State& state)
+    {
+        IpAddress addresses[PacketsPerIteration];
+        int32_t sizes[PacketsPerIteration];
+        int64_t receivedPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sender->BeginSendBatch();
+            SendPackets();
+            m_sender->EndSendBatch();
+
+            uint32_t received = 0;
+            for (uint32_t emptyReads = 0; (received < PacketsPerIteration) && (emptyReads < MaxEmptyReads);)
+            {
+                const uint32_t count = m_receiver->ReceiveBatch(m_receiveBuffer.data(), MaxUdpTransmissionUnit,
+                    addresses, sizes, PacketsPerIteration - received);
+                received += count;
+                emptyReads += (count == 0) ? 1 : 0;
+            }
+            receivedPackets += received;
+        }
+        state.SetItemsProcessed(receivedPackets);
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -9,14 +9,27 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+#if AZ_TRAIT_USE_OPENSSL
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#endif
 
 namespace UnitTest
 {
@@ -125,6 +138,184 @@ namespace UnitTest
         AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_networkingSystemComponent;
     };
 
+    //! Run length encodes payloads as (count, value) byte pairs, so repetitive test payloads compress.
+    class TestRunLengthCompressor
+        : public ICompressor
+    {
+    public:
+        bool Init() override
+        {
+            return true;
+        }
+
+        CompressorType GetType() const override
+        {
+            return CompressorType{ 0x524C45 };
+        }
+
+        AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const override
+        {
+            return maxCompSize / 2;
+        }
+
+        AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const override
+        {
+            return uncompSize * 2;
+        }
+
+        CompressorError Compress(const void* uncompData, AZStd::size_t uncompSize, void* compData, AZStd::size_t compDataSize, AZStd::size_t& compSize) override
+        {
+            const uint8_t* input = static_cast<const uint8_t*>(uncompData);
+            uint8_t* output = static_cast<uint8_t*>(compData);
+            compSize = 0;
+            for (AZStd::size_t i = 0; i < uncompSize;)
+            {
+                uint8_t count = 1;
+                while ((i + count < uncompSize) && (count < 255) && (input[i + count] == input[i]))
+                {
+                    ++count;
+                }
+                if (compSize + 2 > compDataSize)
+                {
+                    return CompressorError::InsufficientBuffer;
+                }
+                output[compSize++] = count;
+                output[compSize++] = input[i];
+                i += count;
+            }
+            return CompressorError::Ok;
+        }
+
+        CompressorError Decompress(const void* compData, AZStd::size_t compDataSize, void* uncompData, AZStd::size_t uncompDataSize, AZStd::size_t& consumedSize, AZStd::size_t& uncompSize) override
+        {
+            const uint8_t* input = static_cast<const uint8_t*>(compData);
+            uint8_t* output = static_cast<uint8_t*>(uncompData);
+            consumedSize = 0;
+            uncompSize = 0;
+            if ((compDataSize % 2) != 0)
+            {
+                return CompressorError::CorruptData;
+            }
+            for (; consumedSize < compDataSize; consumedSize += 2)
+            {
+                const uint8_t count = input[consumedSize];
+                if (uncompSize + count > uncompDataSize)
+                {
+                    return CompressorError::InsufficientBuffer;
+                }
+                memset(output + uncompSize, input[consumedSize + 1], count);
+                uncompSize += count;
+            }
+            return CompressorError::Ok;
+        }
+    };
+
+    class TestRunLengthCompressorFactory
+        : public ICompressorFactory
+    {
+    public:
+        AZStd::unique_ptr<ICompressor> Create() override
+        {
+            return AZStd::make_unique<TestRunLengthCompressor>();
+        }
+
+        AZ::Name GetFactoryName() const override
+        {
+            return AZ::Name(AZStd::string_view("TestRunLengthCompressor"));
+        }
+    };
+
+    //! Carries the sending client and a per client sequence number, padded with a run of bytes so it compresses.
+    class TestSequencePacket
+        : public IPacket
+    {
+    public:
+        static constexpr PacketType Type = PacketType{ static_cast<uint16_t>(static_cast<uint16_t>(CorePackets::PacketType::MAX) + 1) };
+        static constexpr uint32_t PaddingSize = 200;
+
+        TestSequencePacket() = default;
+        TestSequencePacket(uint32_t client, uint32_t sequence)
+            : m_client(client)
+            , m_sequence(sequence)
+        {
+            uint8_t padding[PaddingSize];
+            memset(padding, aznumeric_cast<uint8_t>(sequence), PaddingSize);
+            m_padding.CopyValues(padding, PaddingSize);
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return Type;
+        }
+
+        AZStd::unique_ptr<IPacket> Clone() const override
+        {
+            return AZStd::make_unique<TestSequencePacket>(*this);
+        }
+
+        bool Serialize(ISerializer& serializer) override
+        {
+            serializer.Serialize(m_client, "Client");
+            serializer.Serialize(m_sequence, "Sequence");
+            serializer.Serialize(m_padding, "Padding");
+            return serializer.IsValid();
+        }
+
+        uint32_t m_client = 0;
+        uint32_t m_sequence = 0;
+        ChunkBuffer m_padding;
+    };
+
+    //! Records the test packets a server receives, in dispatch order.
+    class TestRecordingConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        struct ReceivedPacket
+        {
+            ConnectionId m_connectionId;
+            uint32_t m_client;
+            uint32_t m_sequence;
+            bool m_paddingValid;
+        };
+
+        ConnectResult ValidateConnect(const IpAddress&, const IPacketHeader&, ISerializer&) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect(IConnection*) override
+        {
+        }
+
+        PacketDispatchResult OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            if (packetHeader.GetPacketType() != TestSequencePacket::Type)
+            {
+                return PacketDispatchResult::Failure;
+            }
+
+            TestSequencePacket packet;
+            if (!packet.Serialize(serializer))
+            {
+                return PacketDispatchResult::Failure;
+            }
+            const TestSequencePacket expected(packet.m_client, packet.m_sequence);
+            m_received.push_back({ connection->GetConnectionId(), packet.m_client, packet.m_sequence, packet.m_padding == expected.m_padding });
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost(IConnection*, PacketId) override
+        {
+        }
+
+        void OnDisconnect(IConnection*, DisconnectReason, TerminationEndpoint) override
+        {
+        }
+
+        AZStd::vector<ReceivedPacket> m_received;
+    };
+
     TEST_F(UdpTransportTests, PacketIdWrap)
     {
         const uint32_t SEQUENCE_BOUNDARY = 0xFFFF;
@@ -321,4 +512,248 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, SocketSendBatchReceiveBatch)
+    {
+        constexpr uint16_t ReceivePort = 12346;
+        constexpr uint32_t NumPackets = 100;
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        // More packets than fit in a single batch, so the batch is flushed once while it is still open
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceivePort);
+        DtlsEndpoint dtlsEndpoint;
+        uint8_t payload[NumPackets];
+        sender.BeginSendBatch();
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            payload[i] = aznumeric_cast<uint8_t>(i);
+            EXPECT_EQ(aznumeric_cast<int32_t>(i + 1), sender.Send(receiverAddress, payload, i + 1, false, dtlsEndpoint, ConnectionQuality()));
+        }
+        sender.EndSendBatch();
+        EXPECT_EQ(NumPackets, sender.GetSentPackets());
+
+        AZStd::vector<uint8_t> receiveBuffer(NumPackets * MaxUdpTransmissionUnit);
+        IpAddress addresses[NumPackets];
+        int32_t sizes[NumPackets];
+        uint32_t receivedCount = 0;
+        for (uint32_t attempt = 0; (attempt < 100) && (receivedCount < NumPackets); ++attempt)
+        {
+            receivedCount += receiver.ReceiveBatch(receiveBuffer.data() + receivedCount * MaxUdpTransmissionUnit, MaxUdpTransmissionUnit,
+                addresses + receivedCount, sizes + receivedCount, NumPackets - receivedCount);
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_EQ(NumPackets, receivedCount);
+        EXPECT_EQ(NumPackets, receiver.GetRecvPackets());
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            ASSERT_EQ(aznumeric_cast<int32_t>(i + 1), sizes[i]);
+            const uint8_t* data = receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+            EXPECT_EQ(0, memcmp(payload, data, sizes[i]));
+        }
+    }
+
+#if AZ_TRAIT_USE_OPENSSL
+    class TestTaskGraphActive
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    //! Writes a freshly generated self-signed certificate and its private key in PEM format, for DTLS between local endpoints.
+    static bool WriteSelfSignedCertificate(const char* certificatePath, const char* privateKeyPath)
+    {
+        EVP_PKEY* key = nullptr;
+        EVP_PKEY_CTX* keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr);
+        const bool keyGenerated = (keyContext != nullptr)
+            && (EVP_PKEY_keygen_init(keyContext) > 0)
+            && (EVP_PKEY_CTX_set_rsa_keygen_bits(keyContext, 2048) > 0)
+            && (EVP_PKEY_keygen(keyContext, &key) > 0);
+        EVP_PKEY_CTX_free(keyContext);
+        if (!keyGenerated)
+        {
+            return false;
+        }
+
+        X509* certificate = X509_new();
+        ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+        X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+        X509_gmtime_adj(X509_getm_notAfter(certificate), 60 * 60);
+        X509_set_pubkey(certificate, key);
+        X509_NAME* name = X509_get_subject_name(certificate);
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+        X509_set_issuer_name(certificate, name);
+        bool success = X509_sign(certificate, key, EVP_sha256()) > 0;
+
+        BIO* certificateBio = BIO_new_file(certificatePath, "w");
+        success = success && (certificateBio != nullptr) && (PEM_write_bio_X509(certificateBio, certificate) > 0);
+        BIO_free(certificateBio);
+        BIO* keyBio = BIO_new_file(privateKeyPath, "w");
+        success = success && (keyBio != nullptr) && (PEM_write_bio_PrivateKey(keyBio, key, nullptr, nullptr, 0, nullptr, nullptr) > 0);
+        BIO_free(keyBio);
+
+        X509_free(certificate);
+        EVP_PKEY_free(key);
+        return success;
+    }
+
+    TEST_F(UdpTransportTests, ShardedReceive_EncryptedCompressedTraffic_MatchesSerialDecode)
+    {
+        constexpr uint32_t NumTestClients = 8;
+        constexpr uint32_t PacketsPerClient = 24;
+        constexpr uint32_t ShardCount = 4;
+        static_assert(NumTestClients * PacketsPerClient > ShardCount * 8, "Not enough packets per update for the receive shards to be used");
+
+        AZ::Console console;
+        console.LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        AZ::Interface<AZ::IConsole>::Register(&console);
+        AZ::TaskExecutor taskExecutor(ShardCount);
+        AZ::TaskExecutor::SetInstance(&taskExecutor);
+        TestTaskGraphActive taskGraphActive;
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&taskGraphActive);
+        TestRunLengthCompressorFactory compressorFactory;
+        m_networkingSystemComponent->RegisterCompressorFactory(&compressorFactory);
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string certificatePath = tempDirectory.Resolve("certificate.pem");
+        const AZStd::string privateKeyPath = tempDirectory.Resolve("privatekey.pem");
+        ASSERT_TRUE(WriteSelfSignedCertificate(certificatePath.c_str(), privateKeyPath.c_str()));
+
+        console.PerformCommand(AZStd::string::format("net_SslExternalCertificateFile %s", certificatePath.c_str()).c_str());
+        console.PerformCommand(AZStd::string::format("net_SslExternalPrivateKeyFile %s", privateKeyPath.c_str()).c_str());
+        // Pinning reads the certificate through FileIO, which these tests don't have, the self-signed chain is still validated
+        console.PerformCommand("net_SslEnablePinning false");
+        console.PerformCommand("net_UdpUseEncryption true");
+        console.PerformCommand("net_UdpCompressor TestRunLengthCompressor");
+        // Every packet has to be decoded and dispatched, regardless of how long encryption takes in this build
+        console.PerformCommand("net_UdpPacketTimeSliceMs 10000");
+
+        {
+            TestRecordingConnectionListener serverListener;
+            const AZ::Name serverName(AZStd::string_view("ShardedUdpServer"));
+            INetworkInterface* server = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(serverName, ProtocolType::Udp, TrustZone::ExternalClientToServer, serverListener);
+            ASSERT_TRUE(server->Listen(12347));
+            ASSERT_TRUE(static_cast<UdpNetworkInterface*>(server)->IsEncrypted());
+
+            TestUdpConnectionListener clientListener;
+            AZStd::vector<AZ::Name> clientNames;
+            AZStd::vector<INetworkInterface*> clients;
+            AZStd::vector<ConnectionId> clientConnections;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                clientNames.push_back(AZ::Name(AZStd::string::format("ShardedUdpClient%u", i)));
+                clients.push_back(AZ::Interface<INetworking>::Get()->CreateNetworkInterface(clientNames.back(), ProtocolType::Udp, TrustZone::ExternalClientToServer, clientListener));
+                clientConnections.push_back(clients.back()->Connect(IpAddress(127, 0, 0, 1, 12347)));
+            }
+
+            // Wait until every connection has finished its DTLS handshake, only then are its packets decoded on the shards
+            auto isFullyConnected = [](IConnection& connection)
+            {
+                UdpConnection& udpConnection = static_cast<UdpConnection&>(connection);
+                return (udpConnection.GetConnectionState() == ConnectionState::Connected) && !udpConnection.GetDtlsEndpoint().IsConnecting();
+            };
+            const AZ::TimeMs connectStartTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+
+                uint32_t connectedCount = 0;
+                server->GetConnectionSet().VisitConnections([&](IConnection& connection) { connectedCount += isFullyConnected(connection) ? 1 : 0; });
+                for (uint32_t i = 0; i < NumTestClients; ++i)
+                {
+                    IConnection* connection = clients[i]->GetConnectionSet().GetConnection(clientConnections[i]);
+                    connectedCount += ((connection != nullptr) && isFullyConnected(*connection)) ? 1 : 0;
+                }
+                if ((connectedCount == NumTestClients * 2) || (AZ::GetElapsedTimeMs() - connectStartTimeMs > AZ::TimeMs{ 10000 }))
+                {
+                    break;
+                }
+            }
+            ASSERT_EQ(server->GetConnectionSet().GetConnectionCount(), NumTestClients);
+
+            // Sends the same traffic from every client, lets the server receive all of it and returns the packets in dispatch order
+            auto sendAndReceive = [&]()
+            {
+                serverListener.m_received.clear();
+                for (uint32_t sequence = 0; sequence < PacketsPerClient; ++sequence)
+                {
+                    for (uint32_t i = 0; i < NumTestClients; ++i)
+                    {
+                        clients[i]->SendUnreliablePacket(clientConnections[i], TestSequencePacket(i, sequence));
+                    }
+                }
+
+                const AZ::TimeMs receiveStartTimeMs = AZ::GetElapsedTimeMs();
+                while ((serverListener.m_received.size() < NumTestClients * PacketsPerClient) && (AZ::GetElapsedTimeMs() - receiveStartTimeMs < AZ::TimeMs{ 5000 }))
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(50));
+                    m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                }
+                return serverListener.m_received;
+            };
+
+            console.PerformCommand("net_UdpReceiveShardCount 0");
+            const uint64_t clientEncryptedPackets = clients[0]->GetMetrics().m_sendPacketsEncrypted;
+            const AZStd::vector<TestRecordingConnectionListener::ReceivedPacket> serialReceived = sendAndReceive();
+            EXPECT_EQ(server->GetMetrics().m_recvPacketsShardDecoded, 0);
+            EXPECT_GT(clients[0]->GetMetrics().m_sendPacketsEncrypted, clientEncryptedPackets);
+            EXPECT_GT(clients[0]->GetMetrics().m_sendBytesCompressedDelta, 0);
+
+            console.PerformCommand(AZStd::string::format("net_UdpReceiveShardCount %u", ShardCount).c_str());
+            const AZStd::vector<TestRecordingConnectionListener::ReceivedPacket> shardedReceived = sendAndReceive();
+            EXPECT_GT(server->GetMetrics().m_recvPacketsShardDecoded, 0);
+
+            // Both paths have to decode every packet to the sent payload, and dispatch each connection's packets in the order they were sent
+            ASSERT_EQ(serialReceived.size(), NumTestClients * PacketsPerClient);
+            ASSERT_EQ(shardedReceived.size(), serialReceived.size());
+            for (const AZStd::vector<TestRecordingConnectionListener::ReceivedPacket>* received : { &serialReceived, &shardedReceived })
+            {
+                AZStd::vector<uint32_t> nextSequence(NumTestClients, 0);
+                for (const TestRecordingConnectionListener::ReceivedPacket& packet : *received)
+                {
+                    ASSERT_LT(packet.m_client, NumTestClients);
+                    EXPECT_TRUE(packet.m_paddingValid);
+                    EXPECT_EQ(packet.m_sequence, nextSequence[packet.m_client]++);
+                }
+            }
+
+            // Each client's packets arrive on the same server connection in both passes
+            for (uint32_t i = 0; i < serialReceived.size(); ++i)
+            {
+                auto sameClient = [&](const TestRecordingConnectionListener::ReceivedPacket& packet)
+                {
+                    return (packet.m_client == serialReceived[i].m_client) && (packet.m_sequence == serialReceived[i].m_sequence);
+                };
+                auto sharded = AZStd::find_if(shardedReceived.begin(), shardedReceived.end(), sameClient);
+                ASSERT_NE(sharded, shardedReceived.end());
+                EXPECT_EQ(sharded->m_connectionId, serialReceived[i].m_connectionId);
+            }
+
+            for (const AZ::Name& clientName : clientNames)
+            {
+                AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(clientName);
+            }
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(serverName);
+        }
+
+        console.PerformCommand("net_UdpReceiveShardCount 0");
+        console.PerformCommand("net_UdpPacketTimeSliceMs 8");
+        console.PerformCommand("net_UdpCompressor MultiplayerCompressor");
+        console.PerformCommand("net_UdpUseEncryption false");
+        console.PerformCommand("net_SslEnablePinning true");
+        m_networkingSystemComponent->UnregisterCompressorFactory(compressorFactory.GetFactoryName());
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&taskGraphActive);
+        AZ::TaskExecutor::SetInstance(nullptr);
+        AZ::Interface<AZ::IConsole>::Unregister(&console);
+    }
+#endif
 }
@@ -21,6 +21,7 @@ set(FILES
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpSocketBenchmarks.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
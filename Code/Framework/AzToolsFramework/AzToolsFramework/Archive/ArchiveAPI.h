@@ -88,6 +88,16 @@ namespace AzToolsFramework
             const AZStd::string& archivePath,
             const AZStd::string& workingDirectory,
             const AZStd::string& listFilePath) = 0;
+
+        //! Store a shared zstd compression dictionary in an archive
+        //! The archive might not exist yet, but should not contain any files compressed with the default codec
+        //! Files added to the archive afterwards are compressed with zstd against the dictionary
+        //! @param archivePath The path of the archive to add the dictionary to
+        //! @param dictionaryFilePath Full path to a dictionary trained with AZ::ZStd::TrainDictionary
+        //! @return Future (bool) which can obtain the success value of the operation
+        [[nodiscard]] virtual std::future<bool> SetArchiveCompressionDictionary(
+            const AZStd::string& archivePath,
+            const AZStd::string& dictionaryFilePath) = 0;
     };
 
     using ArchiveCommandsBus = AZ::EBus<ArchiveCommands>;
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 
 #include <AzFramework/Archive/INestedArchive.h>
@@ -26,8 +27,24 @@ namespace AzToolsFramework
     constexpr AZ::s32 s_compressionLevel = AZ::IO::INestedArchive::LEVEL_NORMAL;
     constexpr CompressionCodec::Codec s_compressionCodec = CompressionCodec::Codec::ZLIB;
 
+    AZ_CVAR(AZ::u32, ed_archiveSeekableMinSizeKib, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Files of at least this size (in KiB) are added to archives as seekable zstd, which lets the streamer's block decompressor "
+        "read and decompress only the parts of the file that are requested, in parallel. 0 disables seekable compression.");
+
     namespace ArchiveUtils
     {
+        // Large files are written as seekable zstd when enabled. Archives that carry a shared dictionary only benefit from it
+        // when the remaining files are compressed with zstd
+        CompressionCodec::Codec GetCompressionCodec(const AZ::IO::INestedArchive& archive, size_t fileSize)
+        {
+            const AZ::u64 seekableMinSize = aznumeric_cast<AZ::u64>(static_cast<AZ::u32>(ed_archiveSeekableMinSizeKib)) * 1024;
+            if (seekableMinSize != 0 && fileSize >= seekableMinSize)
+            {
+                return CompressionCodec::Codec::ZSTD_SEEKABLE;
+            }
+            return archive.HasCompressionDictionary() ? CompressionCodec::Codec::ZSTD : s_compressionCodec;
+        }
+
         // Read a file's contents into a provided buffer.
         // Does not add a zero byte at the end of the buffer.
         // returns true if read was successful, false otherwise.
@@ -171,7 +188,7 @@ namespace AzToolsFramework
                 {
                     int result = archive->UpdateFile(
                         relativePath.Native(), fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
+                        s_compressionLevel, ArchiveUtils::GetCompressionCodec(*archive, fileBuffer.size()));
 
                     thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                     AZ_Error(
@@ -428,7 +445,7 @@ namespace AzToolsFramework
             {
                 int result = archive->UpdateFile(
                     relativePath.Native(), fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                    s_compressionLevel, s_compressionCodec);
+                    s_compressionLevel, ArchiveUtils::GetCompressionCodec(*archive, fileBuffer.size()));
 
                 success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                 AZ_Error(
@@ -490,7 +507,7 @@ namespace AzToolsFramework
                 {
                     int result = archive->UpdateFile(
                         filePathLine, fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
+                        s_compressionLevel, ArchiveUtils::GetCompressionCodec(*archive, fileBuffer.size()));
 
                     bool thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                     success = (success && thisSuccess);
@@ -523,6 +540,60 @@ namespace AzToolsFramework
     }
 
 
+    std::future<bool> ArchiveComponent::SetArchiveCompressionDictionary(
+        const AZStd::string& archivePath,
+        const AZStd::string& dictionaryFilePath)
+    {
+        if (!m_fileIO || !m_archive || archivePath.empty() || !m_fileIO->Exists(dictionaryFilePath.c_str()))
+        {
+            AZ_Error(s_traceName, false, "Compression dictionary '%s' doesn't exist", dictionaryFilePath.c_str());
+            std::promise<bool> p;
+            p.set_value(false);
+            return p.get_future();
+        }
+
+        auto FnSetCompressionDictionary = [this, archivePath, dictionaryFilePath](std::promise<bool>&& p) -> void
+        {
+            auto archive = m_archive->OpenArchive(archivePath);
+            if (!archive)
+            {
+                AZ_Error(s_traceName, false, "Failed to open archive file '%s'", archivePath.c_str());
+                p.set_value(false);
+                return;
+            }
+
+            AZStd::vector<char> dictionaryBuffer;
+            bool success = false;
+            if (ArchiveUtils::ReadFile(AZ::IO::Path(dictionaryFilePath), AZ::IO::OpenMode::ModeRead, dictionaryBuffer))
+            {
+                int result = archive->SetCompressionDictionary(dictionaryBuffer.data(), dictionaryBuffer.size());
+
+                success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+                AZ_Error(
+                    s_traceName, success, "Error %d encountered while setting compression dictionary '%s' on archive '%.*s'", result,
+                    dictionaryFilePath.c_str(), AZ_STRING_ARG(archive->GetFullPath().Native()));
+            }
+            else
+            {
+                AZ_Error(
+                    s_traceName, false, "Error encountered while reading compression dictionary '%s'", dictionaryFilePath.c_str());
+            }
+
+            archive.reset();
+            p.set_value(success);
+        };
+
+        // Async task...
+        std::promise<bool> p;
+        std::future<bool> f = p.get_future();
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Archive Task (Set Dictionary)";
+        m_threads.emplace_back(threadDesc, FnSetCompressionDictionary, AZStd::move(p));
+        return f;
+    }
+
+
     bool ArchiveComponent::CheckParamsForAdd(const AZStd::string& directory, const AZStd::string& file)
     {
         if (!m_fileIO || !m_archive)
@@ -70,6 +70,10 @@ namespace AzToolsFramework
             const AZStd::string& archivePath,
             const AZStd::string& workingDirectory,
             const AZStd::string& listFilePath) override;
+
+        [[nodiscard]] std::future<bool> SetArchiveCompressionDictionary(
+            const AZStd::string& archivePath,
+            const AZStd::string& dictionaryFilePath) override;
         //////////////////////////////////////////////////////////////////////////
 
     private:
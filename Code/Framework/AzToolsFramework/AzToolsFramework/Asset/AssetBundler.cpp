@@ -55,11 +55,12 @@ namespace AzToolsFramework
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<AssetBundleSettings>()
-                ->Version(3)
+                ->Version(4)
                 ->Field("AssetFileInfoListPath", &AssetBundleSettings::m_assetFileInfoListPath)
                 ->Field("BundleFilePath", &AssetBundleSettings::m_bundleFilePath)
                 ->Field("BundleVersion", &AssetBundleSettings::m_bundleVersion)
                 ->Field("maxBundleSize", &AssetBundleSettings::m_maxBundleSizeInMB)
+                ->Field("compressionDictionarySize", &AssetBundleSettings::m_compressionDictionarySizeInKB)
                 ->Field("comment", &AssetBundleSettings::m_comment);
         }
     }
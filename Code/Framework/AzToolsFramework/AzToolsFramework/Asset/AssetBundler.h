@@ -58,6 +58,8 @@ namespace AzToolsFramework
         AZStd::string m_bundleFilePath; // the file path where the parent bundle file should get saved to disk.
         int m_bundleVersion = AzFramework::AssetBundleManifest::CurrentBundleVersion;
         AZ::u64 m_maxBundleSizeInMB = MaxBundleSizeInMB;
+        // size of the zstd dictionary trained from the bundled files and shared by all their entries, 0 disables it
+        AZ::u32 m_compressionDictionarySizeInKB = 0;
         AZStd::string m_comment;
     };
 
@@ -8,13 +8,16 @@
 
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Compression/zstd_compression.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/optional.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -38,6 +41,12 @@ namespace AzToolsFramework
 
     constexpr int InjectFileRetryCount = 4;
 
+    // Only small files are used as dictionary samples, large files compress well on their own
+    constexpr AZ::u64 MaxDictionarySampleSizeInBytes = 128 * 1024;
+    // zstd recommends training on roughly 100 times the size of the dictionary
+    constexpr AZ::u64 DictionarySampleBudgetMultiplier = 100;
+    constexpr AZ::u32 MinDictionarySampleCount = 8;
+
 
     bool MaxSizeExceeded(AZ::u64 totalFileSize, AZ::u64 bundleSize, AZ::u64 assetCatalogFileSizeBuffer, AZ::u64 maxSizeInBytes)
     {
@@ -293,6 +302,29 @@ namespace AzToolsFramework
             }
         }
 
+        // Train a dictionary shared by all bundles first, so it's in place before any file gets compressed
+        AZStd::optional<TemporaryDir> dictionaryDir;
+        AZStd::string dictionaryFilePath;
+        if (assetBundleSettings.m_compressionDictionarySizeInKB > 0)
+        {
+            // use a folder of its own as the one derived from the bundle name is deleted after every batch of injected files
+            dictionaryDir.emplace(AZStd::string::format("%s_dictionary.tmp", (AZ::IO::Path(bundleFilePath.ParentPath()) / bundleFilePath.Stem()).c_str()));
+        }
+        if (dictionaryDir && dictionaryDir->m_result)
+        {
+            AzFramework::StringFunc::Path::ConstructFull(dictionaryDir->m_tempFolderPath.c_str(), AZ::IO::ZipDir::CompressionDictionaryFileName, dictionaryFilePath, true);
+            if (!TrainCompressionDictionary(assetFileInfoList, assetAlias, assetBundleSettings.m_compressionDictionarySizeInKB, dictionaryFilePath))
+            {
+                AZ_Warning(logWindowName, false, "Unable to train a compression dictionary for bundle (%s), it will be created without one.\n", bundleFilePath.c_str());
+                dictionaryFilePath.clear();
+            }
+        }
+
+        if (!dictionaryFilePath.empty() && !SetBundleCompressionDictionary(tempBundleFilePath, dictionaryFilePath))
+        {
+            return false;
+        }
+
         bool usePrefabSystemForLevels = false;
         AzFramework::ApplicationRequests::Bus::BroadcastResult(
             usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
@@ -391,6 +423,11 @@ namespace AzToolsFramework
                 AZStd::string currentDeltaCatalogName = DeltaCatalogName;
                 AzFramework::StringFunc::Path::ConstructFull(bundleFolder.c_str(), currentDeltaCatalogName.c_str(), deltaCatalogFilePath, true);
                 bundlePathDeltaCatalogPair.emplace_back(AZStd::make_pair(tempBundleFilePath, currentDeltaCatalogName));
+
+                if (!dictionaryFilePath.empty() && !SetBundleCompressionDictionary(tempBundleFilePath, dictionaryFilePath))
+                {
+                    return false;
+                }
             }
 
             fileEntries.emplace_back(assetFileInfo.m_assetRelativePath);
@@ -680,6 +717,80 @@ namespace AzToolsFramework
         return filesAddedToArchive;
     }
 
+    bool AssetBundleComponent::TrainCompressionDictionary(const AssetFileInfoList& assetFileInfoList, const AZStd::string& assetAlias, AZ::u32 dictionarySizeInKB, const AZStd::string& dictionaryFilePath)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+
+        const size_t dictionarySize = static_cast<size_t>(dictionarySizeInKB) * 1024;
+        const AZ::u64 sampleBudget = dictionarySize * DictionarySampleBudgetMultiplier;
+
+        // Samples are concatenated into a single buffer, the order of the list is kept so the result is deterministic
+        AZStd::vector<char> samples;
+        AZStd::vector<size_t> sampleSizes;
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        {
+            AZStd::string fullAssetFilePath;
+            AzFramework::StringFunc::Path::Join(assetAlias.c_str(), assetFileInfo.m_assetRelativePath.c_str(), fullAssetFilePath);
+
+            AZ::u64 fileSize = 0;
+            if (!fileIO->Size(fullAssetFilePath.c_str(), fileSize) || fileSize == 0 || fileSize > MaxDictionarySampleSizeInBytes)
+            {
+                continue;
+            }
+            if (samples.size() + fileSize > sampleBudget)
+            {
+                break;
+            }
+
+            AZ::IO::FileIOStream fileStream(fullAssetFilePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+            if (!fileStream.IsOpen())
+            {
+                continue;
+            }
+            const size_t offset = samples.size();
+            samples.resize_no_construct(offset + fileSize);
+            if (fileStream.Read(fileSize, samples.data() + offset) != fileSize)
+            {
+                samples.resize(offset);
+                continue;
+            }
+            sampleSizes.push_back(static_cast<size_t>(fileSize));
+        }
+
+        if (sampleSizes.size() < MinDictionarySampleCount)
+        {
+            return false;
+        }
+
+        AZStd::vector<char> dictionary;
+        dictionary.resize_no_construct(dictionarySize);
+        size_t trainedSize = AZ::ZStd::TrainDictionary(dictionary.data(), dictionary.size(), samples.data(), sampleSizes.data(), static_cast<unsigned int>(sampleSizes.size()));
+        if (trainedSize == 0)
+        {
+            return false;
+        }
+
+        AZ::IO::FileIOStream fileStream(dictionaryFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!fileStream.IsOpen() || fileStream.Write(trainedSize, dictionary.data()) != trainedSize)
+        {
+            AZ_Error(logWindowName, false, "Failed to write compression dictionary (%s).\n", dictionaryFilePath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool AssetBundleComponent::SetBundleCompressionDictionary(const AZStd::string& bundleFilePath, const AZStd::string& dictionaryFilePath)
+    {
+        std::future<bool> dictionarySet;
+        AzToolsFramework::ArchiveCommandsBus::BroadcastResult(dictionarySet, &AzToolsFramework::ArchiveCommands::SetArchiveCompressionDictionary, bundleFilePath, dictionaryFilePath);
+        bool dictionarySetOnArchive = dictionarySet.get();
+        if (!dictionarySetOnArchive)
+        {
+            AZ_Error(logWindowName, false, "Failed to store compression dictionary in bundle (%s).\n", bundleFilePath.c_str());
+        }
+        return dictionarySetOnArchive;
+    }
+
     bool AssetBundleComponent::HasManifest(const AZStd::vector<AZStd::string>& fileEntries)
     {
         auto itr = AZStd::find(fileEntries.begin(), fileEntries.end(), AZStd::string(AzFramework::AssetBundleManifest::s_manifestFileName));
@@ -90,5 +90,12 @@ namespace AzToolsFramework
         //! Adds the delta catalog and any remaining files to the bundle
         //! We only create the delta catalog once we are sure about what all the files that will go in it. 
         bool AddCatalogAndFilesToBundle(const AZStd::vector<AZStd::string>& deltaCatalogEntries, const AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& bundleFilePath, const char* assetAlias, const AzFramework::PlatformId& platformId);
+
+        //! Trains a zstd dictionary from the small files in the list and saves it to dictionaryFilePath
+        //! Returns false if there aren't enough samples to train a useful dictionary
+        bool TrainCompressionDictionary(const AssetFileInfoList& assetFileInfoList, const AZStd::string& assetAlias, AZ::u32 dictionarySizeInKB, const AZStd::string& dictionaryFilePath);
+
+        //! Stores the dictionary at dictionaryFilePath in the bundle, so files added afterwards are compressed against it
+        bool SetBundleCompressionDictionary(const AZStd::string& bundleFilePath, const AZStd::string& dictionaryFilePath);
     };
 }
@@ -13,6 +13,10 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/CompressionSeekTable.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/NestedArchive.h>
 #include <Tests/AZTestShared/Utils/Utils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -244,6 +248,64 @@ namespace UnitTest
             }
         }
 
+        TEST_F(ArchiveComponentTest, CreateArchive_SeekableMinSizeSet_LargeFilesAreStoredWithSeekTable)
+        {
+            auto console = AZ::Interface<AZ::IConsole>::Get();
+            ASSERT_NE(nullptr, console);
+            console->PerformCommand("ed_archiveSeekableMinSizeKib 256");
+
+            // one file over the threshold and one below it
+            const QDir archiveFolder(GetArchiveFolder());
+            constexpr int largeFileSize = 600 * 1024;
+            QString largeFileContents;
+            largeFileContents.reserve(largeFileSize);
+            for (int i = 0; i < largeFileSize; ++i)
+            {
+                largeFileContents.append(QChar('a' + (i * 7 + i / 1024) % 26));
+            }
+            EXPECT_TRUE(CreateDummyFile(archiveFolder.absoluteFilePath("large.bin"), largeFileContents));
+            EXPECT_TRUE(CreateDummyFile(archiveFolder.absoluteFilePath("small.txt"), "small"));
+
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            bool createResult = CreateArchive();
+            AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+            console->PerformCommand("ed_archiveSeekableMinSizeKib 0");
+            ASSERT_TRUE(createResult);
+
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            ASSERT_NE(nullptr, archive);
+            auto nestedArchive = archive->OpenArchive(GetArchivePath().toUtf8().constData(), {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+            ASSERT_NE(nullptr, nestedArchive);
+            AZ::IO::ZipDir::Cache* cache = static_cast<AZ::IO::NestedArchive*>(nestedArchive.get())->GetCache();
+
+            auto HasSeekTable = [&cache](const char* path)
+            {
+                AZ::IO::ZipDir::FileEntry* entry = cache->FindFile(path);
+                if (!entry || !entry->IsCompressed())
+                {
+                    return false;
+                }
+                AZStd::vector<AZ::u8> compressed(entry->desc.lSizeCompressed);
+                if (cache->ReadFile(entry, compressed.data(), nullptr) != AZ::IO::ZipDir::ZD_ERROR_SUCCESS ||
+                    compressed.size() < AZ::IO::CompressionSeekTable::FooterSize)
+                {
+                    return false;
+                }
+                return AZ::IO::CompressionSeekTable::GetTableSize(
+                    compressed.data() + compressed.size() - AZ::IO::CompressionSeekTable::FooterSize) != 0;
+            };
+            EXPECT_TRUE(HasSeekTable("large.bin"));
+            EXPECT_FALSE(HasSeekTable("small.txt"));
+
+            // seekable files still read back as a whole
+            AZ::IO::INestedArchive::Handle handle = nestedArchive->FindFile("large.bin");
+            ASSERT_NE(nullptr, handle);
+            AZStd::string contents(nestedArchive->GetFileSize(handle), '\0');
+            EXPECT_EQ(0, nestedArchive->ReadFile(handle, contents.data()));
+            const QByteArray expected = largeFileContents.toUtf8();
+            EXPECT_EQ(AZStd::string_view(expected.constData(), largeFileSize), AZStd::string_view(contents).substr(0, largeFileSize));
+        }
+
         TEST_F(ArchiveComponentTest, CreateDeltaCatalog_ArchiveWithoutCatalogAssetsRegistered_Success)
         {
             QStringList fileList = CreateArchiveFileList();
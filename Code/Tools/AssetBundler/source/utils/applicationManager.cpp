@@ -332,6 +332,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            CompressionDictionarySizeArg,
             PlatformArg,
             PrintFlag,
             VerboseFlag,
@@ -1094,6 +1095,16 @@ namespace AssetBundler
             params.m_maxBundleSizeInMB = AZStd::stoi(parser->GetSwitchValue(MaxBundleSizeArg, 0));
         }
 
+        // Read in Compression Dictionary Size arg
+        if (parser->HasSwitch(CompressionDictionarySizeArg))
+        {
+            if (parser->GetNumSwitchValues(CompressionDictionarySizeArg) != 1)
+            {
+                return AZ::Failure(AZStd::string::format("Invalid command: \"--%s\" must have exactly one value.", CompressionDictionarySizeArg));
+            }
+            params.m_compressionDictionarySizeInKB = AZStd::stoi(parser->GetSwitchValue(CompressionDictionarySizeArg, 0));
+        }
+
         // Read in Print flag
         params.m_print = parser->HasSwitch(PrintFlag);
 
@@ -2090,6 +2101,12 @@ namespace AssetBundler
                 bundleSettings.m_maxBundleSizeInMB = params.m_maxBundleSizeInMB;
             }
 
+            // Compression Dictionary Size (in KB), 0 disables the dictionary
+            if (params.m_compressionDictionarySizeInKB >= 0)
+            {
+                bundleSettings.m_compressionDictionarySizeInKB = params.m_compressionDictionarySizeInKB;
+            }
+
             // Print
             if (params.m_print)
             {
@@ -2098,7 +2115,8 @@ namespace AssetBundler
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Asset List file: %s\n", bundleSettings.m_assetFileInfoListPath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Output Bundle path: %s\n", bundleSettings.m_bundleFilePath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Bundle Version: %i\n", bundleSettings.m_bundleVersion);
-                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Compression Dictionary Size: %u KB\n\n", bundleSettings.m_compressionDictionarySizeInKB);
             }
 
             // Save
@@ -2824,6 +2842,8 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which version of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for a single Bundle (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Sets the size of the zstd dictionary trained from the bundled files (in KB). Default is (0), which disables it.\n", CompressionDictionarySizeArg);
+        AZ_Printf(AppWindowName, "%-31s---Bundles with a dictionary are compressed with zstd, which greatly improves the ratio of many small files.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) referenced by all Bundle Settings operations.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---Defaults to all enabled platforms. Platforms can be changed by modifying AssetProcessorPlatformConfig.setreg.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Outputs the contents of the Bundle Settings file after modifying any specified values.\n", PrintFlag);
@@ -124,6 +124,7 @@ namespace AssetBundler
 
         int m_bundleVersion = -1;
         int m_maxBundleSizeInMB = -1;
+        int m_compressionDictionarySizeInKB = -1;
 
         bool m_print = false;
 
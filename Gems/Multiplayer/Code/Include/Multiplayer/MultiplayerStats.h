@@ -49,6 +49,10 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Entity deltas that were copied from another connection's serialization this tick, or serialized and then cached.
+        Metric m_serializedDeltaCacheHits;
+        Metric m_serializedDeltaCacheMisses;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -57,6 +61,8 @@ namespace Multiplayer
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordSerializedDeltaCacheHit(uint32_t totalBytes);
+        void RecordSerializedDeltaCacheMiss(uint32_t totalBytes);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
@@ -68,6 +74,9 @@ namespace Multiplayer
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
 
+        //! Returns the fraction of serialized entity deltas that were shared with another connection, from 0 to 1.
+        float CalculateSerializedDeltaCacheHitRate() const;
+
         struct Events
         {
             AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*> m_entitySerializeStart;
@@ -93,5 +102,52 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! A single Record call, buffered while a DeferRecordsScope is active on the recording thread.
+        struct DeferredRecord
+        {
+            enum class Type : uint8_t
+            {
+                EntitySerializeStart,
+                ComponentSerializeEnd,
+                EntitySerializeStop,
+                PropertySent,
+                PropertyReceived,
+                RpcSent,
+                RpcReceived,
+                SerializedDeltaCacheHit,
+                SerializedDeltaCacheMiss
+            };
+
+            Type m_type = Type::EntitySerializeStart;
+            AzNetworking::SerializerMode m_mode = AzNetworking::SerializerMode::ReadFromObject;
+            AZ::EntityId m_entityId;
+            const char* m_entityName = nullptr;
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+            RpcIndex m_rpcIndex = RpcIndex{ 0 };
+            uint32_t m_totalBytes = 0;
+        };
+        using DeferredRecords = AZStd::vector<DeferredRecord>;
+
+        //! @class DeferRecordsScope
+        //! @brief Buffers every Record call made on the current thread for the lifetime of the scope.
+        //! The stats and their events are not thread safe, so work that serializes entities on a job thread records into its
+        //! own buffer, which is later handed to ApplyDeferredRecords on the main thread.
+        class DeferRecordsScope
+        {
+        public:
+            explicit DeferRecordsScope(DeferredRecords& records);
+            ~DeferRecordsScope();
+
+        private:
+            AZ_DISABLE_COPY_MOVE(DeferRecordsScope);
+            DeferredRecords* m_previousRecords = nullptr;
+        };
+
+        //! Replays buffered Record calls in the order they were made, must be called on the main thread.
+        //! Within a DeferRecordsScope the records are appended to that scope's buffer instead.
+        //! @param records the buffered records to apply
+        void ApplyDeferredRecords(const DeferredRecords& records);
     };
 }
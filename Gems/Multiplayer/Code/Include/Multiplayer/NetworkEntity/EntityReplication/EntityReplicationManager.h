@@ -23,6 +23,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/optional.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 
@@ -36,6 +37,7 @@ namespace Multiplayer
 {
     class IEntityDomain;
     class EntityReplicator;
+    class SerializedDeltaCache;
 
     using SendMigrateEntityEvent = AZ::Event<AzNetworking::IConnection&, const EntityMigrationMessage&>;
 
@@ -61,6 +63,16 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! Serializes all pending entity updates into packets without sending them.
+        //! Only state owned by this manager, its replicators and its connection is modified, so the managers of different
+        //! connections may prepare their updates concurrently. Stats recorded while serializing should be deferred when
+        //! running off the main thread, see MultiplayerStats::DeferRecordsScope.
+        void PrepareUpdates();
+
+        //! Sends the packets built by the last call to PrepareUpdates, followed by any deferred rpcs.
+        //! Must be called on the main thread, SendUpdates is equivalent to PrepareUpdates followed by SendPreparedUpdates.
+        void SendPreparedUpdates();
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -76,6 +88,11 @@ namespace Multiplayer
         void SetReplicationWindow(AZStd::unique_ptr<IReplicationWindow> replicationWindow);
         IReplicationWindow* GetReplicationWindow();
 
+        //! Sets the cache used to share serialized entity deltas with the replication managers of other connections.
+        //! @param deltaCache the cache to share deltas through, nullptr serializes every delta for this connection alone
+        void SetSerializedDeltaCache(SerializedDeltaCache* deltaCache);
+        SerializedDeltaCache* GetSerializedDeltaCache();
+
         void GetEntityReplicatorIdList(AZStd::list<NetEntityId>& outList);
         uint32_t GetEntityReplicatorCount(NetEntityRole localNetworkRole);
 
@@ -120,7 +137,16 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        //! Entity updates serialized by PrepareUpdates that fit in a single packet, along with the replicators that generated them.
+        struct PreparedUpdatePacket
+        {
+            NetworkEntityUpdateVector m_entityUpdates;
+            AZStd::vector<EntityReplicator*> m_replicators;
+        };
+
+        //! @param overflowUpdate the update generated for the front replicator that didn't fit in the previous packet, if any.
+        //!                       Set to the update that doesn't fit in this packet, so the next packet can use it without serializing the entity again.
+        void PrepareEntityUpdateMessages(EntityReplicatorList& replicatorList, PreparedUpdatePacket& outPacket, AZStd::optional<NetworkEntityUpdateMessage>& overflowUpdate);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -188,6 +214,10 @@ namespace Multiplayer
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        // Packets built by PrepareUpdates that are waiting for SendPreparedUpdates
+        AZStd::vector<PreparedUpdatePacket> m_preparedUpdatePackets;
+        uint32_t m_preparedUpdatePacketCount = 0;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
         SendMigrateEntityEvent m_sendMigrateEntityEvent;
@@ -200,6 +230,7 @@ namespace Multiplayer
         AzNetworking::IConnection& m_connection;
         AZStd::unique_ptr<IReplicationWindow> m_replicationWindow;
         AZStd::unique_ptr<IEntityDomain> m_remoteEntityDomain;
+        SerializedDeltaCache* m_serializedDeltaCache = nullptr;
 
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_entityPendingRemovalMs = AZ::Time::ZeroTimeMs;
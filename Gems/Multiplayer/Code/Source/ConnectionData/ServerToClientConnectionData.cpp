@@ -72,6 +72,14 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update()
+    {
+        if (PrepareForUpdate())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
+    bool ServerToClientConnectionData::PrepareForUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
 
@@ -81,9 +89,10 @@ namespace Multiplayer
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
             if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
             {
-                m_entityReplicationManager.SendUpdates();
+                return true;
             }
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
@@ -26,6 +26,12 @@ namespace Multiplayer
 
         void SetControlledEntity(NetworkEntityHandle primaryPlayerEntity);
 
+        //! Activates entities pending activation and returns whether entity updates should be sent to the client this tick.
+        //! Update() sends updates through the replication manager whenever this returns true, callers that send the updates
+        //! of many clients in parallel call this first and then drive the replication manager themselves.
+        //! @return true if the replication manager should send updates
+        bool PrepareForUpdate();
+
         //! IConnectionData interface
         //! @{
         ConnectionDataType GetConnectionDataType() const override;
@@ -10,6 +10,9 @@
 
 namespace Multiplayer
 {
+    // Set while a DeferRecordsScope is active on this thread
+    static thread_local MultiplayerStats::DeferredRecords* s_deferredRecords = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -31,21 +34,57 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::EntitySerializeStart;
+            record.m_mode = mode;
+            record.m_entityId = entityId;
+            record.m_entityName = entityName;
+            return;
+        }
         m_events.m_entitySerializeStart.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::ComponentSerializeEnd;
+            record.m_mode = mode;
+            record.m_netComponentId = netComponentId;
+            return;
+        }
         m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
     }
 
     void MultiplayerStats::RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::EntitySerializeStop;
+            record.m_mode = mode;
+            record.m_entityId = entityId;
+            record.m_entityName = entityName;
+            return;
+        }
         m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::PropertySent;
+            record.m_netComponentId = netComponentId;
+            record.m_propertyIndex = propertyId;
+            record.m_totalBytes = totalBytes;
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -58,6 +97,16 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::PropertyReceived;
+            record.m_netComponentId = netComponentId;
+            record.m_propertyIndex = propertyId;
+            record.m_totalBytes = totalBytes;
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalCalls++;
@@ -70,6 +119,18 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::RpcSent;
+            record.m_entityId = entityId;
+            record.m_entityName = entityName;
+            record.m_netComponentId = netComponentId;
+            record.m_rpcIndex = rpcId;
+            record.m_totalBytes = totalBytes;
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_totalCalls++;
@@ -82,6 +143,18 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::RpcReceived;
+            record.m_entityId = entityId;
+            record.m_entityName = entityName;
+            record.m_netComponentId = netComponentId;
+            record.m_rpcIndex = rpcId;
+            record.m_totalBytes = totalBytes;
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_totalCalls++;
@@ -92,10 +165,46 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::RecordSerializedDeltaCacheHit(uint32_t totalBytes)
+    {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::SerializedDeltaCacheHit;
+            record.m_totalBytes = totalBytes;
+            return;
+        }
+
+        m_serializedDeltaCacheHits.m_totalCalls++;
+        m_serializedDeltaCacheHits.m_totalBytes += totalBytes;
+        m_serializedDeltaCacheHits.m_callHistory[m_recordMetricIndex]++;
+        m_serializedDeltaCacheHits.m_byteHistory[m_recordMetricIndex] += totalBytes;
+    }
+
+    void MultiplayerStats::RecordSerializedDeltaCacheMiss(uint32_t totalBytes)
+    {
+        if (s_deferredRecords != nullptr)
+        {
+            DeferredRecord& record = s_deferredRecords->emplace_back();
+            record.m_type = DeferredRecord::Type::SerializedDeltaCacheMiss;
+            record.m_totalBytes = totalBytes;
+            return;
+        }
+
+        m_serializedDeltaCacheMisses.m_totalCalls++;
+        m_serializedDeltaCacheMisses.m_totalBytes += totalBytes;
+        m_serializedDeltaCacheMisses.m_callHistory[m_recordMetricIndex]++;
+        m_serializedDeltaCacheMisses.m_byteHistory[m_recordMetricIndex] += totalBytes;
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
+        m_serializedDeltaCacheHits.m_callHistory[m_recordMetricIndex] = 0;
+        m_serializedDeltaCacheHits.m_byteHistory[m_recordMetricIndex] = 0;
+        m_serializedDeltaCacheMisses.m_callHistory[m_recordMetricIndex] = 0;
+        m_serializedDeltaCacheMisses.m_byteHistory[m_recordMetricIndex] = 0;
         for (ComponentStats& componentStats : m_componentStats)
         {
             for (Metric& metric : componentStats.m_propertyUpdatesSent)
@@ -210,6 +319,12 @@ namespace Multiplayer
         return result;
     }
 
+    float MultiplayerStats::CalculateSerializedDeltaCacheHitRate() const
+    {
+        const uint64_t totalCalls = m_serializedDeltaCacheHits.m_totalCalls + m_serializedDeltaCacheMisses.m_totalCalls;
+        return (totalCalls > 0) ? static_cast<float>(m_serializedDeltaCacheHits.m_totalCalls) / static_cast<float>(totalCalls) : 0.0f;
+    }
+
     void MultiplayerStats::ConnectHandlers(EventHandlers& handlers)
     {
         handlers.m_entitySerializeStart.Connect(m_events.m_entitySerializeStart);
@@ -220,4 +335,52 @@ namespace Multiplayer
         handlers.m_rpcSent.Connect(m_events.m_rpcSent);
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
+
+    MultiplayerStats::DeferRecordsScope::DeferRecordsScope(DeferredRecords& records)
+        : m_previousRecords(s_deferredRecords)
+    {
+        s_deferredRecords = &records;
+    }
+
+    MultiplayerStats::DeferRecordsScope::~DeferRecordsScope()
+    {
+        s_deferredRecords = m_previousRecords;
+    }
+
+    void MultiplayerStats::ApplyDeferredRecords(const DeferredRecords& records)
+    {
+        for (const DeferredRecord& record : records)
+        {
+            switch (record.m_type)
+            {
+            case DeferredRecord::Type::EntitySerializeStart:
+                RecordEntitySerializeStart(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::ComponentSerializeEnd:
+                RecordComponentSerializeEnd(record.m_mode, record.m_netComponentId);
+                break;
+            case DeferredRecord::Type::EntitySerializeStop:
+                RecordEntitySerializeStop(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::PropertySent:
+                RecordPropertySent(record.m_netComponentId, record.m_propertyIndex, record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::PropertyReceived:
+                RecordPropertyReceived(record.m_netComponentId, record.m_propertyIndex, record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::RpcSent:
+                RecordRpcSent(record.m_entityId, record.m_entityName, record.m_netComponentId, record.m_rpcIndex, record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::RpcReceived:
+                RecordRpcReceived(record.m_entityId, record.m_entityName, record.m_netComponentId, record.m_rpcIndex, record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::SerializedDeltaCacheHit:
+                RecordSerializedDeltaCacheHit(record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::SerializedDeltaCacheMiss:
+                RecordSerializedDeltaCacheMiss(record.m_totalBytes);
+                break;
+            }
+        }
+    }
 }
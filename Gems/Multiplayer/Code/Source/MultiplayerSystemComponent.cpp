@@ -28,6 +28,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Utils/Utils.h>
@@ -92,6 +93,11 @@ namespace Multiplayer
         "The base used for blending between network updates, 0.1 will be quite linear, 0.2 or 0.3 will "
         "slow down quicker and may be better suited to connections with highly variable latency");
     AZ_CVAR(bool, bg_multiplayerDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables debug draw for the multiplayer gem");
+    AZ_CVAR(bool, sv_ParallelSendUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, entity updates for each client connection are serialized in parallel on the task graph before being sent");
+
+    AZ_CVAR_EXTERNED(bool, sv_ReplicationInterestGrid);
+
+    static const AZ::TaskDescriptor PrepareClientUpdatesTaskDescriptor{ "MultiplayerSystemComponent::PrepareClientUpdates", "Multiplayer" };
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -206,6 +212,7 @@ namespace Multiplayer
         SessionNotificationBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
 
+        m_interestGrid.Deactivate();
         m_networkEntityManager.Reset();
     }
 
@@ -378,6 +385,7 @@ namespace Multiplayer
             }
             m_serverSendAccumulator -= serverRateSeconds;
             m_networkTime.IncrementHostFrameId();
+            UpdateInterestGridActivation();
         }
 
         // Handle deferred local rpc messages that were generated during the updates
@@ -401,24 +409,51 @@ namespace Multiplayer
         {            
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - SendOutGameStateUpdate");
 
-            auto sendNetworkUpdates = [&stats](IConnection& connection)
+            // Client updates can be serialized in parallel, they are gathered here and sent below in the order they were visited
+            const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            const bool parallelSend = sv_ParallelSendUpdates && (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+            m_parallelSendConnectionCount = 0;
+
+            // Entity state doesn't change while updates are sent, so client connections can reuse each other's serialized deltas
+            m_serializedDeltaCache.BeginSharing();
+
+            auto sendNetworkUpdates = [this, &stats, parallelSend](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update();
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
+                        if (parallelSend)
+                        {
+                            ServerToClientConnectionData* clientConnectionData = static_cast<ServerToClientConnectionData*>(connectionData);
+                            if (clientConnectionData->PrepareForUpdate())
+                            {
+                                if (m_parallelSendConnectionCount == m_parallelSendConnections.size())
+                                {
+                                    m_parallelSendConnections.emplace_back();
+                                }
+                                m_parallelSendConnections[m_parallelSendConnectionCount++].m_connectionData = clientConnectionData;
+                            }
+                        }
+                        else
+                        {
+                            connectionData->Update();
+                        }
                         stats.m_clientConnectionCount++;
                     }
                     else
                     {
+                        connectionData->Update();
                         stats.m_serverConnectionCount++;
                     }
                 }
             };
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            SendParallelClientUpdates();
+
+            m_serializedDeltaCache.EndSharing();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -556,7 +591,7 @@ namespace Multiplayer
                 EnableAutonomousControl(controlledEntity, connection->GetConnectionId());
 
                 ServerToClientConnectionData* connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData());
-                AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+                AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, &m_interestGrid);
                 connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
                 connectionData->SetControlledEntity(controlledEntity);
 
@@ -783,7 +818,9 @@ namespace Multiplayer
         if (GetAgentType() == MultiplayerAgentType::ClientServer
          || GetAgentType() == MultiplayerAgentType::DedicatedServer)
         {
-            connection->SetUserData(new ServerToClientConnectionData(connection, *this));
+            ServerToClientConnectionData* connectionData = new ServerToClientConnectionData(connection, *this);
+            connectionData->GetReplicationManager().SetSerializedDeltaCache(&m_serializedDeltaCache);
+            connection->SetUserData(connectionData);
         }
         else
         {
@@ -896,12 +933,17 @@ namespace Multiplayer
                     // Set up a full ownership domain if we didn't construct a domain during the initialize event
                     m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
                 }
+                UpdateInterestGridActivation();
             }
             else if (multiplayerType == MultiplayerAgentType::Client)
             {
                 m_networkEntityManager.Initialize(AzNetworking::IpAddress(), AZStd::make_unique<NullEntityDomain>());
             }
         }
+        else if (multiplayerType == MultiplayerAgentType::Uninitialized)
+        {
+            m_interestGrid.Deactivate();
+        }
         m_agentType = multiplayerType;
 
         // Spawn the default player for this host since the host is also a player (not a dedicated server)
@@ -1068,6 +1110,10 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Total serialized delta cache hits: %llu", aznumeric_cast<AZ::u64>(stats.m_serializedDeltaCacheHits.m_totalCalls));
+        AZLOG_INFO("Total serialized delta cache hit bytes: %llu", aznumeric_cast<AZ::u64>(stats.m_serializedDeltaCacheHits.m_totalBytes));
+        AZLOG_INFO("Total serialized delta cache misses: %llu", aznumeric_cast<AZ::u64>(stats.m_serializedDeltaCacheMisses.m_totalCalls));
+        AZLOG_INFO("Serialized delta cache hit rate: %.2f%%", stats.CalculateSerializedDeltaCacheHitRate() * 100.0f);
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -1145,6 +1191,71 @@ namespace Multiplayer
         }
     }
 
+    void MultiplayerSystemComponent::UpdateInterestGridActivation()
+    {
+        // The grid listens to every networked entity activation and move, so it only runs while the replication windows use it
+        if (sv_ReplicationInterestGrid)
+        {
+            m_interestGrid.Activate();
+        }
+        else if (m_interestGrid.IsActive())
+        {
+            m_interestGrid.Deactivate();
+        }
+    }
+
+    void MultiplayerSystemComponent::SendParallelClientUpdates()
+    {
+        if (m_parallelSendConnectionCount == 0)
+        {
+            return;
+        }
+
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - PrepareClientUpdates");
+
+            // Each replication manager only touches its own replicators and connection while preparing, the stats are the one
+            // piece of shared state so they are buffered per connection and applied once all connections have been prepared
+            auto prepareClientUpdates = [this](uint32_t index)
+            {
+                ParallelSendConnection& sendConnection = m_parallelSendConnections[index];
+                sendConnection.m_deferredStats.clear();
+                MultiplayerStats::DeferRecordsScope deferStats(sendConnection.m_deferredStats);
+                sendConnection.m_connectionData->GetReplicationManager().PrepareUpdates();
+            };
+
+            if (m_parallelSendConnectionCount > 1)
+            {
+                AZ::TaskGraph prepareGraph;
+                for (uint32_t index = 0; index < m_parallelSendConnectionCount; ++index)
+                {
+                    prepareGraph.AddTask(PrepareClientUpdatesTaskDescriptor, [&prepareClientUpdates, index]()
+                    {
+                        prepareClientUpdates(index);
+                    });
+                }
+                AZ::TaskGraphEvent prepareFinished;
+                prepareGraph.Submit(&prepareFinished);
+                prepareFinished.Wait();
+            }
+            else
+            {
+                prepareClientUpdates(0);
+            }
+        }
+
+        // Sending modifies the network interface, so packets are sent on this thread in the order the connections were visited
+        MultiplayerStats& stats = GetStats();
+        for (uint32_t index = 0; index < m_parallelSendConnectionCount; ++index)
+        {
+            ParallelSendConnection& sendConnection = m_parallelSendConnections[index];
+            stats.ApplyDeferredRecords(sendConnection.m_deferredStats);
+            sendConnection.m_connectionData->GetReplicationManager().SendPreparedUpdates();
+            sendConnection.m_connectionData = nullptr;
+        }
+        m_parallelSendConnectionCount = 0;
+    }
+
     void MultiplayerSystemComponent::OnConsoleCommandInvoked
     (
         AZStd::string_view command,
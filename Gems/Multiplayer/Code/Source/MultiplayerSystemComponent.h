@@ -14,6 +14,8 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+#include <ReplicationWindows/ReplicationInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -37,6 +39,8 @@ namespace AzNetworking
 
 namespace Multiplayer
 {
+    class ServerToClientConnectionData;
+
     //! Multiplayer system component wraps the bridging logic between the game and transport layer.
     class MultiplayerSystemComponent final
         : public AZ::Component
@@ -142,6 +146,8 @@ namespace Multiplayer
     private:
 
         void TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds);
+        void UpdateInterestGridActivation();
+        void SendParallelClientUpdates();
         void OnConsoleCommandInvoked(AZStd::string_view command, const AZ::ConsoleCommandContainer& args, AZ::ConsoleFunctorFlags flags, AZ::ConsoleInvokedFrom invokedFrom);
         void OnAutonomousEntityReplicatorCreated();
         void ExecuteConsoleCommandList(AzNetworking::IConnection* connection, const AZStd::fixed_vector<Multiplayer::LongNetworkString, 32>& commands);
@@ -153,7 +159,18 @@ namespace Multiplayer
         AZ::ConsoleCommandInvokedEvent::Handler m_consoleCommandHandler;
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
+        //! A client connection whose entity updates are serialized on the task graph, along with the stats recorded while doing so.
+        struct ParallelSendConnection
+        {
+            ServerToClientConnectionData* m_connectionData = nullptr;
+            MultiplayerStats::DeferredRecords m_deferredStats;
+        };
+        AZStd::vector<ParallelSendConnection> m_parallelSendConnections;
+        uint32_t m_parallelSendConnectionCount = 0;
+
         NetworkEntityManager m_networkEntityManager;
+        ReplicationInterestGrid m_interestGrid;
+        SerializedDeltaCache m_serializedDeltaCache;
         NetworkTime m_networkTime;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
@@ -116,8 +116,15 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates()
+    {
+        PrepareUpdates();
+        SendPreparedUpdates();
+    }
+
+    void EntityReplicationManager::PrepareUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+        m_preparedUpdatePacketCount = 0;
 
         {
             EntityReplicatorList toSendList = GenerateEntityUpdateList();
@@ -141,14 +148,39 @@ namespace Multiplayer
             }
 
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareEntityUpdateMessages");
                 // While our to send list is not empty, build up another packet to send
+                AZStd::optional<NetworkEntityUpdateMessage> overflowUpdate;
                 do
                 {
-                    SendEntityUpdateMessages(toSendList);
+                    // Packets are reused between updates to avoid reallocating their storage
+                    if (m_preparedUpdatePacketCount == m_preparedUpdatePackets.size())
+                    {
+                        m_preparedUpdatePackets.emplace_back();
+                    }
+                    PrepareEntityUpdateMessages(toSendList, m_preparedUpdatePackets[m_preparedUpdatePacketCount++], overflowUpdate);
                 } while (!toSendList.empty());
             }
         }
+    }
+
+    void EntityReplicationManager::SendPreparedUpdates()
+    {
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            for (uint32_t packetIndex = 0; packetIndex < m_preparedUpdatePacketCount; ++packetIndex)
+            {
+                PreparedUpdatePacket& packet = m_preparedUpdatePackets[packetIndex];
+                const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(packet.m_entityUpdates);
+
+                // Update the sent things with the packet id
+                for (EntityReplicator* replicator : packet.m_replicators)
+                {
+                    replicator->FinalizeSerialization(sentId);
+                }
+            }
+            m_preparedUpdatePacketCount = 0;
+        }
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -241,16 +273,20 @@ namespace Multiplayer
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::PrepareEntityUpdateMessages(EntityReplicatorList& replicatorList, PreparedUpdatePacket& outPacket, AZStd::optional<NetworkEntityUpdateMessage>& overflowUpdate)
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        NetworkEntityUpdateVector entityUpdates;
+        AZStd::vector<EntityReplicator*>& replicatorUpdatedList = outPacket.m_replicators;
+        NetworkEntityUpdateVector& entityUpdates = outPacket.m_entityUpdates;
+        replicatorUpdatedList.clear();
+        entityUpdates.clear();
         // Serialize everything
         while (!replicatorList.empty())
         {
             EntityReplicator* replicator = replicatorList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            // Regenerating an update that didn't fit would serialize the entity and record its stats a second time
+            NetworkEntityUpdateMessage updateMessage(overflowUpdate.has_value() ? AZStd::move(*overflowUpdate) : replicator->GenerateUpdatePacket());
+            overflowUpdate.reset();
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
@@ -260,6 +296,7 @@ namespace Multiplayer
             const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
+                overflowUpdate = AZStd::move(updateMessage);
                 break;
             }
 
@@ -280,14 +317,6 @@ namespace Multiplayer
                 break;
             }
         }
-
-        const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
-
-        // Update the sent things with the packet id
-        for (EntityReplicator* replicator : replicatorUpdatedList)
-        {
-            replicator->FinalizeSerialization(sentId);
-        }
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& rpcMessages, bool reliable)
@@ -1116,6 +1145,16 @@ namespace Multiplayer
         return m_replicationWindow.get();
     }
 
+    void EntityReplicationManager::SetSerializedDeltaCache(SerializedDeltaCache* deltaCache)
+    {
+        m_serializedDeltaCache = deltaCache;
+    }
+
+    SerializedDeltaCache* EntityReplicationManager::GetSerializedDeltaCache()
+    {
+        return m_serializedDeltaCache;
+    }
+
     void EntityReplicationManager::MigrateEntityInternal(NetEntityId netEntityId)
     {
         ConstNetworkEntityHandle entityHandle = GetNetworkEntityManager()->GetEntity(netEntityId);
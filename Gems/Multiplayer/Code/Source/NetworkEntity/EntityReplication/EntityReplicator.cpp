@@ -493,7 +493,14 @@ namespace Multiplayer
         }
 
         AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        m_propertyPublisher->UpdateSerialization(inputSerializer);
+        if (SerializedDeltaCache* deltaCache = m_replicationManager.GetSerializedDeltaCache())
+        {
+            m_propertyPublisher->UpdateSerialization(inputSerializer, *deltaCache);
+        }
+        else
+        {
+            m_propertyPublisher->UpdateSerialization(inputSerializer);
+        }
         updateMessage.ModifyData().Resize(inputSerializer.GetSize());
 
         return updateMessage;
@@ -7,7 +7,10 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
@@ -176,6 +179,52 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeSharedUpdateEntityRecord(AzNetworking::NetworkInputSerializer& serializer, SerializedDeltaCache& deltaCache)
+    {
+        AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
+        m_pendingRecord.ResetConsumedBits();
+        const uint32_t recordStart = serializer.GetSize();
+        if (!m_pendingRecord.Serialize(serializer))
+        {
+            return false;
+        }
+
+        const SerializedDeltaCache::RecordKey key
+        {
+            m_netBindComponent->GetNetEntityId(),
+            m_pendingRecord.GetRemoteNetworkRole(),
+            serializer.GetBuffer() + recordStart,
+            serializer.GetSize() - recordStart
+        };
+
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        if (const SerializedDeltaCache::Delta* delta = deltaCache.FindDelta(key))
+        {
+            const uint32_t deltaSize = aznumeric_cast<uint32_t>(delta->m_deltaData.size());
+            serializer.CopyToBuffer(delta->m_deltaData.data(), deltaSize);
+            stats.ApplyDeferredRecords(delta->m_stats);
+            stats.RecordSerializedDeltaCacheHit(deltaSize);
+            return serializer.IsValid();
+        }
+
+        // Keep the stats recorded while serializing with the delta, so that connections reusing it report the same property updates
+        MultiplayerStats::DeferredRecords deltaStats;
+        const uint32_t deltaStart = serializer.GetSize();
+        {
+            MultiplayerStats::DeferRecordsScope deferStats(deltaStats);
+            m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
+        }
+        stats.ApplyDeferredRecords(deltaStats);
+
+        if (serializer.IsValid())
+        {
+            const uint32_t deltaSize = serializer.GetSize() - deltaStart;
+            deltaCache.StoreDelta(key, serializer.GetBuffer() + deltaStart, deltaSize, AZStd::move(deltaStats));
+            stats.RecordSerializedDeltaCacheMiss(deltaSize);
+        }
+        return serializer.IsValid();
+    }
+
     bool PropertyPublisher::SerializeDeleteEntityRecord(AzNetworking::ISerializer &serializer)
     {
         return serializer.IsValid();
@@ -318,6 +367,25 @@ namespace Multiplayer
         return success;
     }
 
+    bool PropertyPublisher::UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer, SerializedDeltaCache& deltaCache)
+    {
+        const bool isUpdate = (m_replicatorState == PropertyPublisher::EntityReplicatorState::Creating)
+                           || (m_replicatorState == PropertyPublisher::EntityReplicatorState::Updating);
+        if (!isUpdate || !deltaCache.IsSharing())
+        {
+            return UpdateSerialization(static_cast<AzNetworking::ISerializer&>(serializer));
+        }
+
+        AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
+        const bool success = SerializeSharedUpdateEntityRecord(serializer, deltaCache);
+        if (!success)
+        {
+            AZLOG_ERROR("EntityReplicator: Serialization failed");
+        }
+        AZ_Assert(success, "EntityReplicator: Serialization failed");
+        return success;
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -14,10 +14,13 @@
 namespace AzNetworking
 {
     class IConnection;
+    class NetworkInputSerializer;
 }
 
 namespace Multiplayer
 {
+    class SerializedDeltaCache;
+
     class PropertyPublisher
     {
     public:
@@ -44,6 +47,7 @@ namespace Multiplayer
         bool RequiresSerialization();
         bool PrepareSerialization();
         bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        bool UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer, SerializedDeltaCache& deltaCache);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
@@ -77,6 +81,7 @@ namespace Multiplayer
         //! Phase 2, serialize the record
         //! No add, they share the update path
         bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
+        bool SerializeSharedUpdateEntityRecord(AzNetworking::NetworkInputSerializer& serializer, SerializedDeltaCache& deltaCache);
         bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
 
         //! Phase 3, finalize with the packet id
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/hash.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, sv_ShareSerializedDeltas, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, entity property deltas serialized for one client connection are reused by other client connections sending the same update on the same tick");
+
+    void SerializedDeltaCache::BeginSharing()
+    {
+        m_isSharing = sv_ShareSerializedDeltas;
+    }
+
+    void SerializedDeltaCache::EndSharing()
+    {
+        m_isSharing = false;
+        for (Shard& shard : m_shards)
+        {
+            shard.m_deltas.clear();
+        }
+    }
+
+    bool SerializedDeltaCache::IsSharing() const
+    {
+        return m_isSharing;
+    }
+
+    const SerializedDeltaCache::Delta* SerializedDeltaCache::FindDelta(const RecordKey& key) const
+    {
+        const size_t hash = HashKey(key);
+        const Shard& shard = m_shards[hash % ShardCount];
+
+        AZStd::scoped_lock<AZStd::mutex> lock(shard.m_mutex);
+        auto range = shard.m_deltas.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            if (DeltaMatchesKey(*iter->second, key))
+            {
+                // Deltas are never modified once stored, so the delta can be read after the lock is released
+                return iter->second.get();
+            }
+        }
+        return nullptr;
+    }
+
+    void SerializedDeltaCache::StoreDelta(const RecordKey& key, const uint8_t* deltaData, uint32_t deltaSize, MultiplayerStats::DeferredRecords&& stats)
+    {
+        // Copy everything outside of the lock, other connections only wait on the insert
+        AZStd::unique_ptr<Delta> delta = AZStd::make_unique<Delta>();
+        delta->m_netEntityId = key.m_netEntityId;
+        delta->m_remoteNetEntityRole = key.m_remoteNetEntityRole;
+        delta->m_recordData.assign(key.m_recordData, key.m_recordData + key.m_recordSize);
+        delta->m_deltaData.assign(deltaData, deltaData + deltaSize);
+        delta->m_stats = AZStd::move(stats);
+
+        const size_t hash = HashKey(key);
+        Shard& shard = m_shards[hash % ShardCount];
+
+        AZStd::scoped_lock<AZStd::mutex> lock(shard.m_mutex);
+        auto range = shard.m_deltas.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            if (DeltaMatchesKey(*iter->second, key))
+            {
+                // Another connection serialized the same record at the same time, keep the delta that other connections may already be using
+                return;
+            }
+        }
+        shard.m_deltas.emplace(hash, AZStd::move(delta));
+    }
+
+    uint32_t SerializedDeltaCache::GetDeltaCount() const
+    {
+        uint32_t deltaCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(shard.m_mutex);
+            deltaCount += aznumeric_cast<uint32_t>(shard.m_deltas.size());
+        }
+        return deltaCount;
+    }
+
+    size_t SerializedDeltaCache::HashKey(const RecordKey& key)
+    {
+        size_t hash = AZStd::hash_range(key.m_recordData, key.m_recordData + key.m_recordSize);
+        AZStd::hash_combine(hash, key.m_netEntityId, static_cast<uint8_t>(key.m_remoteNetEntityRole));
+        return hash;
+    }
+
+    bool SerializedDeltaCache::DeltaMatchesKey(const Delta& delta, const RecordKey& key)
+    {
+        return (delta.m_netEntityId == key.m_netEntityId)
+            && (delta.m_remoteNetEntityRole == key.m_remoteNetEntityRole)
+            && (delta.m_recordData.size() == key.m_recordSize)
+            && (memcmp(delta.m_recordData.data(), key.m_recordData, key.m_recordSize) == 0);
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Multiplayer
+{
+    //! @class SerializedDeltaCache
+    //! @brief Shares the serialized property deltas of entities between all the client connections that replicate them.
+    //!
+    //! When many clients observe the same entity, their publishers mostly serialize the same dirty properties on the same tick.
+    //! The first publisher to serialize a replication record for an entity stores the bytes it wrote, and any other publisher
+    //! with an identical record for that entity copies those bytes instead of serializing the entity again.
+    //!
+    //! A cached delta is only correct while entity state is unchanged, so deltas are only shared between BeginSharing and
+    //! EndSharing, which bracket the sending of client updates each tick. Client connections prepare their updates in
+    //! parallel, so finding and storing deltas is thread safe.
+    class SerializedDeltaCache
+    {
+    public:
+
+        //! Identifies a serialized delta by the entity, along with the remote role and serialized bits of its replication record.
+        //! Together these determine exactly which properties are written.
+        struct RecordKey
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            NetEntityRole m_remoteNetEntityRole = NetEntityRole::InvalidRole;
+            const uint8_t* m_recordData = nullptr;
+            uint32_t m_recordSize = 0;
+        };
+
+        //! The serialized properties of a record, along with the stats recorded while serializing them.
+        struct Delta
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            NetEntityRole m_remoteNetEntityRole = NetEntityRole::InvalidRole;
+            AZStd::vector<uint8_t> m_recordData;
+            AZStd::vector<uint8_t> m_deltaData;
+            MultiplayerStats::DeferredRecords m_stats;
+        };
+
+        //! Starts sharing deltas between connections, entity state must not change until EndSharing is called.
+        void BeginSharing();
+
+        //! Stops sharing deltas and discards every cached delta.
+        void EndSharing();
+
+        //! Returns true if deltas are being shared.
+        bool IsSharing() const;
+
+        //! Returns the delta stored for the key, the delta remains valid until EndSharing is called.
+        //! @param key the entity and record to find a delta for
+        //! @return pointer to the delta, or nullptr if no delta has been stored for the key
+        const Delta* FindDelta(const RecordKey& key) const;
+
+        //! Stores the delta serialized for the key, the delta is discarded if one was already stored for the key.
+        //! @param key       the entity and record the delta was serialized for
+        //! @param deltaData the serialized properties
+        //! @param deltaSize the size of the serialized properties in bytes
+        //! @param stats     the stats recorded while serializing the properties
+        void StoreDelta(const RecordKey& key, const uint8_t* deltaData, uint32_t deltaSize, MultiplayerStats::DeferredRecords&& stats);
+
+        //! Returns the number of deltas currently cached.
+        uint32_t GetDeltaCount() const;
+
+    private:
+
+        // Deltas are spread over several independently locked shards to keep contention between connections low
+        static constexpr uint32_t ShardCount = 16;
+
+        struct Shard
+        {
+            mutable AZStd::mutex m_mutex;
+            AZStd::unordered_multimap<size_t, AZStd::unique_ptr<Delta>> m_deltas;
+        };
+
+        static size_t HashKey(const RecordKey& key);
+        static bool DeltaMatchesKey(const Delta& delta, const RecordKey& key);
+
+        AZStd::array<Shard, ShardCount> m_shards;
+        bool m_isSharing = false;
+    };
+}
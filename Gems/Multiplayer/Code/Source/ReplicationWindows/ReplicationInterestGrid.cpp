@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ReplicationInterestCellSize, 128.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The width of the grid cells used to gather replication candidates for client connections");
+
+    // Keeps cell coordinates well within int32 range for far away or invalid positions
+    static constexpr float MaxCellCoordinate = 1.0e9f;
+
+    ReplicationInterestGrid::ReplicationInterestGrid()
+        : m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+        , m_entityBoundsUnionChangedEventHandler([this](AZ::EntityId entityId) { MarkEntityMoved(entityId); })
+    {
+        ;
+    }
+
+    ReplicationInterestGrid::~ReplicationInterestGrid()
+    {
+        Deactivate();
+    }
+
+    void ReplicationInterestGrid::Activate()
+    {
+        if (m_isActive)
+        {
+            return;
+        }
+
+        m_isActive = true;
+        m_cellSize = AZStd::max(static_cast<float>(sv_ReplicationInterestCellSize), 1.0f);
+
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+
+        // Bounds can change without the entity moving, for example when a mesh finishes loading after activation
+        if (AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get())
+        {
+            boundsUnion->RegisterEntityBoundsUnionChangedEventHandler(m_entityBoundsUnionChangedEventHandler);
+        }
+
+        if (NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker())
+        {
+            for (auto& iter : *networkEntityTracker)
+            {
+                AZ::Entity* entity = iter.second;
+                if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+                {
+                    AddEntity(entity);
+                }
+            }
+        }
+    }
+
+    void ReplicationInterestGrid::Deactivate()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+        m_entityBoundsUnionChangedEventHandler.Disconnect();
+
+        m_movedEntities.clear();
+        m_cells.clear();
+        m_oversizedCell.m_candidates.clear();
+        m_entries.clear();
+        m_isActive = false;
+    }
+
+    bool ReplicationInterestGrid::IsActive() const
+    {
+        return m_isActive;
+    }
+
+    void ReplicationInterestGrid::AddEntity(AZ::Entity* entity)
+    {
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if (transformInterface == nullptr)
+        {
+            return;
+        }
+
+        ConstNetworkEntityHandle entityHandle(entity);
+        if (entityHandle.GetNetBindComponent() == nullptr)
+        {
+            // Entity does not have netbinding, it can never be replicated
+            return;
+        }
+
+        const AZ::EntityId entityId = entity->GetId();
+        auto insertResult = m_entries.emplace(entityId, Entry());
+        if (!insertResult.second)
+        {
+            // Already tracked
+            return;
+        }
+
+        Entry& entry = insertResult.first->second;
+        entry.m_entityHandle = entityHandle;
+        entry.m_transformChangedHandler = AZ::TransformChangedEvent::Handler([this, entityId]
+        (
+            [[maybe_unused]] const AZ::Transform& localTm,
+            [[maybe_unused]] const AZ::Transform& worldTm
+        )
+        {
+            MarkEntityMoved(entityId);
+        });
+        transformInterface->BindTransformChangedEventHandler(entry.m_transformChangedHandler);
+
+        // Bucketing is deferred until the next query so that the entity bounds have been computed
+        MarkEntityMoved(entityId);
+    }
+
+    void ReplicationInterestGrid::RemoveEntity(const AZ::EntityId& entityId)
+    {
+        auto entryIter = m_entries.find(entityId);
+        if (entryIter == m_entries.end())
+        {
+            return;
+        }
+
+        // Any pending move for this entity is skipped once the entry is gone
+        RemoveFromCell(entryIter->second);
+        m_entries.erase(entryIter);
+    }
+
+    void ReplicationInterestGrid::MarkEntityMoved(const AZ::EntityId& entityId)
+    {
+        auto entryIter = m_entries.find(entityId);
+        if ((entryIter != m_entries.end()) && !entryIter->second.m_isMoved)
+        {
+            entryIter->second.m_isMoved = true;
+            m_movedEntities.push_back(entityId);
+        }
+    }
+
+    uint32_t ReplicationInterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+
+    uint32_t ReplicationInterestGrid::GetCellCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_cells.size()) + (m_oversizedCell.m_candidates.empty() ? 0 : 1);
+    }
+
+    void ReplicationInterestGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        AddEntity(entity);
+    }
+
+    void ReplicationInterestGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        RemoveEntity(entity->GetId());
+    }
+
+    void ReplicationInterestGrid::RefreshMovedEntities()
+    {
+        const float cellSize = AZStd::max(static_cast<float>(sv_ReplicationInterestCellSize), 1.0f);
+        if (cellSize != m_cellSize)
+        {
+            // Cell size changed, every entity needs to be rebucketed
+            m_cellSize = cellSize;
+            m_cells.clear();
+            m_oversizedCell.m_candidates.clear();
+            m_movedEntities.clear();
+            for (auto& entryIter : m_entries)
+            {
+                entryIter.second.m_isBucketed = false;
+                entryIter.second.m_isMoved = true;
+                m_movedEntities.push_back(entryIter.first);
+            }
+        }
+
+        if (m_movedEntities.empty())
+        {
+            return;
+        }
+
+        for (const AZ::EntityId& entityId : m_movedEntities)
+        {
+            auto entryIter = m_entries.find(entityId);
+            if (entryIter != m_entries.end())
+            {
+                InsertIntoCell(entityId, entryIter->second);
+            }
+        }
+        m_movedEntities.clear();
+    }
+
+    void ReplicationInterestGrid::InsertIntoCell(const AZ::EntityId& entityId, Entry& entry)
+    {
+        entry.m_isMoved = false;
+
+        AZ::Entity* entity = entry.m_entityHandle.GetEntity();
+        if (entity == nullptr)
+        {
+            RemoveFromCell(entry);
+            return;
+        }
+
+        // Matches the bounds the visibility system uses for the entity, the cached local union translated to the world position
+        const AZ::Vector3 worldTranslation = entity->GetTransform()->GetWorldTranslation();
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        if (AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get())
+        {
+            bounds = boundsUnion->GetEntityLocalBoundsUnion(entityId);
+        }
+        bounds = bounds.IsValid() ? bounds.GetTranslated(worldTranslation) : AZ::Aabb::CreateFromPoint(worldTranslation);
+
+        const AZ::Vector3 boundsCenter = bounds.GetCenter();
+        const AZ::Vector3 boundsExtents = bounds.GetExtents();
+        const bool isOversized = AZStd::max(boundsExtents.GetX(), boundsExtents.GetY()) > m_cellSize;
+        const CellKey cellKey = isOversized ? 0 : GetCellKey(GetCellCoordinate(boundsCenter.GetX()), GetCellCoordinate(boundsCenter.GetY()));
+
+        if (entry.m_isBucketed && (entry.m_isOversized == isOversized) && (entry.m_cellKey == cellKey))
+        {
+            // Still in the same cell, only the bounds need updating
+            FindCell(entry)->m_candidates[entry.m_cellIndex].m_bounds = bounds;
+            return;
+        }
+
+        RemoveFromCell(entry);
+
+        entry.m_cellKey = cellKey;
+        entry.m_isOversized = isOversized;
+        entry.m_isBucketed = true;
+
+        Cell& cell = isOversized ? m_oversizedCell : m_cells[cellKey];
+        entry.m_cellIndex = aznumeric_cast<uint32_t>(cell.m_candidates.size());
+        cell.m_candidates.push_back({ entry.m_entityHandle, bounds, entityId });
+    }
+
+    void ReplicationInterestGrid::RemoveFromCell(Entry& entry)
+    {
+        if (!entry.m_isBucketed)
+        {
+            return;
+        }
+        entry.m_isBucketed = false;
+
+        Cell* cell = FindCell(entry);
+        AZ_Assert(cell != nullptr, "Bucketed entity is missing its cell");
+        AZStd::vector<Candidate>& candidates = cell->m_candidates;
+
+        // Swap and pop, then fix up the index of the candidate that was moved into the vacated slot
+        if (entry.m_cellIndex + 1 < candidates.size())
+        {
+            candidates[entry.m_cellIndex] = AZStd::move(candidates.back());
+            auto movedIter = m_entries.find(candidates[entry.m_cellIndex].m_entityId);
+            AZ_Assert(movedIter != m_entries.end(), "Candidate is missing its entry");
+            movedIter->second.m_cellIndex = entry.m_cellIndex;
+        }
+        candidates.pop_back();
+
+        if (candidates.empty() && !entry.m_isOversized)
+        {
+            m_cells.erase(entry.m_cellKey);
+        }
+    }
+
+    ReplicationInterestGrid::Cell* ReplicationInterestGrid::FindCell(const Entry& entry)
+    {
+        if (entry.m_isOversized)
+        {
+            return &m_oversizedCell;
+        }
+        auto cellIter = m_cells.find(entry.m_cellKey);
+        return (cellIter != m_cells.end()) ? &cellIter->second : nullptr;
+    }
+
+    int32_t ReplicationInterestGrid::GetCellCoordinate(float position) const
+    {
+        const float coordinate = AZStd::floor(position / m_cellSize);
+        return static_cast<int32_t>(AZ::GetClamp(coordinate, -MaxCellCoordinate, MaxCellCoordinate));
+    }
+
+    ReplicationInterestGrid::CellKey ReplicationInterestGrid::GetCellKey(int32_t x, int32_t y)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(y));
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class ReplicationInterestGrid
+    //! @brief Spatial hash of networked entities shared by every ServerToClientReplicationWindow on a host.
+    //!
+    //! Entities are bucketed into vertical grid columns by the center of their world bounds. A transform change or a change to
+    //! the entity bounds union only flags the entity, and flagged entities are rebucketed in one pass before the next query. Each cell keeps its candidates packed
+    //! together, so every replication window overlapping a cell reads the same results instead of enumerating the visibility
+    //! octree with its own awareness sphere.
+    //!
+    //! Entities whose bounds are wider than a cell are kept in a separate cell that is visited by every query, which allows
+    //! queries to only expand their radius by half a cell to account for entity extents.
+    class ReplicationInterestGrid
+    {
+    public:
+
+        //! A networked entity tracked by the grid, along with its world bounds as of the last rebucketing.
+        struct Candidate
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+            AZ::EntityId m_entityId;
+        };
+
+        ReplicationInterestGrid();
+        ~ReplicationInterestGrid();
+
+        //! Starts tracking networked entities as they are activated, and adds all currently active networked entities.
+        void Activate();
+
+        //! Stops tracking networked entities and releases all cells.
+        void Deactivate();
+
+        //! Returns true if the grid is tracking networked entities.
+        bool IsActive() const;
+
+        //! Adds an activated entity to the grid, entities without netbinding or a transform are ignored.
+        //! @param entity the entity to start tracking
+        void AddEntity(AZ::Entity* entity);
+
+        //! Removes an entity from the grid.
+        //! @param entityId the id of the entity to stop tracking
+        void RemoveEntity(const AZ::EntityId& entityId);
+
+        //! Flags a tracked entity to be rebucketed prior to the next query.
+        //! @param entityId the id of the entity that moved or whose bounds changed
+        void MarkEntityMoved(const AZ::EntityId& entityId);
+
+        //! Invokes the visitor for every candidate in the cells that may overlap the provided sphere.
+        //! Candidates are not culled against the sphere, callers are expected to test the candidate bounds themselves.
+        //! @param center  the center of the query sphere
+        //! @param radius  the radius of the query sphere
+        //! @param visitor callable invoked with a const Candidate& for each candidate
+        template <typename VISITOR>
+        void EnumerateCandidates(const AZ::Vector3& center, float radius, const VISITOR& visitor);
+
+        //! Returns the number of entities tracked by the grid.
+        uint32_t GetEntityCount() const;
+
+        //! Returns the number of non-empty cells.
+        uint32_t GetCellCount() const;
+
+    private:
+
+        using CellKey = uint64_t;
+
+        struct Cell
+        {
+            AZStd::vector<Candidate> m_candidates;
+        };
+
+        struct Entry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            CellKey m_cellKey = 0;
+            uint32_t m_cellIndex = 0;
+            bool m_isOversized = false;
+            bool m_isBucketed = false;
+            bool m_isMoved = false;
+        };
+
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+
+        //! Rebuckets all entities flagged as moved, and rebuilds the grid if the cell size was changed.
+        void RefreshMovedEntities();
+
+        void InsertIntoCell(const AZ::EntityId& entityId, Entry& entry);
+        void RemoveFromCell(Entry& entry);
+        Cell* FindCell(const Entry& entry);
+
+        int32_t GetCellCoordinate(float position) const;
+        static CellKey GetCellKey(int32_t x, int32_t y);
+
+        AZStd::unordered_map<AZ::EntityId, Entry> m_entries;
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        Cell m_oversizedCell;
+        AZStd::vector<AZ::EntityId> m_movedEntities;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+        AzFramework::EntityBoundsUnionChangedEvent::Handler m_entityBoundsUnionChangedEventHandler;
+
+        float m_cellSize = 0.0f;
+        bool m_isActive = false;
+    };
+}
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.inl>
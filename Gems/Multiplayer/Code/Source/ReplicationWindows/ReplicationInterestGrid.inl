@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace Multiplayer
+{
+    template <typename VISITOR>
+    inline void ReplicationInterestGrid::EnumerateCandidates(const AZ::Vector3& center, float radius, const VISITOR& visitor)
+    {
+        RefreshMovedEntities();
+
+        // Candidates are bucketed by the center of their bounds, and only bounds narrower than a cell are bucketed
+        const float queryExtent = radius + m_cellSize * 0.5f;
+        const int32_t minX = GetCellCoordinate(center.GetX() - queryExtent);
+        const int32_t maxX = GetCellCoordinate(center.GetX() + queryExtent);
+        const int32_t minY = GetCellCoordinate(center.GetY() - queryExtent);
+        const int32_t maxY = GetCellCoordinate(center.GetY() + queryExtent);
+
+        const uint64_t queryCellCount = (static_cast<uint64_t>(maxX - minX) + 1) * (static_cast<uint64_t>(maxY - minY) + 1);
+        if (queryCellCount > m_cells.size())
+        {
+            // Sparse grid, cheaper to test every populated cell than to look up every cell in range
+            for (const auto& cell : m_cells)
+            {
+                const int32_t x = static_cast<int32_t>(static_cast<uint32_t>(cell.first >> 32));
+                const int32_t y = static_cast<int32_t>(static_cast<uint32_t>(cell.first));
+                if ((x >= minX) && (x <= maxX) && (y >= minY) && (y <= maxY))
+                {
+                    for (const Candidate& candidate : cell.second.m_candidates)
+                    {
+                        visitor(candidate);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                for (int32_t y = minY; y <= maxY; ++y)
+                {
+                    auto cell = m_cells.find(GetCellKey(x, y));
+                    if (cell != m_cells.end())
+                    {
+                        for (const Candidate& candidate : cell->second.m_candidates)
+                        {
+                            visitor(candidate);
+                        }
+                    }
+                }
+            }
+        }
+
+        for (const Candidate& candidate : m_oversizedCell.m_candidates)
+        {
+            visitor(candidate);
+        }
+    }
+}
@@ -7,6 +7,7 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
@@ -25,6 +26,8 @@ namespace Multiplayer
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(bool, sv_ReplicationInterestGrid, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Gather client replication candidates from the shared interest grid rather than querying the visibility system per client");
+    AZ_CVAR(float, sv_ClientReplicationPriorityBandSize, 16.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The width of the distance bands used to prioritize interest grid candidates, priorities are only updated when an entity changes band");
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -52,8 +55,9 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
-        : m_controlledEntity(controlledEntity)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, ReplicationInterestGrid* interestGrid)
+        : m_interestGrid(interestGrid)
+        , m_controlledEntity(controlledEntity)
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
         , m_connection(connection)
@@ -77,7 +81,7 @@ namespace Multiplayer
         // if we don't have a controlled entity anymore, don't send updates (validate this)
         if (!m_controlledEntity.Exists())
         {
-            m_replicationSet.clear();
+            ResetReplicationSet();
         }
         return true;
     }
@@ -101,18 +105,11 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
-        // Clear the candidate queue, we're going to rebuild it
-        ReplicationCandidateQueue::container_type clearQueueContainer;
-        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
-        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
-        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
-        m_candidateQueue.swap(clearQueue);
-        m_replicationSet.clear();
-
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
         {
             // If we don't have a controlled entity, or we no longer have control of the entity, don't run the update
+            ResetReplicationSet();
             return;
         }
 
@@ -121,6 +118,73 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
+        if (sv_ReplicationInterestGrid && (m_interestGrid != nullptr) && m_interestGrid->IsActive())
+        {
+            UpdateInterestSet(controlledEntityPosition);
+        }
+        else
+        {
+            ResetReplicationSet();
+            UpdateVisibilitySet(controlledEntityPosition);
+        }
+
+        // Add in all entities that have forced relevancy
+        for (const ConstNetworkEntityHandle& entityHandle : GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet())
+        {
+            if (entityHandle.Exists())
+            {
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };  // Always replicate entities with forced relevancy
+                m_forcedEntities.push_back(entityHandle);
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
+        m_forcedEntities.push_back(m_controlledEntity);
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+        }
+
+        if (m_isInterestSetValid)
+        {
+            // Forced entities don't count against the tracking limit, and must never be evicted for a newly activated entity
+            for (const ConstNetworkEntityHandle& entityHandle : m_forcedEntities)
+            {
+                auto interestIter = m_interestEntries.find(entityHandle);
+                if (interestIter != m_interestEntries.end())
+                {
+                    SetInterestReplicated(*interestIter, false);
+                }
+            }
+        }
+    }
+
+    void ServerToClientReplicationWindow::ResetReplicationSet()
+    {
+        // Clear the candidate queue, we're going to rebuild it
+        ReplicationCandidateQueue::container_type clearQueueContainer;
+        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
+        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
+        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
+        m_candidateQueue.swap(clearQueue);
+        m_replicationSet.clear();
+
+        m_interestEntries.clear();
+        for (auto& replicatedBand : m_replicatedBands)
+        {
+            replicatedBand.clear();
+        }
+        m_interestSetSize = 0;
+        m_forcedEntities.clear();
+        m_isInterestSetValid = false;
+    }
+
+    void ServerToClientReplicationWindow::UpdateVisibilitySet(const AZ::Vector3& controlledEntityPosition)
+    {
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
@@ -163,24 +227,137 @@ namespace Multiplayer
                 
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
+    }
 
-        // Add in all entities that have forced relevancy
-        for (const ConstNetworkEntityHandle& entityHandle : GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet())
+    void ServerToClientReplicationWindow::UpdateInterestSet(const AZ::Vector3& controlledEntityPosition)
+    {
+        if (!m_isInterestSetValid)
         {
-            if (entityHandle.Exists())
+            // The set was last built from the visibility system, start over
+            ResetReplicationSet();
+            m_isInterestSetValid = true;
+        }
+
+        const float bandSize = AZStd::max(static_cast<float>(sv_ClientReplicationPriorityBandSize), 0.01f);
+        if (bandSize != m_priorityBandSize)
+        {
+            // Band priorities depend on the band size, so every tracked entity needs a new priority
+            m_priorityBandSize = bandSize;
+            for (auto& interestEntry : m_interestEntries)
             {
-                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };  // Always replicate entities with forced relevancy
+                interestEntry.second.m_band = InvalidPriorityBand;
             }
         }
 
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
+        // Entities forced into the set last update may have been assigned a different role, treat them as new
+        for (const ConstNetworkEntityHandle& entityHandle : m_forcedEntities)
+        {
+            m_replicationSet.erase(entityHandle);
+            auto interestIter = m_interestEntries.find(entityHandle);
+            if (interestIter != m_interestEntries.end())
+            {
+                SetInterestReplicated(*interestIter, false);
+            }
+        }
+        m_forcedEntities.clear();
 
-        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
-        if (hierarchyComponent != nullptr)
+        ++m_interestUpdateId;
+        m_interestCandidates.clear();
+
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const AzNetworking::ConnectionId connectionId = m_connection->GetConnectionId();
+        const float awarenessRadius = sv_ClientAwarenessRadius;
+        const float awarenessRadiusSq = awarenessRadius * awarenessRadius;
+
+        m_interestGrid->EnumerateCandidates(controlledEntityPosition, awarenessRadius,
+            [this, filterEntityManager, connectionId, &controlledEntityPosition, awarenessRadiusSq, bandSize]
+            (const ReplicationInterestGrid::Candidate& candidate)
+            {
+                // Distance to the closest point of the bounds, entities overlapping the client are in the closest band
+                const float distanceSquared = candidate.m_bounds.GetDistanceSq(controlledEntityPosition);
+                if (distanceSquared > awarenessRadiusSq)
+                {
+                    return;
+                }
+
+                ConstNetworkEntityHandle entityHandle = candidate.m_entityHandle;
+                if (entityHandle.GetNetEntityId() == m_controlledEntity.GetNetEntityId())
+                {
+                    // Always replicated as autonomous, it shouldn't take up one of the tracked slots
+                    return;
+                }
+
+                AZ::Entity* entity = entityHandle.GetEntity();
+                if ((entity == nullptr) || !IsReplicatedProxy(entityHandle))
+                {
+                    return;
+                }
+
+                if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, connectionId))
+                {
+                    return;
+                }
+
+                const float band = AZStd::sqrt(distanceSquared) / bandSize;
+                const uint8_t bandIndex = static_cast<uint8_t>(AZStd::min(band, static_cast<float>(MaxPriorityBand)));
+
+                InterestMap::value_type& interest = *m_interestEntries.emplace(entityHandle, InterestEntry()).first;
+                interest.second.m_updateId = m_interestUpdateId;
+                interest.second.m_isBandChanged = (interest.second.m_band != bandIndex);
+                interest.second.m_band = bandIndex;
+                m_interestCandidates.push_back(&interest);
+            }
+        );
+
+        // Drop everything that was not gathered this update
+        for (auto interestIter = m_interestEntries.begin(); interestIter != m_interestEntries.end();)
         {
-            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+            if (interestIter->second.m_updateId != m_interestUpdateId)
+            {
+                if (interestIter->second.m_isInReplicationSet)
+                {
+                    m_replicationSet.erase(interestIter->first);
+                    SetInterestReplicated(*interestIter, false);
+                }
+                interestIter = m_interestEntries.erase(interestIter);
+            }
+            else
+            {
+                ++interestIter;
+            }
+        }
+
+        const size_t maxCandidates = sv_MaxEntitiesToTrackReplication;
+        if (m_interestCandidates.size() > maxCandidates)
+        {
+            // Only keep the closest bands, ties are broken by id so the selection doesn't flicker between updates
+            AZStd::partial_sort(m_interestCandidates.begin(), m_interestCandidates.begin() + maxCandidates, m_interestCandidates.end(),
+                [](const InterestMap::value_type* lhs, const InterestMap::value_type* rhs)
+                {
+                    return (lhs->second.m_band != rhs->second.m_band)
+                        ? (lhs->second.m_band < rhs->second.m_band)
+                        : (lhs->first.GetNetEntityId() < rhs->first.GetNetEntityId());
+                }
+            );
+        }
+
+        // Only entities that entered the set or changed band need their priority updated
+        for (size_t index = 0; index < m_interestCandidates.size(); ++index)
+        {
+            InterestMap::value_type& interest = *m_interestCandidates[index];
+            if (index < maxCandidates)
+            {
+                if (!interest.second.m_isInReplicationSet || interest.second.m_isBandChanged)
+                {
+                    m_replicationSet[interest.first] = { NetEntityRole::Client, GetBandPriority(interest.second.m_band) };
+                    SetInterestReplicated(interest, true);
+                }
+            }
+            else if (interest.second.m_isInReplicationSet)
+            {
+                m_replicationSet.erase(interest.first);
+                SetInterestReplicated(interest, false);
+            }
         }
     }
 
@@ -255,7 +432,14 @@ namespace Multiplayer
                     // Make sure we would be in the awareness radius
                     if (distSq < awarenessSq)
                     {
-                        AddEntityToReplicationSet(entityHandle, 1.0f, distSq);
+                        if (m_isInterestSetValid)
+                        {
+                            AddEntityToInterestSet(entityHandle, distSq);
+                        }
+                        else
+                        {
+                            AddEntityToReplicationSet(entityHandle, 1.0f, distSq);
+                        }
                     }
                 }
             }
@@ -268,6 +452,12 @@ namespace Multiplayer
         if (entityHandle.GetNetBindComponent() != nullptr)
         {
             m_replicationSet.erase(entityHandle);
+            auto interestIter = m_interestEntries.find(entityHandle);
+            if (interestIter != m_interestEntries.end())
+            {
+                SetInterestReplicated(*interestIter, false);
+                m_interestEntries.erase(interestIter);
+            }
         }
     }
 
@@ -303,14 +493,9 @@ namespace Multiplayer
     void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
-        if (!sv_ReplicateServerProxies)
+        if (!IsReplicatedProxy(entityHandle))
         {
-            NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
-            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
-            {
-                // Proxy replication disabled
-                return;
-            }
+            return;
         }
 
         const bool isQueueFull = (m_candidateQueue.size() >= sv_MaxEntitiesToTrackReplication); // See if have the maximum number of entities in our set
@@ -328,6 +513,103 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::AddEntityToInterestSet(const ConstNetworkEntityHandle& entityHandle, float distanceSquared)
+    {
+        // Assumption: the entity has been checked for filtering prior to this call.
+        if (!IsReplicatedProxy(entityHandle))
+        {
+            return;
+        }
+
+        if (m_replicationSet.find(entityHandle) != m_replicationSet.end())
+        {
+            // Already gathered or forced into the set
+            return;
+        }
+
+        const float band = AZStd::sqrt(distanceSquared) / m_priorityBandSize;
+        const uint8_t bandIndex = static_cast<uint8_t>(AZStd::min(band, static_cast<float>(MaxPriorityBand)));
+
+        if (m_interestSetSize >= sv_MaxEntitiesToTrackReplication) // If our set is full, then we need to remove the worst priority in our set
+        {
+            // Walk from the farthest band towards the new entity's band, any entity in the first non-empty band can be evicted
+            InterestMap::value_type* evictInterest = nullptr;
+            for (int32_t band = MaxPriorityBand; (band >= bandIndex) && (evictInterest == nullptr); --band)
+            {
+                if (!m_replicatedBands[band].empty())
+                {
+                    evictInterest = m_replicatedBands[band].back();
+                }
+            }
+
+            if (evictInterest == nullptr)
+            {
+                // Everything tracked is closer than the new entity, it will compete for a slot on the next update
+                return;
+            }
+
+            m_replicationSet.erase(evictInterest->first);
+            SetInterestReplicated(*evictInterest, false);
+        }
+
+        // Stamped with the last update so the next update keeps or drops it like any other gathered entity
+        InterestMap::value_type& interest = *m_interestEntries.emplace(entityHandle, InterestEntry()).first;
+        interest.second.m_updateId = m_interestUpdateId;
+        interest.second.m_band = bandIndex;
+        m_replicationSet[entityHandle] = { NetEntityRole::Client, GetBandPriority(bandIndex) };
+        SetInterestReplicated(interest, true);
+    }
+
+    void ServerToClientReplicationWindow::SetInterestReplicated(InterestMap::value_type& interest, bool isInReplicationSet)
+    {
+        InterestEntry& interestEntry = interest.second;
+        if (interestEntry.m_isInReplicationSet && (!isInReplicationSet || (interestEntry.m_replicatedBand != interestEntry.m_band)))
+        {
+            // Swap remove from the bucket of the band the entry was added under, fixing up the index of the moved entry
+            AZStd::vector<InterestMap::value_type*>& replicatedBand = m_replicatedBands[interestEntry.m_replicatedBand];
+            InterestMap::value_type* movedInterest = replicatedBand.back();
+            replicatedBand[interestEntry.m_replicatedBandIndex] = movedInterest;
+            movedInterest->second.m_replicatedBandIndex = interestEntry.m_replicatedBandIndex;
+            replicatedBand.pop_back();
+
+            interestEntry.m_replicatedBand = InvalidPriorityBand;
+            interestEntry.m_isInReplicationSet = false;
+            --m_interestSetSize;
+        }
+
+        if (!interestEntry.m_isInReplicationSet && isInReplicationSet)
+        {
+            AZStd::vector<InterestMap::value_type*>& replicatedBand = m_replicatedBands[interestEntry.m_band];
+            interestEntry.m_replicatedBand = interestEntry.m_band;
+            interestEntry.m_replicatedBandIndex = static_cast<uint32_t>(replicatedBand.size());
+            replicatedBand.push_back(&interest);
+
+            interestEntry.m_isInReplicationSet = true;
+            ++m_interestSetSize;
+        }
+    }
+
+    float ServerToClientReplicationWindow::GetBandPriority(uint8_t band) const
+    {
+        // Every entity in a band shares the priority of the band center, so sends are ordered by band rather than exact distance
+        const float bandDistance = (static_cast<float>(band) + 0.5f) * m_priorityBandSize;
+        return 1.0f / (bandDistance * bandDistance);
+    }
+
+    bool ServerToClientReplicationWindow::IsReplicatedProxy(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        if (!sv_ReplicateServerProxies)
+        {
+            NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+            if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+            {
+                // Proxy replication disabled
+                return false;
+            }
+        }
+        return true;
+    }
+
     void ServerToClientReplicationWindow::UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent)
     {
         INetworkEntityManager* networkEntityManager = AZ::Interface<INetworkEntityManager>::Get();
@@ -342,6 +624,7 @@ namespace Multiplayer
             AZ_Assert(controlledEntityHandle != nullptr, "We have lost a controlled entity unexpectedly");
             
             replicationSet[controlledEntityHandle] = { NetEntityRole::Autonomous, 1.0f };
+            m_forcedEntities.push_back(controlledEntityHandle);
         }
     }
 }
@@ -15,12 +15,16 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace Multiplayer
 {
     class NetSystemComponent;
     class NetworkHierarchyRootComponent;
+    class ReplicationInterestGrid;
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
@@ -39,7 +43,10 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        //! @param controlledEntity the entity controlled by the client connection
+        //! @param connection       the client connection to replicate to
+        //! @param interestGrid     optional shared grid to gather replication candidates from, the visibility system is used if nullptr
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, ReplicationInterestGrid* interestGrid = nullptr);
 
         //! IReplicationWindow interface
         //! @{
@@ -54,13 +61,37 @@ namespace Multiplayer
         //! @}
 
     private:
+        static constexpr uint8_t MaxPriorityBand = 254;
+        static constexpr uint8_t InvalidPriorityBand = 255;
+
+        //! Tracks the distance band of an entity gathered from the interest grid.
+        //! The priority of an entity is only re-evaluated when its band changes between updates.
+        struct InterestEntry
+        {
+            uint32_t m_updateId = 0;
+            uint32_t m_replicatedBandIndex = 0; //< Index into the bucket of m_replicatedBand while in the replication set
+            uint8_t m_band = InvalidPriorityBand;
+            uint8_t m_replicatedBand = InvalidPriorityBand; //< The band the entry is bucketed under while in the replication set
+            bool m_isBandChanged = true;
+            bool m_isInReplicationSet = false;
+        };
+        using InterestMap = AZStd::unordered_map<ConstNetworkEntityHandle, InterestEntry>;
+        using ReplicatedBands = AZStd::array<AZStd::vector<InterestMap::value_type*>, MaxPriorityBand + 1>;
+
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
+        void ResetReplicationSet();
+        void UpdateVisibilitySet(const AZ::Vector3& controlledEntityPosition);
+        void UpdateInterestSet(const AZ::Vector3& controlledEntityPosition);
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
+        void AddEntityToInterestSet(const ConstNetworkEntityHandle& entityHandle, float distanceSquared);
+        void SetInterestReplicated(InterestMap::value_type& interest, bool isInReplicationSet);
+        float GetBandPriority(uint8_t band) const;
+        bool IsReplicatedProxy(const ConstNetworkEntityHandle& entityHandle) const;
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
@@ -68,6 +99,17 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
+        // Incrementally maintained candidates when gathering from the interest grid
+        ReplicationInterestGrid* m_interestGrid = nullptr;
+        InterestMap m_interestEntries;
+        AZStd::vector<InterestMap::value_type*> m_interestCandidates;
+        AZStd::vector<ConstNetworkEntityHandle> m_forcedEntities;
+        ReplicatedBands m_replicatedBands; //< Interest entries in the replication set bucketed by band, for eviction of the farthest
+        uint32_t m_interestUpdateId = 0;
+        uint32_t m_interestSetSize = 0;
+        float m_priorityBandSize = 0.0f;
+        bool m_isInterestSetValid = false;
+
         AZ::ScheduledEvent m_updateWindowEvent;
 
         NetworkEntityHandle m_controlledEntity;
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    //! An update packet handed to a replication window, along with the serialized bytes of its entity updates.
+    struct SentUpdatePacket
+    {
+        AzNetworking::ConnectionId m_connectionId;
+        AzNetworking::PacketId m_packetId;
+        AZStd::vector<NetEntityId> m_netEntityIds;
+        AZStd::vector<uint8_t> m_serializedUpdates;
+    };
+
+    //! A property update recorded in the multiplayer stats.
+    struct PropertySentRecord
+    {
+        NetComponentId m_netComponentId = InvalidNetComponentId;
+        PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+        uint32_t m_totalBytes = 0;
+
+        bool operator==(const PropertySentRecord& rhs) const
+        {
+            return (m_netComponentId == rhs.m_netComponentId)
+                && (m_propertyIndex == rhs.m_propertyIndex)
+                && (m_totalBytes == rhs.m_totalBytes);
+        }
+    };
+
+    //! A client connection with its own replication manager, recording the packet ids its replicators check for acks.
+    struct TestClientConnection
+    {
+        AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>> m_connection;
+        AZStd::unique_ptr<EntityReplicationManager> m_replicationManager;
+        AZStd::vector<AzNetworking::PacketId> m_checkedPacketIds;
+        MultiplayerStats::DeferredRecords m_deferredStats;
+    };
+
+    //! One set of client connections, the packets they sent and the property stats recorded while serializing them.
+    //! Packet ids are shared by every connection of a send path, so the order connections send in is part of the record.
+    struct SendPath
+    {
+        AZStd::vector<AZStd::unique_ptr<TestClientConnection>> m_clients;
+        AZStd::vector<SentUpdatePacket> m_sentPackets;
+        AZStd::vector<PropertySentRecord> m_propertiesSent;
+        uint32_t m_lastPacketId = 0;
+    };
+
+    //! Replicates a fixed set of entities and records every update packet instead of sending it.
+    class RecordingReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        static constexpr uint32_t MaxSerializedUpdatesSize = 4096;
+
+        RecordingReplicationWindow(AzNetworking::ConnectionId connectionId, const ReplicationSet& replicationSet, SendPath& sendPath)
+            : m_connectionId(connectionId)
+            , m_replicationSet(replicationSet)
+            , m_sendPath(sendPath)
+        {
+        }
+
+        bool ReplicationSetUpdateReady() override
+        {
+            return true;
+        }
+
+        const ReplicationSet& GetReplicationSet() const override
+        {
+            return m_replicationSet;
+        }
+
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+
+        bool IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const override
+        {
+            const auto iter = m_replicationSet.find(entityHandle);
+            if (iter != m_replicationSet.end())
+            {
+                outNetworkRole = iter->second.m_netEntityRole;
+                return true;
+            }
+            outNetworkRole = NetEntityRole::InvalidRole;
+            return false;
+        }
+
+        void UpdateWindow() override
+        {
+        }
+
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override
+        {
+            SentUpdatePacket& packet = m_sendPath.m_sentPackets.emplace_back();
+            packet.m_connectionId = m_connectionId;
+            packet.m_packetId = AzNetworking::PacketId{ ++m_sendPath.m_lastPacketId };
+            packet.m_serializedUpdates.resize(MaxSerializedUpdatesSize);
+
+            AzNetworking::NetworkInputSerializer serializer(packet.m_serializedUpdates.data(), MaxSerializedUpdatesSize);
+            for (NetworkEntityUpdateMessage& updateMessage : entityUpdateVector)
+            {
+                packet.m_netEntityIds.push_back(updateMessage.GetEntityId());
+                updateMessage.Serialize(serializer);
+            }
+            EXPECT_TRUE(serializer.IsValid());
+            packet.m_serializedUpdates.resize(serializer.GetSize());
+            return packet.m_packetId;
+        }
+
+        void SendEntityRpcs([[maybe_unused]] NetworkEntityRpcVector& entityRpcVector, [[maybe_unused]] bool reliable) override
+        {
+        }
+
+        void DebugDraw() const override
+        {
+        }
+
+    private:
+        AzNetworking::ConnectionId m_connectionId;
+        ReplicationSet m_replicationSet;
+        SendPath& m_sendPath;
+    };
+
+    /*
+     * Replicates the same entities to several clients twice, once through serial SendUpdates calls and once by preparing
+     * every client's updates on a task graph and sending them afterwards, the way the server sends client updates.
+     */
+    class EntityReplicationManagerTests : public HierarchyTests
+    {
+    public:
+        static constexpr uint32_t ClientCount = 3;
+        static constexpr uint32_t EntityCount = 8;
+        // Small enough that the create records of every entity don't fit in a single packet
+        static constexpr uint32_t ConnectionMtu = 256;
+
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            ON_CALL(*m_mockNetworkEntityManager, AddEntityMarkedDirtyHandler(_))
+                .WillByDefault(Invoke([this](AZ::Event<>::Handler& handler) { handler.Connect(m_entityMarkedDirtyEvent); }));
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>(ClientCount);
+
+            m_propertySentHandler = AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler(
+                [this](NetComponentId netComponentId, PropertyIndex propertyIndex, uint32_t totalBytes)
+                {
+                    if (m_recordingPath != nullptr)
+                    {
+                        m_recordingPath->m_propertiesSent.push_back({ netComponentId, propertyIndex, totalBytes });
+                    }
+                });
+            m_propertySentHandler.Connect(GetMultiplayer()->GetStats().m_events.m_propertySent);
+
+            ReplicationSet replicationSet;
+            for (uint32_t index = 0; index < EntityCount; ++index)
+            {
+                const NetEntityId netEntityId = NetEntityId{ index + 1 };
+                m_entityInfos.push_back(AZStd::make_unique<EntityInfo>(static_cast<AZ::u64>(netEntityId), "entity", netEntityId, EntityInfo::Role::None));
+                EntityInfo& entityInfo = *m_entityInfos.back();
+                PopulateHierarchicalEntity(entityInfo);
+                SetupEntity(entityInfo.m_entity, netEntityId, NetEntityRole::Authority);
+                entityInfo.m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(
+                    AZ::Transform::CreateTranslation(AZ::Vector3(aznumeric_cast<float>(index), 0.0f, 0.0f)));
+                entityInfo.m_entity->Activate();
+
+                const ConstNetworkEntityHandle entityHandle(entityInfo.m_entity.get(), m_networkEntityTracker.get());
+                replicationSet[entityHandle].m_netEntityRole = NetEntityRole::Client;
+            }
+
+            // Flush the properties set while activating, the replicators start from the entities' initial state
+            m_entityMarkedDirtyEvent.Signal();
+
+            CreateClients(m_serialPath, replicationSet);
+            CreateClients(m_parallelPath, replicationSet);
+        }
+
+        void TearDown() override
+        {
+            m_serialPath.m_clients.clear();
+            m_parallelPath.m_clients.clear();
+            m_propertySentHandler.Disconnect();
+            m_entityInfos.clear();
+            m_taskExecutor.reset();
+
+            HierarchyTests::TearDown();
+        }
+
+        void CreateClients(SendPath& sendPath, const ReplicationSet& replicationSet)
+        {
+            for (uint32_t index = 0; index < ClientCount; ++index)
+            {
+                sendPath.m_clients.push_back(AZStd::make_unique<TestClientConnection>());
+                TestClientConnection& client = *sendPath.m_clients.back();
+
+                const AzNetworking::ConnectionId connectionId{ index + 2 };
+                const IpAddress address("localhost", aznumeric_cast<uint16_t>(index + 2), ProtocolType::Udp);
+                client.m_connection = AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(connectionId, address, ConnectionRole::Acceptor);
+                ON_CALL(*client.m_connection, GetConnectionMtu()).WillByDefault(Return(ConnectionMtu));
+                // Every sent packet is acked, so each replicator checks the packet id of its last sent record exactly once
+                ON_CALL(*client.m_connection, WasPacketAcked(_)).WillByDefault(Invoke([&client](AzNetworking::PacketId packetId)
+                {
+                    client.m_checkedPacketIds.push_back(packetId);
+                    return true;
+                }));
+
+                client.m_replicationManager = AZStd::make_unique<EntityReplicationManager>(
+                    *client.m_connection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+                client.m_replicationManager->SetReplicationWindow(
+                    AZStd::make_unique<RecordingReplicationWindow>(connectionId, replicationSet, sendPath));
+            }
+        }
+
+        void SendClientUpdates()
+        {
+            m_recordingPath = &m_serialPath;
+            for (AZStd::unique_ptr<TestClientConnection>& client : m_serialPath.m_clients)
+            {
+                client->m_replicationManager->SendUpdates();
+            }
+
+            // Mirrors MultiplayerSystemComponent::SendParallelClientUpdates
+            m_recordingPath = &m_parallelPath;
+            AZ::TaskGraph prepareGraph;
+            for (AZStd::unique_ptr<TestClientConnection>& client : m_parallelPath.m_clients)
+            {
+                TestClientConnection* clientPtr = client.get();
+                prepareGraph.AddTask(AZ::TaskDescriptor{ "EntityReplicationManagerTests::PrepareUpdates", "Multiplayer" }, [clientPtr]()
+                {
+                    clientPtr->m_deferredStats.clear();
+                    MultiplayerStats::DeferRecordsScope deferStats(clientPtr->m_deferredStats);
+                    clientPtr->m_replicationManager->PrepareUpdates();
+                });
+            }
+            AZ::TaskGraphEvent prepareFinished;
+            prepareGraph.SubmitOnExecutor(*m_taskExecutor, &prepareFinished);
+            prepareFinished.Wait();
+
+            MultiplayerStats& stats = GetMultiplayer()->GetStats();
+            for (AZStd::unique_ptr<TestClientConnection>& client : m_parallelPath.m_clients)
+            {
+                stats.ApplyDeferredRecords(client->m_deferredStats);
+                client->m_replicationManager->SendPreparedUpdates();
+            }
+            m_recordingPath = nullptr;
+        }
+
+        void ExpectSameUpdates() const
+        {
+            ASSERT_EQ(m_serialPath.m_sentPackets.size(), m_parallelPath.m_sentPackets.size());
+            for (size_t index = 0; index < m_serialPath.m_sentPackets.size(); ++index)
+            {
+                const SentUpdatePacket& serialPacket = m_serialPath.m_sentPackets[index];
+                const SentUpdatePacket& parallelPacket = m_parallelPath.m_sentPackets[index];
+                EXPECT_EQ(serialPacket.m_connectionId, parallelPacket.m_connectionId);
+                EXPECT_EQ(serialPacket.m_packetId, parallelPacket.m_packetId);
+                EXPECT_EQ(serialPacket.m_netEntityIds, parallelPacket.m_netEntityIds);
+                EXPECT_EQ(serialPacket.m_serializedUpdates, parallelPacket.m_serializedUpdates);
+            }
+            EXPECT_EQ(m_serialPath.m_propertiesSent, m_parallelPath.m_propertiesSent);
+
+            for (uint32_t index = 0; index < ClientCount; ++index)
+            {
+                EXPECT_EQ(m_serialPath.m_clients[index]->m_checkedPacketIds, m_parallelPath.m_clients[index]->m_checkedPacketIds);
+            }
+        }
+
+        //! Expects each replicator to have finalized its record with the id of the packet its update was sent in.
+        static void ExpectFinalizedPacketIds(const SendPath& sendPath, const AZStd::vector<SentUpdatePacket>& sentPackets)
+        {
+            for (const AZStd::unique_ptr<TestClientConnection>& client : sendPath.m_clients)
+            {
+                AZStd::vector<AzNetworking::PacketId> expectedPacketIds;
+                for (const SentUpdatePacket& packet : sentPackets)
+                {
+                    if (packet.m_connectionId == client->m_connection->GetConnectionId())
+                    {
+                        expectedPacketIds.insert(expectedPacketIds.end(), packet.m_netEntityIds.size(), packet.m_packetId);
+                    }
+                }
+
+                AZStd::vector<AzNetworking::PacketId> checkedPacketIds = client->m_checkedPacketIds;
+                AZStd::sort(checkedPacketIds.begin(), checkedPacketIds.end());
+                EXPECT_EQ(checkedPacketIds, expectedPacketIds);
+            }
+        }
+
+        void ClearSentUpdates()
+        {
+            for (SendPath* sendPath : { &m_serialPath, &m_parallelPath })
+            {
+                sendPath->m_sentPackets.clear();
+                sendPath->m_propertiesSent.clear();
+                for (AZStd::unique_ptr<TestClientConnection>& client : sendPath->m_clients)
+                {
+                    client->m_checkedPacketIds.clear();
+                }
+            }
+        }
+
+        size_t GetSentPacketCount(const SendPath& sendPath, AzNetworking::ConnectionId connectionId) const
+        {
+            return AZStd::count_if(sendPath.m_sentPackets.begin(), sendPath.m_sentPackets.end(),
+                [connectionId](const SentUpdatePacket& packet) { return packet.m_connectionId == connectionId; });
+        }
+
+        AZ::Event<> m_entityMarkedDirtyEvent;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler m_propertySentHandler;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+
+        SendPath m_serialPath;
+        SendPath m_parallelPath;
+        SendPath* m_recordingPath = nullptr;
+    };
+
+    TEST_F(EntityReplicationManagerTests, ParallelPreparedUpdatesMatchSerialUpdates)
+    {
+        // Every entity is new to every client, so each client needs several packets of create records
+        SendClientUpdates();
+        ExpectSameUpdates();
+        for (const AZStd::unique_ptr<TestClientConnection>& client : m_serialPath.m_clients)
+        {
+            EXPECT_GE(GetSentPacketCount(m_serialPath, client->m_connection->GetConnectionId()), 2);
+        }
+        EXPECT_FALSE(m_serialPath.m_propertiesSent.empty());
+        const AZStd::vector<SentUpdatePacket> createPackets = m_serialPath.m_sentPackets;
+        ClearSentUpdates();
+
+        // Nothing changed, the replicators only check that the packets their create records were sent in were acked
+        SendClientUpdates();
+        ExpectSameUpdates();
+        EXPECT_TRUE(m_serialPath.m_sentPackets.empty());
+        ExpectFinalizedPacketIds(m_serialPath, createPackets);
+        ExpectFinalizedPacketIds(m_parallelPath, createPackets);
+        ClearSentUpdates();
+
+        // Moving half of the entities sends updates for just those entities
+        for (uint32_t index = 0; index < EntityCount; index += 2)
+        {
+            m_entityInfos[index]->m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(
+                AZ::Transform::CreateTranslation(AZ::Vector3(aznumeric_cast<float>(index), 10.0f, 0.0f)));
+        }
+        m_entityMarkedDirtyEvent.Signal();
+
+        SendClientUpdates();
+        ExpectSameUpdates();
+        size_t updateCount = 0;
+        for (const SentUpdatePacket& packet : m_serialPath.m_sentPackets)
+        {
+            updateCount += packet.m_netEntityIds.size();
+        }
+        EXPECT_EQ(updateCount, ClientCount * EntityCount / 2);
+        const AZStd::vector<SentUpdatePacket> movePackets = m_serialPath.m_sentPackets;
+        ClearSentUpdates();
+
+        SendClientUpdates();
+        ExpectSameUpdates();
+        EXPECT_TRUE(m_serialPath.m_sentPackets.empty());
+        ExpectFinalizedPacketIds(m_serialPath, movePackets);
+        ExpectFinalizedPacketIds(m_parallelPath, movePackets);
+    }
+
+    TEST_F(EntityReplicationManagerTests, SharedDeltasAreOnlyHitsForOtherConnections)
+    {
+        // Only the serial path shares deltas, the parallel path serializes every update for its own connection
+        SerializedDeltaCache deltaCache;
+        for (AZStd::unique_ptr<TestClientConnection>& client : m_serialPath.m_clients)
+        {
+            client->m_replicationManager->SetSerializedDeltaCache(&deltaCache);
+        }
+
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        const uint64_t cacheHits = stats.m_serializedDeltaCacheHits.m_totalCalls;
+        const uint64_t cacheMisses = stats.m_serializedDeltaCacheMisses.m_totalCalls;
+
+        // The create records don't fit in a single packet, the update that overflows a packet has to be carried over to the
+        // next packet rather than serialized again, which would find the delta its own connection just stored
+        deltaCache.BeginSharing();
+        SendClientUpdates();
+        deltaCache.EndSharing();
+
+        ExpectSameUpdates();
+        for (const AZStd::unique_ptr<TestClientConnection>& client : m_serialPath.m_clients)
+        {
+            EXPECT_GE(GetSentPacketCount(m_serialPath, client->m_connection->GetConnectionId()), 2);
+        }
+        EXPECT_EQ(stats.m_serializedDeltaCacheMisses.m_totalCalls - cacheMisses, EntityCount);
+        EXPECT_EQ(stats.m_serializedDeltaCacheHits.m_totalCalls - cacheHits, (ClientCount - 1) * EntityCount);
+
+        for (AZStd::unique_ptr<TestClientConnection>& client : m_serialPath.m_clients)
+        {
+            client->m_replicationManager->SetSerializedDeltaCache(nullptr);
+        }
+    }
+}
@@ -12,6 +12,7 @@
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Spawnable/SpawnableSystemComponent.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzTest/AzTest.h>
@@ -143,5 +144,38 @@ namespace UnitTest
         EXPECT_EQ(m_mpSpawnerMock.m_playerCount, 0);
         AZ::Interface<Multiplayer::IMultiplayerSpawner>::Unregister(&m_mpSpawnerMock);
     }
+
+    TEST_F(MultiplayerSystemTests, TestDeferredStats)
+    {
+        Multiplayer::MultiplayerStats& stats = m_mpComponent->GetStats();
+        stats.ReserveComponentStats(Multiplayer::NetComponentId{ 0 }, 2, 0);
+
+        AZStd::vector<uint32_t> sentBytes;
+        AZ::Event<Multiplayer::NetComponentId, Multiplayer::PropertyIndex, uint32_t>::Handler propertySentHandler(
+            [&sentBytes](Multiplayer::NetComponentId, Multiplayer::PropertyIndex, uint32_t totalBytes) { sentBytes.push_back(totalBytes); });
+        propertySentHandler.Connect(stats.m_events.m_propertySent);
+
+        // Records made on another thread inside a scope are buffered rather than applied
+        Multiplayer::MultiplayerStats::DeferredRecords deferredRecords;
+        AZStd::thread recordThread([&stats, &deferredRecords]()
+        {
+            Multiplayer::MultiplayerStats::DeferRecordsScope deferStats(deferredRecords);
+            stats.RecordPropertySent(Multiplayer::NetComponentId{ 0 }, Multiplayer::PropertyIndex{ 0 }, 8);
+            stats.RecordPropertySent(Multiplayer::NetComponentId{ 0 }, Multiplayer::PropertyIndex{ 1 }, 16);
+        });
+        recordThread.join();
+
+        EXPECT_EQ(deferredRecords.size(), 2);
+        EXPECT_TRUE(sentBytes.empty());
+        EXPECT_EQ(stats.CalculateTotalPropertyUpdateSentMetrics().m_totalCalls, 0);
+
+        stats.ApplyDeferredRecords(deferredRecords);
+
+        ASSERT_EQ(sentBytes.size(), 2);
+        EXPECT_EQ(sentBytes[0], 8);
+        EXPECT_EQ(sentBytes[1], 16);
+        EXPECT_EQ(stats.CalculateTotalPropertyUpdateSentMetrics().m_totalCalls, 2);
+        EXPECT_EQ(stats.CalculateTotalPropertyUpdateSentMetrics().m_totalBytes, 24);
+    }
 }
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzCore/Math/Random.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+
+namespace Multiplayer
+{
+    /*
+     * 2048 networked entities spread over a 2km square, with a replication window for each of 64 clients.
+     * Each iteration moves a percentage of the entities (the benchmark argument) and then updates every client window.
+     */
+    class ReplicationInterestBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr uint32_t EntityCount = 2048;
+        static constexpr uint32_t ClientCount = 64;
+        static constexpr float WorldSize = 2000.0f;
+        static constexpr float MoveDistance = 4.0f;
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            // The interest grid is opt-in, the benchmark has no visibility system to fall back to
+            m_console->GetCvarValue("sv_ReplicationInterestGrid", m_previousInterestGrid);
+            m_console->PerformCommand("sv_ReplicationInterestGrid true");
+
+            m_interestGrid = AZStd::make_unique<ReplicationInterestGrid>();
+            m_interestGrid->Activate();
+
+            m_entities.reserve(EntityCount);
+            for (uint32_t i = 0; i < EntityCount; ++i)
+            {
+                m_entities.push_back(AZStd::make_unique<EntityInfo>((i + 1), "entity", NetEntityId{ i + 1 }, EntityInfo::Role::None));
+                EntityInfo& entityInfo = *m_entities.back();
+                entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
+                entityInfo.m_entity->CreateComponent<NetBindComponent>();
+                SetupEntity(entityInfo.m_entity, entityInfo.m_netId, NetEntityRole::Authority);
+                entityInfo.m_entity->Activate();
+
+                const AZ::Vector3 position(m_random.GetRandomFloat() * WorldSize, m_random.GetRandomFloat() * WorldSize, 0.0f);
+                entityInfo.m_entity->GetTransform()->SetWorldTranslation(position);
+
+                // The benchmark component application doesn't signal entity activation, so add entities explicitly
+                m_interestGrid->AddEntity(entityInfo.m_entity.get());
+            }
+
+            m_windows.reserve(ClientCount);
+            for (uint32_t i = 0; i < ClientCount; ++i)
+            {
+                const NetworkEntityHandle controlledEntity(m_entities[i * (EntityCount / ClientCount)]->m_entity.get(), m_NetworkEntityManager->GetNetworkEntityTracker());
+                m_windows.push_back(AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, m_Connection.get(), m_interestGrid.get()));
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_windows.clear();
+            m_interestGrid.reset();
+            m_entities.clear();
+
+            m_console->PerformCommand(m_previousInterestGrid ? "sv_ReplicationInterestGrid true" : "sv_ReplicationInterestGrid false");
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        void MoveEntities(uint32_t movingPercent)
+        {
+            const uint32_t movingCount = EntityCount * movingPercent / 100;
+            for (uint32_t i = 0; i < movingCount; ++i)
+            {
+                AZ::TransformInterface* transform = m_entities[m_random.GetRandom() % EntityCount]->m_entity->GetTransform();
+                const AZ::Vector3 offset((m_random.GetRandomFloat() - 0.5f) * MoveDistance, (m_random.GetRandomFloat() - 0.5f) * MoveDistance, 0.0f);
+                transform->SetWorldTranslation(transform->GetWorldTranslation() + offset);
+            }
+        }
+
+        void UpdateWindows(benchmark::State& state)
+        {
+            const uint32_t movingPercent = aznumeric_cast<uint32_t>(state.range(0));
+            for ([[maybe_unused]] auto value : state)
+            {
+                MoveEntities(movingPercent);
+                for (AZStd::unique_ptr<ServerToClientReplicationWindow>& window : m_windows)
+                {
+                    window->UpdateWindow();
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * ClientCount);
+        }
+
+        AZ::SimpleLcgRandom m_random;
+        AZStd::unique_ptr<ReplicationInterestGrid> m_interestGrid;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entities;
+        AZStd::vector<AZStd::unique_ptr<ServerToClientReplicationWindow>> m_windows;
+        bool m_previousInterestGrid = false;
+    };
+
+    BENCHMARK_DEFINE_F(ReplicationInterestBenchmark, UpdateWindows)(benchmark::State& state)
+    {
+        UpdateWindows(state);
+    }
+
+    BENCHMARK_REGISTER_F(ReplicationInterestBenchmark, UpdateWindows)
+        ->Arg(0)
+        ->Arg(10)
+        ->Arg(100)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    // Bands narrower than the distance entities move per update, so every moved entity has its priority re-evaluated
+    BENCHMARK_DEFINE_F(ReplicationInterestBenchmark, UpdateWindowsFineBands)(benchmark::State& state)
+    {
+        float currentBandSize = 0.0f;
+        m_console->GetCvarValue<float>("sv_ClientReplicationPriorityBandSize", currentBandSize);
+        m_console->PerformCommand("sv_ClientReplicationPriorityBandSize 0.01");
+
+        UpdateWindows(state);
+
+        m_console->PerformCommand((AZStd::string("sv_ClientReplicationPriorityBandSize ") + AZStd::to_string(currentBandSize)).c_str());
+    }
+
+    BENCHMARK_REGISTER_F(ReplicationInterestBenchmark, UpdateWindowsFineBands)
+        ->Arg(10)
+        ->Arg(100)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
@@ -0,0 +1,571 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Visibility/BoundsBus.h>
+#include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    //! Provides local bounds for a test entity so the bounds union can change without the entity moving.
+    class TestBoundsProvider
+        : public AzFramework::BoundsRequestBus::Handler
+    {
+    public:
+        TestBoundsProvider(const AZ::EntityId& entityId, const AZ::Aabb& localBounds)
+            : m_entityId(entityId)
+            , m_localBounds(localBounds)
+        {
+            AzFramework::BoundsRequestBus::Handler::BusConnect(entityId);
+        }
+
+        ~TestBoundsProvider() override
+        {
+            AzFramework::BoundsRequestBus::Handler::BusDisconnect();
+        }
+
+        AZ::Aabb GetWorldBounds() override
+        {
+            AZ::Transform worldTm = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(worldTm, m_entityId, &AZ::TransformBus::Events::GetWorldTM);
+            return m_localBounds.GetTransformedAabb(worldTm);
+        }
+
+        AZ::Aabb GetLocalBounds() override
+        {
+            return m_localBounds;
+        }
+
+        AZ::EntityId m_entityId;
+        AZ::Aabb m_localBounds;
+    };
+
+    /*
+     * Networked entities are registered with a real visibility octree and bounds union system, and entity activation is
+     * signaled to the interest grid and replication windows the same way the component application does.
+     */
+    class ReplicationInterestTests : public HierarchyTests
+    {
+    public:
+        static constexpr float CellSize = 10.0f;
+
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            ON_CALL(*m_mockComponentApplicationRequests, RegisterEntityActivatedEventHandler(_))
+                .WillByDefault(Invoke([this](AZ::EntityActivatedEvent::Handler& handler) { handler.Connect(m_entityActivatedEvent); }));
+            ON_CALL(*m_mockComponentApplicationRequests, RegisterEntityDeactivatedEventHandler(_))
+                .WillByDefault(Invoke([this](AZ::EntityDeactivatedEvent::Handler& handler) { handler.Connect(m_entityDeactivatedEvent); }));
+            ON_CALL(*m_mockComponentApplicationRequests, SignalEntityActivated(_))
+                .WillByDefault(Invoke([this](AZ::Entity* entity) { m_entityActivatedEvent.Signal(entity); }));
+            ON_CALL(*m_mockComponentApplicationRequests, SignalEntityDeactivated(_))
+                .WillByDefault(Invoke([this](AZ::Entity* entity) { m_entityDeactivatedEvent.Signal(entity); }));
+
+            m_console->GetCvarValue("sv_ReplicationInterestCellSize", m_previousCellSize);
+            m_console->PerformCommand(AZStd::string::format("sv_ReplicationInterestCellSize %f", CellSize).c_str());
+
+            m_octreeSystem = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+            m_boundsUnionSystem = AZStd::make_unique<AzFramework::EntityVisibilityBoundsUnionSystem>();
+            m_boundsUnionSystem->Connect();
+
+            m_interestGrid = AZStd::make_unique<ReplicationInterestGrid>();
+            m_interestGrid->Activate();
+        }
+
+        void TearDown() override
+        {
+            m_interestGrid.reset();
+            m_boundsProviders.clear();
+            m_entityInfos.clear();
+
+            m_boundsUnionSystem->Disconnect();
+            m_boundsUnionSystem.reset();
+            m_octreeSystem.reset();
+
+            m_console->PerformCommand(AZStd::string::format("sv_ReplicationInterestCellSize %f", m_previousCellSize).c_str());
+
+            HierarchyTests::TearDown();
+        }
+
+        EntityInfo& CreateEntity(NetEntityId netEntityId, const AZ::Vector3& position, EntityInfo::Role role = EntityInfo::Role::None)
+        {
+            const AZ::u64 entityId = static_cast<AZ::u64>(netEntityId);
+            m_entityInfos.push_back(AZStd::make_unique<EntityInfo>(entityId, "entity", netEntityId, role));
+            EntityInfo& entityInfo = *m_entityInfos.back();
+            if (role == EntityInfo::Role::None)
+            {
+                entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
+                entityInfo.m_entity->CreateComponent<NetBindComponent>();
+            }
+            else
+            {
+                PopulateHierarchicalEntity(entityInfo);
+            }
+            SetupEntity(entityInfo.m_entity, netEntityId, NetEntityRole::Authority);
+
+            if (role != EntityInfo::Role::None)
+            {
+                const NetworkEntityHandle entityHandle(entityInfo.m_entity.get(), m_networkEntityTracker.get());
+                entityInfo.m_replicator = AZStd::make_unique<EntityReplicator>(*m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Client, entityHandle);
+                entityInfo.m_replicator->Initialize(entityHandle);
+            }
+
+            // Placed before activation so the entity is activated at its final position
+            entityInfo.m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(AZ::Transform::CreateTranslation(position));
+            entityInfo.m_entity->Activate();
+            return entityInfo;
+        }
+
+        EntityInfo& CreateEntityWithBounds(NetEntityId netEntityId, const AZ::Vector3& position, const AZ::Aabb& localBounds)
+        {
+            // Bounds need to be provided before activation, that is when the bounds union is first calculated
+            m_boundsProviders.push_back(AZStd::make_unique<TestBoundsProvider>(AZ::EntityId(static_cast<AZ::u64>(netEntityId)), localBounds));
+            return CreateEntity(netEntityId, position);
+        }
+
+        static void MoveEntity(EntityInfo& entityInfo, const AZ::Vector3& position)
+        {
+            entityInfo.m_entity->GetTransform()->SetWorldTranslation(position);
+        }
+
+        AZStd::vector<NetEntityId> GatherCandidates(const AZ::Vector3& center, float radius)
+        {
+            AZStd::vector<NetEntityId> candidates;
+            m_interestGrid->EnumerateCandidates(center, radius, [&candidates](const ReplicationInterestGrid::Candidate& candidate)
+            {
+                candidates.push_back(candidate.m_entityHandle.GetNetEntityId());
+            });
+            AZStd::sort(candidates.begin(), candidates.end());
+            return candidates;
+        }
+
+        AZ::Aabb GetCandidateBounds(NetEntityId netEntityId, const AZ::Vector3& center, float radius)
+        {
+            AZ::Aabb bounds = AZ::Aabb::CreateNull();
+            m_interestGrid->EnumerateCandidates(center, radius, [netEntityId, &bounds](const ReplicationInterestGrid::Candidate& candidate)
+            {
+                if (candidate.m_entityHandle.GetNetEntityId() == netEntityId)
+                {
+                    bounds = candidate.m_bounds;
+                }
+            });
+            return bounds;
+        }
+
+        AZ::EntityActivatedEvent m_entityActivatedEvent;
+        AZ::EntityDeactivatedEvent m_entityDeactivatedEvent;
+
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystem;
+        AZStd::unique_ptr<AzFramework::EntityVisibilityBoundsUnionSystem> m_boundsUnionSystem;
+        AZStd::unique_ptr<ReplicationInterestGrid> m_interestGrid;
+
+        AZStd::vector<AZStd::unique_ptr<TestBoundsProvider>> m_boundsProviders;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+        float m_previousCellSize = 0.0f;
+    };
+
+    using ReplicationInterestGridTests = ReplicationInterestTests;
+
+    TEST_F(ReplicationInterestGridTests, EntitiesAreBucketedByBoundsCenter)
+    {
+        // Default bounds are a unit cube, so the bounds center is the entity position
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(-10.0f, 5.0f, 0.0f));
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(-10.01f, 5.0f, 0.0f));
+        CreateEntity(NetEntityId{ 3 }, AZ::Vector3(9.99f, 5.0f, 0.0f));
+        CreateEntity(NetEntityId{ 4 }, AZ::Vector3(10.0f, 5.0f, 0.0f));
+
+        EXPECT_EQ(m_interestGrid->GetEntityCount(), 4);
+
+        // A zero radius query at (-5, 5) only expands by half a cell, covering x cells -1 and 0
+        const AZStd::vector<NetEntityId> candidates = GatherCandidates(AZ::Vector3(-5.0f, 5.0f, 0.0f), 0.0f);
+        EXPECT_EQ(candidates, AZStd::vector<NetEntityId>({ NetEntityId{ 1 }, NetEntityId{ 3 } }));
+        EXPECT_EQ(m_interestGrid->GetCellCount(), 4);
+
+        // Height is ignored, cells are vertical columns
+        const AZStd::vector<NetEntityId> highCandidates = GatherCandidates(AZ::Vector3(-5.0f, 5.0f, 1000.0f), 0.0f);
+        EXPECT_EQ(highCandidates, candidates);
+    }
+
+    TEST_F(ReplicationInterestGridTests, OversizedEntitiesAreVisitedByEveryQuery)
+    {
+        const AZ::Aabb oversizedBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-15.0f, -1.0f, -1.0f), AZ::Vector3(15.0f, 1.0f, 1.0f));
+        CreateEntityWithBounds(NetEntityId{ 1 }, AZ::Vector3(500.0f, 500.0f, 0.0f), oversizedBounds);
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(500.0f, 500.0f, 0.0f));
+
+        EXPECT_EQ(GatherCandidates(AZ::Vector3::CreateZero(), 1.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+        EXPECT_EQ(GatherCandidates(AZ::Vector3(500.0f, 500.0f, 0.0f), 1.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 }, NetEntityId{ 2 } }));
+
+        // One regular cell plus the oversized cell
+        EXPECT_EQ(m_interestGrid->GetCellCount(), 2);
+
+        // Candidates keep their world bounds for exact culling by the caller
+        const AZ::Aabb candidateBounds = GetCandidateBounds(NetEntityId{ 1 }, AZ::Vector3::CreateZero(), 1.0f);
+        EXPECT_TRUE(candidateBounds.IsClose(oversizedBounds.GetTranslated(AZ::Vector3(500.0f, 500.0f, 0.0f))));
+    }
+
+    TEST_F(ReplicationInterestGridTests, MovedEntitiesChangeCells)
+    {
+        EntityInfo& entity = CreateEntity(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+
+        EXPECT_EQ(GatherCandidates(AZ::Vector3(5.0f, 5.0f, 0.0f), 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+
+        MoveEntity(entity, AZ::Vector3(35.0f, 5.0f, 0.0f));
+
+        EXPECT_TRUE(GatherCandidates(AZ::Vector3(5.0f, 5.0f, 0.0f), 0.0f).empty());
+        EXPECT_EQ(GatherCandidates(AZ::Vector3(35.0f, 5.0f, 0.0f), 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+        EXPECT_EQ(m_interestGrid->GetCellCount(), 1);
+
+        // Moving within a cell only updates the bounds
+        MoveEntity(entity, AZ::Vector3(36.0f, 6.0f, 0.0f));
+        const AZ::Aabb candidateBounds = GetCandidateBounds(NetEntityId{ 1 }, AZ::Vector3(35.0f, 5.0f, 0.0f), 0.0f);
+        EXPECT_TRUE(candidateBounds.GetCenter().IsClose(AZ::Vector3(36.0f, 6.0f, 0.0f)));
+        EXPECT_EQ(m_interestGrid->GetCellCount(), 1);
+    }
+
+    TEST_F(ReplicationInterestGridTests, RemovedEntitiesKeepCellIndicesValid)
+    {
+        CreateEntity(NetEntityId{ 1 }, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(2.0f, 2.0f, 0.0f));
+        EntityInfo& lastEntity = CreateEntity(NetEntityId{ 3 }, AZ::Vector3(3.0f, 3.0f, 0.0f));
+        CreateEntity(NetEntityId{ 4 }, AZ::Vector3(4.0f, 4.0f, 0.0f));
+
+        const AZ::Vector3 cellCenter(5.0f, 5.0f, 0.0f);
+        EXPECT_EQ(GatherCandidates(cellCenter, 0.0f).size(), 4);
+
+        // Removing the first candidate swaps the last candidate into its slot
+        m_interestGrid->RemoveEntity(AZ::EntityId(1));
+        EXPECT_EQ(GatherCandidates(cellCenter, 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 2 }, NetEntityId{ 3 }, NetEntityId{ 4 } }));
+
+        // Removing a candidate by its stale index would take the wrong entity out of the cell
+        m_interestGrid->RemoveEntity(AZ::EntityId(4));
+        EXPECT_EQ(GatherCandidates(cellCenter, 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 2 }, NetEntityId{ 3 } }));
+
+        MoveEntity(lastEntity, AZ::Vector3(45.0f, 5.0f, 0.0f));
+        EXPECT_EQ(GatherCandidates(cellCenter, 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 2 } }));
+        EXPECT_EQ(GatherCandidates(AZ::Vector3(45.0f, 5.0f, 0.0f), 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 3 } }));
+
+        // Deactivated entities are removed through the entity deactivated event
+        StopAndDeactivateEntity(m_entityInfos[1]->m_entity);
+        EXPECT_TRUE(GatherCandidates(cellCenter, 0.0f).empty());
+        EXPECT_EQ(m_interestGrid->GetEntityCount(), 1);
+        EXPECT_EQ(m_interestGrid->GetCellCount(), 1);
+    }
+
+    TEST_F(ReplicationInterestGridTests, BoundsChangesRebucketWithoutMoving)
+    {
+        const AZ::Aabb smallBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        CreateEntityWithBounds(NetEntityId{ 1 }, AZ::Vector3(5.0f, 5.0f, 0.0f), smallBounds);
+        EXPECT_TRUE(GatherCandidates(AZ::Vector3(500.0f, 500.0f, 0.0f), 0.0f).empty());
+
+        // For example a mesh finishing loading after the entity was activated
+        const AZ::Aabb largeBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-20.0f), AZ::Vector3(20.0f));
+        m_boundsProviders.back()->m_localBounds = largeBounds;
+        m_boundsUnionSystem->RefreshEntityLocalBoundsUnion(AZ::EntityId(1));
+        m_boundsUnionSystem->ProcessEntityBoundsUnionRequests();
+
+        EXPECT_EQ(GatherCandidates(AZ::Vector3(500.0f, 500.0f, 0.0f), 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+        const AZ::Aabb candidateBounds = GetCandidateBounds(NetEntityId{ 1 }, AZ::Vector3(500.0f, 500.0f, 0.0f), 0.0f);
+        EXPECT_TRUE(candidateBounds.IsClose(largeBounds.GetTranslated(AZ::Vector3(5.0f, 5.0f, 0.0f))));
+
+        // An offset that moves the bounds center into another cell
+        m_boundsProviders.back()->m_localBounds = smallBounds.GetTranslated(AZ::Vector3(30.0f, 0.0f, 0.0f));
+        m_boundsUnionSystem->RefreshEntityLocalBoundsUnion(AZ::EntityId(1));
+        m_boundsUnionSystem->ProcessEntityBoundsUnionRequests();
+
+        EXPECT_TRUE(GatherCandidates(AZ::Vector3(5.0f, 5.0f, 0.0f), 0.0f).empty());
+        EXPECT_EQ(GatherCandidates(AZ::Vector3(35.0f, 5.0f, 0.0f), 0.0f), AZStd::vector<NetEntityId>({ NetEntityId{ 1 } }));
+    }
+
+    /*
+     * Compares a replication window gathering from the interest grid against one using the visibility system for the same client.
+     */
+    class ServerToClientReplicationWindowTests : public ReplicationInterestTests
+    {
+    public:
+        static constexpr float AwarenessRadius = 100.0f;
+        static constexpr float BandSize = 16.0f;
+
+        void SetUp() override
+        {
+            ReplicationInterestTests::SetUp();
+
+            m_console->GetCvarValue("sv_ReplicationInterestGrid", m_previousInterestGrid);
+            m_console->GetCvarValue("sv_ClientAwarenessRadius", m_previousAwarenessRadius);
+            m_console->GetCvarValue("sv_ClientReplicationPriorityBandSize", m_previousBandSize);
+            m_console->GetCvarValue("sv_MaxEntitiesToTrackReplication", m_previousMaxTracked);
+            m_console->PerformCommand("sv_ReplicationInterestGrid true");
+            m_console->PerformCommand(AZStd::string::format("sv_ClientAwarenessRadius %f", AwarenessRadius).c_str());
+            m_console->PerformCommand(AZStd::string::format("sv_ClientReplicationPriorityBandSize %f", BandSize).c_str());
+        }
+
+        void TearDown() override
+        {
+            m_interestWindow.reset();
+            m_visibilityWindow.reset();
+
+            m_console->PerformCommand(AZStd::string::format("sv_ReplicationInterestGrid %s", m_previousInterestGrid ? "true" : "false").c_str());
+            m_console->PerformCommand(AZStd::string::format("sv_ClientAwarenessRadius %f", m_previousAwarenessRadius).c_str());
+            m_console->PerformCommand(AZStd::string::format("sv_ClientReplicationPriorityBandSize %f", m_previousBandSize).c_str());
+            m_console->PerformCommand(AZStd::string::format("sv_MaxEntitiesToTrackReplication %u", m_previousMaxTracked).c_str());
+
+            ReplicationInterestTests::TearDown();
+        }
+
+        void CreateWindows(EntityInfo& controlledEntity)
+        {
+            const NetworkEntityHandle controlledHandle(controlledEntity.m_entity.get(), m_networkEntityTracker.get());
+            m_interestWindow = AZStd::make_unique<ServerToClientReplicationWindow>(controlledHandle, m_mockConnection.get(), m_interestGrid.get());
+            m_visibilityWindow = AZStd::make_unique<ServerToClientReplicationWindow>(controlledHandle, m_mockConnection.get());
+            m_controlledEntity = controlledEntity.m_entity.get();
+        }
+
+        void UpdateWindows()
+        {
+            m_interestWindow->UpdateWindow();
+            m_visibilityWindow->UpdateWindow();
+        }
+
+        static const EntityReplicationData* FindEntry(const ReplicationSet& replicationSet, NetEntityId netEntityId)
+        {
+            for (const auto& entry : replicationSet)
+            {
+                if (entry.first.GetNetEntityId() == netEntityId)
+                {
+                    return &entry.second;
+                }
+            }
+            return nullptr;
+        }
+
+        // The visibility path only culls octree nodes, so it may also gather entities outside the awareness radius
+        void ExpectMatchesVisibilityWindow()
+        {
+            const ReplicationSet& interestSet = m_interestWindow->GetReplicationSet();
+            const ReplicationSet& visibilitySet = m_visibilityWindow->GetReplicationSet();
+            const AZ::Vector3 clientPosition = m_controlledEntity->GetTransform()->GetWorldTranslation();
+
+            size_t expectedCount = 0;
+            for (const auto& entry : visibilitySet)
+            {
+                const AZ::Aabb bounds = m_boundsUnionSystem->GetEntityWorldBoundsUnion(entry.first.GetEntity()->GetId());
+                const bool isAware = bounds.GetDistanceSq(clientPosition) <= (AwarenessRadius * AwarenessRadius);
+                if (isAware || (entry.second.m_netEntityRole != NetEntityRole::Client))
+                {
+                    const EntityReplicationData* interestEntry = FindEntry(interestSet, entry.first.GetNetEntityId());
+                    ASSERT_NE(interestEntry, nullptr) << "Missing entity " << static_cast<uint32_t>(entry.first.GetNetEntityId());
+                    EXPECT_EQ(interestEntry->m_netEntityRole, entry.second.m_netEntityRole);
+                    ++expectedCount;
+                }
+            }
+            EXPECT_EQ(interestSet.size(), expectedCount);
+        }
+
+        AZStd::unique_ptr<ServerToClientReplicationWindow> m_interestWindow;
+        AZStd::unique_ptr<ServerToClientReplicationWindow> m_visibilityWindow;
+        AZ::Entity* m_controlledEntity = nullptr;
+
+        bool m_previousInterestGrid = false;
+        float m_previousAwarenessRadius = 0.0f;
+        float m_previousBandSize = 0.0f;
+        uint32_t m_previousMaxTracked = 0;
+    };
+
+    TEST_F(ServerToClientReplicationWindowTests, EntitiesEnterAndLeaveAwareness)
+    {
+        EntityInfo& client = CreateEntity(NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        EntityInfo& nearEntity = CreateEntity(NetEntityId{ 2 }, AZ::Vector3(50.0f, 0.0f, 0.0f));
+        EntityInfo& farEntity = CreateEntity(NetEntityId{ 3 }, AZ::Vector3(0.0f, 150.0f, 0.0f));
+        CreateWindows(client);
+
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        const ReplicationSet& interestSet = m_interestWindow->GetReplicationSet();
+        ASSERT_NE(FindEntry(interestSet, NetEntityId{ 1 }), nullptr);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 1 })->m_netEntityRole, NetEntityRole::Autonomous);
+        ASSERT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_netEntityRole, NetEntityRole::Client);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+
+        MoveEntity(nearEntity, AZ::Vector3(200.0f, 0.0f, 0.0f));
+        MoveEntity(farEntity, AZ::Vector3(0.0f, 30.0f, 0.0f));
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        ASSERT_NE(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 3 })->m_netEntityRole, NetEntityRole::Client);
+
+        // The client moving brings the first entity back into awareness
+        MoveEntity(client, AZ::Vector3(150.0f, 0.0f, 0.0f));
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+
+        // Deactivated entities leave the set immediately
+        StopAndDeactivateEntity(nearEntity.m_entity);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+    }
+
+    TEST_F(ServerToClientReplicationWindowTests, PriorityIsTheDistanceBandCenter)
+    {
+        EntityInfo& client = CreateEntity(NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+
+        // Unit cube bounds, the closest point of each entity is half a meter closer than its position
+        EntityInfo& entity = CreateEntity(NetEntityId{ 2 }, AZ::Vector3(20.5f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 3 }, AZ::Vector3(0.0f, 30.5f, 0.0f));
+        CreateWindows(client);
+
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        const ReplicationSet& interestSet = m_interestWindow->GetReplicationSet();
+        const ReplicationSet& visibilitySet = m_visibilityWindow->GetReplicationSet();
+
+        // Both entities are in band 1, so they share the priority of the band center rather than their exact distance
+        const float bandOnePriority = 1.0f / ((1.5f * BandSize) * (1.5f * BandSize));
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_priority, bandOnePriority);
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 3 })->m_priority, bandOnePriority);
+        EXPECT_GT(FindEntry(visibilitySet, NetEntityId{ 2 })->m_priority, FindEntry(visibilitySet, NetEntityId{ 3 })->m_priority);
+
+        // Changing band updates the priority
+        MoveEntity(entity, AZ::Vector3(40.5f, 0.0f, 0.0f));
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        const float bandTwoPriority = 1.0f / ((2.5f * BandSize) * (2.5f * BandSize));
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_priority, bandTwoPriority);
+
+        // Moving within a band does not
+        const float visibilityPriority = FindEntry(visibilitySet, NetEntityId{ 2 })->m_priority;
+        MoveEntity(entity, AZ::Vector3(45.5f, 0.0f, 0.0f));
+        UpdateWindows();
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_priority, bandTwoPriority);
+        EXPECT_LT(FindEntry(visibilitySet, NetEntityId{ 2 })->m_priority, visibilityPriority);
+
+        // Changing the band size re-evaluates every entity
+        m_console->PerformCommand(AZStd::string::format("sv_ClientReplicationPriorityBandSize %f", BandSize * 2.0f).c_str());
+        UpdateWindows();
+        const float wideBandOnePriority = 1.0f / ((1.5f * BandSize * 2.0f) * (1.5f * BandSize * 2.0f));
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_priority, wideBandOnePriority);
+        const float wideBandZeroPriority = 1.0f / ((0.5f * BandSize * 2.0f) * (0.5f * BandSize * 2.0f));
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 3 })->m_priority, wideBandZeroPriority);
+    }
+
+    TEST_F(ServerToClientReplicationWindowTests, HierarchyEntriesAreRebuiltEachUpdate)
+    {
+        EntityInfo& root = CreateEntity(NetEntityId{ 1 }, AZ::Vector3::CreateZero(), EntityInfo::Role::Root);
+        EntityInfo& child = CreateEntity(NetEntityId{ 2 }, AZ::Vector3(10.0f, 0.0f, 0.0f), EntityInfo::Role::Child);
+        CreateEntity(NetEntityId{ 3 }, AZ::Vector3(20.0f, 0.0f, 0.0f));
+        CreateWindows(root);
+
+        child.m_entity->FindComponent<AzFramework::TransformComponent>()->SetParent(root.m_entity->GetId());
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        const ReplicationSet& interestSet = m_interestWindow->GetReplicationSet();
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 1 })->m_netEntityRole, NetEntityRole::Autonomous);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_netEntityRole, NetEntityRole::Autonomous);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 3 })->m_netEntityRole, NetEntityRole::Client);
+
+        // The detached child is gathered again as a regular entity, even though it did not change band
+        child.m_entity->FindComponent<AzFramework::TransformComponent>()->SetParent(AZ::EntityId());
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 1 })->m_netEntityRole, NetEntityRole::Autonomous);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_netEntityRole, NetEntityRole::Client);
+
+        child.m_entity->FindComponent<AzFramework::TransformComponent>()->SetParent(root.m_entity->GetId());
+        UpdateWindows();
+        ExpectMatchesVisibilityWindow();
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 })->m_netEntityRole, NetEntityRole::Autonomous);
+    }
+
+    TEST_F(ServerToClientReplicationWindowTests, ActivatedEntitiesRespectMaxTrackedEntities)
+    {
+        m_console->PerformCommand("sv_MaxEntitiesToTrackReplication 2");
+
+        EntityInfo& client = CreateEntity(NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        CreateEntity(NetEntityId{ 2 }, AZ::Vector3(20.5f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 3 }, AZ::Vector3(40.5f, 0.0f, 0.0f));
+        CreateEntity(NetEntityId{ 4 }, AZ::Vector3(60.5f, 0.0f, 0.0f));
+        CreateWindows(client);
+
+        // The controlled entity is forced into the set and doesn't take up one of the tracked slots
+        m_interestWindow->UpdateWindow();
+        const ReplicationSet& interestSet = m_interestWindow->GetReplicationSet();
+        EXPECT_EQ(interestSet.size(), 3);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 4 }), nullptr);
+
+        // Farther than everything tracked, it has to wait for the next update to compete for a slot
+        CreateEntity(NetEntityId{ 5 }, AZ::Vector3(80.5f, 0.0f, 0.0f));
+        EXPECT_EQ(interestSet.size(), 3);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 5 }), nullptr);
+
+        // Closer than the farthest tracked entity, which is evicted
+        CreateEntity(NetEntityId{ 6 }, AZ::Vector3(0.0f, 10.5f, 0.0f));
+        EXPECT_EQ(interestSet.size(), 3);
+        ASSERT_NE(FindEntry(interestSet, NetEntityId{ 6 }), nullptr);
+        EXPECT_FLOAT_EQ(FindEntry(interestSet, NetEntityId{ 6 })->m_priority, 1.0f / ((0.5f * BandSize) * (0.5f * BandSize)));
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 1 }), nullptr);
+
+        // The next update keeps the closest entities
+        m_interestWindow->UpdateWindow();
+        EXPECT_EQ(interestSet.size(), 3);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 6 }), nullptr);
+    }
+
+    TEST_F(ServerToClientReplicationWindowTests, ActivatedEntitiesEvictFromTheCurrentBand)
+    {
+        m_console->PerformCommand("sv_MaxEntitiesToTrackReplication 2");
+
+        EntityInfo& client = CreateEntity(NetEntityId{ 1 }, AZ::Vector3::CreateZero());
+        EntityInfo& movingEntity = CreateEntity(NetEntityId{ 2 }, AZ::Vector3(20.5f, 0.0f, 0.0f));
+        EntityInfo& bandTwoEntity = CreateEntity(NetEntityId{ 3 }, AZ::Vector3(40.5f, 0.0f, 0.0f));
+        CreateWindows(client);
+
+        m_interestWindow->UpdateWindow();
+        const ReplicationSet& interestSet = m_interestWindow->GetReplicationSet();
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+
+        // Moves from band 1 to band 3, past the other tracked entity in band 2
+        MoveEntity(movingEntity, AZ::Vector3(60.5f, 0.0f, 0.0f));
+        m_interestWindow->UpdateWindow();
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+
+        // The moved entity is now the farthest, so it's evicted rather than the entity in band 2
+        CreateEntity(NetEntityId{ 4 }, AZ::Vector3(0.0f, 35.5f, 0.0f));
+        EXPECT_EQ(interestSet.size(), 3);
+        EXPECT_EQ(FindEntry(interestSet, NetEntityId{ 2 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 3 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 4 }), nullptr);
+
+        // Deactivating a tracked entity frees its slot
+        StopAndDeactivateEntity(bandTwoEntity.m_entity);
+        CreateEntity(NetEntityId{ 5 }, AZ::Vector3(0.0f, -90.5f, 0.0f));
+        EXPECT_EQ(interestSet.size(), 3);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 5 }), nullptr);
+        EXPECT_NE(FindEntry(interestSet, NetEntityId{ 4 }), nullptr);
+    }
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/SerializedDeltaCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+
+namespace UnitTest
+{
+    using SerializedDeltaCacheTests = AllocatorsFixture;
+
+    static Multiplayer::SerializedDeltaCache::RecordKey MakeKey(uint64_t netEntityId, Multiplayer::NetEntityRole role, const AZStd::vector<uint8_t>& record)
+    {
+        return { Multiplayer::NetEntityId{ netEntityId }, role, record.data(), aznumeric_cast<uint32_t>(record.size()) };
+    }
+
+    TEST_F(SerializedDeltaCacheTests, FindDelta_MatchingRecord_ReturnsStoredDelta)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        cache.BeginSharing();
+        ASSERT_TRUE(cache.IsSharing());
+
+        const AZStd::vector<uint8_t> record = { 3, 0x05 };
+        const AZStd::vector<uint8_t> deltaData = { 1, 2, 3, 4 };
+        cache.StoreDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record), deltaData.data(), aznumeric_cast<uint32_t>(deltaData.size()), {});
+
+        // An identical record serialized into a different buffer by another connection
+        const AZStd::vector<uint8_t> otherRecord = record;
+        const Multiplayer::SerializedDeltaCache::Delta* delta = cache.FindDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, otherRecord));
+        ASSERT_NE(delta, nullptr);
+        EXPECT_EQ(delta->m_deltaData, deltaData);
+
+        cache.EndSharing();
+    }
+
+    TEST_F(SerializedDeltaCacheTests, FindDelta_DifferentEntityRoleOrRecord_ReturnsNull)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        cache.BeginSharing();
+
+        const AZStd::vector<uint8_t> record = { 3, 0x05 };
+        const AZStd::vector<uint8_t> deltaData = { 1, 2, 3, 4 };
+        cache.StoreDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record), deltaData.data(), aznumeric_cast<uint32_t>(deltaData.size()), {});
+
+        const AZStd::vector<uint8_t> otherRecord = { 3, 0x04 };
+        EXPECT_EQ(cache.FindDelta(MakeKey(2, Multiplayer::NetEntityRole::Client, record)), nullptr);
+        EXPECT_EQ(cache.FindDelta(MakeKey(1, Multiplayer::NetEntityRole::Autonomous, record)), nullptr);
+        EXPECT_EQ(cache.FindDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, otherRecord)), nullptr);
+
+        cache.EndSharing();
+    }
+
+    TEST_F(SerializedDeltaCacheTests, StoreDelta_SameRecordTwice_KeepsFirstDelta)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        cache.BeginSharing();
+
+        const AZStd::vector<uint8_t> record = { 3, 0x05 };
+        const AZStd::vector<uint8_t> firstDelta = { 1, 2, 3, 4 };
+        const AZStd::vector<uint8_t> secondDelta = { 5, 6 };
+        cache.StoreDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record), firstDelta.data(), aznumeric_cast<uint32_t>(firstDelta.size()), {});
+        cache.StoreDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record), secondDelta.data(), aznumeric_cast<uint32_t>(secondDelta.size()), {});
+
+        EXPECT_EQ(cache.GetDeltaCount(), 1);
+        const Multiplayer::SerializedDeltaCache::Delta* delta = cache.FindDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record));
+        ASSERT_NE(delta, nullptr);
+        EXPECT_EQ(delta->m_deltaData, firstDelta);
+
+        cache.EndSharing();
+    }
+
+    TEST_F(SerializedDeltaCacheTests, EndSharing_DiscardsDeltas)
+    {
+        Multiplayer::SerializedDeltaCache cache;
+        cache.BeginSharing();
+
+        const AZStd::vector<uint8_t> record = { 3, 0x05 };
+        const AZStd::vector<uint8_t> deltaData = { 1, 2, 3, 4 };
+        cache.StoreDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record), deltaData.data(), aznumeric_cast<uint32_t>(deltaData.size()), {});
+        EXPECT_EQ(cache.GetDeltaCount(), 1);
+
+        cache.EndSharing();
+        EXPECT_FALSE(cache.IsSharing());
+        EXPECT_EQ(cache.GetDeltaCount(), 0);
+        EXPECT_EQ(cache.FindDelta(MakeKey(1, Multiplayer::NetEntityRole::Client, record)), nullptr);
+    }
+}
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    /*
+     * Serializes one entity for several client connections, with one set of publishers writing every delta themselves and
+     * another set sharing deltas through a SerializedDeltaCache.
+     */
+    class SerializedDeltaPublisherTests : public HierarchyTests
+    {
+    public:
+        static constexpr uint32_t MaxSerializedUpdateSize = 4096;
+
+        //! A replicator for the test entity with its own client connection.
+        struct TestPublisher
+        {
+            AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>> m_connection;
+            AZStd::unique_ptr<EntityReplicator> m_replicator;
+        };
+
+        //! The serialized updates of one set of publishers, along with the stats recorded while serializing them.
+        struct SerializedUpdates
+        {
+            AZStd::vector<AZStd::vector<uint8_t>> m_updates;
+            AZStd::vector<AZStd::pair<NetComponentId, PropertyIndex>> m_propertiesSent;
+            AZStd::vector<uint32_t> m_propertyBytesSent;
+            MultiplayerStats::Metric m_propertyTotals;
+            uint64_t m_cacheHits = 0;
+            uint64_t m_cacheMisses = 0;
+        };
+
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            ON_CALL(*m_mockNetworkEntityManager, AddEntityMarkedDirtyHandler(_))
+                .WillByDefault(Invoke([this](AZ::Event<>::Handler& handler) { handler.Connect(m_entityMarkedDirtyEvent); }));
+
+            m_propertySentHandler = AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler(
+                [this](NetComponentId netComponentId, PropertyIndex propertyIndex, uint32_t totalBytes)
+                {
+                    if (m_recordingUpdates != nullptr)
+                    {
+                        m_recordingUpdates->m_propertiesSent.emplace_back(netComponentId, propertyIndex);
+                        m_recordingUpdates->m_propertyBytesSent.push_back(totalBytes);
+                    }
+                });
+            m_propertySentHandler.Connect(GetMultiplayer()->GetStats().m_events.m_propertySent);
+
+            m_entityInfo = AZStd::make_unique<EntityInfo>(1, "entity", NetEntityId{ 1 }, EntityInfo::Role::None);
+            PopulateHierarchicalEntity(*m_entityInfo);
+            SetupEntity(m_entityInfo->m_entity, m_entityInfo->m_netId, NetEntityRole::Authority);
+            m_entityInfo->m_entity->Activate();
+
+            // Flush the properties set while activating, the publishers start from the entity's initial state
+            m_entityMarkedDirtyEvent.Signal();
+
+            m_unsharedReplicationManager = AZStd::make_unique<EntityReplicationManager>(
+                *m_mockConnection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+            m_sharedReplicationManager = AZStd::make_unique<EntityReplicationManager>(
+                *m_mockConnection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+            m_sharedReplicationManager->SetSerializedDeltaCache(&m_deltaCache);
+
+            // Two clients that observe the entity and the client that controls it, each set uses the same connection ids
+            for (EntityReplicationManager* replicationManager : { m_unsharedReplicationManager.get(), m_sharedReplicationManager.get() })
+            {
+                AZStd::vector<TestPublisher>& publishers = (replicationManager == m_sharedReplicationManager.get()) ? m_sharedPublishers : m_unsharedPublishers;
+                publishers.push_back(CreatePublisher(*replicationManager, AzNetworking::ConnectionId{ 2 }, NetEntityRole::Client));
+                publishers.push_back(CreatePublisher(*replicationManager, AzNetworking::ConnectionId{ 3 }, NetEntityRole::Autonomous));
+                publishers.push_back(CreatePublisher(*replicationManager, AzNetworking::ConnectionId{ 4 }, NetEntityRole::Client));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_unsharedPublishers.clear();
+            m_sharedPublishers.clear();
+            m_unsharedReplicationManager.reset();
+            m_sharedReplicationManager.reset();
+            m_propertySentHandler.Disconnect();
+            m_entityInfo.reset();
+
+            HierarchyTests::TearDown();
+        }
+
+        TestPublisher CreatePublisher(EntityReplicationManager& replicationManager, AzNetworking::ConnectionId connectionId, NetEntityRole remoteRole)
+        {
+            TestPublisher publisher;
+            const IpAddress address("localhost", aznumeric_cast<uint16_t>(connectionId), ProtocolType::Udp);
+            publisher.m_connection = AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(connectionId, address, ConnectionRole::Acceptor);
+            ON_CALL(*publisher.m_connection, WasPacketAcked(_)).WillByDefault(Return(true));
+
+            const NetworkEntityHandle entityHandle(m_entityInfo->m_entity.get(), m_networkEntityTracker.get());
+            publisher.m_replicator = AZStd::make_unique<EntityReplicator>(replicationManager, publisher.m_connection.get(), remoteRole, entityHandle);
+            publisher.m_replicator->Initialize(entityHandle);
+            return publisher;
+        }
+
+        //! Serializes the pending update of every publisher in order, the way a replication manager would for each connection.
+        SerializedUpdates SerializeUpdates(AZStd::vector<TestPublisher>& publishers, AzNetworking::PacketId packetId)
+        {
+            MultiplayerStats& stats = GetMultiplayer()->GetStats();
+            const MultiplayerStats::Metric propertyTotals = stats.CalculateTotalPropertyUpdateSentMetrics();
+            const uint64_t cacheHits = stats.m_serializedDeltaCacheHits.m_totalCalls;
+            const uint64_t cacheMisses = stats.m_serializedDeltaCacheMisses.m_totalCalls;
+
+            SerializedUpdates serializedUpdates;
+            m_recordingUpdates = &serializedUpdates;
+            for (TestPublisher& publisher : publishers)
+            {
+                PropertyPublisher* propertyPublisher = publisher.m_replicator->GetPropertyPublisher();
+                EXPECT_TRUE(propertyPublisher->RequiresSerialization());
+                EXPECT_TRUE(propertyPublisher->PrepareSerialization());
+
+                NetworkEntityUpdateMessage updateMessage = publisher.m_replicator->GenerateUpdatePacket();
+                publisher.m_replicator->FinalizeSerialization(packetId);
+
+                AZStd::vector<uint8_t>& update = serializedUpdates.m_updates.emplace_back(MaxSerializedUpdateSize);
+                AzNetworking::NetworkInputSerializer serializer(update.data(), MaxSerializedUpdateSize);
+                EXPECT_TRUE(updateMessage.Serialize(serializer));
+                update.resize(serializer.GetSize());
+            }
+            m_recordingUpdates = nullptr;
+
+            const MultiplayerStats::Metric updatedPropertyTotals = stats.CalculateTotalPropertyUpdateSentMetrics();
+            serializedUpdates.m_propertyTotals.m_totalCalls = updatedPropertyTotals.m_totalCalls - propertyTotals.m_totalCalls;
+            serializedUpdates.m_propertyTotals.m_totalBytes = updatedPropertyTotals.m_totalBytes - propertyTotals.m_totalBytes;
+            serializedUpdates.m_cacheHits = stats.m_serializedDeltaCacheHits.m_totalCalls - cacheHits;
+            serializedUpdates.m_cacheMisses = stats.m_serializedDeltaCacheMisses.m_totalCalls - cacheMisses;
+            return serializedUpdates;
+        }
+
+        //! Serializes the pending updates without and then with sharing, and expects the publishers to write the same updates
+        //! and record the same property stats either way.
+        void ExpectSharedUpdatesMatchUnshared(AzNetworking::PacketId packetId)
+        {
+            const SerializedUpdates unsharedUpdates = SerializeUpdates(m_unsharedPublishers, packetId);
+
+            m_deltaCache.BeginSharing();
+            const SerializedUpdates sharedUpdates = SerializeUpdates(m_sharedPublishers, packetId);
+            // The clients share a delta, the autonomous record is cached separately from the client records
+            EXPECT_EQ(m_deltaCache.GetDeltaCount(), 2);
+            m_deltaCache.EndSharing();
+
+            ASSERT_EQ(unsharedUpdates.m_updates.size(), sharedUpdates.m_updates.size());
+            for (size_t index = 0; index < unsharedUpdates.m_updates.size(); ++index)
+            {
+                EXPECT_EQ(unsharedUpdates.m_updates[index], sharedUpdates.m_updates[index]);
+            }
+            EXPECT_EQ(unsharedUpdates.m_updates[0], unsharedUpdates.m_updates[2]);
+            EXPECT_NE(unsharedUpdates.m_updates[0], unsharedUpdates.m_updates[1]);
+
+            EXPECT_FALSE(unsharedUpdates.m_propertiesSent.empty());
+            EXPECT_EQ(unsharedUpdates.m_propertiesSent, sharedUpdates.m_propertiesSent);
+            EXPECT_EQ(unsharedUpdates.m_propertyBytesSent, sharedUpdates.m_propertyBytesSent);
+            EXPECT_EQ(unsharedUpdates.m_propertyTotals.m_totalCalls, sharedUpdates.m_propertyTotals.m_totalCalls);
+            EXPECT_EQ(unsharedUpdates.m_propertyTotals.m_totalBytes, sharedUpdates.m_propertyTotals.m_totalBytes);
+
+            EXPECT_EQ(unsharedUpdates.m_cacheHits, 0);
+            EXPECT_EQ(unsharedUpdates.m_cacheMisses, 0);
+            EXPECT_EQ(sharedUpdates.m_cacheHits, 1);
+            EXPECT_EQ(sharedUpdates.m_cacheMisses, 2);
+        }
+
+        AZ::Event<> m_entityMarkedDirtyEvent;
+        AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler m_propertySentHandler;
+        AZStd::unique_ptr<EntityInfo> m_entityInfo;
+        SerializedDeltaCache m_deltaCache;
+        AZStd::unique_ptr<EntityReplicationManager> m_unsharedReplicationManager;
+        AZStd::unique_ptr<EntityReplicationManager> m_sharedReplicationManager;
+        AZStd::vector<TestPublisher> m_unsharedPublishers;
+        AZStd::vector<TestPublisher> m_sharedPublishers;
+        SerializedUpdates* m_recordingUpdates = nullptr;
+    };
+
+    TEST_F(SerializedDeltaPublisherTests, SharedCreateRecordsMatchUnsharedSerialization)
+    {
+        ExpectSharedUpdatesMatchUnshared(AzNetworking::PacketId{ 1 });
+    }
+
+    TEST_F(SerializedDeltaPublisherTests, SharedDirtyRecordsMatchUnsharedSerialization)
+    {
+        ExpectSharedUpdatesMatchUnshared(AzNetworking::PacketId{ 1 });
+
+        m_entityInfo->m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(
+            AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        m_entityMarkedDirtyEvent.Signal();
+
+        ExpectSharedUpdatesMatchUnshared(AzNetworking::PacketId{ 2 });
+    }
+}
@@ -117,6 +117,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
+    Source/NetworkEntity/EntityReplication/SerializedDeltaCache.cpp
+    Source/NetworkEntity/EntityReplication/SerializedDeltaCache.h
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
     Source/NetworkEntity/NetworkEntityHandle.cpp
@@ -140,6 +142,9 @@ set(FILES
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
+    Source/ReplicationWindows/ReplicationInterestGrid.cpp
+    Source/ReplicationWindows/ReplicationInterestGrid.h
+    Source/ReplicationWindows/ReplicationInterestGrid.inl
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
     Source/Session/MatchmakingRequests.cpp
@@ -15,8 +15,11 @@ set(FILES
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
+    Tests/ReplicationInterestBenchmarks.cpp
+    Tests/ReplicationInterestTests.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonBenchmarkSetup.h
+    Tests/EntityReplicationManagerTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
@@ -26,6 +29,7 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/SerializedDeltaCacheTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
@@ -69,6 +69,8 @@ namespace Terrain
     {
         m_patchModel = {};
         m_sectorData.clear();
+        m_sectorMinimums.Clear();
+        m_sectorMaximums.Clear();
         m_rebuildSectors = true;
         m_isInitialized = false;
     }
@@ -82,6 +84,8 @@ namespace Terrain
 
         m_rebuildSectors = false;
         m_sectorData.clear();
+        m_sectorMinimums.Clear();
+        m_sectorMaximums.Clear();
 
         const auto layout = materialInstance->GetAsset()->GetObjectSrgLayout();
 
@@ -142,6 +146,8 @@ namespace Terrain
                         AZ::Vector3(xPatch, yPatch, m_worldBounds.GetMin().GetZ()),
                         AZ::Vector3(xPatch + gridMeters, yPatch + gridMeters, m_worldBounds.GetMax().GetZ())
                     );
+                m_sectorMinimums.PushBack(sectorData.m_aabb.GetMin());
+                m_sectorMaximums.PushBack(sectorData.m_aabb.GetMax());
             }
         }
         return true;
@@ -151,8 +157,10 @@ namespace Terrain
     {
         const float gridMeters = GridSize * m_sampleSpacing;
 
-        for (auto& sectorData : m_sectorData)
+        m_sectorLods.resize(m_sectorData.size());
+        for (size_t sectorIndex = 0; sectorIndex < m_sectorData.size(); ++sectorIndex)
         {
+            const SectorData& sectorData = m_sectorData[sectorIndex];
             uint8_t lodChoice = AZ::RPI::ModelLodAsset::LodCountMax;
 
             // Go through all cameras and choose an LOD based on the closest camera.
@@ -177,14 +185,22 @@ namespace Terrain
                     lodChoice = AZ::GetMin(lodChoice, aznumeric_cast<uint8_t>(lodForCamera));
                 }
             }
+            m_sectorLods[sectorIndex] = lodChoice;
+        }
 
-            // Add the correct LOD draw packet for visible sectors.
-            for (auto& view : process.m_views)
+        // Add the correct LOD draw packet for visible sectors. All sectors are culled against a view in one batch, which uses
+        // AVX2 when the CPU supports it.
+        m_sectorCullResults.resize(m_sectorData.size());
+        for (auto& view : process.m_views)
+        {
+            AZ::Frustum viewFrustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+            viewFrustum.IntersectAabbs(m_sectorMinimums, m_sectorMaximums, m_sectorCullResults.data());
+            for (size_t sectorIndex = 0; sectorIndex < m_sectorData.size(); ++sectorIndex)
             {
-                AZ::Frustum viewFrustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
-                if (viewFrustum.IntersectAabb(sectorData.m_aabb) != AZ::IntersectResult::Exterior)
+                if (m_sectorCullResults[sectorIndex] != AZ::IntersectResult::Exterior)
                 {
-                    const uint8_t lodToRender = AZ::GetMin(lodChoice, aznumeric_cast<uint8_t>(sectorData.m_drawPackets.size() - 1));
+                    const SectorData& sectorData = m_sectorData[sectorIndex];
+                    const uint8_t lodToRender = AZ::GetMin(m_sectorLods[sectorIndex], aznumeric_cast<uint8_t>(sectorData.m_drawPackets.size() - 1));
                     view->AddDrawPacket(sectorData.m_drawPackets.at(lodToRender).GetRHIDrawPacket());
                 }
             }
@@ -10,6 +10,8 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Math/Vector3Array.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -103,6 +105,13 @@ namespace Terrain
         void ForOverlappingSectors(const AZ::Aabb& bounds, Callback callback);
 
         AZStd::vector<SectorData> m_sectorData;
+
+        // Bounds of each sector in m_sectorData as a structure of arrays, so all sectors can be culled against a view in one batch.
+        AZ::Vector3Array m_sectorMinimums;
+        AZ::Vector3Array m_sectorMaximums;
+        // Per sector scratch data reused by DrawMeshes every frame.
+        AZStd::vector<uint8_t> m_sectorLods;
+        AZStd::vector<AZ::IntersectResult> m_sectorCullResults;
         AZ::Data::Instance<AZ::RPI::Model> m_patchModel;
         
         AZ::Aabb m_worldBounds{ AZ::Aabb::CreateNull() };